@@ -38,23 +38,35 @@ namespace catapult { namespace filespooling {
 			{}
 
 		public:
-			std::unique_ptr<io::FileQueueWriter> create(const std::string& queueName) const {
-				return std::make_unique<io::FileQueueWriter>(m_dataDirectory.spoolDir(queueName).str());
+			std::unique_ptr<io::FileQueueWriter> create(const std::string& queueName, utils::FileSize segmentSize) const {
+				auto queueDirectory = m_dataDirectory.spoolDir(queueName).str();
+				return std::make_unique<io::FileQueueWriter>(queueDirectory, "index.dat", io::FileQueueLayout::Segmented, segmentSize);
 			}
 
 		private:
 			config::CatapultDataDirectory m_dataDirectory;
 		};
 
+		// segment sizes are derived from the expected volume of each queue (segments hold 1024 messages)
+		// - block and unconfirmed transaction changes contain full blocks and transactions
+		// - partial transaction changes and transaction statuses are only produced by aggregate bonded and rejected transactions
+		// - finalization messages are small fixed size messages
+		constexpr auto Large_Segment_Size = utils::FileSize::FromMegabytes(8);
+		constexpr auto Medium_Segment_Size = utils::FileSize::FromMegabytes(1);
+		constexpr auto Small_Segment_Size = utils::FileSize::FromKilobytes(256);
+
 		void RegisterExtension(extensions::ProcessBootstrapper& bootstrapper) {
 			// register subscribers
 			FileQueueFactory factory(bootstrapper.config().User.DataDirectory);
 			auto& subscriptionManager = bootstrapper.subscriptionManager();
-			subscriptionManager.addBlockChangeSubscriber(CreateFileBlockChangeStorage(factory.create("block_change")));
-			subscriptionManager.addUtChangeSubscriber(CreateFileUtChangeStorage(factory.create("unconfirmed_transactions_change")));
-			subscriptionManager.addPtChangeSubscriber(CreateFilePtChangeStorage(factory.create("partial_transactions_change")));
-			subscriptionManager.addFinalizationSubscriber(CreateFileFinalizationStorage(factory.create("finalization")));
-			subscriptionManager.addTransactionStatusSubscriber(CreateFileTransactionStatusStorage(factory.create("transaction_status")));
+			subscriptionManager.addBlockChangeSubscriber(CreateFileBlockChangeStorage(factory.create("block_change", Large_Segment_Size)));
+			subscriptionManager.addUtChangeSubscriber(CreateFileUtChangeStorage(
+					factory.create("unconfirmed_transactions_change", Large_Segment_Size)));
+			subscriptionManager.addPtChangeSubscriber(CreateFilePtChangeStorage(
+					factory.create("partial_transactions_change", Medium_Segment_Size)));
+			subscriptionManager.addFinalizationSubscriber(CreateFileFinalizationStorage(factory.create("finalization", Small_Segment_Size)));
+			subscriptionManager.addTransactionStatusSubscriber(CreateFileTransactionStatusStorage(
+					factory.create("transaction_status", Medium_Segment_Size)));
 		}
 	}
 }}
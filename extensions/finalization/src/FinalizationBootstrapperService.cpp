@@ -26,6 +26,7 @@
 #include "finalization/src/io/AggregateProofStorage.h"
 #include "finalization/src/io/FilePrevoteChainStorage.h"
 #include "finalization/src/io/ProofStorageCache.h"
+#include "finalization/src/model/ParentSignatureCache.h"
 #include "catapult/extensions/ConfigurationUtils.h"
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/ServiceState.h"
@@ -38,6 +39,7 @@ namespace catapult { namespace finalization {
 		constexpr auto Hooks_Service_Name = "fin.hooks";
 		constexpr auto Storage_Service_Name = "fin.proof.storage";
 		constexpr auto Aggregator_Service_Name = "fin.aggregator.multiround";
+		constexpr auto Parent_Signature_Cache_Service_Name = "fin.cache.parentsignature";
 		constexpr auto Subscriber_Adapter_Service_Name = "fin.subscriber.adapter";
 
 		// region CreateMultiRoundMessageAggregator
@@ -45,6 +47,7 @@ namespace catapult { namespace finalization {
 		auto CreateMultiRoundMessageAggregator(
 				const FinalizationConfiguration& config,
 				const io::ProofStorageCache& proofStorage,
+				const std::shared_ptr<model::ParentSignatureCache>& pParentSignatureCache,
 				extensions::ServiceState& state) {
 			FinalizationContextFactory finalizationContextFactory(config, state);
 
@@ -54,8 +57,9 @@ namespace catapult { namespace finalization {
 					config.MessageSynchronizationMaxResponseSize.bytes(),
 					finalizationStatistics.Round,
 					model::HeightHashPair{ finalizationStatistics.Height, finalizationStatistics.Hash },
-					[finalizationContextFactory](const auto& round) {
-						return chain::CreateRoundMessageAggregator(finalizationContextFactory.create(round.Epoch));
+					[finalizationContextFactory, pParentSignatureCache](const auto& round) {
+						auto finalizationContext = finalizationContextFactory.create(round.Epoch);
+						return chain::CreateRoundMessageAggregator(finalizationContext, *pParentSignatureCache);
 					});
 		}
 
@@ -162,6 +166,18 @@ namespace catapult { namespace finalization {
 				locator.registerServiceCounter<AggregatorType>(Aggregator_Service_Name, "FIN CUR EST", [](const auto& aggregator) {
 					return GetEstimateHeight(aggregator, FinalizationPoint(0)).unwrap();
 				});
+
+				using CacheType = model::ParentSignatureCache;
+
+				locator.registerServiceCounter<CacheType>(Parent_Signature_Cache_Service_Name, "FIN PSIG SIZE", [](const auto& cache) {
+					return cache.size();
+				});
+				locator.registerServiceCounter<CacheType>(Parent_Signature_Cache_Service_Name, "FIN PSIG HIT", [](const auto& cache) {
+					return cache.numHits();
+				});
+				locator.registerServiceCounter<CacheType>(Parent_Signature_Cache_Service_Name, "FIN PSIG MISS", [](const auto& cache) {
+					return cache.numMisses();
+				});
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
@@ -196,7 +212,14 @@ namespace catapult { namespace finalization {
 
 				locator.registerRootedService(Storage_Service_Name, pProofStorageCache);
 
-				auto pMultiRoundMessageAggregator = CreateMultiRoundMessageAggregator(m_config, *pProofStorageCache, state);
+				auto pParentSignatureCache = std::make_shared<model::ParentSignatureCache>(m_config.MaxCachedParentSignatures);
+				locator.registerRootedService(Parent_Signature_Cache_Service_Name, pParentSignatureCache);
+
+				auto pMultiRoundMessageAggregator = CreateMultiRoundMessageAggregator(
+						m_config,
+						*pProofStorageCache,
+						pParentSignatureCache,
+						state);
 				locator.registerRootedService(Aggregator_Service_Name, pMultiRoundMessageAggregator);
 			}
 
@@ -243,6 +266,10 @@ namespace catapult { namespace finalization {
 		return *locator.service<chain::MultiRoundMessageAggregator>(Aggregator_Service_Name);
 	}
 
+	model::ParentSignatureCache& GetParentSignatureCache(const extensions::ServiceLocator& locator) {
+		return *locator.service<model::ParentSignatureCache>(Parent_Signature_Cache_Service_Name);
+	}
+
 	FinalizationServerHooks& GetFinalizationServerHooks(const extensions::ServiceLocator& locator) {
 		return *locator.service<FinalizationServerHooks>(Hooks_Service_Name);
 	}
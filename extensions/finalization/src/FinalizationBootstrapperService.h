@@ -30,6 +30,7 @@ namespace catapult {
 	namespace chain { class MultiRoundMessageAggregator; }
 	namespace finalization { struct FinalizationConfiguration; }
 	namespace io { class ProofStorageCache; }
+	namespace model { class ParentSignatureCache; }
 }
 
 namespace catapult { namespace finalization {
@@ -69,6 +70,9 @@ namespace catapult { namespace finalization {
 	/// Gets the multi round message aggregator stored in \a locator.
 	chain::MultiRoundMessageAggregator& GetMultiRoundMessageAggregator(const extensions::ServiceLocator& locator);
 
+	/// Gets the parent signature cache stored in \a locator.
+	model::ParentSignatureCache& GetParentSignatureCache(const extensions::ServiceLocator& locator);
+
 	/// Gets the finalization server hooks stored in \a locator.
 	FinalizationServerHooks& GetFinalizationServerHooks(const extensions::ServiceLocator& locator);
 
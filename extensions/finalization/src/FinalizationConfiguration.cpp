@@ -48,10 +48,11 @@ namespace catapult { namespace finalization {
 
 		LOAD_PROPERTY(MaxHashesPerPoint);
 		LOAD_PROPERTY(PrevoteBlocksMultiple);
+		LOAD_PROPERTY(MaxCachedParentSignatures);
 
 		LOAD_PROPERTY(UnfinalizedBlocksDuration);
 
-		utils::VerifyBagSizeExact(bag, 10);
+		utils::VerifyBagSizeExact(bag, 11);
 		return config;
 	}
 
@@ -60,6 +60,9 @@ namespace catapult { namespace finalization {
 		/// Height multiple of the last block in a prevote hash chain.
 		uint16_t PrevoteBlocksMultiple;
 
+		/// Maximum number of verified parent signatures to cache per epoch.
+		uint32_t MaxCachedParentSignatures;
+
 		/// Target duration of unfinalized blocks.
 		/// \note This should be zero when `EnableVoting` is \c true.
 		utils::BlockSpan UnfinalizedBlocksDuration;
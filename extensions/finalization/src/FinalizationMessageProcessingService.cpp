@@ -76,6 +76,7 @@ namespace catapult { namespace finalization {
 				hooks.setMessageRangeConsumer([&messageAggregator, &messageProcessingPool, pRecentHashCache, messagesSink](
 						auto&& messages) {
 					auto newMessages = ionet::FinalizationMessages();
+					auto messagesToAdd = std::vector<std::shared_ptr<model::FinalizationMessage>>();
 					auto extractedMessages = model::FinalizationMessageRange::ExtractEntitiesFromRange(std::move(messages.Range));
 					CATAPULT_LOG(trace) << "received " << extractedMessages.size() << " messages from peer " << messages.SourceIdentity;
 
@@ -94,16 +95,25 @@ namespace catapult { namespace finalization {
 						if (!pRecentHashCache->add(messageHash))
 							continue;
 
-						messageProcessingPool.ioContext().dispatch([&messageAggregator, pMessage, messageHash]() {
-							auto addResult = messageAggregator.modifier().add(pMessage);
-							if (addResult < chain::RoundMessageAggregatorAddResult::Neutral_Redundant)
-								CATAPULT_LOG(warning) << "finalization message " << messageHash << " rejected due to " << addResult;
-						});
+						messagesToAdd.push_back(pMessage);
 						newMessages.push_back(pMessage);
 					}
 
-					if (!newMessages.empty())
-						messagesSink(newMessages);
+					if (newMessages.empty())
+						return;
+
+					// add all new messages together so that their signatures can be verified in a batch
+					messageProcessingPool.ioContext().dispatch([&messageAggregator, messagesToAdd{std::move(messagesToAdd)}]() {
+						auto addResults = messageAggregator.modifier().addAll(messagesToAdd);
+						for (auto i = 0u; i < messagesToAdd.size(); ++i) {
+							if (addResults[i] < chain::RoundMessageAggregatorAddResult::Neutral_Redundant) {
+								CATAPULT_LOG(warning)
+										<< "finalization message " << model::CalculateMessageHash(*messagesToAdd[i])
+										<< " rejected due to " << addResults[i];
+							}
+						}
+					});
+					messagesSink(newMessages);
 				});
 			}
 
@@ -20,29 +20,25 @@
 **/
 
 #include "FinalizationHashTree.h"
-#include "catapult/utils/Hashers.h"
 
 namespace catapult { namespace chain {
 
-	size_t FinalizationHashTree::TreeNodeHasher::operator()(const TreeNode& node) const {
-		return utils::ArrayHasher<Hash256>()(node.Key.Hash);
-	}
-
 	size_t FinalizationHashTree::size() const {
-		return m_tree.size();
+		return m_index.size();
 	}
 
 	bool FinalizationHashTree::contains(const model::HeightHashPair& key) const {
-		return !!tryFindNode(key);
+		return Invalid_Index != findIndex(key);
 	}
 
 	bool FinalizationHashTree::isDescendant(const model::HeightHashPair& parentKey, const model::HeightHashPair& childKey) const {
-		const auto* pNode = tryFindNode(childKey);
-		while (pNode) {
-			if (pNode->Key == parentKey)
-				return true;
+		auto parentIndex = findIndex(parentKey);
+		if (Invalid_Index == parentIndex)
+			return false;
 
-			pNode = pNode->pParent;
+		for (auto index = findIndex(childKey); Invalid_Index != index; index = m_links[index].ParentIndex) {
+			if (parentIndex == index)
+				return true;
 		}
 
 		return false;
@@ -50,28 +46,51 @@ namespace catapult { namespace chain {
 
 	std::vector<model::HeightHashPair> FinalizationHashTree::findAncestors(const model::HeightHashPair& key) const {
 		std::vector<model::HeightHashPair> ancestors;
-		const auto* pNode = tryFindNode(key);
-		while (pNode) {
-			ancestors.push_back(pNode->Key);
-			pNode = pNode->pParent;
-		}
+		for (auto index = findIndex(key); Invalid_Index != index; index = m_links[index].ParentIndex)
+			ancestors.push_back(m_index.key(index));
 
 		return ancestors;
 	}
 
-	void FinalizationHashTree::addBranch(Height height, const Hash256* pHashes, size_t count) {
-		const TreeNode* pParent = nullptr;
-		for (auto i = 0u; i < count; ++i) {
-			auto node = TreeNode({ height + Height(i), pHashes[i] });
-			node.pParent = pParent;
+	size_t FinalizationHashTree::findIndex(const model::HeightHashPair& key) const {
+		return m_index.find(key);
+	}
+
+	const model::HeightHashPair& FinalizationHashTree::key(size_t index) const {
+		return m_index.key(index);
+	}
+
+	size_t FinalizationHashTree::parentIndex(size_t index) const {
+		return m_links[index].ParentIndex;
+	}
 
-			auto insertResultPair = m_tree.insert(node);
-			pParent = &*insertResultPair.first;
+	std::vector<size_t> FinalizationHashTree::findChildIndexes(size_t index) const {
+		std::vector<size_t> childIndexes;
+		auto childIndex = m_links[index].FirstChildIndex;
+		while (Invalid_Index != childIndex) {
+			childIndexes.push_back(childIndex);
+			childIndex = m_links[childIndex].NextSiblingIndex;
 		}
+
+		return childIndexes;
 	}
 
-	const FinalizationHashTree::TreeNode* FinalizationHashTree::tryFindNode(const model::HeightHashPair& key) const {
-		auto iter = m_tree.find(TreeNode(key));
-		return m_tree.cend() == iter ? nullptr : &*iter;
+	void FinalizationHashTree::addBranch(Height height, const Hash256* pHashes, size_t count) {
+		auto parentIndex = Invalid_Index;
+		for (auto i = 0u; i < count; ++i) {
+			auto insertResultPair = m_index.insert({ height + Height(i), pHashes[i] });
+			if (insertResultPair.second) {
+				// existing nodes keep their original parents
+				auto links = TreeNodeLinks{ parentIndex, Invalid_Index, Invalid_Index };
+				if (Invalid_Index != parentIndex) {
+					links.NextSiblingIndex = m_links[parentIndex].FirstChildIndex;
+					m_links[parentIndex].FirstChildIndex = insertResultPair.first;
+				}
+
+				m_links.push_back(links);
+			}
+
+			parentIndex = insertResultPair.first;
+		}
 	}
 }}
@@ -20,14 +20,18 @@
 **/
 
 #pragma once
-#include "catapult/model/HeightHashPair.h"
-#include <unordered_set>
+#include "HeightHashPairIndex.h"
 
 namespace catapult { namespace chain {
 
 	/// Finalization hash tree.
 	/// \note Any node in the tree is considered to be an ancestor and descendant of itself.
+	/// \note Nodes are stored in a flat array and are identified by dense (insertion order) indexes.
 	class FinalizationHashTree {
+	public:
+		/// Index used to indicate the absence of a node.
+		static constexpr size_t Invalid_Index = HeightHashPairIndex::Invalid_Index;
+
 	public:
 		/// Gets the number of tree nodes.
 		size_t size() const;
@@ -42,35 +46,31 @@ namespace catapult { namespace chain {
 		std::vector<model::HeightHashPair> findAncestors(const model::HeightHashPair& key) const;
 
 	public:
-		/// Adds a branch of \a count hashes (\a pHashes) starting at \a height.
-		void addBranch(Height height, const Hash256* pHashes, size_t count);
+		/// Finds the index of the node with \a key or Invalid_Index if it is unknown.
+		size_t findIndex(const model::HeightHashPair& key) const;
 
-	private:
-		struct TreeNode {
-		public:
-			explicit TreeNode(const model::HeightHashPair& key)
-					: pParent(nullptr)
-					, Key(key)
-			{}
+		/// Gets the key of the node with \a index.
+		const model::HeightHashPair& key(size_t index) const;
 
-		public:
-			constexpr bool operator==(const TreeNode& rhs) const {
-				return Key == rhs.Key;
-			}
+		/// Gets the index of the parent of the node with \a index or Invalid_Index if it does not have a parent.
+		size_t parentIndex(size_t index) const;
 
-		public:
-			const TreeNode* pParent;
-			model::HeightHashPair Key;
-		};
+		/// Finds the indexes of all direct children of the node with \a index.
+		std::vector<size_t> findChildIndexes(size_t index) const;
 
-	private:
-		const TreeNode* tryFindNode(const model::HeightHashPair& key) const;
+	public:
+		/// Adds a branch of \a count hashes (\a pHashes) starting at \a height.
+		void addBranch(Height height, const Hash256* pHashes, size_t count);
 
 	private:
-		struct TreeNodeHasher {
-			size_t operator()(const TreeNode& node) const;
+		struct TreeNodeLinks {
+			size_t ParentIndex;
+			size_t FirstChildIndex;
+			size_t NextSiblingIndex;
 		};
 
-		std::unordered_set<TreeNode, TreeNodeHasher> m_tree;
+	private:
+		HeightHashPairIndex m_index;
+		std::vector<TreeNodeLinks> m_links;
 	};
 }}
@@ -36,7 +36,7 @@ namespace catapult { namespace chain {
 #undef DEFINE_ENUM
 
 	namespace {
-		std::shared_ptr<model::FinalizationMessage> CreateTemplateMessage(
+		std::shared_ptr<model::FinalizationMessage> CreateMessage(
 				const model::FinalizationRound& round,
 				const model::FinalizationMessageGroup& messageGroup) {
 			uint32_t hashesPayloadSize = static_cast<uint32_t>(messageGroup.HashesCount * Hash256::Size);
@@ -64,16 +64,21 @@ namespace catapult { namespace chain {
 		if (proof.Round.Epoch != context.epoch())
 			return VerifyFinalizationProofResult::Failure_Invalid_Epoch;
 
-		auto pMessageAggregator = CreateRoundMessageAggregator(context);
+		// expand all messages so that their signatures can be verified in a single batch
+		std::vector<std::shared_ptr<model::FinalizationMessage>> messages;
 		for (const auto& messageGroup : proof.MessageGroups()) {
-			auto pTemplateMessage = CreateTemplateMessage(proof.Round, messageGroup);
 			for (auto i = 0u; i < messageGroup.SignaturesCount; ++i) {
-				pTemplateMessage->Signature = messageGroup.SignaturesPtr()[i];
-				auto addResult = pMessageAggregator->add(pTemplateMessage);
-				if (addResult <= chain::RoundMessageAggregatorAddResult::Neutral_Redundant) {
-					CATAPULT_LOG(warning) << "finalization message for proof " << proof.Hash << " rejected due to " << addResult;
-					return VerifyFinalizationProofResult::Failure_Invalid_Messsage;
-				}
+				auto pMessage = CreateMessage(proof.Round, messageGroup);
+				pMessage->Signature = messageGroup.SignaturesPtr()[i];
+				messages.push_back(pMessage);
+			}
+		}
+
+		auto pMessageAggregator = CreateRoundMessageAggregator(context);
+		for (auto addResult : pMessageAggregator->addAll(messages)) {
+			if (addResult <= chain::RoundMessageAggregatorAddResult::Neutral_Redundant) {
+				CATAPULT_LOG(warning) << "finalization message for proof " << proof.Hash << " rejected due to " << addResult;
+				return VerifyFinalizationProofResult::Failure_Invalid_Messsage;
 			}
 		}
 
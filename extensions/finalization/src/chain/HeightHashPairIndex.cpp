@@ -0,0 +1,83 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "HeightHashPairIndex.h"
+#include "catapult/utils/Hashers.h"
+
+namespace catapult { namespace chain {
+
+	namespace {
+		constexpr size_t Min_Num_Slots = 16;
+	}
+
+	size_t HeightHashPairIndex::size() const {
+		return m_keys.size();
+	}
+
+	const model::HeightHashPair& HeightHashPairIndex::key(size_t index) const {
+		return m_keys[index];
+	}
+
+	size_t HeightHashPairIndex::find(const model::HeightHashPair& key) const {
+		if (m_slots.empty())
+			return Invalid_Index;
+
+		auto slotValue = m_slots[findSlot(key)];
+		return 0 == slotValue ? Invalid_Index : slotValue - 1;
+	}
+
+	std::pair<size_t, bool> HeightHashPairIndex::insert(const model::HeightHashPair& key) {
+		// keep load factor at most 1/2 so that probe sequences stay short
+		if (2 * (m_keys.size() + 1) > m_slots.size())
+			rehash(std::max(Min_Num_Slots, 2 * m_slots.size()));
+
+		auto& slotValue = m_slots[findSlot(key)];
+		if (0 != slotValue)
+			return std::make_pair(slotValue - 1, false);
+
+		m_keys.push_back(key);
+		slotValue = m_keys.size();
+		return std::make_pair(slotValue - 1, true);
+	}
+
+	size_t HeightHashPairIndex::findSlot(const model::HeightHashPair& key) const {
+		// number of slots is always a power of two
+		auto mask = m_slots.size() - 1;
+		auto slot = utils::ArrayHasher<Hash256>()(key.Hash) & mask;
+		while (0 != m_slots[slot] && key != m_keys[m_slots[slot] - 1])
+			slot = (slot + 1) & mask;
+
+		return slot;
+	}
+
+	void HeightHashPairIndex::rehash(size_t numSlots) {
+		m_slots.assign(numSlots, 0);
+		for (auto i = 0u; i < m_keys.size(); ++i) {
+			// all keys are unique, so first empty slot can be used
+			auto mask = numSlots - 1;
+			auto slot = utils::ArrayHasher<Hash256>()(m_keys[i].Hash) & mask;
+			while (0 != m_slots[slot])
+				slot = (slot + 1) & mask;
+
+			m_slots[slot] = i + 1;
+		}
+	}
+}}
@@ -0,0 +1,59 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/model/HeightHashPair.h"
+#include <vector>
+
+namespace catapult { namespace chain {
+
+	/// Flat open-addressing index that maps height hash pairs to dense indexes.
+	/// \note Indexes are assigned in insertion order and keys cannot be removed.
+	class HeightHashPairIndex {
+	public:
+		/// Index returned when a key is not found.
+		static constexpr size_t Invalid_Index = static_cast<size_t>(-1);
+
+	public:
+		/// Gets the number of indexed keys.
+		size_t size() const;
+
+		/// Gets the key with \a index.
+		const model::HeightHashPair& key(size_t index) const;
+
+		/// Finds the index of \a key or Invalid_Index if it is unknown.
+		size_t find(const model::HeightHashPair& key) const;
+
+	public:
+		/// Inserts \a key if it is unknown.
+		/// Returns the index of \a key and \c true if it was inserted.
+		std::pair<size_t, bool> insert(const model::HeightHashPair& key);
+
+	private:
+		size_t findSlot(const model::HeightHashPair& key) const;
+
+		void rehash(size_t numSlots);
+
+	private:
+		std::vector<model::HeightHashPair> m_keys;
+		std::vector<size_t> m_slots; // one-based indexes into m_keys, zero when empty
+	};
+}}
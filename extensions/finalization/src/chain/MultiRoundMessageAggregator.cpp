@@ -160,23 +160,67 @@ namespace catapult { namespace chain {
 		CATAPULT_LOG(trace) << "set max finalization round to " << m_state.MaxFinalizationRound;
 	}
 
+	namespace {
+		bool IsAcceptedRound(const MultiRoundMessageAggregatorState& state, const model::FinalizationRound& messageRound) {
+			if (state.MinFinalizationRound > messageRound || state.MaxFinalizationRound < messageRound) {
+				CATAPULT_LOG(warning)
+						<< "rejecting message with round " << messageRound
+						<< ", min round " << state.MinFinalizationRound
+						<< ", max round " << state.MaxFinalizationRound;
+				return false;
+			}
+
+			return true;
+		}
+
+		RoundMessageAggregator& GetOrCreateRoundMessageAggregator(
+				MultiRoundMessageAggregatorState& state,
+				const model::FinalizationRound& messageRound) {
+			auto iter = state.RoundMessageAggregators.find(messageRound);
+			if (state.RoundMessageAggregators.cend() == iter) {
+				auto pRoundAggregator = state.RoundMessageAggregatorFactory(messageRound);
+				iter = state.RoundMessageAggregators.emplace(messageRound, std::move(pRoundAggregator)).first;
+			}
+
+			return *iter->second;
+		}
+	}
+
 	RoundMessageAggregatorAddResult MultiRoundMessageAggregatorModifier::add(const std::shared_ptr<model::FinalizationMessage>& pMessage) {
 		auto messageRound = pMessage->StepIdentifier.Round();
-		if (m_state.MinFinalizationRound > messageRound || m_state.MaxFinalizationRound < messageRound) {
-			CATAPULT_LOG(warning)
-					<< "rejecting message with round " << messageRound
-					<< ", min round " << m_state.MinFinalizationRound
-					<< ", max round " << m_state.MaxFinalizationRound;
+		if (!IsAcceptedRound(m_state, messageRound))
 			return RoundMessageAggregatorAddResult::Failure_Invalid_Point;
+
+		return GetOrCreateRoundMessageAggregator(m_state, messageRound).add(pMessage);
+	}
+
+	std::vector<RoundMessageAggregatorAddResult> MultiRoundMessageAggregatorModifier::addAll(
+			const std::vector<std::shared_ptr<model::FinalizationMessage>>& messages) {
+		std::vector<RoundMessageAggregatorAddResult> results(messages.size());
+
+		// group messages by round so that each round message aggregator can verify its messages in a single batch
+		std::map<model::FinalizationRound, std::vector<size_t>> roundMessageIndexesMap;
+		for (auto i = 0u; i < messages.size(); ++i) {
+			auto messageRound = messages[i]->StepIdentifier.Round();
+			if (!IsAcceptedRound(m_state, messageRound)) {
+				results[i] = RoundMessageAggregatorAddResult::Failure_Invalid_Point;
+				continue;
+			}
+
+			roundMessageIndexesMap[messageRound].push_back(i);
 		}
 
-		auto iter = m_state.RoundMessageAggregators.find(messageRound);
-		if (m_state.RoundMessageAggregators.cend() == iter) {
-			auto pRoundAggregator = m_state.RoundMessageAggregatorFactory(messageRound);
-			iter = m_state.RoundMessageAggregators.emplace(messageRound, std::move(pRoundAggregator)).first;
+		for (const auto& pair : roundMessageIndexesMap) {
+			std::vector<std::shared_ptr<model::FinalizationMessage>> roundMessages;
+			for (auto index : pair.second)
+				roundMessages.push_back(messages[index]);
+
+			auto roundResults = GetOrCreateRoundMessageAggregator(m_state, pair.first).addAll(roundMessages);
+			for (auto i = 0u; i < pair.second.size(); ++i)
+				results[pair.second[i]] = roundResults[i];
 		}
 
-		return iter->second->add(pMessage);
+		return results;
 	}
 
 	void MultiRoundMessageAggregatorModifier::prune(FinalizationEpoch epoch) {
@@ -112,6 +112,10 @@ namespace catapult { namespace chain {
 		/// \note Message is a shared_ptr because it is detached from an EntityRange and is kept alive with its associated step.
 		RoundMessageAggregatorAddResult add(const std::shared_ptr<model::FinalizationMessage>& pMessage);
 
+		/// Adds finalization messages (\a messages) to the aggregator and returns the result of adding each one.
+		/// \note Signatures of all messages with the same round are verified in a single batch.
+		std::vector<RoundMessageAggregatorAddResult> addAll(const std::vector<std::shared_ptr<model::FinalizationMessage>>& messages);
+
 		/// Prunes this aggregator by removing all rounds with an epoch less than \a epoch.
 		void prune(FinalizationEpoch epoch);
 
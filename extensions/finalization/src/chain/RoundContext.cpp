@@ -20,50 +20,43 @@
 **/
 
 #include "RoundContext.h"
-#include "catapult/utils/Hashers.h"
 
 namespace catapult { namespace chain {
 
 	namespace {
 		constexpr auto Try_Find_Failure_Result = std::make_pair(model::HeightHashPair(), false);
-	}
-
-	bool RoundContext::HeightHashPairComparer::operator()(const model::HeightHashPair& lhs, const model::HeightHashPair& rhs) const {
-		return lhs.Height < rhs.Height || (lhs.Height == rhs.Height && lhs.Hash < rhs.Hash);
-	}
 
-	size_t RoundContext::HeightHashPairHasher::operator()(const model::HeightHashPair& pair) const {
-		return utils::ArrayHasher<Hash256>()(pair.Hash);
+		bool IsLess(const model::HeightHashPair& lhs, const model::HeightHashPair& rhs) {
+			return lhs.Height < rhs.Height || (lhs.Height == rhs.Height && lhs.Hash < rhs.Hash);
+		}
 	}
 
 	RoundContext::RoundContext(uint64_t weight, uint64_t threshold)
 			: m_totalWeight(weight)
 			, m_threshold(threshold)
 			, m_cumulativePrecommitWeight(0)
+			, m_bestPrevoteIndex(FinalizationHashTree::Invalid_Index)
+			, m_bestPrecommitIndex(FinalizationHashTree::Invalid_Index)
+			, m_numPendingPrecommits(0)
 	{}
 
 	size_t RoundContext::size() const {
-		return m_candidates.size();
+		return m_tree.size();
 	}
 
 	std::pair<model::HeightHashPair, bool> RoundContext::tryFindBestPrevote() const {
-		return tryFindLastMatch([threshold = m_threshold](const auto&, const auto& weights) {
-			return weights.Prevote >= threshold;
-		});
+		return toResultPair(m_bestPrevoteIndex);
 	}
 
 	std::pair<model::HeightHashPair, bool> RoundContext::tryFindBestPrecommit() const {
-		return tryFindLastMatch([threshold = m_threshold](const auto&, const auto& weights) {
-			return weights.Prevote >= threshold && weights.Precommit >= threshold;
-		});
+		return toResultPair(m_bestPrecommitIndex);
 	}
 
 	std::pair<model::HeightHashPair, bool> RoundContext::tryFindEstimate() const {
-		auto bestPrevoteResultPair = tryFindBestPrevote();
-		if (!bestPrevoteResultPair.second)
+		if (FinalizationHashTree::Invalid_Index == m_bestPrevoteIndex)
 			return Try_Find_Failure_Result;
 
-		return tryFindEstimate(bestPrevoteResultPair.first);
+		return toResultPair(findEstimateIndex(m_bestPrevoteIndex));
 	}
 
 	bool RoundContext::isDescendant(const model::HeightHashPair& parentKey, const model::HeightHashPair& childKey) const {
@@ -71,15 +64,14 @@ namespace catapult { namespace chain {
 	}
 
 	bool RoundContext::isCompletable() const {
-		auto bestPrevoteResultPair = tryFindBestPrevote();
-		if (!bestPrevoteResultPair.second) {
+		if (FinalizationHashTree::Invalid_Index == m_bestPrevoteIndex) {
 			CATAPULT_LOG(trace) << "not completable - no best prevote";
 			return false;
 		}
 
 		// Erv < g(Vrv) is always completable
-		auto estimateResultPair = tryFindEstimate(bestPrevoteResultPair.first);
-		if (estimateResultPair.second && bestPrevoteResultPair.first != estimateResultPair.first) {
+		auto estimateIndex = findEstimateIndex(m_bestPrevoteIndex);
+		if (FinalizationHashTree::Invalid_Index != estimateIndex && m_bestPrevoteIndex != estimateIndex) {
 			CATAPULT_LOG(trace) << "completable - Erv < g(Vrv)";
 			return true;
 		}
@@ -92,17 +84,16 @@ namespace catapult { namespace chain {
 			return false;
 		}
 
-		for (auto iter = m_candidates.crbegin(); m_candidates.crend() != iter; ++iter) {
-			// check explicitly because isDescendant includes self
-			if (bestPrevoteResultPair.first == iter->first)
-				continue;
-
+		// precommit weights are propagated to all ancestors, so no descendant can have more precommit weight than its ancestors;
+		// consequently, it is sufficient to only check the direct children of `best prevote`
+		for (auto childIndex : m_tree.findChildIndexes(m_bestPrevoteIndex)) {
 			// if any `best prevote` descendant can reach precommit threshold, round is not yet completable
-			if (m_tree.isDescendant(bestPrevoteResultPair.first, iter->first) && canReachPrecommitThreshold(iter->second)) {
+			const auto& childWeights = m_weights[childIndex];
+			if (canReachPrecommitThreshold(childWeights)) {
 				CATAPULT_LOG(debug)
 						<< "not completable - Erv == g(Vrv) and descendant can reach g(Crv)"
 						<< " (total weight " << m_totalWeight << ", cumulative precommit weight " << m_cumulativePrecommitWeight
-						<< ", prevote weight " << iter->second.Prevote << ", precommit weight " << iter->second.Precommit << ")";
+						<< ", prevote weight " << childWeights.Prevote << ", precommit weight " << childWeights.Precommit << ")";
 				return false;
 			}
 		}
@@ -112,60 +103,100 @@ namespace catapult { namespace chain {
 	}
 
 	RoundContext::Weights RoundContext::weights(const model::HeightHashPair& key) const {
-		auto iter = m_candidates.find(key);
-		return m_candidates.cend() == iter ? RoundContext::Weights() : iter->second;
+		auto index = m_tree.findIndex(key);
+		return FinalizationHashTree::Invalid_Index == index ? RoundContext::Weights() : m_weights[index];
 	}
 
 	bool RoundContext::canReachPrecommitThreshold(const Weights& weights) const {
 		return weights.Precommit + (m_totalWeight - m_cumulativePrecommitWeight) >= m_threshold;
 	}
 
-	std::pair<model::HeightHashPair, bool> RoundContext::tryFindLastMatch(const MatchPredicate& predicate) const {
-		auto iter = std::find_if(m_candidates.crbegin(), m_candidates.crend(), [predicate](const auto& pair) {
-			return predicate(pair.first, pair.second);
-		});
-
-		return m_candidates.crend() == iter ? Try_Find_Failure_Result : std::make_pair(iter->first, true);
+	std::pair<model::HeightHashPair, bool> RoundContext::toResultPair(size_t index) const {
+		return FinalizationHashTree::Invalid_Index == index ? Try_Find_Failure_Result : std::make_pair(m_tree.key(index), true);
 	}
 
-	std::pair<model::HeightHashPair, bool> RoundContext::tryFindEstimate(const model::HeightHashPair& bestPrevote) const {
-		return tryFindLastMatch([this, &bestPrevote](const auto& key, const auto& weights) {
-			return m_tree.isDescendant(key, bestPrevote) && canReachPrecommitThreshold(weights);
-		});
+	size_t RoundContext::findEstimateIndex(size_t bestPrevoteIndex) const {
+		// ancestors have strictly decreasing heights, so the first match is the last (largest) match
+		auto index = bestPrevoteIndex;
+		while (FinalizationHashTree::Invalid_Index != index && !canReachPrecommitThreshold(m_weights[index]))
+			index = m_tree.parentIndex(index);
+
+		return index;
 	}
 
 	void RoundContext::acceptPrevote(Height height, const Hash256* pHashes, size_t count, uint64_t weight) {
 		m_tree.addBranch(height, pHashes, count);
+		m_weights.resize(m_tree.size());
 
 		for (auto i = 0u; i < count; ++i) {
 			auto key = model::HeightHashPair{ height + Height(i), pHashes[i] };
-			auto insertResultPair = m_candidates.emplace(key, Weights());
-			insertResultPair.first->second.Prevote += weight;
+			auto index = m_tree.findIndex(key);
+			addPrevoteWeight(index, weight);
 
 			// check and update if hash has pending precommit
-			auto pendingPrecommitWeightsIter = m_pendingPrecommitWeights.find(key);
-			if (m_pendingPrecommitWeights.cend() != pendingPrecommitWeightsIter) {
-				auto ancestorKeys = m_tree.findAncestors(key);
-				for (const auto& ancestorKey : ancestorKeys)
-					m_candidates.find(ancestorKey)->second.Precommit += pendingPrecommitWeightsIter->second;
-
-				m_cumulativePrecommitWeight += pendingPrecommitWeightsIter->second;
-				m_pendingPrecommitWeights.erase(pendingPrecommitWeightsIter);
-			}
+			if (0 == m_numPendingPrecommits)
+				continue;
+
+			auto pendingPrecommitIndex = m_pendingPrecommitIndex.find(key);
+			if (HeightHashPairIndex::Invalid_Index == pendingPrecommitIndex || 0 == m_pendingPrecommitWeights[pendingPrecommitIndex])
+				continue;
+
+			addPrecommitWeight(index, m_pendingPrecommitWeights[pendingPrecommitIndex]);
+			m_pendingPrecommitWeights[pendingPrecommitIndex] = 0;
+			--m_numPendingPrecommits;
 		}
 	}
 
 	void RoundContext::acceptPrecommit(Height height, const Hash256& hash, uint64_t weight) {
 		auto key = model::HeightHashPair{ height, hash };
-		auto ancestorKeys = m_tree.findAncestors(key);
-		if (ancestorKeys.empty()) {
-			m_pendingPrecommitWeights.emplace(key, 0).first->second += weight;
+		auto index = m_tree.findIndex(key);
+		if (FinalizationHashTree::Invalid_Index != index) {
+			addPrecommitWeight(index, weight);
 			return;
 		}
 
-		for (const auto& ancestorKey : ancestorKeys)
-			m_candidates.find(ancestorKey)->second.Precommit += weight;
+		if (0 == weight)
+			return;
+
+		auto pendingPrecommitIndex = m_pendingPrecommitIndex.insert(key).first;
+		m_pendingPrecommitWeights.resize(m_pendingPrecommitIndex.size());
+
+		auto& pendingPrecommitWeight = m_pendingPrecommitWeights[pendingPrecommitIndex];
+		if (0 == pendingPrecommitWeight)
+			++m_numPendingPrecommits;
+
+		pendingPrecommitWeight += weight;
+	}
+
+	void RoundContext::addPrevoteWeight(size_t index, uint64_t weight) {
+		m_weights[index].Prevote += weight;
+		updateBestIndexes(index);
+	}
+
+	void RoundContext::addPrecommitWeight(size_t index, uint64_t weight) {
+		// precommit for a node is implicitly a precommit for all of its ancestors
+		for (; FinalizationHashTree::Invalid_Index != index; index = m_tree.parentIndex(index)) {
+			m_weights[index].Precommit += weight;
+			updateBestIndexes(index);
+		}
 
 		m_cumulativePrecommitWeight += weight;
 	}
+
+	void RoundContext::updateBestIndexes(size_t index) {
+		// weights never decrease, so a candidate that reaches a threshold can never fall below it
+		const auto& weights = m_weights[index];
+		if (weights.Prevote < m_threshold)
+			return;
+
+		const auto& key = m_tree.key(index);
+		if (FinalizationHashTree::Invalid_Index == m_bestPrevoteIndex || IsLess(m_tree.key(m_bestPrevoteIndex), key))
+			m_bestPrevoteIndex = index;
+
+		if (weights.Precommit < m_threshold)
+			return;
+
+		if (FinalizationHashTree::Invalid_Index == m_bestPrecommitIndex || IsLess(m_tree.key(m_bestPrecommitIndex), key))
+			m_bestPrecommitIndex = index;
+	}
 }}
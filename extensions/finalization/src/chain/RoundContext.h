@@ -21,13 +21,11 @@
 
 #pragma once
 #include "FinalizationHashTree.h"
-#include "catapult/functions.h"
-#include <map>
-#include <unordered_map>
 
 namespace catapult { namespace chain {
 
 	/// Context for a finalization round.
+	/// \note Weights are accumulated incrementally along the prevote hash tree, so best candidate queries are constant time.
 	class RoundContext {
 	public:
 		/// Weights associated with a finalization candidate.
@@ -66,13 +64,11 @@ namespace catapult { namespace chain {
 		Weights weights(const model::HeightHashPair& key) const;
 
 	private:
-		using MatchPredicate = predicate<const model::HeightHashPair&, const Weights&>;
-
 		bool canReachPrecommitThreshold(const Weights& weights) const;
 
-		std::pair<model::HeightHashPair, bool> tryFindLastMatch(const MatchPredicate& predicate) const;
+		std::pair<model::HeightHashPair, bool> toResultPair(size_t index) const;
 
-		std::pair<model::HeightHashPair, bool> tryFindEstimate(const model::HeightHashPair& bestPrevote) const;
+		size_t findEstimateIndex(size_t bestPrevoteIndex) const;
 
 	public:
 		/// Accepts a prevote for \a count hashes (\a pHashes) starting at \a height with \a weight.
@@ -82,13 +78,11 @@ namespace catapult { namespace chain {
 		void acceptPrecommit(Height height, const Hash256& hash, uint64_t weight);
 
 	private:
-		struct HeightHashPairComparer {
-			bool operator()(const model::HeightHashPair& lhs, const model::HeightHashPair& rhs) const;
-		};
+		void addPrevoteWeight(size_t index, uint64_t weight);
 
-		struct HeightHashPairHasher {
-			size_t operator()(const model::HeightHashPair& pair) const;
-		};
+		void addPrecommitWeight(size_t index, uint64_t weight);
+
+		void updateBestIndexes(size_t index);
 
 	private:
 		const uint64_t m_totalWeight;
@@ -96,7 +90,12 @@ namespace catapult { namespace chain {
 		uint64_t m_cumulativePrecommitWeight;
 
 		FinalizationHashTree m_tree;
-		std::map<model::HeightHashPair, Weights, HeightHashPairComparer> m_candidates;
-		std::unordered_map<model::HeightHashPair, uint64_t, HeightHashPairHasher> m_pendingPrecommitWeights;
+		std::vector<Weights> m_weights; // indexed by tree node index
+		size_t m_bestPrevoteIndex;
+		size_t m_bestPrecommitIndex;
+
+		HeightHashPairIndex m_pendingPrecommitIndex;
+		std::vector<uint64_t> m_pendingPrecommitWeights; // indexed by pending precommit index, zero when resolved
+		size_t m_numPendingPrecommits;
 	};
 }}
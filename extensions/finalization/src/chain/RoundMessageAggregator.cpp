@@ -23,7 +23,9 @@
 #include "RoundContext.h"
 #include "finalization/src/model/FinalizationContext.h"
 #include "finalization/src/model/FinalizationMessage.h"
+#include "finalization/src/model/ParentSignatureCache.h"
 #include "finalization/src/model/VotingSet.h"
+#include "catapult/crypto/SecureRandomGenerator.h"
 #include "catapult/model/HeightGrouping.h"
 #include "catapult/utils/MacroBasedEnumIncludes.h"
 #include <unordered_map>
@@ -69,14 +71,33 @@ namespace catapult { namespace chain {
 			return model::FinalizationStage::Prevote == message.StepIdentifier.Stage();
 		}
 
+		MessageKey ToMessageKey(const model::FinalizationMessage& message) {
+			return std::make_pair(message.Signature.Root.ParentPublicKey, IsPrevote(message));
+		}
+
+		std::pair<model::ProcessMessageResult, size_t> ToProcessResultPair(bool isSignatureValid, size_t weight) {
+			return isSignatureValid
+					? std::make_pair(model::ProcessMessageResult::Success, weight)
+					: std::make_pair(model::ProcessMessageResult::Failure_Signature, static_cast<size_t>(0));
+		}
+
+		crypto::RandomFiller CreateRandomFiller() {
+			return [](auto* pOut, auto count) {
+				crypto::SecureRandomGenerator().fill(pOut, count);
+			};
+		}
+
 		// endregion
 
 		// region DefaultRoundMessageAggregator
 
 		class DefaultRoundMessageAggregator : public RoundMessageAggregator {
 		public:
-			explicit DefaultRoundMessageAggregator(const model::FinalizationContext& finalizationContext)
+			DefaultRoundMessageAggregator(
+					const model::FinalizationContext& finalizationContext,
+					model::ParentSignatureCache* pParentSignatureCache)
 					: m_finalizationContext(finalizationContext)
+					, m_pParentSignatureCache(pParentSignatureCache)
 					, m_maxResponseSize(m_finalizationContext.config().MessageSynchronizationMaxResponseSize.bytes())
 					, m_roundContext(m_finalizationContext.weight().unwrap(), CalculateWeightedThreshold(m_finalizationContext))
 			{}
@@ -123,55 +144,139 @@ namespace catapult { namespace chain {
 
 		public:
 			RoundMessageAggregatorAddResult add(const std::shared_ptr<model::FinalizationMessage>& pMessage) override {
+				RoundMessageAggregatorAddResult result;
+				if (tryRejectInvalid(*pMessage, result) || tryRejectKnown(*pMessage, result))
+					return result;
+
+				if (!m_pParentSignatureCache)
+					return accept(pMessage, model::ProcessMessage(*pMessage, m_finalizationContext));
+
+				size_t weight;
+				if (tryRejectUnprocessable(*pMessage, result, weight))
+					return result;
+
+				bool isSignatureValid = verifySignatures({ pMessage.get() })[0];
+				return accept(pMessage, ToProcessResultPair(isSignatureValid, weight));
+			}
+
+			std::vector<RoundMessageAggregatorAddResult> addAll(
+					const std::vector<std::shared_ptr<model::FinalizationMessage>>& messages) override {
+				std::vector<RoundMessageAggregatorAddResult> results(messages.size());
+				std::vector<size_t> candidateIndexes;
+				std::vector<size_t> candidateWeights;
+				std::vector<const model::FinalizationMessage*> candidates;
+				for (auto i = 0u; i < messages.size(); ++i) {
+					// only verify signatures of messages that would otherwise be accepted
+					size_t weight;
+					if (tryRejectInvalid(*messages[i], results[i])
+							|| tryRejectKnown(*messages[i], results[i])
+							|| tryRejectUnprocessable(*messages[i], results[i], weight))
+						continue;
+
+					candidateIndexes.push_back(i);
+					candidateWeights.push_back(weight);
+					candidates.push_back(messages[i].get());
+				}
+
+				if (candidates.empty())
+					return results;
+
+				auto signatureResults = verifySignatures(candidates);
+				for (auto i = 0u; i < candidateIndexes.size(); ++i) {
+					const auto& pMessage = messages[candidateIndexes[i]];
+					auto& result = results[candidateIndexes[i]];
+
+					// an earlier message in the batch could have been accepted with the same key
+					if (tryRejectKnown(*pMessage, result))
+						continue;
+
+					result = accept(pMessage, ToProcessResultPair(signatureResults[i], candidateWeights[i]));
+				}
+
+				return results;
+			}
+
+		private:
+			std::vector<bool> verifySignatures(const std::vector<const model::FinalizationMessage*>& messages) const {
+				return m_pParentSignatureCache
+						? model::VerifyMessageSignatures(CreateRandomFiller(), *m_pParentSignatureCache, messages)
+						: model::VerifyMessageSignatures(CreateRandomFiller(), messages);
+			}
+
+			bool tryRejectInvalid(const model::FinalizationMessage& message, RoundMessageAggregatorAddResult& result) const {
 				auto maxHashesPerPoint = m_finalizationContext.config().MaxHashesPerPoint;
 				CATAPULT_LOG(trace)
-						<< "received message at " << pMessage->StepIdentifier
-						<< " with " << pMessage->HashesCount << " hashes (max " << maxHashesPerPoint << ")";
+						<< "received message at " << message.StepIdentifier
+						<< " with " << message.HashesCount << " hashes (max " << maxHashesPerPoint << ")";
 
-				if (0 == pMessage->HashesCount || pMessage->HashesCount > maxHashesPerPoint)
-					return RoundMessageAggregatorAddResult::Failure_Invalid_Hashes;
+				if (0 == message.HashesCount || message.HashesCount > maxHashesPerPoint)
+					return reject(RoundMessageAggregatorAddResult::Failure_Invalid_Hashes, result);
 
-				auto isPrevote = IsPrevote(*pMessage);
-				auto lastHashHeight = pMessage->Height + Height(pMessage->HashesCount - 1);
+				auto lastHashHeight = message.Height + Height(message.HashesCount - 1);
 
 				// only consider messages that have at least one hash at or after the epoch height
 				if (m_finalizationContext.height() > lastHashHeight)
-					return RoundMessageAggregatorAddResult::Failure_Invalid_Height;
+					return reject(RoundMessageAggregatorAddResult::Failure_Invalid_Height, result);
 
-				if (isPrevote) {
+				if (IsPrevote(message)) {
 					auto votingSetGrouping = m_finalizationContext.config().VotingSetGrouping;
-					auto previousEpoch = pMessage->StepIdentifier.Epoch - FinalizationEpoch(1);
+					auto previousEpoch = message.StepIdentifier.Epoch - FinalizationEpoch(1);
 					auto epochMinHeight = model::CalculateVotingSetEndHeight(previousEpoch, votingSetGrouping);
-					auto epochMaxHeight = model::CalculateVotingSetEndHeight(pMessage->StepIdentifier.Epoch, votingSetGrouping);
+					auto epochMaxHeight = model::CalculateVotingSetEndHeight(message.StepIdentifier.Epoch, votingSetGrouping);
 
-					if (pMessage->Height < epochMinHeight || lastHashHeight > epochMaxHeight)
-						return RoundMessageAggregatorAddResult::Failure_Invalid_Hashes;
+					if (message.Height < epochMinHeight || lastHashHeight > epochMaxHeight)
+						return reject(RoundMessageAggregatorAddResult::Failure_Invalid_Hashes, result);
 				} else {
-					if (1 != pMessage->HashesCount)
-						return RoundMessageAggregatorAddResult::Failure_Invalid_Hashes;
+					if (1 != message.HashesCount)
+						return reject(RoundMessageAggregatorAddResult::Failure_Invalid_Hashes, result);
 				}
 
-				auto messageKey = std::make_pair(pMessage->Signature.Root.ParentPublicKey, isPrevote);
-				auto messageIter = m_messages.find(messageKey);
-				if (m_messages.cend() != messageIter) {
-					return messageIter->second.Hash == model::CalculateMessageHash(*pMessage)
-							? RoundMessageAggregatorAddResult::Neutral_Redundant
-							: RoundMessageAggregatorAddResult::Failure_Conflicting;
-				}
+				return false;
+			}
 
-				auto processResultPair = model::ProcessMessage(*pMessage, m_finalizationContext);
-				if (model::ProcessMessageResult::Success != processResultPair.first) {
-					CATAPULT_LOG(warning) << "rejecting finalization message with result " << processResultPair.first;
-					return RoundMessageAggregatorAddResult::Failure_Processing;
+			bool tryRejectUnprocessable(
+					const model::FinalizationMessage& message,
+					RoundMessageAggregatorAddResult& result,
+					size_t& weight) const {
+				// run all (cheap) processing checks except for signature verification
+				auto processResultPair = model::ProcessMessage(message, m_finalizationContext, true);
+				if (model::ProcessMessageResult::Success == processResultPair.first) {
+					weight = processResultPair.second;
+					return false;
 				}
 
+				return reject(rejectProcessing(processResultPair.first), result);
+			}
+
+			bool tryRejectKnown(const model::FinalizationMessage& message, RoundMessageAggregatorAddResult& result) const {
+				auto messageIter = m_messages.find(ToMessageKey(message));
+				if (m_messages.cend() == messageIter)
+					return false;
+
+				return reject(
+						messageIter->second.Hash == model::CalculateMessageHash(message)
+								? RoundMessageAggregatorAddResult::Neutral_Redundant
+								: RoundMessageAggregatorAddResult::Failure_Conflicting,
+						result);
+			}
+
+			RoundMessageAggregatorAddResult accept(
+					const std::shared_ptr<model::FinalizationMessage>& pMessage,
+					const std::pair<model::ProcessMessageResult, size_t>& processResultPair) {
+				if (model::ProcessMessageResult::Success != processResultPair.first)
+					return rejectProcessing(processResultPair.first);
+
 				CATAPULT_LOG(trace)
 						<< "processing message for epoch " << m_finalizationContext.epoch() << " with weight " << processResultPair.second
 						<< std::endl << *pMessage;
 
-				m_messages.emplace(messageKey, CreateMessageDescriptor(pMessage));
+				m_messages.emplace(ToMessageKey(*pMessage), CreateMessageDescriptor(pMessage));
+
+				// only cache parent signatures of accepted messages so that the cache cannot be filled by ineligible voters
+				if (m_pParentSignatureCache)
+					m_pParentSignatureCache->add(pMessage->Signature, pMessage->StepIdentifier.Epoch);
 
-				if (isPrevote) {
+				if (IsPrevote(*pMessage)) {
 					m_roundContext.acceptPrevote(pMessage->Height, pMessage->HashesPtr(), pMessage->HashesCount, processResultPair.second);
 					return RoundMessageAggregatorAddResult::Success_Prevote;
 				} else {
@@ -180,8 +285,20 @@ namespace catapult { namespace chain {
 				}
 			}
 
+		private:
+			static RoundMessageAggregatorAddResult rejectProcessing(model::ProcessMessageResult processResult) {
+				CATAPULT_LOG(warning) << "rejecting finalization message with result " << processResult;
+				return RoundMessageAggregatorAddResult::Failure_Processing;
+			}
+
+			static bool reject(RoundMessageAggregatorAddResult rejectResult, RoundMessageAggregatorAddResult& result) {
+				result = rejectResult;
+				return true;
+			}
+
 		private:
 			model::FinalizationContext m_finalizationContext;
+			model::ParentSignatureCache* m_pParentSignatureCache;
 			uint64_t m_maxResponseSize;
 			chain::RoundContext m_roundContext;
 			std::unordered_map<MessageKey, MessageDescriptor, MessageKeyHasher> m_messages;
@@ -191,6 +308,12 @@ namespace catapult { namespace chain {
 	}
 
 	std::unique_ptr<RoundMessageAggregator> CreateRoundMessageAggregator(const model::FinalizationContext& finalizationContext) {
-		return std::make_unique<DefaultRoundMessageAggregator>(finalizationContext);
+		return std::make_unique<DefaultRoundMessageAggregator>(finalizationContext, nullptr);
+	}
+
+	std::unique_ptr<RoundMessageAggregator> CreateRoundMessageAggregator(
+			const model::FinalizationContext& finalizationContext,
+			model::ParentSignatureCache& parentSignatureCache) {
+		return std::make_unique<DefaultRoundMessageAggregator>(finalizationContext, &parentSignatureCache);
 	}
 }}
@@ -30,6 +30,7 @@ namespace catapult {
 	namespace model {
 		class FinalizationContext;
 		struct FinalizationMessage;
+		class ParentSignatureCache;
 	}
 }
 
@@ -64,8 +65,19 @@ namespace catapult { namespace chain {
 		/// Adds a finalization message (\a pMessage) to the aggregator.
 		/// \note Message is a shared_ptr because it is detached from an EntityRange and is kept alive with its associated step.
 		virtual RoundMessageAggregatorAddResult add(const std::shared_ptr<model::FinalizationMessage>& pMessage) = 0;
+
+		/// Adds finalization messages (\a messages) to the aggregator and returns the result of adding each one.
+		/// \note Signatures of all messages are verified in a single batch.
+		virtual std::vector<RoundMessageAggregatorAddResult> addAll(
+				const std::vector<std::shared_ptr<model::FinalizationMessage>>& messages) = 0;
 	};
 
 	/// Creates a round message aggregator around \a finalizationContext.
 	std::unique_ptr<RoundMessageAggregator> CreateRoundMessageAggregator(const model::FinalizationContext& finalizationContext);
+
+	/// Creates a round message aggregator around \a finalizationContext that skips verification of parent signatures
+	/// present in \a parentSignatureCache and adds the parent signatures of all accepted messages to it.
+	std::unique_ptr<RoundMessageAggregator> CreateRoundMessageAggregator(
+			const model::FinalizationContext& finalizationContext,
+			model::ParentSignatureCache& parentSignatureCache);
 }}
@@ -21,6 +21,7 @@
 
 #include "FinalizationMessage.h"
 #include "FinalizationContext.h"
+#include "ParentSignatureCache.h"
 #include "catapult/crypto/Hashes.h"
 #include "catapult/crypto_voting/AggregateBmPrivateKeyTree.h"
 #include "catapult/utils/MacroBasedEnumIncludes.h"
@@ -92,21 +93,76 @@ namespace catapult { namespace model {
 		return pMessage;
 	}
 
+	namespace {
+		template<typename TSignatureVerifier>
+		std::pair<ProcessMessageResult, size_t> ProcessMessage(
+				const FinalizationMessage& message,
+				const FinalizationContext& context,
+				TSignatureVerifier verifySignature) {
+			auto accountView = context.lookup(message.Signature.Root.ParentPublicKey);
+			if (Amount() == accountView.Weight)
+				return std::make_pair(ProcessMessageResult::Failure_Voter, 0);
+
+			if (0 != message.FinalizationMessage_Reserved1)
+				return std::make_pair(ProcessMessageResult::Failure_Padding, 0);
+
+			if (FinalizationMessage::Current_Version != message.Version)
+				return std::make_pair(ProcessMessageResult::Failure_Version, 0);
+
+			if (!verifySignature())
+				return std::make_pair(ProcessMessageResult::Failure_Signature, 0);
+
+			return std::make_pair(ProcessMessageResult::Success, accountView.Weight.unwrap());
+		}
+	}
+
 	std::pair<ProcessMessageResult, size_t> ProcessMessage(const FinalizationMessage& message, const FinalizationContext& context) {
-		auto accountView = context.lookup(message.Signature.Root.ParentPublicKey);
-		if (Amount() == accountView.Weight)
-			return std::make_pair(ProcessMessageResult::Failure_Voter, 0);
+		return ProcessMessage(message, context, [&message]() {
+			auto keyIdentifier = StepIdentifierToBmKeyIdentifier(message.StepIdentifier);
+			return crypto::Verify(message.Signature, keyIdentifier, ToBuffer(message));
+		});
+	}
 
-		if (0 != message.FinalizationMessage_Reserved1)
-			return std::make_pair(ProcessMessageResult::Failure_Padding, 0);
+	std::pair<ProcessMessageResult, size_t> ProcessMessage(
+			const FinalizationMessage& message,
+			const FinalizationContext& context,
+			bool isSignatureValid) {
+		return ProcessMessage(message, context, [isSignatureValid]() {
+			return isSignatureValid;
+		});
+	}
 
-		if (FinalizationMessage::Current_Version != message.Version)
-			return std::make_pair(ProcessMessageResult::Failure_Version, 0);
+	namespace {
+		template<typename TIsRootVerified>
+		std::vector<bool> VerifyMessageSignatures(
+				const crypto::RandomFiller& randomFiller,
+				const std::vector<const FinalizationMessage*>& messages,
+				TIsRootVerified isRootVerified) {
+			std::vector<crypto::BmTreeSignatureInput> signatureInputs;
+			signatureInputs.reserve(messages.size());
+			for (const auto* pMessage : messages) {
+				auto keyIdentifier = StepIdentifierToBmKeyIdentifier(pMessage->StepIdentifier);
+				signatureInputs.push_back({ pMessage->Signature, keyIdentifier, ToBuffer(*pMessage), isRootVerified(*pMessage) });
+			}
+
+			return crypto::VerifyMulti(randomFiller, signatureInputs.data(), signatureInputs.size()).first;
+		}
+	}
 
-		auto keyIdentifier = StepIdentifierToBmKeyIdentifier(message.StepIdentifier);
-		if (!crypto::Verify(message.Signature, keyIdentifier, ToBuffer(message)))
-			return std::make_pair(ProcessMessageResult::Failure_Signature, 0);
+	std::vector<bool> VerifyMessageSignatures(
+			const crypto::RandomFiller& randomFiller,
+			const std::vector<const FinalizationMessage*>& messages) {
+		return VerifyMessageSignatures(randomFiller, messages, [](const auto&) {
+			return false;
+		});
+	}
 
-		return std::make_pair(ProcessMessageResult::Success, accountView.Weight.unwrap());
+	std::vector<bool> VerifyMessageSignatures(
+			const crypto::RandomFiller& randomFiller,
+			ParentSignatureCache& parentSignatureCache,
+			const std::vector<const FinalizationMessage*>& messages) {
+		return VerifyMessageSignatures(randomFiller, messages, [&parentSignatureCache](const auto& message) {
+			return parentSignatureCache.contains(message.Signature, message.StepIdentifier.Epoch);
+		});
 	}
 }}
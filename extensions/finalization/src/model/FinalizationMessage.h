@@ -21,13 +21,17 @@
 
 #pragma once
 #include "StepIdentifier.h"
+#include "catapult/crypto/Signer.h"
 #include "catapult/crypto_voting/BmTreeSignature.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/model/TrailingVariableDataLayout.h"
 
 namespace catapult {
 	namespace crypto { class AggregateBmPrivateKeyTree; }
-	namespace model { class FinalizationContext; }
+	namespace model {
+		class FinalizationContext;
+		class ParentSignatureCache;
+	}
 }
 
 namespace catapult { namespace model {
@@ -133,5 +137,28 @@ namespace catapult { namespace model {
 	/// Processes a finalization \a message using \a context.
 	std::pair<ProcessMessageResult, size_t> ProcessMessage(const FinalizationMessage& message, const FinalizationContext& context);
 
+	/// Processes a finalization \a message using \a context given the result of a prior verification of its signature
+	/// (\a isSignatureValid).
+	std::pair<ProcessMessageResult, size_t> ProcessMessage(
+			const FinalizationMessage& message,
+			const FinalizationContext& context,
+			bool isSignatureValid);
+
+	/// Verifies the signatures of all \a messages using \a randomFiller to generate random bytes.
+	/// Returns a vector of bools that indicates the verification result for each message.
+	/// \note All signatures are verified in a single batch, which falls back to verifying individual signatures on failure.
+	std::vector<bool> VerifyMessageSignatures(
+			const crypto::RandomFiller& randomFiller,
+			const std::vector<const FinalizationMessage*>& messages);
+
+	/// Verifies the signatures of all \a messages using \a randomFiller to generate random bytes and skipping parent signatures
+	/// already present in \a parentSignatureCache.
+	/// Returns a vector of bools that indicates the verification result for each message.
+	/// \note Verified parent signatures are not added to \a parentSignatureCache.
+	std::vector<bool> VerifyMessageSignatures(
+			const crypto::RandomFiller& randomFiller,
+			ParentSignatureCache& parentSignatureCache,
+			const std::vector<const FinalizationMessage*>& messages);
+
 	// endregion
 }}
@@ -0,0 +1,93 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ParentSignatureCache.h"
+#include "catapult/utils/Hashers.h"
+
+namespace catapult { namespace model {
+
+	bool ParentSignatureCache::ParentSignatureKey::operator==(const ParentSignatureKey& rhs) const {
+		return RootPublicKey == rhs.RootPublicKey && ParentPublicKey == rhs.ParentPublicKey && Signature == rhs.Signature;
+	}
+
+	size_t ParentSignatureCache::ParentSignatureKeyHasher::operator()(const ParentSignatureKey& key) const {
+		return utils::ArrayHasher<crypto::VotingSignature>()(key.Signature);
+	}
+
+	ParentSignatureCache::ParentSignatureCache(size_t maxSize)
+			: m_maxSize(maxSize)
+			, m_numHits(0)
+			, m_numMisses(0)
+	{}
+
+	size_t ParentSignatureCache::size() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_keys.size();
+	}
+
+	FinalizationEpoch ParentSignatureCache::epoch() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_epoch;
+	}
+
+	uint64_t ParentSignatureCache::numHits() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_numHits;
+	}
+
+	uint64_t ParentSignatureCache::numMisses() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_numMisses;
+	}
+
+	bool ParentSignatureCache::contains(const crypto::BmTreeSignature& signature, FinalizationEpoch epoch) {
+		auto key = ToParentSignatureKey(signature);
+
+		utils::SpinLockGuard guard(m_lock);
+		if (m_epoch != epoch || m_keys.cend() == m_keys.find(key)) {
+			++m_numMisses;
+			return false;
+		}
+
+		++m_numHits;
+		return true;
+	}
+
+	void ParentSignatureCache::add(const crypto::BmTreeSignature& signature, FinalizationEpoch epoch) {
+		auto key = ToParentSignatureKey(signature);
+
+		utils::SpinLockGuard guard(m_lock);
+		if (epoch < m_epoch)
+			return;
+
+		if (epoch > m_epoch) {
+			m_keys.clear();
+			m_epoch = epoch;
+		}
+
+		if (m_keys.size() < m_maxSize)
+			m_keys.insert(key);
+	}
+
+	ParentSignatureCache::ParentSignatureKey ParentSignatureCache::ToParentSignatureKey(const crypto::BmTreeSignature& signature) {
+		return { signature.Root.ParentPublicKey, signature.Bottom.ParentPublicKey, signature.Root.Signature };
+	}
+}}
@@ -0,0 +1,86 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/crypto_voting/BmTreeSignature.h"
+#include "catapult/utils/SpinLock.h"
+#include "catapult/types.h"
+#include <unordered_set>
+
+namespace catapult { namespace model {
+
+	/// Bounded cache of verified parent signatures of Bellare-Miner tree signatures.
+	/// \note All finalization messages sent by a voter in an epoch share the same parent signature,
+	///       which binds the bottom public key to the root public key.
+	class ParentSignatureCache {
+	public:
+		/// Creates a cache that holds at most \a maxSize parent signatures.
+		explicit ParentSignatureCache(size_t maxSize);
+
+	public:
+		/// Gets the number of cached parent signatures.
+		size_t size() const;
+
+		/// Gets the epoch of all cached parent signatures.
+		FinalizationEpoch epoch() const;
+
+		/// Gets the number of lookups that found a verified parent signature.
+		uint64_t numHits() const;
+
+		/// Gets the number of lookups that did not find a verified parent signature.
+		uint64_t numMisses() const;
+
+	public:
+		/// Returns \c true if the parent signature of \a signature has been verified in \a epoch.
+		bool contains(const crypto::BmTreeSignature& signature, FinalizationEpoch epoch);
+
+		/// Adds the (verified) parent signature of \a signature in \a epoch.
+		/// \note Cache is cleared when \a epoch is greater than the current epoch.
+		///       Parent signatures with an epoch less than the current epoch are ignored.
+		void add(const crypto::BmTreeSignature& signature, FinalizationEpoch epoch);
+
+	private:
+		struct ParentSignatureKey {
+		public:
+			VotingKey RootPublicKey;
+			VotingKey ParentPublicKey;
+			crypto::VotingSignature Signature;
+
+		public:
+			bool operator==(const ParentSignatureKey& rhs) const;
+		};
+
+		struct ParentSignatureKeyHasher {
+			size_t operator()(const ParentSignatureKey& key) const;
+		};
+
+	private:
+		static ParentSignatureKey ToParentSignatureKey(const crypto::BmTreeSignature& signature);
+
+	private:
+		size_t m_maxSize;
+		FinalizationEpoch m_epoch;
+		uint64_t m_numHits;
+		uint64_t m_numMisses;
+		std::unordered_set<ParentSignatureKey, ParentSignatureKeyHasher> m_keys;
+		mutable utils::SpinLock m_lock;
+	};
+}}
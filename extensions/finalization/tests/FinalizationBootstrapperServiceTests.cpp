@@ -24,6 +24,7 @@
 #include "finalization/src/io/FilePrevoteChainStorage.h"
 #include "finalization/src/io/ProofStorageCache.h"
 #include "finalization/src/model/FinalizationProofUtils.h"
+#include "finalization/src/model/ParentSignatureCache.h"
 #include "finalization/tests/test/FinalizationBootstrapperServiceTestUtils.h"
 #include "finalization/tests/test/mocks/MockProofStorage.h"
 #include "tests/test/core/BlockTestUtils.h"
@@ -118,6 +119,7 @@ namespace catapult { namespace finalization {
 				config.Size = 3000;
 				config.Threshold = 2000;
 				config.MaxHashesPerPoint = 64;
+				config.MaxCachedParentSignatures = 100;
 				config.VotingSetGrouping = 500;
 				return CreateFinalizationBootstrapperServiceRegistrar(config, std::move(pProofStorage));
 			}
@@ -184,7 +186,7 @@ namespace catapult { namespace finalization {
 
 		// Assert:
 		EXPECT_EQ(Num_Services, context.locator().numServices());
-		EXPECT_EQ(6u, context.locator().counters().size());
+		EXPECT_EQ(9u, context.locator().counters().size());
 
 		// - service
 		const auto& aggregator = GetMultiRoundMessageAggregator(context.locator());
@@ -209,6 +211,27 @@ namespace catapult { namespace finalization {
 		GetFinalizationServerHooks(context.locator());
 	}
 
+	TEST(TEST_CLASS, ParentSignatureCacheServiceIsRegistered) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.boot();
+
+		// Assert:
+		EXPECT_EQ(Num_Services, context.locator().numServices());
+		EXPECT_EQ(9u, context.locator().counters().size());
+
+		// - service
+		const auto& cache = GetParentSignatureCache(context.locator());
+		EXPECT_EQ(0u, cache.size());
+
+		// - counters
+		EXPECT_EQ(0u, context.counter("FIN PSIG SIZE"));
+		EXPECT_EQ(0u, context.counter("FIN PSIG HIT"));
+		EXPECT_EQ(0u, context.counter("FIN PSIG MISS"));
+	}
+
 	TEST(TEST_CLASS, ProofStorageServiceIsRegistered) {
 		// Arrange:
 		TestContext context;
@@ -388,6 +411,27 @@ namespace catapult { namespace finalization {
 		});
 	}
 
+	TEST(TEST_CLASS, MultiRoundMessageAggregatorServiceCachesParentSignaturesOfAcceptedMessages) {
+		// Arrange:
+		RunMultiRoundMessageAggregatorServiceTest([](auto& aggregator, const auto& context, const auto&) {
+			aggregator.modifier().setMaxFinalizationRound({ Finalization_Epoch, FinalizationPoint(15) });
+
+			// Act:
+			auto hash = test::GenerateRandomByteArray<Hash256>();
+			aggregator.modifier().add(context.createMessage(VoterType::Large1, CreateStepIdentifier(12), Height(22), hash));
+			aggregator.modifier().add(context.createMessage(VoterType::Large2, CreateStepIdentifier(15), Height(24), hash));
+
+			// Assert:
+			EXPECT_EQ(2u, context.counter("FIN PSIG SIZE"));
+			EXPECT_EQ(0u, context.counter("FIN PSIG HIT"));
+			EXPECT_EQ(2u, context.counter("FIN PSIG MISS"));
+
+			// - check cache
+			const auto& cache = GetParentSignatureCache(context.locator());
+			EXPECT_EQ(Finalization_Epoch, cache.epoch());
+		});
+	}
+
 	// endregion
 
 	// region FinalizationBootstrapperService - proof storage
@@ -48,6 +48,7 @@ namespace catapult { namespace finalization {
 
 							{ "maxHashesPerPoint", "123" },
 							{ "prevoteBlocksMultiple", "7" },
+							{ "maxCachedParentSignatures", "345" },
 
 							{ "unfinalizedBlocksDuration", "7m" }
 						}
@@ -73,6 +74,7 @@ namespace catapult { namespace finalization {
 
 				EXPECT_EQ(0u, config.MaxHashesPerPoint);
 				EXPECT_EQ(0u, config.PrevoteBlocksMultiple);
+				EXPECT_EQ(0u, config.MaxCachedParentSignatures);
 
 				EXPECT_EQ(utils::BlockSpan(), config.UnfinalizedBlocksDuration);
 
@@ -93,6 +95,7 @@ namespace catapult { namespace finalization {
 
 				EXPECT_EQ(123u, config.MaxHashesPerPoint);
 				EXPECT_EQ(7u, config.PrevoteBlocksMultiple);
+				EXPECT_EQ(345u, config.MaxCachedParentSignatures);
 
 				EXPECT_EQ(utils::BlockSpan::FromMinutes(7), config.UnfinalizedBlocksDuration);
 
@@ -127,6 +130,7 @@ namespace catapult { namespace finalization {
 
 		EXPECT_EQ(256u, config.MaxHashesPerPoint);
 		EXPECT_EQ(4u, config.PrevoteBlocksMultiple);
+		EXPECT_EQ(10'000u, config.MaxCachedParentSignatures);
 
 		EXPECT_EQ(utils::BlockSpan(), config.UnfinalizedBlocksDuration);
 
@@ -21,6 +21,7 @@
 
 #include "finalization/src/chain/FinalizationHashTree.h"
 #include "tests/TestHarness.h"
+#include <set>
 
 namespace catapult { namespace chain {
 
@@ -270,4 +271,94 @@ namespace catapult { namespace chain {
 	}
 
 	// endregion
+
+	// region findIndex / key / parentIndex
+
+	TEST(TEST_CLASS, FindIndexReturnsInvalidIndexForUnknownNode) {
+		// Arrange:
+		RunOverlappingBranchesTest([](const auto& tree, const auto& hashes1, const auto&) {
+			// Act + Assert:
+			EXPECT_EQ(FinalizationHashTree::Invalid_Index, tree.findIndex({ Height(10), hashes1[2] }));
+			EXPECT_EQ(FinalizationHashTree::Invalid_Index, tree.findIndex({ Height(9), test::GenerateRandomByteArray<Hash256>() }));
+		});
+	}
+
+	TEST(TEST_CLASS, FindIndexReturnsIndexesInInsertionOrder) {
+		// Arrange:
+		RunOverlappingBranchesTest([](const auto& tree, const auto& hashes1, const auto& hashes2) {
+			// Act + Assert:
+			EXPECT_EQ(0u, tree.findIndex({ Height(7), hashes1[0] }));
+			EXPECT_EQ(1u, tree.findIndex({ Height(8), hashes1[1] }));
+			EXPECT_EQ(2u, tree.findIndex({ Height(9), hashes1[2] }));
+			EXPECT_EQ(3u, tree.findIndex({ Height(10), hashes1[3] }));
+			EXPECT_EQ(4u, tree.findIndex({ Height(10), hashes2[2] }));
+			EXPECT_EQ(5u, tree.findIndex({ Height(11), hashes2[3] }));
+		});
+	}
+
+	TEST(TEST_CLASS, KeyReturnsKeyOfNode) {
+		// Arrange:
+		RunOverlappingBranchesTest([](const auto& tree, const auto& hashes1, const auto& hashes2) {
+			// Act + Assert:
+			EXPECT_EQ(model::HeightHashPair({ Height(7), hashes1[0] }), tree.key(0));
+			EXPECT_EQ(model::HeightHashPair({ Height(10), hashes1[3] }), tree.key(3));
+			EXPECT_EQ(model::HeightHashPair({ Height(11), hashes2[3] }), tree.key(5));
+		});
+	}
+
+	TEST(TEST_CLASS, ParentIndexReturnsIndexOfParentNode) {
+		// Arrange:
+		RunOverlappingBranchesTest([](const auto& tree, const auto&, const auto&) {
+			// Act + Assert:
+			EXPECT_EQ(FinalizationHashTree::Invalid_Index, tree.parentIndex(0));
+			EXPECT_EQ(0u, tree.parentIndex(1));
+			EXPECT_EQ(1u, tree.parentIndex(2));
+			EXPECT_EQ(2u, tree.parentIndex(3));
+			EXPECT_EQ(2u, tree.parentIndex(4));
+			EXPECT_EQ(4u, tree.parentIndex(5));
+		});
+	}
+
+	TEST(TEST_CLASS, ExistingNodeKeepsOriginalParentWhenAddedWithDifferentParent) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(3);
+
+		FinalizationHashTree tree;
+		tree.addBranch(Height(8), hashes.data() + 1, 2);
+
+		// Act:
+		tree.addBranch(Height(7), hashes.data(), hashes.size());
+
+		// Assert:
+		EXPECT_EQ(3u, tree.size());
+		EXPECT_EQ(FinalizationHashTree::Invalid_Index, tree.parentIndex(tree.findIndex({ Height(8), hashes[1] })));
+		EXPECT_FALSE(tree.isDescendant({ Height(7), hashes[0] }, { Height(9), hashes[2] }));
+	}
+
+	// endregion
+
+	// region findChildIndexes
+
+	TEST(TEST_CLASS, FindChildIndexesReturnsEmptyForLeafNode) {
+		// Arrange:
+		RunOverlappingBranchesTest([](const auto& tree, const auto&, const auto&) {
+			// Act + Assert:
+			EXPECT_TRUE(tree.findChildIndexes(3).empty());
+			EXPECT_TRUE(tree.findChildIndexes(5).empty());
+		});
+	}
+
+	TEST(TEST_CLASS, FindChildIndexesReturnsAllDirectChildren) {
+		// Arrange:
+		RunOverlappingBranchesTest([](const auto& tree, const auto&, const auto&) {
+			// Act:
+			auto childIndexes = tree.findChildIndexes(2);
+
+			// Assert:
+			EXPECT_EQ(std::set<size_t>({ 3, 4 }), std::set<size_t>(childIndexes.cbegin(), childIndexes.cend()));
+			EXPECT_EQ(std::vector<size_t>({ 1 }), tree.findChildIndexes(0));
+		});
+	}
+
+	// endregion
 }}
@@ -0,0 +1,104 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "finalization/src/chain/HeightHashPairIndex.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace chain {
+
+#define TEST_CLASS HeightHashPairIndexTests
+
+	TEST(TEST_CLASS, IndexIsInitiallyEmpty) {
+		// Act:
+		HeightHashPairIndex index;
+
+		// Assert:
+		EXPECT_EQ(0u, index.size());
+		EXPECT_EQ(HeightHashPairIndex::Invalid_Index, index.find({ Height(7), test::GenerateRandomByteArray<Hash256>() }));
+	}
+
+	TEST(TEST_CLASS, CanInsertUnknownKey) {
+		// Arrange:
+		auto key = model::HeightHashPair{ Height(7), test::GenerateRandomByteArray<Hash256>() };
+		HeightHashPairIndex index;
+
+		// Act:
+		auto insertResultPair = index.insert(key);
+
+		// Assert:
+		EXPECT_EQ(std::make_pair(static_cast<size_t>(0), true), insertResultPair);
+		EXPECT_EQ(1u, index.size());
+		EXPECT_EQ(0u, index.find(key));
+		EXPECT_EQ(key, index.key(0));
+	}
+
+	TEST(TEST_CLASS, CannotInsertKnownKey) {
+		// Arrange:
+		auto keys = std::vector<model::HeightHashPair>{
+			{ Height(7), test::GenerateRandomByteArray<Hash256>() },
+			{ Height(8), test::GenerateRandomByteArray<Hash256>() }
+		};
+		HeightHashPairIndex index;
+		index.insert(keys[0]);
+		index.insert(keys[1]);
+
+		// Act:
+		auto insertResultPair = index.insert(keys[1]);
+
+		// Assert:
+		EXPECT_EQ(std::make_pair(static_cast<size_t>(1), false), insertResultPair);
+		EXPECT_EQ(2u, index.size());
+	}
+
+	TEST(TEST_CLASS, FindDistinguishesKeysWithSameHashAtDifferentHeights) {
+		// Arrange:
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		HeightHashPairIndex index;
+		index.insert({ Height(7), hash });
+		index.insert({ Height(9), hash });
+
+		// Act + Assert:
+		EXPECT_EQ(2u, index.size());
+		EXPECT_EQ(0u, index.find({ Height(7), hash }));
+		EXPECT_EQ(HeightHashPairIndex::Invalid_Index, index.find({ Height(8), hash }));
+		EXPECT_EQ(1u, index.find({ Height(9), hash }));
+	}
+
+	TEST(TEST_CLASS, CanInsertManyKeys) {
+		// Arrange: insert enough keys to force multiple rehashes
+		auto hashes = test::GenerateRandomDataVector<Hash256>(1000);
+		HeightHashPairIndex index;
+
+		// Act:
+		for (auto i = 0u; i < hashes.size(); ++i)
+			index.insert({ Height(i + 1), hashes[i] });
+
+		// Assert: indexes are assigned in insertion order and are preserved across rehashes
+		ASSERT_EQ(1000u, index.size());
+		for (auto i = 0u; i < hashes.size(); ++i) {
+			auto key = model::HeightHashPair{ Height(i + 1), hashes[i] };
+			EXPECT_EQ(i, index.find(key)) << i;
+			EXPECT_EQ(key, index.key(i)) << i;
+		}
+
+		EXPECT_EQ(HeightHashPairIndex::Invalid_Index, index.find({ Height(1001), test::GenerateRandomByteArray<Hash256>() }));
+	}
+}}
@@ -354,6 +354,62 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region addAll
+
+	TEST(TEST_CLASS, AddAllCanAddZeroMessages) {
+		// Arrange:
+		TestContext context;
+		context.aggregator().modifier().setMaxFinalizationRound(Default_Max_Round);
+
+		// Act:
+		auto results = context.aggregator().modifier().addAll({});
+
+		// Assert:
+		EXPECT_TRUE(results.empty());
+		EXPECT_EQ(0u, context.aggregator().view().size());
+		EXPECT_EQ(0u, context.roundMessageAggregators().size());
+	}
+
+	TEST(TEST_CLASS, AddAllDelegatesToRoundMessageAggregatorsGroupedByRound) {
+		// Arrange:
+		auto round1 = Default_Min_Round + FinalizationPoint(5);
+		auto round2 = Default_Min_Round;
+
+		TestContext context;
+		context.aggregator().modifier().setMaxFinalizationRound(Default_Max_Round);
+		context.setRoundMessageAggregatorInitializer([round1](auto& roundMessageAggregator) {
+			roundMessageAggregator.setAddResult(round1 == roundMessageAggregator.round()
+					? RoundMessageAggregatorAddResult::Success_Prevote
+					: RoundMessageAggregatorAddResult::Failure_Invalid_Height);
+		});
+
+		// Act:
+		auto results = context.aggregator().modifier().addAll({
+			CreateMessage(round1, Height(150)),
+			CreateMessage(round2, Height(200)),
+			CreateMessage(round1, Height(250)),
+			CreateMessage(Default_Max_Round + FinalizationPoint(1), Height(300)),
+			CreateMessage(round2, Height(350))
+		});
+
+		// Assert:
+		std::vector<RoundMessageAggregatorAddResult> expectedResults{
+			RoundMessageAggregatorAddResult::Success_Prevote,
+			RoundMessageAggregatorAddResult::Failure_Invalid_Height,
+			RoundMessageAggregatorAddResult::Success_Prevote,
+			RoundMessageAggregatorAddResult::Failure_Invalid_Point,
+			RoundMessageAggregatorAddResult::Failure_Invalid_Height
+		};
+		EXPECT_EQ(expectedResults, results);
+
+		EXPECT_EQ(2u, context.aggregator().view().size());
+		ASSERT_EQ(2u, context.roundMessageAggregators().size());
+		for (const auto* pRoundMessageAggregator : context.roundMessageAggregators())
+			EXPECT_EQ(2u, pRoundMessageAggregator->numAddCalls()) << pRoundMessageAggregator->round();
+	}
+
+	// endregion
+
 	// region tryGetRoundContext
 
 	TEST(TEST_CLASS, TryGetRoundContextReturnsNullptrWhenSpecifiedPointIsUnknown) {
@@ -230,6 +230,26 @@ namespace catapult { namespace chain {
 		});
 	}
 
+	TEST(TEST_CLASS, BestPrecommitExistsWhenPendingPrecommitsAreResolvedByPrevote) {
+		// Arrange: votes { 769, 769, *769*, 669 | 100 }, commits { 769, 769, *769*, 0 | 100 }
+		RunTryFindBestPrecommitTest([](auto& context, const auto& hashes) {
+			auto branchHashes = std::vector<Hash256>{ hashes[0], hashes[1], hashes[2], test::GenerateRandomByteArray<Hash256>() };
+			context.acceptPrecommit(Height(10), branchHashes[3], 100);
+
+			// Sanity:
+			AssertUnset(context.tryFindBestPrecommit());
+
+			// Act:
+			context.acceptPrevote(Height(7), branchHashes.data(), branchHashes.size(), 100);
+
+			// Assert:
+			AssertSet(model::HeightHashPair({ Height(9), hashes[2] }), context.tryFindBestPrecommit());
+
+			// Sanity:
+			AssertSet(model::HeightHashPair({ Height(9), hashes[2] }), context.tryFindBestPrevote());
+		});
+	}
+
 	// endregion
 
 	// region tryFindEstimate
@@ -497,6 +517,20 @@ namespace catapult { namespace chain {
 		});
 	}
 
+	TEST(TEST_CLASS, NotCompletableWhenAnyIndirectBestPrevoteDescendantCanReachPrecommitThreshold) {
+		// Arrange:
+		RunTryFindEstimateTest(10, [](auto& context, const auto& hashes1, const auto&, const auto&) {
+			context.acceptPrevote(Height(7), hashes1.data(), 2, 700);
+			context.acceptPrecommit(Height(10), hashes1[3], 400);
+
+			// Act + Assert:
+			EXPECT_FALSE(context.isCompletable());
+
+			// Sanity:
+			AssertSet({ Height(8), hashes1[1] }, context.tryFindEstimate());
+		});
+	}
+
 	TEST(TEST_CLASS, CompletableIgnoresPendingCommits) {
 		// Arrange:
 		RunTryFindEstimateTest(10, [](auto& context, const auto& hashes1, const auto&, const auto&) {
@@ -21,6 +21,7 @@
 
 #include "finalization/src/chain/RoundMessageAggregator.h"
 #include "finalization/src/chain/RoundContext.h"
+#include "finalization/src/model/ParentSignatureCache.h"
 #include "catapult/utils/MemoryUtils.h"
 #include "finalization/tests/test/FinalizationMessageTestUtils.h"
 #include "tests/TestHarness.h"
@@ -40,6 +41,7 @@ namespace catapult { namespace chain {
 			uint64_t MaxResponseSize = 10'000'000;
 			uint32_t MaxHashesPerPoint = 100;
 			uint64_t VotingSetGrouping = 123;
+			model::ParentSignatureCache* pParentSignatureCache = nullptr;
 		};
 
 		class TestContext {
@@ -62,7 +64,9 @@ namespace catapult { namespace chain {
 				});
 
 				m_keyPairDescriptors = std::move(finalizationContextPair.second);
-				m_pAggregator = CreateRoundMessageAggregator(finalizationContextPair.first);
+				m_pAggregator = options.pParentSignatureCache
+						? CreateRoundMessageAggregator(finalizationContextPair.first, *options.pParentSignatureCache)
+						: CreateRoundMessageAggregator(finalizationContextPair.first);
 			}
 
 		public:
@@ -82,6 +86,10 @@ namespace catapult { namespace chain {
 					signMessage(*messages[i], signerIndexes[i]);
 			}
 
+			void signAllMessagesWithSameTree(const std::vector<model::FinalizationMessage*>& messages, size_t signerIndex) const {
+				test::SignAllMessages(messages, m_keyPairDescriptors[signerIndex].VotingKeyPair);
+			}
+
 		private:
 			std::unique_ptr<RoundMessageAggregator> m_pAggregator;
 			std::vector<test::AccountKeyPairDescriptor> m_keyPairDescriptors;
@@ -503,6 +511,242 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region addAll
+
+	namespace {
+		template<typename TTraits>
+		std::shared_ptr<model::FinalizationMessage> CreateSignedMessage(
+				const TestContext& context,
+				uint32_t numHashes,
+				size_t signerIndex) {
+			auto pMessage = utils::UniqueToShared(test::CreateMessage(Last_Finalized_Height + Height(1), numHashes));
+			pMessage->StepIdentifier = { Finalization_Epoch, Finalization_Point, TTraits::Stage };
+			context.signMessage(*pMessage, signerIndex);
+			return pMessage;
+		}
+	}
+
+	TEST(TEST_CLASS, AddAllCanAddZeroMessages) {
+		// Arrange:
+		TestContext context(1000, 700);
+
+		// Act:
+		auto results = context.aggregator().addAll({});
+
+		// Assert:
+		EXPECT_TRUE(results.empty());
+		EXPECT_EQ(0u, context.aggregator().size());
+	}
+
+	PREVOTE_PRECOMIT_TEST(AddAllReturnsResultForEachMessage) {
+		// Arrange:
+		TestContext context(1000, 700);
+		std::vector<std::shared_ptr<model::FinalizationMessage>> messages{
+			CreateSignedMessage<TTraits>(context, 1, 0),
+			CreateSignedMessage<TTraits>(context, 1, 1),
+			CreateSignedMessage<TTraits>(context, 0, 3),
+			CreateSignedMessage<TTraits>(context, 1, 2),
+			CreateSignedMessage<TTraits>(context, 1, 4)
+		};
+
+		// - corrupt the signature of the second message
+		messages[1]->HashesPtr()[0][0] ^= 0xFF;
+
+		// Act:
+		auto results = context.aggregator().addAll(messages);
+
+		// Assert: invalid signature and ineligible signer are both processing failures
+		std::vector<RoundMessageAggregatorAddResult> expectedResults{
+			TTraits::Success_Result,
+			RoundMessageAggregatorAddResult::Failure_Processing,
+			RoundMessageAggregatorAddResult::Failure_Invalid_Hashes,
+			RoundMessageAggregatorAddResult::Failure_Processing,
+			TTraits::Success_Result
+		};
+		EXPECT_EQ(expectedResults, results);
+		EXPECT_EQ(2u, context.aggregator().size());
+	}
+
+	PREVOTE_PRECOMIT_TEST(AddAllCannotAddRedundantOrConflictingMessagesWithinBatch) {
+		// Arrange:
+		TestContext context(1000, 700);
+		auto pMessage = CreateSignedMessage<TTraits>(context, 1, 0);
+		auto pConflictingMessage = CreateSignedMessage<TTraits>(context, 1, 0);
+
+		// Act:
+		auto results = context.aggregator().addAll({ pMessage, pMessage, pConflictingMessage });
+
+		// Assert:
+		std::vector<RoundMessageAggregatorAddResult> expectedResults{
+			TTraits::Success_Result,
+			RoundMessageAggregatorAddResult::Neutral_Redundant,
+			RoundMessageAggregatorAddResult::Failure_Conflicting
+		};
+		EXPECT_EQ(expectedResults, results);
+		EXPECT_EQ(1u, context.aggregator().size());
+	}
+
+	PREVOTE_PRECOMIT_TEST(AddAllCannotAddPreviouslyAddedMessage) {
+		// Arrange:
+		TestContext context(1000, 700);
+		auto pMessage = CreateSignedMessage<TTraits>(context, 1, 0);
+		context.aggregator().add(pMessage);
+
+		// Act:
+		auto results = context.aggregator().addAll({ pMessage });
+
+		// Assert:
+		EXPECT_EQ(std::vector<RoundMessageAggregatorAddResult>{ RoundMessageAggregatorAddResult::Neutral_Redundant }, results);
+		EXPECT_EQ(1u, context.aggregator().size());
+	}
+
+	TEST(TEST_CLASS, AddAllUpdatesRoundContext) {
+		// Arrange: all signers vote for the same hash
+		TestContext context(1000, 700);
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		std::vector<std::shared_ptr<model::FinalizationMessage>> messages;
+		for (auto i = 0u; i < 4; ++i) {
+			auto pMessage = CreateSignedMessage<PrevoteTraits>(context, 1, i);
+			*pMessage->HashesPtr() = hash;
+			context.signMessage(*pMessage, i);
+			messages.push_back(pMessage);
+		}
+
+		// Act:
+		context.aggregator().addAll(messages);
+
+		// Assert: signer 2 is ineligible, so only 4M + 2M + 2M is accepted
+		EXPECT_EQ(3u, context.aggregator().size());
+
+		auto weights = context.aggregator().roundContext().weights({ Last_Finalized_Height + Height(1), hash });
+		EXPECT_EQ(8'000'000u, weights.Prevote);
+		EXPECT_EQ(0u, weights.Precommit);
+	}
+
+	// endregion
+
+	// region parent signature cache
+
+	namespace {
+		TestContextOptions CreateOptions(model::ParentSignatureCache& parentSignatureCache) {
+			TestContextOptions options;
+			options.pParentSignatureCache = &parentSignatureCache;
+			return options;
+		}
+
+		void AssertCache(const model::ParentSignatureCache& cache, size_t size, uint64_t numHits, uint64_t numMisses) {
+			EXPECT_EQ(size, cache.size());
+			EXPECT_EQ(numHits, cache.numHits());
+			EXPECT_EQ(numMisses, cache.numMisses());
+		}
+	}
+
+	PREVOTE_PRECOMIT_TEST(AddWithCacheAddsParentSignaturesOfAcceptedMessages) {
+		// Arrange:
+		model::ParentSignatureCache cache(100);
+		TestContext context(1000, 700, CreateOptions(cache));
+		auto pMessage = CreateSignedMessage<TTraits>(context, 1, 0);
+
+		// Act:
+		auto result = context.aggregator().add(pMessage);
+
+		// Assert:
+		EXPECT_EQ(TTraits::Success_Result, result);
+		AssertCache(cache, 1, 0, 1);
+		EXPECT_TRUE(cache.contains(pMessage->Signature, Finalization_Epoch));
+	}
+
+	PREVOTE_PRECOMIT_TEST(AddWithCacheDoesNotAddParentSignaturesOfRejectedMessages) {
+		// Arrange: signer 2 is ineligible
+		model::ParentSignatureCache cache(100);
+		TestContext context(1000, 700, CreateOptions(cache));
+		auto pInvalidMessage = CreateSignedMessage<TTraits>(context, 1, 0);
+		pInvalidMessage->HashesPtr()[0][0] ^= 0xFF;
+		auto pIneligibleMessage = CreateSignedMessage<TTraits>(context, 1, 2);
+
+		// Act:
+		auto result1 = context.aggregator().add(pInvalidMessage);
+		auto result2 = context.aggregator().add(pIneligibleMessage);
+
+		// Assert:
+		EXPECT_EQ(RoundMessageAggregatorAddResult::Failure_Processing, result1);
+		EXPECT_EQ(RoundMessageAggregatorAddResult::Failure_Processing, result2);
+		AssertCache(cache, 0, 0, 1);
+	}
+
+	PREVOTE_PRECOMIT_TEST(AddAllWithCacheDoesNotVerifySignaturesOfUnprocessableMessages) {
+		// Arrange: signer 2 is ineligible
+		model::ParentSignatureCache cache(100);
+		TestContext context(1000, 700, CreateOptions(cache));
+		std::vector<std::shared_ptr<model::FinalizationMessage>> messages{
+			CreateSignedMessage<TTraits>(context, 1, 2),
+			CreateSignedMessage<TTraits>(context, 1, 1),
+			CreateSignedMessage<TTraits>(context, 1, 3),
+			CreateSignedMessage<TTraits>(context, 1, 0)
+		};
+
+		// - invalidate the padding of the second message and the version of the third message
+		messages[1]->FinalizationMessage_Reserved1 = 1;
+		context.signMessage(*messages[1], 1);
+		messages[2]->Version = model::FinalizationMessage::Current_Version + 1;
+		context.signMessage(*messages[2], 3);
+
+		// Act:
+		auto results = context.aggregator().addAll(messages);
+
+		// Assert: only the signature of the last (processable) message was checked against the cache
+		std::vector<RoundMessageAggregatorAddResult> expectedResults{
+			RoundMessageAggregatorAddResult::Failure_Processing,
+			RoundMessageAggregatorAddResult::Failure_Processing,
+			RoundMessageAggregatorAddResult::Failure_Processing,
+			TTraits::Success_Result
+		};
+		EXPECT_EQ(expectedResults, results);
+		EXPECT_EQ(1u, context.aggregator().size());
+		AssertCache(cache, 1, 0, 1);
+	}
+
+	PREVOTE_PRECOMIT_TEST(AddWithCacheSkipsVerificationOfCachedParentSignatures) {
+		// Arrange: corrupt the root signature and cache it to prove that it is not verified
+		model::ParentSignatureCache cache(100);
+		TestContext context(1000, 700, CreateOptions(cache));
+		auto pMessage = CreateSignedMessage<TTraits>(context, 1, 0);
+		pMessage->Signature.Root.Signature[0] ^= 0xFF;
+		cache.add(pMessage->Signature, Finalization_Epoch);
+
+		// Act:
+		auto result = context.aggregator().add(pMessage);
+
+		// Assert:
+		EXPECT_EQ(TTraits::Success_Result, result);
+		AssertCache(cache, 1, 1, 0);
+	}
+
+	TEST(TEST_CLASS, AddAllWithCacheSkipsVerificationOfParentSignaturesOfPreviouslyAcceptedMessages) {
+		// Arrange:
+		model::ParentSignatureCache cache(100);
+		TestContext context(1000, 700, CreateOptions(cache));
+		std::vector<std::shared_ptr<model::FinalizationMessage>> prevotes;
+		std::vector<std::shared_ptr<model::FinalizationMessage>> precommits;
+		for (auto signerIndex : { 0u, 1u, 3u }) {
+			prevotes.push_back(CreateSignedMessage<PrevoteTraits>(context, 1, signerIndex));
+			precommits.push_back(CreateSignedMessage<PrecommitTraits>(context, 1, signerIndex));
+			context.signAllMessagesWithSameTree({ prevotes.back().get(), precommits.back().get() }, signerIndex);
+		}
+
+		// Act:
+		auto prevoteResults = context.aggregator().addAll(prevotes);
+		auto precommitResults = context.aggregator().addAll(precommits);
+
+		// Assert: all precommit parent signatures were cached by prevotes
+		EXPECT_EQ(std::vector<RoundMessageAggregatorAddResult>(3, RoundMessageAggregatorAddResult::Success_Prevote), prevoteResults);
+		EXPECT_EQ(std::vector<RoundMessageAggregatorAddResult>(3, RoundMessageAggregatorAddResult::Success_Precommit), precommitResults);
+		EXPECT_EQ(6u, context.aggregator().size());
+		AssertCache(cache, 3, 3, 3);
+	}
+
+	// endregion
+
 	// region shortHashes
 
 	namespace {
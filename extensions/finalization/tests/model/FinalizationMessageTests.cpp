@@ -20,7 +20,9 @@
 **/
 
 #include "finalization/src/model/FinalizationMessage.h"
+#include "finalization/src/model/ParentSignatureCache.h"
 #include "catapult/crypto_voting/AggregateBmPrivateKeyTree.h"
+#include "catapult/utils/RandomGenerator.h"
 #include "finalization/tests/test/FinalizationMessageTestUtils.h"
 #include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/HashTestUtils.h"
@@ -459,5 +461,170 @@ namespace catapult { namespace model {
 		});
 	}
 
+
+	TEST(TEST_CLASS, ProcessMessage_PreverifiedFailsWhenSignatureIsInvalid) {
+		// Arrange:
+		RunProcessMessageTest(VoterType::Large, 3, [](const auto& context, const auto&, const auto& message) {
+			// Act: signature is actually valid but was reported as invalid
+			auto processResultPair = ProcessMessage(message, context, false);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Failure_Signature, processResultPair.first);
+			EXPECT_EQ(0u, processResultPair.second);
+		});
+	}
+
+	TEST(TEST_CLASS, ProcessMessage_PreverifiedFailsWhenAccountIsNotVotingEligible) {
+		// Arrange:
+		RunProcessMessageTest(VoterType::Ineligible, 3, [](const auto& context, const auto&, const auto& message) {
+			// Act:
+			auto processResultPair = ProcessMessage(message, context, true);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Failure_Voter, processResultPair.first);
+			EXPECT_EQ(0u, processResultPair.second);
+		});
+	}
+
+	TEST(TEST_CLASS, ProcessMessage_PreverifiedDoesNotVerifySignature) {
+		// Arrange:
+		RunProcessMessageTest(VoterType::Large, 3, [](const auto& context, const auto&, auto& message) {
+			// - corrupt a hash
+			test::FillWithRandomData(message.HashesPtr()[1]);
+
+			// Act: signature is actually invalid but was reported as valid
+			auto processResultPair = ProcessMessage(message, context, true);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Success, processResultPair.first);
+			EXPECT_EQ(Expected_Large_Weight, processResultPair.second);
+		});
+	}
+
+	// endregion
+
+	// region VerifyMessageSignatures
+
+	namespace {
+		crypto::RandomFiller CreateRandomFiller() {
+			return [](auto* pOut, auto count) {
+				utils::LowEntropyRandomGenerator().fill(pOut, count);
+			};
+		}
+
+		void AssertVerifyMessageSignatures(const std::vector<size_t>& corruptedIndexes) {
+			// Arrange:
+			RunFinalizationContextTest([&corruptedIndexes](const auto&, const auto& keyPairDescriptors) {
+				std::vector<std::unique_ptr<FinalizationMessage>> messages;
+				std::vector<const FinalizationMessage*> messagePointers;
+				for (const auto& keyPairDescriptor : keyPairDescriptors) {
+					auto pMessage = CreateMessage(3);
+					pMessage->StepIdentifier = DefaultStepIdentifier();
+					test::SignMessage(*pMessage, keyPairDescriptor.VotingKeyPair);
+					messagePointers.push_back(pMessage.get());
+					messages.push_back(std::move(pMessage));
+				}
+
+				std::vector<bool> expectedResults(messages.size(), true);
+				for (auto index : corruptedIndexes) {
+					test::FillWithRandomData(messages[index]->HashesPtr()[1]);
+					expectedResults[index] = false;
+				}
+
+				// Act:
+				auto results = VerifyMessageSignatures(CreateRandomFiller(), messagePointers);
+
+				// Assert:
+				EXPECT_EQ(expectedResults, results);
+			});
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_CanVerifyZeroMessages) {
+		// Act:
+		auto results = VerifyMessageSignatures(CreateRandomFiller(), {});
+
+		// Assert:
+		EXPECT_TRUE(results.empty());
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_SucceedsWhenAllSignaturesAreValid) {
+		AssertVerifyMessageSignatures({});
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_FailsOnlyMessagesWithInvalidSignatures) {
+		AssertVerifyMessageSignatures({ 1 });
+		AssertVerifyMessageSignatures({ 0, 3 });
+		AssertVerifyMessageSignatures({ 0, 1, 2, 3 });
+	}
+
+	namespace {
+		void RunVerifyMessageSignaturesWithCacheTest(
+				const consumer<std::vector<std::unique_ptr<FinalizationMessage>>&, ParentSignatureCache&>& prepare,
+				const consumer<const std::vector<bool>&, const ParentSignatureCache&>& checkResults) {
+			// Arrange:
+			RunFinalizationContextTest([&prepare, &checkResults](const auto&, const auto& keyPairDescriptors) {
+				std::vector<std::unique_ptr<FinalizationMessage>> messages;
+				std::vector<const FinalizationMessage*> messagePointers;
+				for (const auto& keyPairDescriptor : keyPairDescriptors) {
+					auto pMessage = CreateMessage(3);
+					pMessage->StepIdentifier = DefaultStepIdentifier();
+					test::SignMessage(*pMessage, keyPairDescriptor.VotingKeyPair);
+					messagePointers.push_back(pMessage.get());
+					messages.push_back(std::move(pMessage));
+				}
+
+				ParentSignatureCache cache(100);
+				prepare(messages, cache);
+
+				// Act:
+				auto results = VerifyMessageSignatures(CreateRandomFiller(), cache, messagePointers);
+
+				// Assert:
+				checkResults(results, cache);
+			});
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_WithCache_VerifiesUncachedParentSignatures) {
+		RunVerifyMessageSignaturesWithCacheTest([](auto& messages, const auto&) {
+			messages[1]->Signature.Root.Signature[0] ^= 0xFF;
+		}, [](const auto& results, const auto& cache) {
+			// Assert: parent signatures of verified messages are not added to the cache
+			EXPECT_EQ(std::vector<bool>({ true, false, true, true }), results);
+			EXPECT_EQ(0u, cache.size());
+			EXPECT_EQ(0u, cache.numHits());
+			EXPECT_EQ(4u, cache.numMisses());
+		});
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_WithCache_SkipsVerificationOfCachedParentSignatures) {
+		RunVerifyMessageSignaturesWithCacheTest([](auto& messages, auto& cache) {
+			// corrupt the root signatures of cached messages to prove they are not verified
+			for (auto index : { 1u, 2u }) {
+				messages[index]->Signature.Root.Signature[0] ^= 0xFF;
+				cache.add(messages[index]->Signature, messages[index]->StepIdentifier.Epoch);
+			}
+		}, [](const auto& results, const auto& cache) {
+			EXPECT_EQ(std::vector<bool>(4, true), results);
+			EXPECT_EQ(2u, cache.size());
+			EXPECT_EQ(2u, cache.numHits());
+			EXPECT_EQ(2u, cache.numMisses());
+		});
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_WithCache_VerifiesBottomSignaturesOfCachedParentSignatures) {
+		RunVerifyMessageSignaturesWithCacheTest([](auto& messages, auto& cache) {
+			for (const auto& pMessage : messages)
+				cache.add(pMessage->Signature, pMessage->StepIdentifier.Epoch);
+
+			test::FillWithRandomData(messages[2]->HashesPtr()[1]);
+		}, [](const auto& results, const auto& cache) {
+			EXPECT_EQ(std::vector<bool>({ true, true, false, true }), results);
+			EXPECT_EQ(4u, cache.numHits());
+			EXPECT_EQ(0u, cache.numMisses());
+		});
+	}
+
 	// endregion
 }}
@@ -0,0 +1,198 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "finalization/src/model/ParentSignatureCache.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS ParentSignatureCacheTests
+
+	namespace {
+		crypto::BmTreeSignature CreateRandomSignature() {
+			crypto::BmTreeSignature signature;
+			test::FillWithRandomData(signature);
+			return signature;
+		}
+
+		void AssertCounters(const ParentSignatureCache& cache, uint64_t numHits, uint64_t numMisses) {
+			EXPECT_EQ(numHits, cache.numHits());
+			EXPECT_EQ(numMisses, cache.numMisses());
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyCache) {
+		// Act:
+		ParentSignatureCache cache(10);
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_EQ(FinalizationEpoch(), cache.epoch());
+		AssertCounters(cache, 0, 0);
+	}
+
+	// endregion
+
+	// region add
+
+	TEST(TEST_CLASS, CanAddParentSignatures) {
+		// Arrange:
+		ParentSignatureCache cache(10);
+
+		// Act:
+		for (auto i = 0u; i < 3; ++i)
+			cache.add(CreateRandomSignature(), FinalizationEpoch(5));
+
+		// Assert:
+		EXPECT_EQ(3u, cache.size());
+		EXPECT_EQ(FinalizationEpoch(5), cache.epoch());
+		AssertCounters(cache, 0, 0);
+	}
+
+	TEST(TEST_CLASS, AddingSameParentSignatureIsIdempotent) {
+		// Arrange:
+		ParentSignatureCache cache(10);
+		auto signature = CreateRandomSignature();
+
+		// Act:
+		cache.add(signature, FinalizationEpoch(5));
+		cache.add(signature, FinalizationEpoch(5));
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+	}
+
+	TEST(TEST_CLASS, CannotAddMoreThanMaxSizeParentSignatures) {
+		// Arrange:
+		ParentSignatureCache cache(3);
+		std::vector<crypto::BmTreeSignature> signatures;
+		for (auto i = 0u; i < 5; ++i)
+			signatures.push_back(CreateRandomSignature());
+
+		// Act:
+		for (const auto& signature : signatures)
+			cache.add(signature, FinalizationEpoch(5));
+
+		// Assert: only the first signatures were added
+		EXPECT_EQ(3u, cache.size());
+		for (auto i = 0u; i < signatures.size(); ++i)
+			EXPECT_EQ(i < 3, cache.contains(signatures[i], FinalizationEpoch(5))) << i;
+	}
+
+	TEST(TEST_CLASS, AddingParentSignatureWithGreaterEpochClearsCache) {
+		// Arrange:
+		ParentSignatureCache cache(10);
+		auto signature1 = CreateRandomSignature();
+		auto signature2 = CreateRandomSignature();
+		cache.add(signature1, FinalizationEpoch(5));
+		cache.add(CreateRandomSignature(), FinalizationEpoch(5));
+
+		// Act:
+		cache.add(signature2, FinalizationEpoch(6));
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_EQ(FinalizationEpoch(6), cache.epoch());
+		EXPECT_FALSE(cache.contains(signature1, FinalizationEpoch(5)));
+		EXPECT_TRUE(cache.contains(signature2, FinalizationEpoch(6)));
+	}
+
+	TEST(TEST_CLASS, AddingParentSignatureWithLesserEpochHasNoEffect) {
+		// Arrange:
+		ParentSignatureCache cache(10);
+		auto signature = CreateRandomSignature();
+		cache.add(CreateRandomSignature(), FinalizationEpoch(5));
+
+		// Act:
+		cache.add(signature, FinalizationEpoch(4));
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_EQ(FinalizationEpoch(5), cache.epoch());
+		EXPECT_FALSE(cache.contains(signature, FinalizationEpoch(4)));
+	}
+
+	// endregion
+
+	// region contains
+
+	TEST(TEST_CLASS, ContainsReturnsTrueForCachedParentSignature) {
+		// Arrange:
+		ParentSignatureCache cache(10);
+		auto signature = CreateRandomSignature();
+		cache.add(signature, FinalizationEpoch(5));
+
+		// Act + Assert:
+		EXPECT_TRUE(cache.contains(signature, FinalizationEpoch(5)));
+		AssertCounters(cache, 1, 0);
+	}
+
+	TEST(TEST_CLASS, ContainsIgnoresBottomSignature) {
+		// Arrange:
+		ParentSignatureCache cache(10);
+		auto signature = CreateRandomSignature();
+		cache.add(signature, FinalizationEpoch(5));
+
+		// - bottom signature is different for every message
+		test::FillWithRandomData(signature.Bottom.Signature);
+
+		// Act + Assert:
+		EXPECT_TRUE(cache.contains(signature, FinalizationEpoch(5)));
+		AssertCounters(cache, 1, 0);
+	}
+
+	namespace {
+		void AssertNotContained(const consumer<crypto::BmTreeSignature&>& modifySignature, FinalizationEpoch lookupEpoch) {
+			// Arrange:
+			ParentSignatureCache cache(10);
+			auto signature = CreateRandomSignature();
+			cache.add(signature, FinalizationEpoch(5));
+
+			modifySignature(signature);
+
+			// Act + Assert:
+			EXPECT_FALSE(cache.contains(signature, lookupEpoch));
+			AssertCounters(cache, 0, 1);
+		}
+	}
+
+	TEST(TEST_CLASS, ContainsReturnsFalseForUnknownRootPublicKey) {
+		AssertNotContained([](auto& signature) { test::FillWithRandomData(signature.Root.ParentPublicKey); }, FinalizationEpoch(5));
+	}
+
+	TEST(TEST_CLASS, ContainsReturnsFalseForUnknownParentPublicKey) {
+		AssertNotContained([](auto& signature) { test::FillWithRandomData(signature.Bottom.ParentPublicKey); }, FinalizationEpoch(5));
+	}
+
+	TEST(TEST_CLASS, ContainsReturnsFalseForUnknownParentSignature) {
+		AssertNotContained([](auto& signature) { test::FillWithRandomData(signature.Root.Signature); }, FinalizationEpoch(5));
+	}
+
+	TEST(TEST_CLASS, ContainsReturnsFalseForDifferentEpoch) {
+		AssertNotContained([](const auto&) {}, FinalizationEpoch(4));
+		AssertNotContained([](const auto&) {}, FinalizationEpoch(6));
+	}
+
+	// endregion
+}}
@@ -160,15 +160,21 @@ namespace catapult { namespace test {
 	// region message utils
 
 	void SignMessage(model::FinalizationMessage& message, const crypto::VotingKeyPair& votingKeyPair) {
+		SignAllMessages({ &message }, votingKeyPair);
+	}
+
+	void SignAllMessages(const std::vector<model::FinalizationMessage*>& messages, const crypto::VotingKeyPair& votingKeyPair) {
 		auto storage = mocks::MockSeekableMemoryStream();
 		auto bmOptions = crypto::BmOptions{ { 0 }, { 15 } };
 		auto bmPrivateKeyTree = crypto::BmPrivateKeyTree::Create(CopyKeyPair(votingKeyPair), storage, bmOptions);
 
-		auto keyIdentifier = model::StepIdentifierToBmKeyIdentifier(message.StepIdentifier);
-		message.Signature = bmPrivateKeyTree.sign(keyIdentifier, {
-			reinterpret_cast<const uint8_t*>(&message) + model::FinalizationMessage::Header_Size,
-			message.Size - model::FinalizationMessage::Header_Size
-		});
+		for (auto* pMessage : messages) {
+			auto keyIdentifier = model::StepIdentifierToBmKeyIdentifier(pMessage->StepIdentifier);
+			pMessage->Signature = bmPrivateKeyTree.sign(keyIdentifier, {
+				reinterpret_cast<const uint8_t*>(pMessage) + model::FinalizationMessage::Header_Size,
+				pMessage->Size - model::FinalizationMessage::Header_Size
+			});
+		}
 	}
 
 	void AssertEqualMessage(
@@ -106,6 +106,10 @@ namespace catapult { namespace test {
 	/// Signs \a message with \a votingKeyPair.
 	void SignMessage(model::FinalizationMessage& message, const crypto::VotingKeyPair& votingKeyPair);
 
+	/// Signs all \a messages with a single tree derived from \a votingKeyPair.
+	/// \note Messages with the same epoch will share the same parent signature.
+	void SignAllMessages(const std::vector<model::FinalizationMessage*>& messages, const crypto::VotingKeyPair& votingKeyPair);
+
 	/// Asserts that \a expected and \a actual are equal with optional \a message.
 	void AssertEqualMessage(
 			const model::FinalizationMessage& expected,
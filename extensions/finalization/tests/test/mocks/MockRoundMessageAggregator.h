@@ -103,6 +103,12 @@ namespace catapult { namespace mocks {
 			return m_addResult;
 		}
 
+		std::vector<chain::RoundMessageAggregatorAddResult> addAll(
+				const std::vector<std::shared_ptr<model::FinalizationMessage>>& messages) override {
+			m_numAddCalls += messages.size();
+			return std::vector<chain::RoundMessageAggregatorAddResult>(messages.size(), m_addResult);
+		}
+
 	private:
 		model::FinalizationRound m_round;
 		Height m_height;
@@ -21,6 +21,7 @@
 
 #include "src/HarvestingConfiguration.h"
 #include "src/HarvestingService.h"
+#include "src/UtChangeTracker.h"
 #include "src/ValidateHarvestingConfiguration.h"
 #include "catapult/extensions/ProcessBootstrapper.h"
 
@@ -31,7 +32,17 @@ namespace catapult { namespace harvesting {
 			auto config = HarvestingConfiguration::LoadFromPath(bootstrapper.resourcesPath());
 			ValidateHarvestingConfiguration(config);
 
-			bootstrapper.extensionManager().addServiceRegistrar(CreateHarvestingServiceRegistrar(config));
+			// unconfirmed transactions changes are used to incrementally update prepared block templates, which is only
+			// possible when the oldest transactions are selected (fee based selection can reorder all transactions)
+			std::shared_ptr<UtChangeTracker> pUtChangeTracker;
+			const auto& catapultConfig = bootstrapper.config();
+			if (model::TransactionSelectionStrategy::Oldest == catapultConfig.Node.TransactionSelectionStrategy) {
+				// when more changes than fit into a block are not consumed, rebuilding the template is cheaper
+				pUtChangeTracker = std::make_shared<UtChangeTracker>(catapultConfig.BlockChain.MaxTransactionsPerBlock);
+				bootstrapper.subscriptionManager().addUtChangeSubscriber(CreateUtChangeTrackerSubscriber(pUtChangeTracker));
+			}
+
+			bootstrapper.extensionManager().addServiceRegistrar(CreateHarvestingServiceRegistrar(config, pUtChangeTracker));
 		}
 	}
 }}
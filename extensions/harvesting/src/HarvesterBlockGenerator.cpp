@@ -22,6 +22,8 @@
 #include "HarvesterBlockGenerator.h"
 #include "HarvestingUtFacadeFactory.h"
 #include "TransactionsInfoSupplier.h"
+#include "UtChangeTracker.h"
+#include "catapult/model/FeeUtils.h"
 #include "catapult/model/TransactionPlugin.h"
 
 namespace catapult { namespace harvesting {
@@ -40,6 +42,12 @@ namespace catapult { namespace harvesting {
 			// generate the block
 			return facade.commit(blockHeader);
 		}
+
+		cache::EmbeddedCountRetriever CreateEmbeddedCountRetriever(const model::TransactionRegistry& transactionRegistry) {
+			return [&transactionRegistry](const auto& transaction) {
+				return 1 + transactionRegistry.findPlugin(transaction.Type)->embeddedCount(transaction);
+			};
+		}
 	}
 
 	BlockGenerator CreateHarvesterBlockGenerator(
@@ -47,10 +55,7 @@ namespace catapult { namespace harvesting {
 			const model::TransactionRegistry& transactionRegistry,
 			const HarvestingUtFacadeFactory& utFacadeFactory,
 			const cache::ReadWriteUtCache& utCache) {
-		auto countRetriever = [&transactionRegistry](const auto& transaction) {
-			return 1 + transactionRegistry.findPlugin(transaction.Type)->embeddedCount(transaction);
-		};
-
+		auto countRetriever = CreateEmbeddedCountRetriever(transactionRegistry);
 		auto transactionsInfoSupplier = CreateTransactionsInfoSupplier(strategy, countRetriever, utCache);
 		return [utFacadeFactory, transactionsInfoSupplier](const auto& blockHeader, auto maxTransactionsPerBlock) {
 			// 1. check height consistency
@@ -75,4 +80,213 @@ namespace catapult { namespace harvesting {
 			return pBlock;
 		};
 	}
+
+	// region BlockTemplateGenerator::Impl
+
+	class BlockTemplateGenerator::Impl {
+	public:
+		Impl(
+				model::TransactionSelectionStrategy strategy,
+				const model::TransactionRegistry& transactionRegistry,
+				const HarvestingUtFacadeFactory& utFacadeFactory,
+				const cache::ReadWriteUtCache& utCache,
+				const std::shared_ptr<UtChangeTracker>& pUtChangeTracker)
+				: m_strategy(strategy)
+				, m_countRetriever(CreateEmbeddedCountRetriever(transactionRegistry))
+				, m_utFacadeFactory(utFacadeFactory)
+				, m_utCache(utCache)
+				, m_pUtChangeTracker(pUtChangeTracker)
+				, m_transactionsInfoSupplier(CreateTransactionsInfoSupplier(strategy, m_countRetriever, utCache))
+				, m_fallbackGenerator(CreateHarvesterBlockGenerator(strategy, transactionRegistry, utFacadeFactory, utCache))
+				, m_maxTransactionsPerBlock(0)
+				, m_numTransactions(0)
+		{}
+
+	public:
+		void prepare(Timestamp blockTime, uint32_t maxTransactionsPerBlock) {
+			// 1. discard template when it cannot be incrementally updated
+			auto changes = m_pUtChangeTracker->consume();
+			if (m_pUtFacade && !canUpdate(blockTime, maxTransactionsPerBlock, changes))
+				reset();
+
+			// 2. relock template (this fails when the chain has changed since the template was created)
+			if (m_pUtFacade && !m_pUtFacade->tryLock())
+				reset();
+
+			// 3. build a new template or append new transactions to the existing one
+			if (!m_pUtFacade)
+				build(blockTime, maxTransactionsPerBlock);
+			else if (!changes.AddedHashes.empty())
+				append(changes.AddedHashes);
+
+			// 4. release cache locks so that the chain can be modified between harvesting attempts
+			m_pUtFacade->unlock();
+		}
+
+		std::unique_ptr<model::Block> generate(const model::BlockHeader& blockHeader, uint32_t maxTransactionsPerBlock) {
+			if (!tryLockTemplate(blockHeader, maxTransactionsPerBlock)) {
+				reset();
+				return m_fallbackGenerator(blockHeader, maxTransactionsPerBlock);
+			}
+
+			auto pUtFacade = std::move(m_pUtFacade);
+			auto transactionsInfo = std::move(m_transactionsInfo);
+			reset();
+
+			CATAPULT_LOG(debug) << "generating block at height " << blockHeader.Height << " from prepared block template";
+			auto pBlock = GenerateBlock(*pUtFacade, blockHeader, transactionsInfo);
+			if (!pBlock) {
+				CATAPULT_LOG(warning) << "failed to generate harvested block";
+				return std::unique_ptr<model::Block>();
+			}
+
+			return pBlock;
+		}
+
+		void discard() {
+			reset();
+			m_pUtChangeTracker->consume();
+		}
+
+	private:
+		bool canUpdate(Timestamp blockTime, uint32_t maxTransactionsPerBlock, const UtChanges& changes) const {
+			if (changes.HasOverflowed || maxTransactionsPerBlock != m_maxTransactionsPerBlock || hasExpiredTransactions(blockTime))
+				return false;
+
+			for (const auto& hash : changes.RemovedHashes) {
+				if (m_transactionHashes.cend() != m_transactionHashes.find(hash))
+					return false;
+			}
+
+			// only transactions selected by age can be appended without changing the order of previously selected transactions
+			return changes.AddedHashes.empty() || model::TransactionSelectionStrategy::Oldest == m_strategy;
+		}
+
+		bool hasExpiredTransactions(Timestamp blockTime) const {
+			return std::any_of(m_transactionsInfo.Transactions.cbegin(), m_transactionsInfo.Transactions.cend(), [blockTime](
+					const auto& pTransaction) {
+				return blockTime > pTransaction->Deadline;
+			});
+		}
+
+		bool tryLockTemplate(const model::BlockHeader& blockHeader, uint32_t maxTransactionsPerBlock) {
+			if (!m_pUtFacade || m_blockTime > blockHeader.Timestamp)
+				return false;
+
+			// template is not updated with added transactions, but it must not contain any removed or expired ones
+			auto changes = m_pUtChangeTracker->consume();
+			changes.AddedHashes.clear();
+			if (!canUpdate(blockHeader.Timestamp, maxTransactionsPerBlock, changes))
+				return false;
+
+			return m_pUtFacade->tryLock() && blockHeader.Height == m_pUtFacade->height();
+		}
+
+		void build(Timestamp blockTime, uint32_t maxTransactionsPerBlock) {
+			m_pUtFacade = m_utFacadeFactory.create(blockTime);
+			m_transactionsInfo = m_transactionsInfoSupplier(*m_pUtFacade, maxTransactionsPerBlock);
+			m_blockTime = blockTime;
+			m_maxTransactionsPerBlock = maxTransactionsPerBlock;
+
+			for (const auto& pTransaction : m_transactionsInfo.Transactions)
+				m_numTransactions += m_countRetriever(*pTransaction);
+
+			m_transactionHashes.insert(m_transactionsInfo.TransactionHashes.cbegin(), m_transactionsInfo.TransactionHashes.cend());
+		}
+
+		void append(const utils::HashSet& addedHashes) {
+			// new transactions are the youngest, so they are visited last in insertion order
+			auto numAppendedTransactions = 0u;
+			auto utCacheView = m_utCache.view();
+			utCacheView.forEach([this, &addedHashes, &numAppendedTransactions](const auto& transactionInfo) {
+				const auto& hash = transactionInfo.EntityHash;
+				if (addedHashes.cend() == addedHashes.find(hash) || m_transactionHashes.cend() != m_transactionHashes.find(hash))
+					return true;
+
+				auto numTransactions = m_countRetriever(*transactionInfo.pEntity);
+				if (m_numTransactions + numTransactions > m_maxTransactionsPerBlock)
+					return false;
+
+				if (m_pUtFacade->apply(transactionInfo)) {
+					m_numTransactions += numTransactions;
+					m_transactionHashes.insert(hash);
+					m_transactionsInfo.Transactions.push_back(transactionInfo.pEntity);
+					m_transactionsInfo.TransactionHashes.push_back(hash);
+					++numAppendedTransactions;
+				}
+
+				return true;
+			});
+
+			if (0 == numAppendedTransactions)
+				return;
+
+			// pick the smallest multiplier so that all transactions pass validation
+			std::vector<const model::TransactionInfo*> transactionInfoPointers;
+			for (const auto& transactionInfo : m_pUtFacade->transactionInfos()) {
+				transactionInfoPointers.push_back(&transactionInfo);
+
+				auto maxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*transactionInfo.pEntity);
+				if (1 == transactionInfoPointers.size() || maxFeeMultiplier < m_transactionsInfo.FeeMultiplier)
+					m_transactionsInfo.FeeMultiplier = maxFeeMultiplier;
+			}
+
+			model::CalculateBlockTransactionsHash(transactionInfoPointers, m_transactionsInfo.TransactionsHash);
+			CATAPULT_LOG(trace) << "appended " << numAppendedTransactions << " transactions to block template";
+		}
+
+		void reset() {
+			m_pUtFacade.reset();
+			m_transactionsInfo = TransactionsInfo();
+			m_transactionHashes.clear();
+			m_numTransactions = 0;
+		}
+
+	private:
+		model::TransactionSelectionStrategy m_strategy;
+		cache::EmbeddedCountRetriever m_countRetriever;
+		HarvestingUtFacadeFactory m_utFacadeFactory;
+		const cache::ReadWriteUtCache& m_utCache;
+		std::shared_ptr<UtChangeTracker> m_pUtChangeTracker;
+		TransactionsInfoSupplier m_transactionsInfoSupplier;
+		BlockGenerator m_fallbackGenerator;
+
+		std::unique_ptr<HarvestingUtFacade> m_pUtFacade;
+		TransactionsInfo m_transactionsInfo;
+		Timestamp m_blockTime;
+		uint32_t m_maxTransactionsPerBlock;
+		uint32_t m_numTransactions;
+		utils::HashSet m_transactionHashes;
+	};
+
+	// endregion
+
+	// region BlockTemplateGenerator
+
+	BlockTemplateGenerator::BlockTemplateGenerator(
+			model::TransactionSelectionStrategy strategy,
+			const model::TransactionRegistry& transactionRegistry,
+			const HarvestingUtFacadeFactory& utFacadeFactory,
+			const cache::ReadWriteUtCache& utCache,
+			const std::shared_ptr<UtChangeTracker>& pUtChangeTracker)
+			: m_pImpl(std::make_unique<Impl>(strategy, transactionRegistry, utFacadeFactory, utCache, pUtChangeTracker))
+	{}
+
+	BlockTemplateGenerator::~BlockTemplateGenerator() = default;
+
+	void BlockTemplateGenerator::prepare(Timestamp blockTime, uint32_t maxTransactionsPerBlock) {
+		m_pImpl->prepare(blockTime, maxTransactionsPerBlock);
+	}
+
+	void BlockTemplateGenerator::discard() {
+		m_pImpl->discard();
+	}
+
+	std::unique_ptr<model::Block> BlockTemplateGenerator::generate(
+			const model::BlockHeader& blockHeader,
+			uint32_t maxTransactionsPerBlock) {
+		return m_pImpl->generate(blockHeader, maxTransactionsPerBlock);
+	}
+
+	// endregion
 }}
@@ -25,7 +25,10 @@
 
 namespace catapult {
 	namespace cache { class ReadWriteUtCache; }
-	namespace harvesting { class HarvestingUtFacadeFactory; }
+	namespace harvesting {
+		class HarvestingUtFacadeFactory;
+		class UtChangeTracker;
+	}
 }
 
 namespace catapult { namespace harvesting {
@@ -40,4 +43,41 @@ namespace catapult { namespace harvesting {
 			const model::TransactionRegistry& transactionRegistry,
 			const HarvestingUtFacadeFactory& utFacadeFactory,
 			const cache::ReadWriteUtCache& utCache);
+
+	/// Block generator that keeps a block template with pre-applied transactions between harvesting attempts.
+	/// \note Template is incrementally updated as unconfirmed transactions change and is rebuilt when the chain changes.
+	///       Templates can only be extended with added transactions when the oldest transactions are selected,
+	///       so they are rebuilt after any addition when using other strategies.
+	class BlockTemplateGenerator {
+	public:
+		/// Creates a generator around \a transactionRegistry, \a utFacadeFactory, \a utCache and \a pUtChangeTracker
+		/// for specified transaction \a strategy.
+		BlockTemplateGenerator(
+				model::TransactionSelectionStrategy strategy,
+				const model::TransactionRegistry& transactionRegistry,
+				const HarvestingUtFacadeFactory& utFacadeFactory,
+				const cache::ReadWriteUtCache& utCache,
+				const std::shared_ptr<UtChangeTracker>& pUtChangeTracker);
+
+		/// Destroys the generator.
+		~BlockTemplateGenerator();
+
+	public:
+		/// Prepares a block template for the next block at \a blockTime containing at most \a maxTransactionsPerBlock transactions.
+		/// \note Cache locks are only held during preparation.
+		void prepare(Timestamp blockTime, uint32_t maxTransactionsPerBlock);
+
+		/// Discards the prepared block template and all tracked unconfirmed transactions changes.
+		void discard();
+
+		/// Generates a block from a seed block header (\a blockHeader) containing at most \a maxTransactionsPerBlock transactions.
+		/// \note Prepared block template is used when it is compatible with \a blockHeader.
+		std::unique_ptr<model::Block> generate(const model::BlockHeader& blockHeader, uint32_t maxTransactionsPerBlock);
+
+	private:
+		class Impl;
+
+	private:
+		std::unique_ptr<Impl> m_pImpl;
+	};
 }}
@@ -25,6 +25,7 @@
 #include "ScheduledHarvesterTask.h"
 #include "UnlockedAccounts.h"
 #include "UnlockedAccountsUpdater.h"
+#include "UtChangeTracker.h"
 #include "catapult/cache_core/ImportanceView.h"
 #include "catapult/cache_tx/MemoryUtCache.h"
 #include "catapult/config/CatapultKeys.h"
@@ -104,7 +105,10 @@ namespace catapult { namespace harvesting {
 
 		// region harvesting task
 
-		ScheduledHarvesterTaskOptions CreateHarvesterTaskOptions(extensions::ServiceState& state) {
+		ScheduledHarvesterTaskOptions CreateHarvesterTaskOptions(
+				extensions::ServiceState& state,
+				const UnlockedAccounts& unlockedAccounts,
+				const std::shared_ptr<BlockTemplateGenerator>& pBlockTemplateGenerator) {
 			ScheduledHarvesterTaskOptions options;
 			options.HarvestingAllowed = state.hooks().chainSyncedPredicate();
 			options.LastBlockElementSupplier = [&storage = state.storage()]() {
@@ -113,13 +117,25 @@ namespace catapult { namespace harvesting {
 			};
 			options.TimeSupplier = state.timeSupplier();
 			options.RangeConsumer = state.hooks().completionAwareBlockRangeConsumerFactory()(disruptor::InputSource::Local);
+			if (!pBlockTemplateGenerator)
+				return options;
+
+			auto maxTransactionsPerBlock = state.config().BlockChain.MaxTransactionsPerBlock;
+			options.NextBlockPreparer = [&unlockedAccounts, pBlockTemplateGenerator, maxTransactionsPerBlock](auto timestamp) {
+				// only spend time preparing a block template when there is an account that can harvest it
+				if (0 != unlockedAccounts.view().size())
+					pBlockTemplateGenerator->prepare(timestamp, maxTransactionsPerBlock);
+				else
+					pBlockTemplateGenerator->discard();
+			};
 			return options;
 		}
 
 		thread::Task CreateHarvestingTask(
 				extensions::ServiceState& state,
 				const UnlockedAccountsHolder& unlockedAccountsHolder,
-				const Address& beneficiaryAddress) {
+				const Address& beneficiaryAddress,
+				const std::shared_ptr<UtChangeTracker>& pUtChangeTracker) {
 			auto strategy = state.config().Node.TransactionSelectionStrategy;
 			const auto& transactionRegistry = state.pluginManager().transactionRegistry();
 			const auto& utCache = const_cast<const extensions::ServiceState&>(state).utCache();
@@ -133,9 +149,21 @@ namespace catapult { namespace harvesting {
 			});
 
 			auto pUnlockedAccounts = unlockedAccountsHolder.pUnlockedAccounts;
+			std::shared_ptr<BlockTemplateGenerator> pBlockTemplateGenerator;
 			auto blockGenerator = CreateHarvesterBlockGenerator(strategy, transactionRegistry, utFacadeFactory, utCache);
+			if (pUtChangeTracker) {
+				pBlockTemplateGenerator = std::make_shared<BlockTemplateGenerator>(
+						strategy,
+						transactionRegistry,
+						utFacadeFactory,
+						utCache,
+						pUtChangeTracker);
+				blockGenerator = [pBlockTemplateGenerator](const auto& blockHeader, auto maxTransactionsPerBlock) {
+					return pBlockTemplateGenerator->generate(blockHeader, maxTransactionsPerBlock);
+				};
+			}
 			auto pHarvesterTask = std::make_shared<ScheduledHarvesterTask>(
-					CreateHarvesterTaskOptions(state),
+					CreateHarvesterTaskOptions(state, *pUnlockedAccounts, pBlockTemplateGenerator),
 					std::make_unique<Harvester>(cache, blockChainConfig, beneficiaryAddress, *pUnlockedAccounts, blockGenerator));
 
 			auto pUnlockedAccountsUpdater = unlockedAccountsHolder.pUnlockedAccountsUpdater;
@@ -185,7 +213,9 @@ namespace catapult { namespace harvesting {
 
 		class HarvestingServiceRegistrar : public extensions::ServiceRegistrar {
 		public:
-			explicit HarvestingServiceRegistrar(const HarvestingConfiguration& config) : m_config(config)
+			HarvestingServiceRegistrar(const HarvestingConfiguration& config, const std::shared_ptr<UtChangeTracker>& pUtChangeTracker)
+					: m_config(config)
+					, m_pUtChangeTracker(pUtChangeTracker)
 			{}
 
 			extensions::ServiceRegistrarInfo info() const override {
@@ -204,7 +234,11 @@ namespace catapult { namespace harvesting {
 				locator.registerRootedService("unlockedAccounts", unlockedAccountsHolder.pUnlockedAccounts);
 
 				// add tasks
-				state.tasks().push_back(CreateHarvestingTask(state, unlockedAccountsHolder, m_config.BeneficiaryAddress));
+				state.tasks().push_back(CreateHarvestingTask(
+						state,
+						unlockedAccountsHolder,
+						m_config.BeneficiaryAddress,
+						m_pUtChangeTracker));
 
 				if (IsDiagnosticExtensionEnabled(state.config().Extensions))
 					RegisterDiagnosticUnlockedAccountsHandler(state, *unlockedAccountsHolder.pUnlockedAccounts);
@@ -212,10 +246,13 @@ namespace catapult { namespace harvesting {
 
 		private:
 			HarvestingConfiguration m_config;
+			std::shared_ptr<UtChangeTracker> m_pUtChangeTracker;
 		};
 	}
 
-	DECLARE_SERVICE_REGISTRAR(Harvesting)(const HarvestingConfiguration& config) {
-		return std::make_unique<HarvestingServiceRegistrar>(config);
+	DECLARE_SERVICE_REGISTRAR(Harvesting)(
+			const HarvestingConfiguration& config,
+			const std::shared_ptr<UtChangeTracker>& pUtChangeTracker) {
+		return std::make_unique<HarvestingServiceRegistrar>(config, pUtChangeTracker);
 	}
 }}
@@ -23,9 +23,12 @@
 #include "HarvestingConfiguration.h"
 #include "catapult/extensions/ServiceRegistrar.h"
 
+namespace catapult { namespace harvesting { class UtChangeTracker; } }
+
 namespace catapult { namespace harvesting {
 
-	/// Creates a registrar for a harvesting service around \a config.
+	/// Creates a registrar for a harvesting service around \a config and \a pUtChangeTracker.
+	/// \note Block templates are only prepared when \a pUtChangeTracker is not \c nullptr.
 	/// \note This service is responsible for enabling node harvesting.
-	DECLARE_SERVICE_REGISTRAR(Harvesting)(const HarvestingConfiguration& config);
+	DECLARE_SERVICE_REGISTRAR(Harvesting)(const HarvestingConfiguration& config, const std::shared_ptr<UtChangeTracker>& pUtChangeTracker);
 }}
@@ -86,23 +86,43 @@ namespace catapult { namespace harvesting {
 		class CacheFacade {
 		public:
 			explicit CacheFacade(const cache::CatapultCache& cache)
-					: m_cacheDetachableDelta(cache.createDetachableDelta())
-					, m_cacheDetachedDelta(m_cacheDetachableDelta.detach())
+					: m_pCacheDetachableDelta(std::make_unique<cache::CatapultCacheDetachableDelta>(cache.createDetachableDelta()))
+					, m_cacheDetachedDelta(m_pCacheDetachableDelta->detach())
+					, m_cacheHeight(m_pCacheDetachableDelta->height())
 					, m_pCacheDelta(m_cacheDetachedDelta.tryLock())
 			{}
 
 		public:
-			Height height() {
-				return m_cacheDetachableDelta.height();
+			Height height() const {
+				return m_cacheHeight;
 			}
 
 			cache::CatapultCacheDelta& delta() {
+				if (!m_pCacheDelta)
+					CATAPULT_THROW_RUNTIME_ERROR("facade cache is not locked");
+
 				return *m_pCacheDelta;
 			}
 
+		public:
+			void unlock() {
+				// release the delta before the height view so that locks are released in reverse order of acquisition
+				m_pCacheDelta.reset();
+				m_pCacheDetachableDelta.reset();
+			}
+
+			bool tryLock() {
+				// detached delta retains all changes and fails to lock when any sub cache has been committed since detaching
+				if (!m_pCacheDelta)
+					m_pCacheDelta = m_cacheDetachedDelta.tryLock();
+
+				return !!m_pCacheDelta;
+			}
+
 		private:
-			cache::CatapultCacheDetachableDelta m_cacheDetachableDelta;
+			std::unique_ptr<cache::CatapultCacheDetachableDelta> m_pCacheDetachableDelta;
 			cache::CatapultCacheDetachedDelta m_cacheDetachedDelta;
+			Height m_cacheHeight;
 			std::unique_ptr<cache::CatapultCacheDelta> m_pCacheDelta;
 		};
 
@@ -132,6 +152,15 @@ namespace catapult { namespace harvesting {
 			return m_cacheHeight + Height(1);
 		}
 
+		void unlock() {
+			if (m_pCacheFacade)
+				m_pCacheFacade->unlock();
+		}
+
+		bool tryLock() {
+			return m_pCacheFacade && m_pCacheFacade->tryLock();
+		}
+
 	public:
 		bool apply(const model::TransactionInfo& transactionInfo) {
 			auto originalSource = m_blockStatementBuilder.source();
@@ -343,6 +372,14 @@ namespace catapult { namespace harvesting {
 		return pBlock;
 	}
 
+	void HarvestingUtFacade::unlock() {
+		m_pImpl->unlock();
+	}
+
+	bool HarvestingUtFacade::tryLock() {
+		return m_pImpl->tryLock();
+	}
+
 	// endregion
 
 	// region HarvestingUtFacadeFactory
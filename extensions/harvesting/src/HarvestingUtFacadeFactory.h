@@ -64,6 +64,15 @@ namespace catapult { namespace harvesting {
 		/// Commits all transactions into a block with specified seed header (\a blockHeader).
 		std::unique_ptr<model::Block> commit(const model::BlockHeader& blockHeader);
 
+	public:
+		/// Releases all cache locks held by the facade.
+		/// \note Applied transactions are preserved and the facade can be used again after it is successfully relocked.
+		void unlock();
+
+		/// Attempts to reacquire cache locks released by unlock.
+		/// \note \c false is returned when the cache has been modified since the facade was created.
+		bool tryLock();
+
 	private:
 		class Impl;
 
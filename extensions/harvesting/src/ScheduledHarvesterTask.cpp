@@ -29,6 +29,7 @@ namespace catapult { namespace harvesting {
 			, m_lastBlockElementSupplier(options.LastBlockElementSupplier)
 			, m_timeSupplier(options.TimeSupplier)
 			, m_rangeConsumer(options.RangeConsumer)
+			, m_nextBlockPreparer(options.NextBlockPreparer)
 			, m_pHarvester(std::move(pHarvester))
 			, m_pIsAnyHarvestedBlockPending(std::make_shared<std::atomic_bool>(false))
 	{}
@@ -38,9 +39,15 @@ namespace catapult { namespace harvesting {
 			return;
 
 		auto pLastBlockElement = m_lastBlockElementSupplier();
-		auto pBlock = m_pHarvester->harvest(*pLastBlockElement, m_timeSupplier());
-		if (!pBlock)
+		auto timestamp = m_timeSupplier();
+		auto pBlock = m_pHarvester->harvest(*pLastBlockElement, timestamp);
+		if (!pBlock) {
+			// use time between harvesting attempts to prepare the next block
+			if (m_nextBlockPreparer)
+				m_nextBlockPreparer(timestamp);
+
 			return;
+		}
 
 		CATAPULT_LOG(info) << "successfully harvested block at " << pBlock->Height << " with signer " << pBlock->SignerPublicKey;
 		*m_pIsAnyHarvestedBlockPending = true;
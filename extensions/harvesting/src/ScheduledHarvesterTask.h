@@ -43,6 +43,9 @@ namespace catapult { namespace harvesting {
 
 		/// Consumes a range consisting of the harvested block, usually delivers it to the disruptor queue.
 		consumer<model::BlockRange&&, const disruptor::ProcessingCompleteFunc&> RangeConsumer;
+
+		/// Prepares the next block given the current network time after a harvesting attempt did not create a block (optional).
+		consumer<Timestamp> NextBlockPreparer;
 	};
 
 	/// Class that lets a harvester create a block and supplies the block to a consumer.
@@ -64,6 +67,7 @@ namespace catapult { namespace harvesting {
 		const decltype(TaskOptions::LastBlockElementSupplier) m_lastBlockElementSupplier;
 		const decltype(TaskOptions::TimeSupplier) m_timeSupplier;
 		const decltype(TaskOptions::RangeConsumer) m_rangeConsumer;
+		const decltype(TaskOptions::NextBlockPreparer) m_nextBlockPreparer;
 		std::unique_ptr<Harvester> m_pHarvester;
 
 		std::shared_ptr<std::atomic_bool> m_pIsAnyHarvestedBlockPending;
@@ -29,18 +29,11 @@ namespace catapult { namespace harvesting {
 	namespace {
 		using TransactionInfoPointers = std::vector<const model::TransactionInfo*>;
 
-		enum class SortDirection { Ascending, Descending };
-
-		template<SortDirection Direction>
-		struct MaxFeeMultiplierComparer {
-			bool operator()(const model::TransactionInfo* pLhs, const model::TransactionInfo* pRhs) const {
-				auto lhsMaxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*pLhs->pEntity);
-				auto rhsMaxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*pRhs->pEntity);
-				return SortDirection::Ascending == Direction
-						? lhsMaxFeeMultiplier < rhsMaxFeeMultiplier
-						: lhsMaxFeeMultiplier > rhsMaxFeeMultiplier;
-			}
-		};
+		bool IsMaxFeeMultiplierLess(const model::TransactionInfo* pLhs, const model::TransactionInfo* pRhs) {
+			auto lhsMaxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*pLhs->pEntity);
+			auto rhsMaxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*pRhs->pEntity);
+			return lhsMaxFeeMultiplier < rhsMaxFeeMultiplier;
+		}
 
 		TransactionsInfo ToTransactionsInfo(const TransactionInfoPointers& transactionInfoPointers, BlockFeeMultiplier feeMultiplier) {
 			TransactionsInfo transactionsInfo;
@@ -83,13 +76,13 @@ namespace catapult { namespace harvesting {
 
 		auto GetFirstTransactionInfoPointers(
 				const SupplyInput& input,
-				const predicate<const model::TransactionInfo*, const model::TransactionInfo*>& sortComparer,
+				cache::MaxFeeMultiplierOrder order,
 				const predicate<const model::TransactionInfo&>& filter) {
 			return cache::GetFirstTransactionInfoPointers(
 					input.UtCacheView,
 					input.TransactionLimit,
 					input.EmbeddedCountRetriever,
-					sortComparer,
+					order,
 					filter);
 		}
 
@@ -102,8 +95,7 @@ namespace catapult { namespace harvesting {
 			// 2. pick the smallest multiplier so that all transactions pass validation
 			auto minFeeMultiplier = BlockFeeMultiplier();
 			if (!candidates.empty()) {
-				auto comparer = MaxFeeMultiplierComparer<SortDirection::Ascending>();
-				auto minIter = std::min_element(candidates.cbegin(), candidates.cend(), comparer);
+				auto minIter = std::min_element(candidates.cbegin(), candidates.cend(), IsMaxFeeMultiplierLess);
 				minFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*(*minIter)->pEntity);
 			}
 
@@ -111,9 +103,9 @@ namespace catapult { namespace harvesting {
 		}
 
 		TransactionsInfo SupplyMinimumFee(const SupplyInput& input) {
-			// 1. get all transactions from the ut cache
-			auto comparer = MaxFeeMultiplierComparer<SortDirection::Ascending>();
-			auto candidates = GetFirstTransactionInfoPointers(input, comparer, [&utFacade = input.UtFacade](const auto& transactionInfo) {
+			// 1. get cheapest transactions from the ut cache
+			auto order = cache::MaxFeeMultiplierOrder::Ascending;
+			auto candidates = GetFirstTransactionInfoPointers(input, order, [&utFacade = input.UtFacade](const auto& transactionInfo) {
 				return utFacade.apply(transactionInfo);
 			});
 
@@ -126,10 +118,10 @@ namespace catapult { namespace harvesting {
 		}
 
 		TransactionsInfo SupplyMaximumFee(const SupplyInput& input) {
-			// 1. get all transactions from the ut cache
-			auto comparer = MaxFeeMultiplierComparer<SortDirection::Descending>();
+			// 1. get most expensive transactions from the ut cache
+			auto order = cache::MaxFeeMultiplierOrder::Descending;
 			auto maximizer = TransactionFeeMaximizer();
-			auto candidates = GetFirstTransactionInfoPointers(input, comparer, [&utFacade = input.UtFacade, &maximizer](
+			auto candidates = GetFirstTransactionInfoPointers(input, order, [&utFacade = input.UtFacade, &maximizer](
 					const auto& transactionInfo) {
 				if (!utFacade.apply(transactionInfo))
 					return false;
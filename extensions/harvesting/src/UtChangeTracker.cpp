@@ -0,0 +1,99 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "UtChangeTracker.h"
+
+namespace catapult { namespace harvesting {
+
+	UtChangeTracker::UtChangeTracker(size_t maxChanges) : m_maxChanges(maxChanges)
+	{}
+
+	void UtChangeTracker::add(const model::TransactionInfosSet& transactionInfos) {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		for (const auto& transactionInfo : transactionInfos) {
+			if (checkOverflow())
+				return;
+
+			m_changes.RemovedHashes.erase(transactionInfo.EntityHash);
+			m_changes.AddedHashes.insert(transactionInfo.EntityHash);
+		}
+	}
+
+	void UtChangeTracker::remove(const model::TransactionInfosSet& transactionInfos) {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		for (const auto& transactionInfo : transactionInfos) {
+			if (checkOverflow())
+				return;
+
+			m_changes.AddedHashes.erase(transactionInfo.EntityHash);
+			m_changes.RemovedHashes.insert(transactionInfo.EntityHash);
+		}
+	}
+
+	UtChanges UtChangeTracker::consume() {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		UtChanges changes;
+		std::swap(changes, m_changes);
+		return changes;
+	}
+
+	bool UtChangeTracker::checkOverflow() {
+		if (m_changes.HasOverflowed)
+			return true;
+
+		if (m_changes.AddedHashes.size() + m_changes.RemovedHashes.size() < m_maxChanges)
+			return false;
+
+		// stop tracking individual changes when they are not consumed (e.g. while harvesting is not allowed)
+		m_changes = UtChanges();
+		m_changes.HasOverflowed = true;
+		return true;
+	}
+
+	namespace {
+		class UtChangeTrackerSubscriber : public cache::UtChangeSubscriber {
+		public:
+			explicit UtChangeTrackerSubscriber(const std::shared_ptr<UtChangeTracker>& pUtChangeTracker)
+					: m_pUtChangeTracker(pUtChangeTracker)
+			{}
+
+		public:
+			void notifyAdds(const TransactionInfos& transactionInfos) override {
+				m_pUtChangeTracker->add(transactionInfos);
+			}
+
+			void notifyRemoves(const TransactionInfos& transactionInfos) override {
+				m_pUtChangeTracker->remove(transactionInfos);
+			}
+
+			void flush() override {
+				// nothing to flush
+			}
+
+		private:
+			std::shared_ptr<UtChangeTracker> m_pUtChangeTracker;
+		};
+	}
+
+	std::unique_ptr<cache::UtChangeSubscriber> CreateUtChangeTrackerSubscriber(const std::shared_ptr<UtChangeTracker>& pUtChangeTracker) {
+		return std::make_unique<UtChangeTrackerSubscriber>(pUtChangeTracker);
+	}
+}}
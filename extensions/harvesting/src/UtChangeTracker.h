@@ -0,0 +1,69 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/cache_tx/UtChangeSubscriber.h"
+#include "catapult/utils/ArraySet.h"
+#include <memory>
+#include <mutex>
+
+namespace catapult { namespace harvesting {
+
+	/// Unconfirmed transactions changes.
+	struct UtChanges {
+		/// Hashes of added transactions.
+		utils::HashSet AddedHashes;
+
+		/// Hashes of removed transactions.
+		utils::HashSet RemovedHashes;
+
+		/// \c true if too many changes were made to be tracked individually.
+		bool HasOverflowed = false;
+	};
+
+	/// Collects unconfirmed transactions changes between harvesting attempts.
+	class UtChangeTracker {
+	public:
+		/// Creates a tracker that tracks at most \a maxChanges changes before overflowing.
+		explicit UtChangeTracker(size_t maxChanges);
+
+	public:
+		/// Marks all transactions in \a transactionInfos as added.
+		void add(const model::TransactionInfosSet& transactionInfos);
+
+		/// Marks all transactions in \a transactionInfos as removed.
+		void remove(const model::TransactionInfosSet& transactionInfos);
+
+		/// Gets all changes collected since the last call and resets the tracker.
+		UtChanges consume();
+
+	private:
+		bool checkOverflow();
+
+	private:
+		size_t m_maxChanges;
+		UtChanges m_changes;
+		std::mutex m_mutex;
+	};
+
+	/// Creates an unconfirmed transactions change subscriber that forwards all changes to \a pUtChangeTracker.
+	std::unique_ptr<cache::UtChangeSubscriber> CreateUtChangeTrackerSubscriber(const std::shared_ptr<UtChangeTracker>& pUtChangeTracker);
+}}
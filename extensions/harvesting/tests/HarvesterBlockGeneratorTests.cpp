@@ -21,6 +21,7 @@
 
 #include "harvesting/src/HarvesterBlockGenerator.h"
 #include "harvesting/src/HarvestingUtFacadeFactory.h"
+#include "harvesting/src/UtChangeTracker.h"
 #include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/cache_tx/MemoryUtCache.h"
 #include "catapult/model/BlockUtils.h"
@@ -37,6 +38,8 @@ namespace catapult { namespace harvesting {
 
 	namespace {
 		constexpr auto Cache_Height = Height(7);
+		constexpr auto Transaction_Deadline = Timestamp(1000);
+		constexpr auto Max_Tracked_Changes = 10u;
 
 		// region test context
 
@@ -48,13 +51,15 @@ namespace catapult { namespace harvesting {
 					, m_transactionRegistry(mocks::CreateDefaultTransactionRegistry(mocks::PluginOptionFlags::Contains_Embeddings))
 					, m_utFacadeFactory(m_catapultCache, m_config, m_executionConfig.Config, [](auto) { return Hash256(); })
 					, m_pUtCache(test::CreateSeededMemoryUtCache(0))
-					, m_generator(CreateHarvesterBlockGenerator(strategy, m_transactionRegistry, m_utFacadeFactory, *m_pUtCache)) {
+					, m_generator(CreateHarvesterBlockGenerator(strategy, m_transactionRegistry, m_utFacadeFactory, *m_pUtCache))
+					, m_pUtChangeTracker(std::make_shared<UtChangeTracker>(Max_Tracked_Changes))
+					, m_templateGenerator(strategy, m_transactionRegistry, m_utFacadeFactory, *m_pUtCache, m_pUtChangeTracker) {
 				// add 5 transaction infos to UT cache with multipliers alternating between 10 and 20
 				m_transactionInfos = test::CreateTransactionInfosFromSizeMultiplierPairs({
 					{ 201, 200 }, { 202, 100 }, { 203, 200 }, { 204, 100 }, { 205, 200 }
 				});
 				for (auto& transactionInfo : m_transactionInfos)
-					const_cast<model::Transaction&>(*transactionInfo.pEntity).Type = mocks::MockTransaction::Entity_Type;
+					PrepareMockTransaction(transactionInfo);
 
 				test::AddAll(*m_pUtCache, m_transactionInfos);
 
@@ -100,11 +105,69 @@ namespace catapult { namespace harvesting {
 			}
 
 		public:
+			void prepareTemplate(Timestamp blockTime, uint32_t maxTransactionsPerBlock) {
+				m_templateGenerator.prepare(blockTime, maxTransactionsPerBlock);
+			}
+
+			void discardTemplate() {
+				m_templateGenerator.discard();
+			}
+
+			auto generateFromTemplate(Height blockHeight, Timestamp blockTime, uint32_t maxTransactionsPerBlock) {
+				model::BlockHeader blockHeader;
+				blockHeader.Height = blockHeight;
+				blockHeader.Timestamp = blockTime;
+				return m_templateGenerator.generate(blockHeader, maxTransactionsPerBlock);
+			}
+
+		public:
+			void addTransaction(uint32_t size, uint32_t multiplier, bool shouldTrack) {
+				auto transactionInfos = test::CreateTransactionInfosFromSizeMultiplierPairs({ { size, multiplier } });
+				PrepareMockTransaction(transactionInfos[0]);
+				test::AddAll(*m_pUtCache, transactionInfos);
+
+				if (!shouldTrack)
+					return;
+
+				model::TransactionInfosSet transactionInfosSet;
+				transactionInfosSet.insert(transactionInfos[0].copy());
+				m_pUtChangeTracker->add(transactionInfosSet);
+			}
+
+			void removeTransaction(size_t index) {
+				const auto& transactionInfo = m_transactionInfos[index];
+				m_pUtCache->modifier().remove(transactionInfo.EntityHash);
+
+				model::TransactionInfosSet transactionInfosSet;
+				transactionInfosSet.insert(transactionInfo.copy());
+				m_pUtChangeTracker->remove(transactionInfosSet);
+			}
+
+			void overflowTracker() {
+				// track removals of transactions that are not in the UT cache
+				model::TransactionInfosSet transactionInfosSet;
+				for (const auto& transactionInfo : test::CreateTransactionInfos(Max_Tracked_Changes + 1))
+					transactionInfosSet.insert(transactionInfo.copy());
+
+				m_pUtChangeTracker->remove(transactionInfosSet);
+			}
+
+			void commitCache() {
+				auto cacheDelta = m_catapultCache.createDelta();
+				m_catapultCache.commit(Cache_Height);
+			}
+
 			void setValidationFailure() {
 				m_executionConfig.pValidator->setResult(validators::ValidationResult::Failure);
 			}
 
 		private:
+			static void PrepareMockTransaction(model::TransactionInfo& transactionInfo) {
+				auto& transaction = const_cast<model::Transaction&>(*transactionInfo.pEntity);
+				transaction.Type = mocks::MockTransaction::Entity_Type;
+				transaction.Deadline = Transaction_Deadline;
+			}
+
 			static model::BlockChainConfiguration CreateBlockChainConfiguration() {
 				auto config = model::BlockChainConfiguration::Uninitialized();
 				config.EnableVerifiableState = true;
@@ -127,6 +190,8 @@ namespace catapult { namespace harvesting {
 			HarvestingUtFacadeFactory m_utFacadeFactory;
 			std::unique_ptr<cache::MemoryUtCache> m_pUtCache;
 			BlockGenerator m_generator;
+			std::shared_ptr<UtChangeTracker> m_pUtChangeTracker;
+			BlockTemplateGenerator m_templateGenerator;
 
 			std::vector<model::TransactionInfo> m_transactionInfos;
 			Hash256 m_initialStateHash;
@@ -219,4 +284,225 @@ namespace catapult { namespace harvesting {
 	}
 
 	// endregion
+
+	// region block template - generation
+
+	namespace {
+		std::vector<uint32_t> GetTransactionSizes(const model::Block& block) {
+			std::vector<uint32_t> transactionSizes;
+			for (const auto& transaction : block.Transactions())
+				transactionSizes.push_back(transaction.Size);
+
+			return transactionSizes;
+		}
+
+		void AssertTransactionSizes(const std::vector<uint32_t>& expectedTransactionSizes, const std::unique_ptr<model::Block>& pBlock) {
+			ASSERT_TRUE(!!pBlock);
+			EXPECT_EQ(expectedTransactionSizes, GetTransactionSizes(*pBlock));
+		}
+	}
+
+	TEST(TEST_CLASS, TemplateGenerationFallsBackToDirectGenerationWhenTemplateIsNotPrepared) {
+		// Arrange:
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+
+		// Act:
+		auto pBlock = context.generateFromTemplate(Cache_Height + Height(1), Timestamp(200), 16);
+
+		// Assert:
+		AssertTransactionSizes({ 201, 202, 203, 204 }, pBlock);
+	}
+
+	TEST(TEST_CLASS, TemplateGenerationFailsWhenBlockHeightMismatchDetected) {
+		// Arrange:
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+		context.prepareTemplate(Timestamp(100), 16);
+
+		// Act: use mismatched height
+		auto pBlock = context.generateFromTemplate(Cache_Height, Timestamp(200), 16);
+
+		// Assert:
+		EXPECT_FALSE(!!pBlock);
+	}
+
+	TEST(TEST_CLASS, TemplateGenerationProducesSameBlockAsDirectGeneration) {
+		// Arrange:
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+		context.prepareTemplate(Timestamp(100), 16);
+
+		// Act:
+		auto pBlock = context.generateFromTemplate(Cache_Height + Height(1), Timestamp(200), 16);
+
+		// Assert: 4 (deterministic) transactions should have been added to the block
+		AssertTransactionSizes({ 201, 202, 203, 204 }, pBlock);
+		EXPECT_NE(Hash256(), pBlock->TransactionsHash);
+		EXPECT_EQ(BlockFeeMultiplier(10), pBlock->FeeMultiplier);
+
+		// - state changes are identical to direct generation
+		std::vector<Amount> expectedSurpluses{ Amount(201 * 10), Amount(0), Amount(203 * 10), Amount(0), Amount(0) };
+		EXPECT_EQ(context.calculateExpectedStateHash(expectedSurpluses), pBlock->StateHash);
+		EXPECT_EQ(Hash256(), pBlock->ReceiptsHash);
+	}
+
+	TEST(TEST_CLASS, TemplateGenerationIgnoresUntrackedTransactions) {
+		// Arrange:
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+		context.prepareTemplate(Timestamp(100), 21);
+
+		// - add a transaction that fits into the template without notifying the tracker
+		context.addTransaction(200, 100, false);
+
+		// Act:
+		auto pBlock = context.generateFromTemplate(Cache_Height + Height(1), Timestamp(200), 21);
+
+		// Assert: prepared template was used
+		AssertTransactionSizes({ 201, 202, 203, 204, 205 }, pBlock);
+	}
+
+	TEST(TEST_CLASS, TemplateCanOnlyBeUsedOnce) {
+		// Arrange:
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+		context.prepareTemplate(Timestamp(100), 21);
+		context.addTransaction(200, 100, false);
+		context.generateFromTemplate(Cache_Height + Height(1), Timestamp(200), 21);
+
+		// Act:
+		auto pBlock = context.generateFromTemplate(Cache_Height + Height(1), Timestamp(200), 21);
+
+		// Assert: block was directly generated
+		AssertTransactionSizes({ 201, 202, 203, 204, 205, 200 }, pBlock);
+	}
+
+	// endregion
+
+	// region block template - incremental updates
+
+	TEST(TEST_CLASS, TemplateIsAppendedWithTrackedTransactions_Oldest) {
+		// Arrange:
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+		context.prepareTemplate(Timestamp(100), 22);
+
+		// - add a tracked transaction and update the template
+		context.addTransaction(200, 100, true);
+		context.prepareTemplate(Timestamp(150), 22);
+
+		// - add an untracked transaction
+		context.addTransaction(200, 100, false);
+
+		// Act:
+		auto pBlock = context.generateFromTemplate(Cache_Height + Height(1), Timestamp(200), 22);
+
+		// Assert: tracked transaction was appended to the template
+		AssertTransactionSizes({ 201, 202, 203, 204, 205, 200 }, pBlock);
+		EXPECT_EQ(BlockFeeMultiplier(10), pBlock->FeeMultiplier);
+	}
+
+	TEST(TEST_CLASS, TemplateIsRebuiltWhenTrackedTransactionsAreAdded_MinimizeFee) {
+		// Arrange: template is ordered by ascending fee multiplier
+		TestContext context(model::TransactionSelectionStrategy::Minimize_Fee);
+		context.prepareTemplate(Timestamp(100), 16);
+
+		// - add a tracked transaction with the smallest fee multiplier and update the template
+		context.addTransaction(200, 50, true);
+		context.prepareTemplate(Timestamp(150), 16);
+
+		// - add an untracked transaction with an even smaller fee multiplier
+		context.addTransaction(200, 10, false);
+
+		// Act:
+		auto pBlock = context.generateFromTemplate(Cache_Height + Height(1), Timestamp(200), 16);
+
+		// Assert: template was rebuilt to include the tracked transaction at the start
+		ASSERT_TRUE(!!pBlock);
+		auto transactionSizes = GetTransactionSizes(*pBlock);
+		ASSERT_FALSE(transactionSizes.empty());
+		EXPECT_EQ(200u, transactionSizes[0]);
+		EXPECT_EQ(1u, std::count(transactionSizes.cbegin(), transactionSizes.cend(), 200u));
+		EXPECT_EQ(BlockFeeMultiplier(5), pBlock->FeeMultiplier);
+	}
+
+	TEST(TEST_CLASS, TemplateIsPreservedWhenUnrelatedTransactionIsRemoved) {
+		// Arrange:
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+		context.prepareTemplate(Timestamp(100), 16);
+
+		// - remove transaction that does not fit into the template
+		context.removeTransaction(4);
+		context.prepareTemplate(Timestamp(150), 16);
+
+		// - add an untracked transaction
+		context.addTransaction(200, 100, false);
+
+		// Act:
+		auto pBlock = context.generateFromTemplate(Cache_Height + Height(1), Timestamp(200), 16);
+
+		// Assert: prepared template was used
+		AssertTransactionSizes({ 201, 202, 203, 204 }, pBlock);
+	}
+
+	// endregion
+
+	// region block template - invalidation
+
+	namespace {
+		template<typename TAction>
+		void AssertTemplateIsDiscarded(
+				Timestamp blockTime,
+				uint32_t maxTransactionsPerBlock,
+				const std::vector<uint32_t>& expectedTransactionSizes,
+				TAction action) {
+			// Arrange:
+			TestContext context(model::TransactionSelectionStrategy::Oldest);
+			context.prepareTemplate(Timestamp(100), 21);
+
+			// - invalidate the template and add an untracked transaction that is only picked up by direct generation
+			action(context);
+			context.addTransaction(200, 100, false);
+
+			// Act:
+			auto pBlock = context.generateFromTemplate(Cache_Height + Height(1), blockTime, maxTransactionsPerBlock);
+
+			// Assert: block was directly generated
+			AssertTransactionSizes(expectedTransactionSizes, pBlock);
+		}
+	}
+
+	TEST(TEST_CLASS, TemplateIsDiscardedWhenTemplateTransactionIsRemoved) {
+		AssertTemplateIsDiscarded(Timestamp(200), 21, { 201, 203, 204, 205, 200 }, [](auto& context) {
+			context.removeTransaction(1);
+		});
+	}
+
+	TEST(TEST_CLASS, TemplateIsDiscardedWhenCacheIsCommitted) {
+		AssertTemplateIsDiscarded(Timestamp(200), 21, { 201, 202, 203, 204, 205, 200 }, [](auto& context) {
+			context.commitCache();
+		});
+	}
+
+	TEST(TEST_CLASS, TemplateIsDiscardedWhenTemplateTransactionExpires) {
+		auto blockTime = Transaction_Deadline + Timestamp(1);
+		AssertTemplateIsDiscarded(blockTime, 21, { 201, 202, 203, 204, 205, 200 }, [](const auto&) {});
+	}
+
+	TEST(TEST_CLASS, TemplateIsDiscardedWhenBlockTimeIsBeforePreparationTime) {
+		AssertTemplateIsDiscarded(Timestamp(99), 21, { 201, 202, 203, 204, 205, 200 }, [](const auto&) {});
+	}
+
+	TEST(TEST_CLASS, TemplateIsDiscardedWhenMaxTransactionsPerBlockChanges) {
+		AssertTemplateIsDiscarded(Timestamp(200), 22, { 201, 202, 203, 204, 205, 200 }, [](const auto&) {});
+	}
+
+	TEST(TEST_CLASS, TemplateIsDiscardedWhenTrackerOverflows) {
+		AssertTemplateIsDiscarded(Timestamp(200), 21, { 201, 202, 203, 204, 205, 200 }, [](auto& context) {
+			context.overflowTracker();
+		});
+	}
+
+	TEST(TEST_CLASS, TemplateIsDiscardedWhenExplicitlyDiscarded) {
+		AssertTemplateIsDiscarded(Timestamp(200), 21, { 201, 202, 203, 204, 205, 200 }, [](auto& context) {
+			context.discardTemplate();
+		});
+	}
+
+	// endregion
 }}
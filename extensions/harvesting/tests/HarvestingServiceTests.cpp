@@ -23,6 +23,7 @@
 #include "harvesting/src/HarvestingConfiguration.h"
 #include "harvesting/src/UnlockedAccounts.h"
 #include "harvesting/src/UnlockedAccountsStorage.h"
+#include "harvesting/src/UtChangeTracker.h"
 #include "catapult/cache_core/BlockStatisticCache.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "harvesting/tests/test/HarvestRequestEncryptedPayload.h"
@@ -56,7 +57,7 @@ namespace catapult { namespace harvesting {
 
 		struct HarvestingServiceTraits {
 			static auto CreateRegistrar(const HarvestingConfiguration& config) {
-				return CreateHarvestingServiceRegistrar(config);
+				return CreateHarvestingServiceRegistrar(config, std::make_shared<UtChangeTracker>(100));
 			}
 
 			static auto CreateRegistrar() {
@@ -768,6 +768,102 @@ namespace catapult { namespace harvesting {
 
 	// endregion
 
+	// region unlock / tryLock
+
+	TEST(TEST_CLASS, TryLockSucceedsWhenFacadeIsLocked) {
+		// Arrange:
+		RunUtFacadeTest([](auto& facade, const auto&) {
+			// Act:
+			auto isLocked = facade.tryLock();
+
+			// Assert:
+			EXPECT_TRUE(isLocked);
+		});
+	}
+
+	TEST(TEST_CLASS, CannotApplyTransactionsWhenUnlocked) {
+		// Arrange:
+		RunUtFacadeTest(1, [](auto& facade, const auto& transactionInfos, const auto&) {
+			facade.unlock();
+
+			// Act + Assert:
+			EXPECT_THROW(facade.apply(transactionInfos[0]), catapult_runtime_error);
+			AssertEmpty(facade);
+		});
+	}
+
+	TEST(TEST_CLASS, CanCommitTransactionsAppliedBeforeUnlockAfterRelock) {
+		// Arrange:
+		RunUtFacadeTest(4, [](auto& facade, const auto& transactionInfos, const auto&) {
+			// - seed facade with four transactions
+			auto transactionsSize = 0u;
+			for (const auto& transactionInfo : transactionInfos) {
+				facade.apply(transactionInfo);
+				transactionsSize += transactionInfo.pEntity->Size;
+			}
+
+			// Act: unlock and relock facade
+			facade.unlock();
+			auto isLocked = facade.tryLock();
+
+			// - commit (update header size to match expected)
+			auto pBlockHeader = CreateBlockHeaderWithHeight(Default_Height + Height(1));
+			pBlockHeader->Size += transactionsSize;
+			auto pBlock = facade.commit(*pBlockHeader);
+
+			// Assert:
+			EXPECT_TRUE(isLocked);
+			ASSERT_TRUE(!!pBlock);
+			EXPECT_EQ(4u, model::CalculateBlockTransactionsInfo(*pBlock).Count);
+
+			auto i = 0u;
+			for (const auto& transaction : pBlock->Transactions()) {
+				EXPECT_EQ(*transactionInfos[i].pEntity, transaction) << "transaction at " << i;
+				++i;
+			}
+		});
+	}
+
+	TEST(TEST_CLASS, UnlockReleasesCacheLocksAndTryLockFailsAfterCacheCommit) {
+		// Arrange:
+		auto catapultCache = test::CreateCatapultCacheWithMarkerAccount(Default_Height);
+		SetDependentState(catapultCache);
+
+		test::MockExecutionConfiguration executionConfig;
+		HarvestingUtFacadeFactory factory(catapultCache, CreateBlockChainConfiguration(), executionConfig.Config, EmptyHashSupplier);
+
+		auto pFacade = factory.create(Default_Time);
+		pFacade->unlock();
+
+		// Act: cache can only be committed when facade does not hold any locks
+		{
+			auto cacheDelta = catapultCache.createDelta();
+			catapultCache.commit(Default_Height + Height(1));
+		}
+
+		auto isLocked = pFacade->tryLock();
+
+		// Assert:
+		EXPECT_FALSE(isLocked);
+		EXPECT_EQ(Default_Height + Height(1), pFacade->height());
+	}
+
+	TEST(TEST_CLASS, TryLockFailsAfterCommit) {
+		// Arrange:
+		RunUtFacadeTest(0, [](auto& facade, const auto&, const auto&) {
+			auto pBlockHeader = CreateBlockHeaderWithHeight(Default_Height + Height(1));
+			facade.commit(*pBlockHeader);
+
+			// Act:
+			auto isLocked = facade.tryLock();
+
+			// Assert:
+			EXPECT_FALSE(isLocked);
+		});
+	}
+
+	// endregion
+
 	// region FacadeTestContext
 
 	namespace {
@@ -53,6 +53,7 @@ namespace catapult { namespace harvesting {
 					, NumLastBlockElementSupplierCalls(0)
 					, NumTimeSupplierCalls(0)
 					, NumRangeConsumerCalls(0)
+					, NumNextBlockPreparerCalls(0)
 					, BlockHeight(0)
 					, BlockSigner()
 					, pLastBlock(std::make_shared<model::Block>())
@@ -79,6 +80,10 @@ namespace catapult { namespace harvesting {
 					BlockSigner = block.SignerPublicKey;
 					CompletionFunction = processingComplete;
 				};
+				NextBlockPreparer = [this](auto timestamp) {
+					++NumNextBlockPreparerCalls;
+					NextBlockPreparerTimestamp = timestamp;
+				};
 				pLastBlock->Size = sizeof(model::BlockHeader);
 				pLastBlock->Height = Height(1);
 			}
@@ -87,6 +92,8 @@ namespace catapult { namespace harvesting {
 			size_t NumLastBlockElementSupplierCalls;
 			size_t NumTimeSupplierCalls;
 			size_t NumRangeConsumerCalls;
+			size_t NumNextBlockPreparerCalls;
+			Timestamp NextBlockPreparerTimestamp;
 			Height BlockHeight;
 			Key BlockSigner;
 			std::shared_ptr<model::Block> pLastBlock;
@@ -161,6 +168,7 @@ namespace catapult { namespace harvesting {
 		EXPECT_EQ(0u, options.NumLastBlockElementSupplierCalls);
 		EXPECT_EQ(0u, options.NumTimeSupplierCalls);
 		EXPECT_EQ(0u, options.NumRangeConsumerCalls);
+		EXPECT_EQ(0u, options.NumNextBlockPreparerCalls);
 		EXPECT_EQ(Height(0), options.BlockHeight);
 		EXPECT_EQ(Key(), options.BlockSigner);
 	}
@@ -179,10 +187,28 @@ namespace catapult { namespace harvesting {
 		EXPECT_EQ(1u, options.NumLastBlockElementSupplierCalls);
 		EXPECT_EQ(1u, options.NumTimeSupplierCalls);
 		EXPECT_EQ(0u, options.NumRangeConsumerCalls);
+		EXPECT_EQ(1u, options.NumNextBlockPreparerCalls);
+		EXPECT_EQ(Max_Time, options.NextBlockPreparerTimestamp);
 		EXPECT_EQ(Height(0), options.BlockHeight);
 		EXPECT_EQ(Key(), options.BlockSigner);
 	}
 
+	TEST(TEST_CLASS, NextBlockPreparerIsOptional) {
+		// Arrange:
+		TaskOptionsWithCounters options;
+		options.NextBlockPreparer = nullptr;
+		HarvesterContext context(*options.pLastBlock);
+		ScheduledHarvesterTask task(options, CreateHarvester(context));
+
+		// Act: no block can be harvested since no account is unlocked
+		task.harvest();
+
+		// Assert:
+		EXPECT_EQ(1u, options.NumTimeSupplierCalls);
+		EXPECT_EQ(0u, options.NumRangeConsumerCalls);
+		EXPECT_EQ(0u, options.NumNextBlockPreparerCalls);
+	}
+
 	TEST(TEST_CLASS, BlockConsumerIsCalledWhenBlockIsHarvested) {
 		// Arrange:
 		TaskOptionsWithCounters options;
@@ -199,6 +225,7 @@ namespace catapult { namespace harvesting {
 		EXPECT_EQ(1u, options.NumLastBlockElementSupplierCalls);
 		EXPECT_EQ(1u, options.NumTimeSupplierCalls);
 		EXPECT_EQ(1u, options.NumRangeConsumerCalls);
+		EXPECT_EQ(0u, options.NumNextBlockPreparerCalls);
 		EXPECT_EQ(Height(2), options.BlockHeight);
 		EXPECT_EQ(keyPair.publicKey(), options.BlockSigner);
 	}
@@ -221,6 +248,7 @@ namespace catapult { namespace harvesting {
 		EXPECT_EQ(1u, options.NumLastBlockElementSupplierCalls);
 		EXPECT_EQ(1u, options.NumTimeSupplierCalls);
 		EXPECT_EQ(1u, options.NumRangeConsumerCalls);
+		EXPECT_EQ(0u, options.NumNextBlockPreparerCalls);
 		EXPECT_EQ(Height(2), options.BlockHeight);
 		EXPECT_EQ(keyPair.publicKey(), options.BlockSigner);
 	}
@@ -243,6 +271,7 @@ namespace catapult { namespace harvesting {
 		EXPECT_EQ(2u, options.NumLastBlockElementSupplierCalls);
 		EXPECT_EQ(2u, options.NumTimeSupplierCalls);
 		EXPECT_EQ(2u, options.NumRangeConsumerCalls);
+		EXPECT_EQ(0u, options.NumNextBlockPreparerCalls);
 		EXPECT_EQ(Height(2), options.BlockHeight);
 		EXPECT_EQ(keyPair.publicKey(), options.BlockSigner);
 	}
@@ -258,6 +287,7 @@ namespace catapult { namespace harvesting {
 
 		// Sanity:
 		EXPECT_EQ(0u, options.NumRangeConsumerCalls);
+		EXPECT_EQ(1u, options.NumNextBlockPreparerCalls);
 
 		// Act: unlock an account and harvest again
 		auto keyPair = AddImportantAccount(context.Cache);
@@ -269,6 +299,7 @@ namespace catapult { namespace harvesting {
 		EXPECT_EQ(2u, options.NumLastBlockElementSupplierCalls);
 		EXPECT_EQ(2u, options.NumTimeSupplierCalls);
 		EXPECT_EQ(1u, options.NumRangeConsumerCalls);
+		EXPECT_EQ(1u, options.NumNextBlockPreparerCalls);
 		EXPECT_EQ(Height(2), options.BlockHeight);
 		EXPECT_EQ(keyPair.publicKey(), options.BlockSigner);
 	}
@@ -0,0 +1,234 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "harvesting/src/UtChangeTracker.h"
+#include "tests/test/core/TransactionInfoTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace harvesting {
+
+#define TEST_CLASS UtChangeTrackerTests
+
+	namespace {
+		model::TransactionInfosSet ToTransactionInfosSet(const std::vector<model::TransactionInfo>& transactionInfos) {
+			model::TransactionInfosSet transactionInfosSet;
+			for (const auto& transactionInfo : transactionInfos)
+				transactionInfosSet.insert(transactionInfo.copy());
+
+			return transactionInfosSet;
+		}
+
+		model::TransactionInfosSet ToTransactionInfosSet(
+				const std::vector<model::TransactionInfo>& transactionInfos,
+				std::initializer_list<size_t> indexes) {
+			model::TransactionInfosSet transactionInfosSet;
+			for (auto index : indexes)
+				transactionInfosSet.insert(transactionInfos[index].copy());
+
+			return transactionInfosSet;
+		}
+
+		utils::HashSet ToHashSet(const std::vector<model::TransactionInfo>& transactionInfos) {
+			utils::HashSet hashes;
+			for (const auto& transactionInfo : transactionInfos)
+				hashes.insert(transactionInfo.EntityHash);
+
+			return hashes;
+		}
+	}
+
+	// region UtChangeTracker
+
+	TEST(TEST_CLASS, TrackerIsInitiallyEmpty) {
+		// Arrange:
+		UtChangeTracker tracker(100);
+
+		// Act:
+		auto changes = tracker.consume();
+
+		// Assert:
+		EXPECT_TRUE(changes.AddedHashes.empty());
+		EXPECT_TRUE(changes.RemovedHashes.empty());
+		EXPECT_FALSE(changes.HasOverflowed);
+	}
+
+	TEST(TEST_CLASS, CanTrackAddedTransactions) {
+		// Arrange:
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		UtChangeTracker tracker(100);
+
+		// Act:
+		tracker.add(ToTransactionInfosSet(transactionInfos));
+		auto changes = tracker.consume();
+
+		// Assert:
+		EXPECT_EQ(ToHashSet(transactionInfos), changes.AddedHashes);
+		EXPECT_TRUE(changes.RemovedHashes.empty());
+	}
+
+	TEST(TEST_CLASS, CanTrackRemovedTransactions) {
+		// Arrange:
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		UtChangeTracker tracker(100);
+
+		// Act:
+		tracker.remove(ToTransactionInfosSet(transactionInfos));
+		auto changes = tracker.consume();
+
+		// Assert:
+		EXPECT_TRUE(changes.AddedHashes.empty());
+		EXPECT_EQ(ToHashSet(transactionInfos), changes.RemovedHashes);
+	}
+
+	TEST(TEST_CLASS, TransactionThatIsAddedAndRemovedIsOnlyTrackedAsRemoved) {
+		// Arrange:
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		UtChangeTracker tracker(100);
+
+		// Act:
+		tracker.add(ToTransactionInfosSet(transactionInfos));
+		tracker.remove(ToTransactionInfosSet(transactionInfos, { 1 }));
+		auto changes = tracker.consume();
+
+		// Assert:
+		EXPECT_EQ(utils::HashSet({ transactionInfos[0].EntityHash, transactionInfos[2].EntityHash }), changes.AddedHashes);
+		EXPECT_EQ(utils::HashSet({ transactionInfos[1].EntityHash }), changes.RemovedHashes);
+	}
+
+	TEST(TEST_CLASS, TransactionThatIsRemovedAndAddedIsOnlyTrackedAsAdded) {
+		// Arrange:
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		UtChangeTracker tracker(100);
+
+		// Act:
+		tracker.remove(ToTransactionInfosSet(transactionInfos));
+		tracker.add(ToTransactionInfosSet(transactionInfos, { 1 }));
+		auto changes = tracker.consume();
+
+		// Assert:
+		EXPECT_EQ(utils::HashSet({ transactionInfos[1].EntityHash }), changes.AddedHashes);
+		EXPECT_EQ(utils::HashSet({ transactionInfos[0].EntityHash, transactionInfos[2].EntityHash }), changes.RemovedHashes);
+	}
+
+	TEST(TEST_CLASS, ConsumeResetsTracker) {
+		// Arrange:
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		UtChangeTracker tracker(100);
+		tracker.add(ToTransactionInfosSet(transactionInfos, { 0 }));
+		tracker.remove(ToTransactionInfosSet(transactionInfos, { 1 }));
+		tracker.consume();
+
+		// Act:
+		tracker.add(ToTransactionInfosSet(transactionInfos, { 2 }));
+		auto changes = tracker.consume();
+
+		// Assert:
+		EXPECT_EQ(utils::HashSet({ transactionInfos[2].EntityHash }), changes.AddedHashes);
+		EXPECT_TRUE(changes.RemovedHashes.empty());
+	}
+
+	TEST(TEST_CLASS, CanTrackMaxChanges) {
+		// Arrange:
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		UtChangeTracker tracker(5);
+
+		// Act:
+		tracker.add(ToTransactionInfosSet(transactionInfos, { 0, 1, 2 }));
+		tracker.remove(ToTransactionInfosSet(transactionInfos, { 3, 4 }));
+		auto changes = tracker.consume();
+
+		// Assert:
+		EXPECT_EQ(3u, changes.AddedHashes.size());
+		EXPECT_EQ(2u, changes.RemovedHashes.size());
+		EXPECT_FALSE(changes.HasOverflowed);
+	}
+
+	namespace {
+		template<typename TAction>
+		void AssertTrackerOverflowsWhenMaxChangesIsExceeded(TAction action) {
+			// Arrange:
+			auto transactionInfos = test::CreateTransactionInfos(6);
+			UtChangeTracker tracker(5);
+			tracker.add(ToTransactionInfosSet(transactionInfos, { 0, 1, 2 }));
+
+			// Act:
+			action(tracker, ToTransactionInfosSet(transactionInfos, { 3, 4, 5 }));
+			auto changes = tracker.consume();
+
+			// Assert: individual changes are dropped
+			EXPECT_TRUE(changes.AddedHashes.empty());
+			EXPECT_TRUE(changes.RemovedHashes.empty());
+			EXPECT_TRUE(changes.HasOverflowed);
+		}
+	}
+
+	TEST(TEST_CLASS, TrackerOverflowsWhenMaxChangesIsExceededByAdd) {
+		AssertTrackerOverflowsWhenMaxChangesIsExceeded([](auto& tracker, const auto& transactionInfos) {
+			tracker.add(transactionInfos);
+		});
+	}
+
+	TEST(TEST_CLASS, TrackerOverflowsWhenMaxChangesIsExceededByRemove) {
+		AssertTrackerOverflowsWhenMaxChangesIsExceeded([](auto& tracker, const auto& transactionInfos) {
+			tracker.remove(transactionInfos);
+		});
+	}
+
+	TEST(TEST_CLASS, ConsumeResetsOverflowedTracker) {
+		// Arrange:
+		auto transactionInfos = test::CreateTransactionInfos(4);
+		UtChangeTracker tracker(2);
+		tracker.add(ToTransactionInfosSet(transactionInfos, { 0, 1, 2 }));
+		tracker.consume();
+
+		// Act:
+		tracker.add(ToTransactionInfosSet(transactionInfos, { 3 }));
+		auto changes = tracker.consume();
+
+		// Assert:
+		EXPECT_EQ(utils::HashSet({ transactionInfos[3].EntityHash }), changes.AddedHashes);
+		EXPECT_TRUE(changes.RemovedHashes.empty());
+		EXPECT_FALSE(changes.HasOverflowed);
+	}
+
+	// endregion
+
+	// region CreateUtChangeTrackerSubscriber
+
+	TEST(TEST_CLASS, SubscriberForwardsAllChangesToTracker) {
+		// Arrange:
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		auto pTracker = std::make_shared<UtChangeTracker>(100);
+		auto pSubscriber = CreateUtChangeTrackerSubscriber(pTracker);
+
+		// Act:
+		pSubscriber->notifyAdds(ToTransactionInfosSet(transactionInfos, { 0, 1 }));
+		pSubscriber->notifyRemoves(ToTransactionInfosSet(transactionInfos, { 2 }));
+		pSubscriber->flush();
+		auto changes = pTracker->consume();
+
+		// Assert:
+		EXPECT_EQ(utils::HashSet({ transactionInfos[0].EntityHash, transactionInfos[1].EntityHash }), changes.AddedHashes);
+		EXPECT_EQ(utils::HashSet({ transactionInfos[2].EntityHash }), changes.RemovedHashes);
+	}
+
+	// endregion
+}}
@@ -167,6 +167,7 @@ namespace catapult { namespace partialtransaction {
 				extensions::ServiceLocator& locator,
 				extensions::ServiceState& state) {
 			locator.registerService(Service_Name, pDispatcher);
+			extensions::AddDispatcherLatencyCounters(locator, Service_Name, "PT", pDispatcher->size());
 
 			auto pBatchRangeDispatcher = std::make_shared<extensions::TransactionBatchRangeDispatcher>(
 					*pDispatcher,
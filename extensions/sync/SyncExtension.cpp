@@ -20,11 +20,13 @@
 **/
 
 #include "src/DispatcherService.h"
+#include "src/DispatcherSyncHandlers.h"
 #include "src/NetworkPacketWritersService.h"
 #include "src/SchedulerService.h"
 #include "src/SyncService.h"
 #include "src/TasksConfiguration.h"
 #include "catapult/extensions/ProcessBootstrapper.h"
+#include "catapult/subscribers/FinalizationSubscriber.h"
 
 namespace catapult { namespace sync {
 
@@ -39,6 +41,11 @@ namespace catapult { namespace sync {
 			extensionManager.addServiceRegistrar(CreateNetworkPacketWritersServiceRegistrar());
 			extensionManager.addServiceRegistrar(CreateSchedulerServiceRegistrar(tasksConfig));
 			extensionManager.addServiceRegistrar(CreateSyncServiceRegistrar());
+
+			// register subscriber(s)
+			auto* pGroupCommitter = bootstrapper.pluginManager().cacheDatabaseGroupCommitter();
+			if (pGroupCommitter)
+				bootstrapper.subscriptionManager().addFinalizationSubscriber(CreateGroupCommitFinalizationSubscriber(*pGroupCommitter));
 		}
 	}
 }}
@@ -28,6 +28,7 @@
 #include "catapult/cache_core/BlockStatisticCache.h"
 #include "catapult/cache_core/ImportanceView.h"
 #include "catapult/cache_tx/MemoryUtCache.h"
+#include "catapult/chain/BatchEntityPrefetcher.h"
 #include "catapult/chain/BlockExecutor.h"
 #include "catapult/chain/BlockScorer.h"
 #include "catapult/chain/ChainUtils.h"
@@ -68,6 +69,9 @@ namespace catapult { namespace sync {
 	namespace {
 		// region utils
 
+		// minimum number of pairs in a transactions merkle tree level before it is hashed across the validator pool
+		constexpr size_t Min_Merkle_Partition_Size = 512;
+
 		crypto::RandomFiller CreateRandomFiller() {
 			return [](auto* pOut, auto count) {
 				crypto::SecureRandomGenerator().fill(pOut, count);
@@ -149,21 +153,34 @@ namespace catapult { namespace sync {
 		}
 
 		BlockChainProcessor CreateSyncProcessor(
-				const model::BlockChainConfiguration& blockChainConfig,
-				const chain::ExecutionConfiguration& executionConfig) {
+				const config::CatapultConfiguration& config,
+				const chain::ExecutionConfiguration& executionConfig,
+				const std::vector<cache::CachePrefetcherFactory>& prefetcherFactories,
+				thread::IoThreadPool& stateHashPool) {
+			const auto& blockChainConfig = config.BlockChain;
 			BlockHitPredicateFactory blockHitPredicateFactory = [&blockChainConfig](const cache::ReadOnlyCatapultCache& cache) {
 				cache::ImportanceView view(cache.sub<cache::AccountStateCache>());
 				return chain::BlockHitPredicate(blockChainConfig, [view](const auto& publicKey, auto height) {
 					return view.getAccountImportanceOrDefault(publicKey, height);
 				});
 			};
-			return CreateBlockChainProcessor(
-					blockHitPredicateFactory,
-					chain::CreateBatchEntityProcessor(executionConfig),
-					GetReceiptValidationMode(blockChainConfig));
+			auto batchEntityProcessor = chain::CreateBatchEntityProcessor(executionConfig);
+			if (config.Node.EnableCacheDatabaseStorage && !prefetcherFactories.empty()) {
+				// cache entries are loaded from disk on demand, so load all entries referenced by a block with batched reads
+				auto batchEntityPrefetcher = chain::CreateBatchEntityPrefetcher(executionConfig, prefetcherFactories, stateHashPool);
+				batchEntityProcessor = chain::CreatePrefetchingBatchEntityProcessor(batchEntityPrefetcher, batchEntityProcessor);
+			}
+
+			auto receiptValidationMode = GetReceiptValidationMode(blockChainConfig);
+			return config.Node.EnableParallelStateHashCalculation
+					? CreateBlockChainProcessor(blockHitPredicateFactory, batchEntityProcessor, receiptValidationMode, stateHashPool)
+					: CreateBlockChainProcessor(blockHitPredicateFactory, batchEntityProcessor, receiptValidationMode);
 		}
 
-		BlockChainSyncHandlers CreateBlockChainSyncHandlers(extensions::ServiceState& state, RollbackInfo& rollbackInfo) {
+		BlockChainSyncHandlers CreateBlockChainSyncHandlers(
+				extensions::ServiceState& state,
+				thread::IoThreadPool& stateHashPool,
+				RollbackInfo& rollbackInfo) {
 			const auto& blockChainConfig = state.config().BlockChain;
 			const auto& pluginManager = state.pluginManager();
 
@@ -187,7 +204,11 @@ namespace catapult { namespace sync {
 				auto resolverContext = pluginManager.createResolverContext(readOnlyCache);
 				UndoBlock(blockElement, { *pUndoObserver, resolverContext, observerState }, undoBlockType);
 			};
-			syncHandlers.Processor = CreateSyncProcessor(blockChainConfig, extensions::CreateExecutionConfiguration(pluginManager));
+			syncHandlers.Processor = CreateSyncProcessor(
+					state.config(),
+					extensions::CreateExecutionConfiguration(pluginManager),
+					pluginManager.cachePrefetcherFactories(),
+					stateHashPool);
 
 			syncHandlers.StateChange = [&rollbackInfo, &localScore = state.score(), &subscriber = state.stateChangeSubscriber()](
 					const auto& changeInfo) {
@@ -203,11 +224,19 @@ namespace catapult { namespace sync {
 			auto dataDirectory = config::CatapultDataDirectory(state.config().User.DataDirectory);
 			syncHandlers.PreStateWritten = [](const auto&, auto) {};
 			syncHandlers.TransactionsChange = state.hooks().transactionsChangeHandler();
-			syncHandlers.CommitStep = extensions::CreateCommitStepHandler(dataDirectory);
+			auto* pGroupCommitter = pluginManager.cacheDatabaseGroupCommitter();
+			syncHandlers.CommitStep = pGroupCommitter
+					? extensions::CreateCommitStepHandler(dataDirectory, *pGroupCommitter)
+					: extensions::CreateCommitStepHandler(dataDirectory);
 
 			if (state.config().Node.EnableCacheDatabaseStorage)
 				AddSupplementalDataResiliency(syncHandlers, dataDirectory, state.cache(), state.score());
 
+			// when sync cleanup is enabled, state changes are discarded as soon as they are committed, so they cannot be replayed
+			// by recovery and all cache database writes need to be durable before state is marked as updated
+			if (pGroupCommitter && state.config().Node.EnableAutoSyncCleanup)
+				AddCacheDatabaseGroupCommitBarrier(syncHandlers, *pGroupCommitter);
+
 			return syncHandlers;
 		}
 
@@ -219,10 +248,12 @@ namespace catapult { namespace sync {
 			{}
 
 		public:
-			void addHashConsumers() {
+			void addHashConsumers(thread::IoThreadPool& validatorPool) {
 				m_consumers.push_back(CreateBlockHashCalculatorConsumer(
 						m_state.config().BlockChain.Network.GenerationHashSeed,
-						m_state.pluginManager().transactionRegistry()));
+						m_state.pluginManager().transactionRegistry(),
+						validatorPool,
+						Min_Merkle_Partition_Size));
 				m_consumers.push_back(CreateBlockHashCheckConsumer(
 						m_state.timeSupplier(),
 						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheBlockDuration, m_nodeConfig)));
@@ -249,7 +280,7 @@ namespace catapult { namespace sync {
 						m_state.config().BlockChain.ImportanceGrouping,
 						m_state.cache(),
 						m_state.storage(),
-						CreateBlockChainSyncHandlers(m_state, rollbackInfo)));
+						CreateBlockChainSyncHandlers(m_state, validatorPool, rollbackInfo)));
 
 				if (m_state.config().Node.EnableAutoSyncCleanup)
 					disruptorConsumers.push_back(CreateBlockChainSyncCleanupConsumer(m_state.config().User.DataDirectory));
@@ -279,6 +310,9 @@ namespace catapult { namespace sync {
 			serviceGroup.registerService(pDispatcher);
 			locator.registerService("dispatcher.block", pDispatcher);
 
+			// latency counters depend on the number of consumers, which is only known after the dispatcher is built
+			extensions::AddDispatcherLatencyCounters(locator, "dispatcher.block", "BLK", pDispatcher->size());
+
 			state.hooks().setBlockRangeConsumerFactory([&dispatcher = *pDispatcher, &nodes = state.nodes()](auto source) {
 				return [&dispatcher, &nodes, source](auto&& range) {
 					if (!nodes.view().isBanned(range.SourceIdentity))
@@ -361,6 +395,7 @@ namespace catapult { namespace sync {
 				extensions::ServiceState& state) {
 			serviceGroup.registerService(pDispatcher);
 			locator.registerService("dispatcher.transaction", pDispatcher);
+			extensions::AddDispatcherLatencyCounters(locator, "dispatcher.transaction", "TX", pDispatcher->size());
 
 			auto pBatchRangeDispatcher = std::make_shared<extensions::TransactionBatchRangeDispatcher>(
 					*pDispatcher,
@@ -458,7 +493,7 @@ namespace catapult { namespace sync {
 				auto pServiceGroup = state.pool().pushServiceGroup("dispatcher service");
 
 				BlockDispatcherBuilder blockDispatcherBuilder(state);
-				blockDispatcherBuilder.addHashConsumers();
+				blockDispatcherBuilder.addHashConsumers(*pValidatorPool);
 
 				TransactionDispatcherBuilder transactionDispatcherBuilder(state);
 				transactionDispatcherBuilder.addHashConsumers();
@@ -22,9 +22,11 @@
 #include "DispatcherSyncHandlers.h"
 #include "catapult/cache/CacheStorage.h"
 #include "catapult/cache/CatapultCache.h"
+#include "catapult/cache_db/RocksGroupCommitter.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
 #include "catapult/extensions/LocalNodeStateFileStorage.h"
+#include "catapult/subscribers/FinalizationSubscriber.h"
 
 namespace catapult { namespace sync {
 
@@ -54,4 +56,37 @@ namespace catapult { namespace sync {
 			commitStepHandler(step);
 		};
 	}
+
+	void AddCacheDatabaseGroupCommitBarrier(
+			consumers::BlockChainSyncHandlers& syncHandlers,
+			cache::RocksGroupCommitter& groupCommitter) {
+		auto commitStepHandler = syncHandlers.CommitStep;
+		syncHandlers.CommitStep = [commitStepHandler, &groupCommitter](auto step) {
+			if (consumers::CommitOperationStep::All_Updated == step)
+				groupCommitter.sync();
+
+			commitStepHandler(step);
+		};
+	}
+
+	namespace {
+		class GroupCommitFinalizationSubscriber : public subscribers::FinalizationSubscriber {
+		public:
+			explicit GroupCommitFinalizationSubscriber(cache::RocksGroupCommitter& groupCommitter) : m_groupCommitter(groupCommitter)
+			{}
+
+		public:
+			void notifyFinalizedBlock(const model::FinalizationRound&, Height, const Hash256&) override {
+				m_groupCommitter.sync();
+			}
+
+		private:
+			cache::RocksGroupCommitter& m_groupCommitter;
+		};
+	}
+
+	std::unique_ptr<subscribers::FinalizationSubscriber> CreateGroupCommitFinalizationSubscriber(
+			cache::RocksGroupCommitter& groupCommitter) {
+		return std::make_unique<GroupCommitFinalizationSubscriber>(groupCommitter);
+	}
 }}
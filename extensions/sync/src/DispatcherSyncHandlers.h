@@ -23,8 +23,10 @@
 #include "catapult/consumers/BlockChainSyncHandlers.h"
 
 namespace catapult {
+	namespace cache { class RocksGroupCommitter; }
 	namespace config { class CatapultDataDirectory; }
 	namespace extensions { class LocalNodeChainScore; }
+	namespace subscribers { class FinalizationSubscriber; }
 }
 
 namespace catapult { namespace sync {
@@ -35,4 +37,13 @@ namespace catapult { namespace sync {
 			const config::CatapultDataDirectory& dataDirectory,
 			const cache::CatapultCache& cache,
 			const extensions::LocalNodeChainScore& score);
+
+	/// Updates \a syncHandlers to wait for all cache database writes tracked by \a groupCommitter to be durable before
+	/// all state is updated.
+	void AddCacheDatabaseGroupCommitBarrier(consumers::BlockChainSyncHandlers& syncHandlers, cache::RocksGroupCommitter& groupCommitter);
+
+	/// Creates a finalization subscriber that waits for all cache database writes tracked by \a groupCommitter to be durable
+	/// whenever a block is finalized.
+	std::unique_ptr<subscribers::FinalizationSubscriber> CreateGroupCommitFinalizationSubscriber(
+			cache::RocksGroupCommitter& groupCommitter);
 }}
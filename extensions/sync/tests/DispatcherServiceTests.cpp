@@ -48,7 +48,7 @@ namespace catapult { namespace sync {
 
 	namespace {
 		constexpr auto Num_Expected_Services = 5u;
-		constexpr auto Num_Expected_Counters = 10u;
+		constexpr auto Num_Expected_Counters = 10u + 6 * (7 + 5); // latency counters for each block and transaction consumer
 		constexpr auto Num_Expected_Tasks = 1u;
 
 		constexpr auto Block_Elements_Counter_Name = "BLK ELEM TOT";
@@ -385,9 +385,9 @@ namespace catapult { namespace sync {
 		// Act:
 		context.boot();
 
-		// Assert:
+		// Assert: latency counters are registered for the audit consumers too
 		EXPECT_EQ(Num_Expected_Services, context.locator().numServices());
-		EXPECT_EQ(Num_Expected_Counters, context.locator().counters().size());
+		EXPECT_EQ(Num_Expected_Counters + 6 * 2, context.locator().counters().size());
 		EXPECT_EQ(Num_Expected_Tasks, context.testState().state().tasks().size());
 
 		EXPECT_EQ(8u, GetBlockDispatcherStatus(context.locator()).Size);
@@ -407,9 +407,9 @@ namespace catapult { namespace sync {
 		// Act:
 		context.boot();
 
-		// Assert:
+		// Assert: latency counters are registered for the cleanup consumer too
 		EXPECT_EQ(Num_Expected_Services, context.locator().numServices());
-		EXPECT_EQ(Num_Expected_Counters, context.locator().counters().size());
+		EXPECT_EQ(Num_Expected_Counters + 6, context.locator().counters().size());
 		EXPECT_EQ(Num_Expected_Tasks, context.testState().state().tasks().size());
 
 		EXPECT_EQ(8u, GetBlockDispatcherStatus(context.locator()).Size);
@@ -21,8 +21,12 @@
 
 #include "sync/src/DispatcherSyncHandlers.h"
 #include "catapult/cache/CatapultCache.h"
+#include "catapult/cache_db/RocksDatabase.h"
+#include "catapult/cache_db/RocksInclude.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
+#include "catapult/model/FinalizationRound.h"
+#include "catapult/subscribers/FinalizationSubscriber.h"
 #include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
 #include <filesystem>
@@ -142,4 +146,111 @@ namespace catapult { namespace sync {
 	}
 
 	// endregion
+
+	// region group commit - test context
+
+	namespace {
+		class GroupCommitTestContext {
+		public:
+			GroupCommitTestContext()
+					: m_dataDirectory(m_tempDir.name())
+					, m_pGroupCommitter(std::make_shared<cache::RocksGroupCommitter>(utils::TimeSpan::FromHours(1)))
+					, m_database(cache::RocksDatabaseSettings(
+							m_dataDirectory.dir("statedb").str(),
+							config::NodeConfiguration::CacheDatabaseSubConfiguration(),
+							{ "default" },
+							cache::FilterPruningMode::Disabled,
+							m_pGroupCommitter))
+					, m_numCommitStepCalls(0) {
+				m_syncHandlers.CommitStep = [&numCommitStepCalls = m_numCommitStepCalls](auto) {
+					++numCommitStepCalls;
+				};
+
+				AddCacheDatabaseGroupCommitBarrier(m_syncHandlers, *m_pGroupCommitter);
+
+				// create outstanding (unsynced) write
+				m_database.put(0, "hello", "amazing");
+				m_database.flush();
+			}
+
+		public:
+			size_t numCommitStepCalls() const {
+				return m_numCommitStepCalls;
+			}
+
+			cache::RocksGroupCommitter& groupCommitter() {
+				return *m_pGroupCommitter;
+			}
+
+			const auto& syncHandlers() const {
+				return m_syncHandlers;
+			}
+
+		private:
+			test::TempDirectoryGuard m_tempDir;
+			config::CatapultDataDirectory m_dataDirectory;
+			std::shared_ptr<cache::RocksGroupCommitter> m_pGroupCommitter;
+			cache::RocksDatabase m_database;
+			size_t m_numCommitStepCalls;
+			consumers::BlockChainSyncHandlers m_syncHandlers;
+		};
+	}
+
+	// endregion
+
+	// region AddCacheDatabaseGroupCommitBarrier
+
+	namespace {
+		void AssertGroupCommitBarrierCommitStepDoesNotSync(consumers::CommitOperationStep step) {
+			// Arrange:
+			GroupCommitTestContext context;
+
+			// Act:
+			context.syncHandlers().CommitStep(step);
+
+			// Assert:
+			EXPECT_EQ(1u, context.numCommitStepCalls());
+			EXPECT_EQ(0u, context.groupCommitter().numSyncs());
+		}
+	}
+
+	TEST(TEST_CLASS, AddCacheDatabaseGroupCommitBarrier_CommitStepDoesNotSyncWhenOperationIsBlocksWritten) {
+		AssertGroupCommitBarrierCommitStepDoesNotSync(consumers::CommitOperationStep::Blocks_Written);
+	}
+
+	TEST(TEST_CLASS, AddCacheDatabaseGroupCommitBarrier_CommitStepDoesNotSyncWhenOperationIsStateWritten) {
+		AssertGroupCommitBarrierCommitStepDoesNotSync(consumers::CommitOperationStep::State_Written);
+	}
+
+	TEST(TEST_CLASS, AddCacheDatabaseGroupCommitBarrier_CommitStepSyncsWhenOperationIsAllUpdated) {
+		// Arrange:
+		GroupCommitTestContext context;
+
+		// Act:
+		context.syncHandlers().CommitStep(consumers::CommitOperationStep::All_Updated);
+
+		// Assert:
+		EXPECT_EQ(1u, context.numCommitStepCalls());
+		EXPECT_EQ(1u, context.groupCommitter().numSyncs());
+	}
+
+	// endregion
+
+	// region CreateGroupCommitFinalizationSubscriber
+
+	TEST(TEST_CLASS, CreateGroupCommitFinalizationSubscriber_SyncsWhenBlockIsFinalized) {
+		// Arrange:
+		GroupCommitTestContext context;
+		context.createStateChangeSpool();
+		auto pSubscriber = CreateGroupCommitFinalizationSubscriber(context.groupCommitter());
+
+		// Act:
+		auto round = model::FinalizationRound{ FinalizationEpoch(2), FinalizationPoint(3) };
+		pSubscriber->notifyFinalizedBlock(round, Height(11), test::GenerateRandomByteArray<Hash256>());
+
+		// Assert:
+		EXPECT_EQ(1u, context.groupCommitter().numSyncs());
+	}
+
+	// endregion
 }}
@@ -21,12 +21,14 @@
 
 #pragma once
 #include "catapult/model/HeightGrouping.h"
+#include "catapult/functions.h"
 #include "catapult/types.h"
 #include <memory>
 
 namespace catapult {
 	namespace cache { class AccountStateCacheDelta; }
 	namespace model { struct BlockChainConfiguration; }
+	namespace thread { class IoThreadPool; }
 }
 
 namespace catapult { namespace importance {
@@ -56,9 +58,26 @@ namespace catapult { namespace importance {
 				cache::AccountStateCacheDelta& cache) const = 0;
 	};
 
+	/// Supplies the (optional) thread pool used to parallelize importance recalculations.
+	using ImportanceCalculatorPoolSupplier = supplier<thread::IoThreadPool*>;
+
 	/// Creates an importance calculator for the block chain described by \a config.
+	/// \note Recalculations are not parallelized.
 	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(const model::BlockChainConfiguration& config);
 
+	/// Creates an importance calculator for the block chain described by \a config that distributes recalculations
+	/// of many eligible accounts across the pool returned by \a poolSupplier (when available).
+	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(
+			const model::BlockChainConfiguration& config,
+			const ImportanceCalculatorPoolSupplier& poolSupplier);
+
+	/// Creates an importance calculator for the block chain described by \a config that distributes recalculations
+	/// of at least \a minParallelAccounts eligible accounts across the pool returned by \a poolSupplier (when available).
+	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(
+			const model::BlockChainConfiguration& config,
+			const ImportanceCalculatorPoolSupplier& poolSupplier,
+			size_t minParallelAccounts);
+
 	/// Creates a restore importance calculator.
 	std::unique_ptr<ImportanceCalculator> CreateRestoreImportanceCalculator();
 }}
@@ -25,17 +25,107 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/HeightGrouping.h"
 #include "catapult/state/AccountImportanceSnapshots.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
-#include <boost/multiprecision/cpp_int.hpp>
 #include <memory>
 #include <vector>
 
 namespace catapult { namespace importance {
 
 	namespace {
+		constexpr size_t Default_Min_Parallel_Accounts = 10'000;
+
+		// region AccountImportanceBuffers
+
+		// structure of arrays holding the eligible account fields that are used during recalculation
+		struct AccountImportanceBuffers {
+		public:
+			explicit AccountImportanceBuffers(size_t numAccounts)
+					: AccountStates(numAccounts)
+					, Balances(numAccounts)
+					, ActivitySummaries(numAccounts)
+					, StakeImportances(numAccounts)
+					, ActivityImportances(numAccounts)
+			{}
+
+		public:
+			std::vector<state::AccountState*> AccountStates;
+			std::vector<Amount> Balances;
+			std::vector<AccountActivitySummary> ActivitySummaries;
+			std::vector<Importance> StakeImportances;
+			std::vector<Importance> ActivityImportances;
+		};
+
+		// endregion
+
+		// region PartitionedRunner
+
+		struct NoPartialResult {};
+
+		// runs actions over fixed contiguous partitions of account indexes, so integer partial results can be combined exactly
+		class PartitionedRunner {
+		private:
+			using AccountStatePointers = std::vector<state::AccountState*>;
+
+		public:
+			PartitionedRunner(thread::IoThreadPool* pPool, const AccountStatePointers& accountStates)
+					: m_pPool(pPool)
+					, m_accountStates(accountStates)
+					, m_numPartitions(pPool ? std::max<size_t>(1, std::min<size_t>(pPool->numWorkerThreads(), accountStates.size())) : 1)
+			{}
+
+		public:
+			// calls action with (startIndex, endIndex, partialResult) for each partition and returns all partial results
+			template<typename TPartialResult, typename TAction>
+			std::vector<TPartialResult> run(TAction action) const {
+				std::vector<TPartialResult> partialResults(m_numPartitions);
+				if (1 == m_numPartitions) {
+					action(static_cast<size_t>(0), m_accountStates.size(), partialResults[0]);
+					return partialResults;
+				}
+
+				std::vector<std::exception_ptr> exceptions(m_numPartitions);
+				auto& ioContext = m_pPool->ioContext();
+				thread::ParallelForPartition(ioContext, m_accountStates, m_numPartitions, [&action, &partialResults, &exceptions](
+						auto itBegin,
+						auto itEnd,
+						auto startIndex,
+						auto batchIndex) {
+					try {
+						auto endIndex = startIndex + static_cast<size_t>(std::distance(itBegin, itEnd));
+						action(startIndex, endIndex, partialResults[batchIndex]);
+					} catch (...) {
+						// exceptions cannot escape pool threads, so rethrow them after all partitions complete
+						exceptions[batchIndex] = std::current_exception();
+					}
+				}).get();
+
+				for (const auto& pException : exceptions) {
+					if (pException)
+						std::rethrow_exception(pException);
+				}
+
+				return partialResults;
+			}
+
+		private:
+			thread::IoThreadPool* m_pPool;
+			const AccountStatePointers& m_accountStates;
+			size_t m_numPartitions;
+		};
+
+		// endregion
+
 		class PosImportanceCalculator final : public ImportanceCalculator {
 		public:
-			explicit PosImportanceCalculator(const model::BlockChainConfiguration& config) : m_config(config)
+			PosImportanceCalculator(
+					const model::BlockChainConfiguration& config,
+					const ImportanceCalculatorPoolSupplier& poolSupplier,
+					size_t minParallelAccounts)
+					: m_config(config)
+					, m_poolSupplier(poolSupplier)
+					, m_minParallelAccounts(minParallelAccounts)
 			{}
 
 		public:
@@ -45,45 +135,26 @@ namespace catapult { namespace importance {
 					cache::AccountStateCacheDelta& cache) const override {
 				utils::StackLogger stopwatch("PosImportanceCalculator::recalculate", utils::LogLevel::debug);
 
-				// 1. get high value accounts (notice two step lookup because only const iteration is supported)
+				// 1. gather high value accounts (notice two step lookup because only const iteration is supported)
+				//    (cache lookups are not thread safe, so this is the only sequential pass over all accounts)
 				const auto& highValueAccounts = cache.highValueAccounts();
 				const auto& highValueAddresses = highValueAccounts.addresses();
-				std::vector<AccountSummary> accountSummaries;
-				accountSummaries.reserve(highValueAddresses.size());
+				AccountImportanceBuffers buffers(highValueAddresses.size());
+
+				size_t accountIndex = 0;
+				for (const auto& address : highValueAddresses)
+					buffers.AccountStates[accountIndex++] = &cache.find(address).get();
+
+				PartitionedRunner runner(selectThreadPool(buffers.AccountStates.size()), buffers.AccountStates);
 
 				// 2. calculate sums
-				auto importanceGrouping = m_config.ImportanceGrouping;
-				ImportanceCalculationContext context;
-				auto mosaicId = m_config.HarvestingMosaicId;
-				for (const auto& address : highValueAddresses) {
-					auto accountStateIter = cache.find(address);
-					auto& accountState = accountStateIter.get();
-					const auto& activityBuckets = accountState.ActivityBuckets;
-					auto accountActivitySummary = SummarizeAccountActivity(importanceHeight, importanceGrouping, activityBuckets);
-					accountSummaries.push_back(AccountSummary(accountActivitySummary, accountState));
-					context.ActiveHarvestingMosaics = context.ActiveHarvestingMosaics + accountState.Balances.get(mosaicId);
-					context.TotalBeneficiaryCount += accountActivitySummary.BeneficiaryCount;
-					context.TotalFeesPaid = context.TotalFeesPaid + accountActivitySummary.TotalFeesPaid;
-				}
+				auto context = calculateSums(importanceHeight, runner, buffers);
 
 				// 3. calculate importance parts
-				Importance totalActivityImportance;
-				for (auto& accountSummary : accountSummaries) {
-					CalculateImportances(accountSummary, context, m_config);
-					totalActivityImportance = totalActivityImportance + accountSummary.ActivityImportance;
-				}
+				auto totalActivityImportance = calculateImportanceParts(context, runner, buffers);
 
 				// 4. calculate the final importance
-				auto targetActivityImportanceRaw = m_config.TotalChainImportance.unwrap() * m_config.ImportanceActivityPercentage / 100;
-				for (auto& accountSummary : accountSummaries) {
-					auto importance = calculateFinalImportance(accountSummary, totalActivityImportance, targetActivityImportanceRaw);
-					auto& accountState = *accountSummary.pAccountState;
-					FinalizeAccountActivity(importanceHeight, importance, accountState.ActivityBuckets);
-					auto effectiveImportance = model::ImportanceHeight(1) == importanceHeight
-							? importance
-							: Importance(std::min(importance.unwrap(), accountSummary.ActivitySummary.PreviousImportance.unwrap()));
-					accountSummary.pAccountState->ImportanceSnapshots.set(effectiveImportance, importanceHeight);
-				}
+				finalizeImportances(importanceHeight, totalActivityImportance, runner, buffers);
 
 				CATAPULT_LOG(debug)
 						<< "recalculated importances (" << highValueAddresses.size() << " / " << cache.size() << " eligible)"
@@ -94,26 +165,133 @@ namespace catapult { namespace importance {
 			}
 
 		private:
+			thread::IoThreadPool* selectThreadPool(size_t numAccounts) const {
+				if (!m_poolSupplier || numAccounts < m_minParallelAccounts)
+					return nullptr;
+
+				auto* pPool = m_poolSupplier();
+				return pPool && pPool->numWorkerThreads() > 1 ? pPool : nullptr;
+			}
+
+			ImportanceCalculationContext calculateSums(
+					model::ImportanceHeight importanceHeight,
+					const PartitionedRunner& runner,
+					AccountImportanceBuffers& buffers) const {
+				auto importanceGrouping = m_config.ImportanceGrouping;
+				auto mosaicId = m_config.HarvestingMosaicId;
+				auto partialContexts = runner.run<ImportanceCalculationContext>([importanceHeight, importanceGrouping, mosaicId, &buffers](
+						auto startIndex,
+						auto endIndex,
+						auto& partialContext) {
+					for (auto i = startIndex; i < endIndex; ++i) {
+						const auto& accountState = *buffers.AccountStates[i];
+						const auto& activityBuckets = accountState.ActivityBuckets;
+						auto accountActivitySummary = SummarizeAccountActivity(importanceHeight, importanceGrouping, activityBuckets);
+						buffers.Balances[i] = accountState.Balances.get(mosaicId);
+						buffers.ActivitySummaries[i] = accountActivitySummary;
+						partialContext.ActiveHarvestingMosaics = partialContext.ActiveHarvestingMosaics + buffers.Balances[i];
+						partialContext.TotalBeneficiaryCount += accountActivitySummary.BeneficiaryCount;
+						partialContext.TotalFeesPaid = partialContext.TotalFeesPaid + accountActivitySummary.TotalFeesPaid;
+					}
+				});
+
+				ImportanceCalculationContext context;
+				for (const auto& partialContext : partialContexts) {
+					context.ActiveHarvestingMosaics = context.ActiveHarvestingMosaics + partialContext.ActiveHarvestingMosaics;
+					context.TotalBeneficiaryCount += partialContext.TotalBeneficiaryCount;
+					context.TotalFeesPaid = context.TotalFeesPaid + partialContext.TotalFeesPaid;
+				}
+
+				return context;
+			}
+
+			Importance calculateImportanceParts(
+					const ImportanceCalculationContext& context,
+					const PartitionedRunner& runner,
+					AccountImportanceBuffers& buffers) const {
+				const auto& config = m_config;
+				auto partialTotals = runner.run<Importance>([&context, &config, &buffers](
+						auto startIndex,
+						auto endIndex,
+						auto& partialTotalActivityImportance) {
+					for (auto i = startIndex; i < endIndex; ++i) {
+						auto importances = CalculateImportances(buffers.Balances[i], buffers.ActivitySummaries[i], context, config);
+						buffers.StakeImportances[i] = importances.StakeImportance;
+						buffers.ActivityImportances[i] = importances.ActivityImportance;
+						partialTotalActivityImportance = partialTotalActivityImportance + importances.ActivityImportance;
+					}
+				});
+
+				Importance totalActivityImportance;
+				for (auto partialTotal : partialTotals)
+					totalActivityImportance = totalActivityImportance + partialTotal;
+
+				return totalActivityImportance;
+			}
+
+			void finalizeImportances(
+					model::ImportanceHeight importanceHeight,
+					Importance totalActivityImportance,
+					const PartitionedRunner& runner,
+					AccountImportanceBuffers& buffers) const {
+				// each account state is only written by the partition containing it
+				auto targetActivityImportanceRaw = m_config.TotalChainImportance.unwrap() * m_config.ImportanceActivityPercentage / 100;
+				runner.run<NoPartialResult>([this, importanceHeight, totalActivityImportance, targetActivityImportanceRaw, &buffers](
+						auto startIndex,
+						auto endIndex,
+						auto&) {
+					for (auto i = startIndex; i < endIndex; ++i) {
+						auto importance = calculateFinalImportance(
+								buffers.StakeImportances[i],
+								buffers.ActivityImportances[i],
+								totalActivityImportance,
+								targetActivityImportanceRaw);
+						auto& accountState = *buffers.AccountStates[i];
+						FinalizeAccountActivity(importanceHeight, importance, accountState.ActivityBuckets);
+						auto effectiveImportance = model::ImportanceHeight(1) == importanceHeight
+								? importance
+								: Importance(std::min(importance.unwrap(), buffers.ActivitySummaries[i].PreviousImportance.unwrap()));
+						accountState.ImportanceSnapshots.set(effectiveImportance, importanceHeight);
+					}
+				});
+			}
+
 			Importance calculateFinalImportance(
-					const AccountSummary& accountSummary,
+					Importance stakeImportance,
+					Importance activityImportance,
 					Importance totalActivityImportance,
 					Importance::ValueType targetActivityImportanceRaw) const {
 				if (Importance() == totalActivityImportance) {
 					return 0 < m_config.ImportanceActivityPercentage
-							? Importance(accountSummary.StakeImportance.unwrap() * 100 / (100 - m_config.ImportanceActivityPercentage))
-							: accountSummary.StakeImportance;
+							? Importance(stakeImportance.unwrap() * 100 / (100 - m_config.ImportanceActivityPercentage))
+							: stakeImportance;
 				}
 
-				auto numerator = accountSummary.ActivityImportance.unwrap() * targetActivityImportanceRaw;
-				return accountSummary.StakeImportance + Importance(numerator / totalActivityImportance.unwrap());
+				auto numerator = activityImportance.unwrap() * targetActivityImportanceRaw;
+				return stakeImportance + Importance(numerator / totalActivityImportance.unwrap());
 			}
 
 		private:
 			const model::BlockChainConfiguration m_config;
+			ImportanceCalculatorPoolSupplier m_poolSupplier;
+			size_t m_minParallelAccounts;
 		};
 	}
 
 	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(const model::BlockChainConfiguration& config) {
-		return std::make_unique<PosImportanceCalculator>(config);
+		return CreateImportanceCalculator(config, ImportanceCalculatorPoolSupplier());
+	}
+
+	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(
+			const model::BlockChainConfiguration& config,
+			const ImportanceCalculatorPoolSupplier& poolSupplier) {
+		return CreateImportanceCalculator(config, poolSupplier, Default_Min_Parallel_Accounts);
+	}
+
+	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(
+			const model::BlockChainConfiguration& config,
+			const ImportanceCalculatorPoolSupplier& poolSupplier,
+			size_t minParallelAccounts) {
+		return std::make_unique<PosImportanceCalculator>(config, poolSupplier, minParallelAccounts);
 	}
 }}
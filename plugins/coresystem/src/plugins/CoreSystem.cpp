@@ -35,6 +35,7 @@
 #include "catapult/keylink/KeyLinkValidator.h"
 #include "catapult/keylink/MultiKeyLinkObserver.h"
 #include "catapult/keylink/MultiKeyLinkValidator.h"
+#include "catapult/model/Address.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/plugins/CacheHandlers.h"
 #include "catapult/plugins/PluginManager.h"
@@ -57,6 +58,29 @@ namespace catapult { namespace plugins {
 			};
 		}
 
+		void CollectAccountAddresses(
+				const model::Notification& notification,
+				const model::ResolverContext& resolvers,
+				model::NetworkIdentifier networkIdentifier,
+				std::vector<Address>& addresses) {
+			if (model::AccountAddressNotification::Notification_Type == notification.Type) {
+				addresses.push_back(static_cast<const model::AccountAddressNotification&>(notification).Address.resolved(resolvers));
+			} else if (model::AccountPublicKeyNotification::Notification_Type == notification.Type) {
+				const auto& publicKey = static_cast<const model::AccountPublicKeyNotification&>(notification).PublicKey;
+				addresses.push_back(model::PublicKeyToAddress(publicKey, networkIdentifier));
+			} else if (model::BalanceTransferNotification::Notification_Type == notification.Type) {
+				const auto& transferNotification = static_cast<const model::BalanceTransferNotification&>(notification);
+				addresses.push_back(transferNotification.Sender);
+				addresses.push_back(resolvers.resolve(transferNotification.Recipient));
+			} else if (model::BalanceDebitNotification::Notification_Type == notification.Type) {
+				addresses.push_back(static_cast<const model::BalanceDebitNotification&>(notification).Sender);
+			} else if (model::BlockNotification::Notification_Type == notification.Type) {
+				const auto& blockNotification = static_cast<const model::BlockNotification&>(notification);
+				addresses.push_back(blockNotification.Harvester);
+				addresses.push_back(blockNotification.Beneficiary);
+			}
+		}
+
 		void AddAccountStateCache(PluginManager& manager, const model::BlockChainConfiguration& config) {
 			using namespace catapult::cache;
 
@@ -67,6 +91,13 @@ namespace catapult { namespace plugins {
 			using CacheHandlers = CacheHandlers<cache::AccountStateCacheDescriptor>;
 			CacheHandlers::Register<model::FacilityCode::Core>(manager);
 
+			auto networkIdentifier = config.Network.Identifier;
+			manager.addCachePrefetcher(cache::CreateCachePrefetcherFactory<AccountStateCache, Address>(
+					cache::CachePrefetchPhase::Default,
+					[networkIdentifier](const auto& notification, const auto& resolvers, auto& addresses) {
+						CollectAccountAddresses(notification, resolvers, networkIdentifier, addresses);
+					}));
+
 			manager.addDiagnosticCounterHook([](auto& counters, const CatapultCache& cache) {
 				counters.emplace_back(utils::DiagnosticCounterId("ACNTST C"), [&cache]() {
 					return cache.sub<AccountStateCache>().createView()->size();
@@ -93,10 +124,10 @@ namespace catapult { namespace plugins {
 
 		// region observers
 
-		auto CreateRecalculateImportancesObserver(
-				const model::BlockChainConfiguration& config,
-				const config::CatapultDirectory& directory) {
-			auto pCommitCalculator = importance::CreateImportanceCalculator(config);
+		auto CreateRecalculateImportancesObserver(const PluginManager& manager, const config::CatapultDirectory& directory) {
+			// worker pool is only available after the node is booted, so it needs to be retrieved for each recalculation
+			const auto& config = manager.config();
+			auto pCommitCalculator = importance::CreateImportanceCalculator(config, [&manager]() { return manager.workerPool(); });
 			auto pRollbackCalculator = importance::CreateRestoreImportanceCalculator();
 
 			if (0 == config.MaxRollbackBlocks) {
@@ -220,7 +251,7 @@ namespace catapult { namespace plugins {
 		});
 
 		auto dataDirectory = config::CatapultDataDirectory(manager.userConfig().DataDirectory);
-		manager.addTransientObserverHook([&config, dataDirectory](auto& builder) {
+		manager.addTransientObserverHook([&manager, &config, dataDirectory](auto& builder) {
 			// important:
 			// HighValueAccountObserver and RecalculateImportancesObserver are both triggered by BlockNotification and must execute
 			// AFTER all state changes.
@@ -228,7 +259,7 @@ namespace catapult { namespace plugins {
 			// registered as transient observers independent of any transient observers registered by other plugins.
 			builder
 				.add(observers::CreateHighValueAccountObserver(observers::NotifyMode::Commit))
-				.add(CreateRecalculateImportancesObserver(config, dataDirectory.dir("importance")))
+				.add(CreateRecalculateImportancesObserver(manager, dataDirectory.dir("importance")))
 				.add(observers::CreateHighValueAccountObserver(observers::NotifyMode::Rollback))
 				.add(observers::CreateBlockStatisticObserver(config.MaxDifficultyBlocks, config.DefaultDynamicFeeMultiplier));
 		});
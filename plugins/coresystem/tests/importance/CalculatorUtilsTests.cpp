@@ -393,5 +393,25 @@ namespace catapult { namespace importance {
 		AssertActivityImportance(0, Importance(4'500), Importance());
 	}
 
+	TEST(TEST_CLASS, CanCalculateImportancesFromBalanceAndActivitySummary) {
+		// Arrange:
+		AccountActivitySummary activitySummary;
+		activitySummary.TotalFeesPaid = Amount(200);
+		activitySummary.BeneficiaryCount = 100;
+		ImportanceCalculationContext importanceContext;
+		importanceContext.ActiveHarvestingMosaics = Amount(1'000);
+		importanceContext.TotalFeesPaid = Amount(600);
+		importanceContext.TotalBeneficiaryCount = 300;
+		auto config = CreateBlockChainConfiguration(25);
+
+		// Act:
+		auto importances = CalculateImportances(Amount(500), activitySummary, importanceContext, config);
+
+		// Assert:    stake importance: 9'000 * (500 / 1'000) * ((100 - 25) / 100) = 3'375
+		//         activity importance: 1'200 + 300 = 1'500
+		EXPECT_EQ(Importance(3'375), importances.StakeImportance);
+		EXPECT_EQ(Importance(1'500), importances.ActivityImportance);
+	}
+
 	// endregion
 }}
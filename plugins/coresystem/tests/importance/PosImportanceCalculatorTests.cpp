@@ -26,6 +26,7 @@
 #include "catapult/state/AccountActivityBuckets.h"
 #include "tests/test/cache/AccountStateCacheTestUtils.h"
 #include "tests/test/core/AccountStateTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace importance {
@@ -600,4 +601,172 @@ namespace catapult { namespace importance {
 	}
 
 	// endregion
+
+	// region parallel recalculation
+
+	namespace {
+		constexpr uint8_t Num_Parallel_Account_States = 250;
+
+		std::vector<AccountSeed> CreateVariedAccountSeeds(const model::BlockChainConfiguration& config) {
+			auto height1 = Recalculation_Height - model::ImportanceHeight(2);
+			auto height2 = Recalculation_Height - model::ImportanceHeight(1);
+
+			std::vector<AccountSeed> accountSeeds;
+			for (auto i = 1u; i <= Num_Parallel_Account_States; ++i) {
+				// some accounts have balances below the min harvester balance
+				auto amount = Amount((i % 7 + 1) * i * config.MinHarvesterBalance.unwrap() / 20);
+				std::vector<state::AccountActivityBuckets::ActivityBucket> buckets;
+				buckets.push_back(CreateActivityBucket(Amount(i * 17 % 1000), i * 13 % 100, height1));
+				buckets.push_back(CreateActivityBucket(Amount(i * 31 % 1000), i * 7 % 100, height2));
+				accountSeeds.emplace_back(amount, buckets);
+			}
+
+			return accountSeeds;
+		}
+
+		std::vector<uint64_t> GetBucketRawScores(const state::AccountActivityBuckets& buckets) {
+			std::vector<uint64_t> rawScores;
+			for (const auto& bucket : buckets)
+				rawScores.push_back(bucket.RawScore);
+
+			return rawScores;
+		}
+
+		template<typename TTraits>
+		void AssertParallelRecalculationMatchesSequentialRecalculation(uint32_t numWorkerThreads) {
+			// Arrange:
+			auto config = TTraits::CreateConfiguration();
+			auto accountSeeds = CreateVariedAccountSeeds(config);
+
+			CacheHolder sequentialHolder(config.MinHarvesterBalance);
+			sequentialHolder.seedDelta(accountSeeds, Recalculation_Height);
+			auto pSequentialCalculator = CreateImportanceCalculator(config, ImportanceCalculatorPoolSupplier(), 0);
+
+			CacheHolder parallelHolder(config.MinHarvesterBalance);
+			parallelHolder.seedDelta(accountSeeds, Recalculation_Height);
+			auto pPool = test::CreateStartedIoThreadPool(numWorkerThreads);
+			auto pParallelCalculator = CreateImportanceCalculator(config, [&pPool]() { return pPool.get(); }, 1);
+
+			// Act:
+			RecalculateTwice(*pSequentialCalculator, Recalculation_Height, sequentialHolder.delta());
+			RecalculateTwice(*pParallelCalculator, Recalculation_Height, parallelHolder.delta());
+
+			// Assert:
+			auto numAccountsWithImportance = 0u;
+			for (uint8_t i = 1; i <= Num_Parallel_Account_States; ++i) {
+				const auto& expectedAccountState = sequentialHolder.get(Key{ { i } });
+				const auto& accountState = parallelHolder.get(Key{ { i } });
+
+				const auto& expectedSnapshots = expectedAccountState.ImportanceSnapshots;
+				EXPECT_EQ(expectedSnapshots.current(), accountState.ImportanceSnapshots.current()) << "account " << i;
+				EXPECT_EQ(test::GetSnapshotHeights(expectedSnapshots), test::GetSnapshotHeights(accountState.ImportanceSnapshots))
+						<< "account " << i;
+
+				const auto& expectedBuckets = expectedAccountState.ActivityBuckets;
+				EXPECT_EQ(test::GetBucketHeights(expectedBuckets), test::GetBucketHeights(accountState.ActivityBuckets)) << "account " << i;
+				EXPECT_EQ(GetBucketRawScores(expectedBuckets), GetBucketRawScores(accountState.ActivityBuckets)) << "account " << i;
+
+				if (Importance() != expectedSnapshots.current())
+					++numAccountsWithImportance;
+			}
+
+			// Sanity:
+			EXPECT_LT(0u, numAccountsWithImportance);
+			EXPECT_GT(Num_Parallel_Account_States, numAccountsWithImportance);
+		}
+	}
+
+	ACTIVITY_BASED_TEST(ParallelRecalculationMatchesSequentialRecalculation) {
+		AssertParallelRecalculationMatchesSequentialRecalculation<TTraits>(2);
+		AssertParallelRecalculationMatchesSequentialRecalculation<TTraits>(3);
+		AssertParallelRecalculationMatchesSequentialRecalculation<TTraits>(8);
+	}
+
+	namespace {
+		template<typename TTraits>
+		void AssertRecalculationIsSequential(const ImportanceCalculatorPoolSupplier& poolSupplier, size_t minParallelAccounts) {
+			// Arrange:
+			auto config = TTraits::CreateConfiguration();
+			auto accountSeeds = CreateVariedAccountSeeds(config);
+
+			CacheHolder holder1(config.MinHarvesterBalance);
+			holder1.seedDelta(accountSeeds, Recalculation_Height);
+			auto pCalculator1 = CreateImportanceCalculator(config, ImportanceCalculatorPoolSupplier(), 0);
+
+			CacheHolder holder2(config.MinHarvesterBalance);
+			holder2.seedDelta(accountSeeds, Recalculation_Height);
+			auto pCalculator2 = CreateImportanceCalculator(config, poolSupplier, minParallelAccounts);
+
+			// Act:
+			RecalculateTwice(*pCalculator1, Recalculation_Height, holder1.delta());
+			RecalculateTwice(*pCalculator2, Recalculation_Height, holder2.delta());
+
+			// Assert: results are the same irrespective of threading
+			for (uint8_t i = 1; i <= Num_Parallel_Account_States; ++i) {
+				auto expectedImportance = holder1.get(Key{ { i } }).ImportanceSnapshots.current();
+				EXPECT_EQ(expectedImportance, holder2.get(Key{ { i } }).ImportanceSnapshots.current()) << "account " << i;
+			}
+		}
+	}
+
+	ACTIVITY_BASED_TEST(ParallelRecalculationIsNotUsedForFewerThanMinParallelAccounts) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool(4);
+		auto numPoolRequests = 0u;
+		auto poolSupplier = [&pPool, &numPoolRequests]() {
+			++numPoolRequests;
+			return pPool.get();
+		};
+
+		// Act:
+		AssertRecalculationIsSequential<TTraits>(poolSupplier, 1'000);
+
+		// Assert: pool was never requested
+		EXPECT_EQ(0u, numPoolRequests);
+	}
+
+	ACTIVITY_BASED_TEST(ParallelRecalculationIsNotUsedWhenPoolIsUnavailable) {
+		// Arrange:
+		auto numPoolRequests = 0u;
+		auto poolSupplier = [&numPoolRequests]() {
+			++numPoolRequests;
+			return static_cast<thread::IoThreadPool*>(nullptr);
+		};
+
+		// Act:
+		AssertRecalculationIsSequential<TTraits>(poolSupplier, 1);
+
+		// Assert: pool was requested for each recalculation
+		EXPECT_EQ(2u, numPoolRequests);
+	}
+
+	namespace {
+		void AssertRecalculationFailsWhenAnyBucketHasStartHeightGreaterThanRecalculationHeight(uint32_t numWorkerThreads) {
+			// Arrange:
+			auto config = CreateBlockChainConfiguration(10);
+			auto accountSeeds = CreateVariedAccountSeeds(config);
+			accountSeeds[123].Buckets.push_back(CreateActivityBucket(Amount(), 0, Recalculation_Height + model::ImportanceHeight(1)));
+
+			CacheHolder holder(config.MinHarvesterBalance);
+			holder.seedDelta(accountSeeds, Recalculation_Height);
+			holder.delta().updateHighValueAccounts(Height(1));
+			auto pPool = test::CreateStartedIoThreadPool(numWorkerThreads);
+			auto pCalculator = CreateImportanceCalculator(config, [&pPool]() { return pPool.get(); }, 1);
+
+			// Act + Assert:
+			EXPECT_THROW(
+					pCalculator->recalculate(ImportanceRollbackMode::Disabled, Recalculation_Height, holder.delta()),
+					catapult_invalid_argument);
+		}
+	}
+
+	TEST(TEST_CLASS, SequentialRecalculationFailsWhenAnyBucketHasStartHeightGreaterThanRecalculationHeight) {
+		AssertRecalculationFailsWhenAnyBucketHasStartHeightGreaterThanRecalculationHeight(1);
+	}
+
+	TEST(TEST_CLASS, ParallelRecalculationFailsWhenAnyBucketHasStartHeightGreaterThanRecalculationHeight) {
+		AssertRecalculationFailsWhenAnyBucketHasStartHeightGreaterThanRecalculationHeight(4);
+	}
+
+	// endregion
 }}
@@ -22,7 +22,7 @@
 #include "Observers.h"
 #include "src/cache/HashLockInfoCache.h"
 #include "src/model/HashLockReceiptType.h"
-#include "plugins/txes/aggregate/src/model/AggregateEntityType.h"
+#include "src/model/HashLockUtils.h"
 #include "plugins/txes/lock_shared/src/observers/LockStatusAccountBalanceObserver.h"
 
 namespace catapult { namespace observers {
@@ -47,7 +47,7 @@ namespace catapult { namespace observers {
 	}
 
 	DEFINE_OBSERVER(CompletedAggregate, Notification, [](const Notification& notification, ObserverContext& context) {
-		if (model::Entity_Type_Aggregate_Bonded != notification.TransactionType)
+		if (!model::RequiresHashLock(notification.TransactionType))
 			return;
 
 		LockStatusAccountBalanceObserver<HashTraits>(notification, context);
@@ -23,6 +23,7 @@
 #include "src/cache/HashLockInfoCache.h"
 #include "src/config/HashLockConfiguration.h"
 #include "src/model/HashLockReceiptType.h"
+#include "src/model/HashLockUtils.h"
 #include "src/observers/Observers.h"
 #include "src/plugins/HashLockTransactionPlugin.h"
 #include "src/validators/Validators.h"
@@ -31,6 +32,19 @@
 
 namespace catapult { namespace plugins {
 
+	namespace {
+		void CollectLockHashes(const model::Notification& notification, const model::ResolverContext&, std::vector<Hash256>& hashes) {
+			if (model::HashLockNotification::Notification_Type == notification.Type) {
+				hashes.push_back(static_cast<const model::HashLockNotification&>(notification).Hash);
+			} else if (model::TransactionNotification::Notification_Type == notification.Type) {
+				// only completed transactions secured by hash locks consume them
+				const auto& transactionNotification = static_cast<const model::TransactionNotification&>(notification);
+				if (model::RequiresHashLock(transactionNotification.TransactionType))
+					hashes.push_back(transactionNotification.TransactionHash);
+			}
+		}
+	}
+
 	void RegisterHashLockSubsystem(PluginManager& manager) {
 		manager.addTransactionSupport(CreateHashLockTransactionPlugin());
 
@@ -40,6 +54,10 @@ namespace catapult { namespace plugins {
 		using CacheHandlers = CacheHandlers<cache::HashLockInfoCacheDescriptor>;
 		CacheHandlers::Register<model::FacilityCode::LockHash>(manager);
 
+		manager.addCachePrefetcher(cache::CreateCachePrefetcherFactory<cache::HashLockInfoCache, Hash256>(
+				cache::CachePrefetchPhase::Default,
+				CollectLockHashes));
+
 		manager.addDiagnosticCounterHook([](auto& counters, const cache::CatapultCache& cache) {
 			counters.emplace_back(utils::DiagnosticCounterId("HASHLOCK C"), [&cache]() {
 				return cache.sub<cache::HashLockInfoCache>().createView()->size();
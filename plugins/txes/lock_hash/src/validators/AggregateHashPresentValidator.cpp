@@ -21,7 +21,7 @@
 
 #include "Validators.h"
 #include "src/cache/HashLockInfoCache.h"
-#include "plugins/txes/aggregate/src/model/AggregateEntityType.h"
+#include "src/model/HashLockUtils.h"
 #include "catapult/validators/ValidatorContext.h"
 
 namespace catapult { namespace validators {
@@ -29,7 +29,7 @@ namespace catapult { namespace validators {
 	using Notification = model::TransactionNotification;
 
 	DEFINE_STATEFUL_VALIDATOR(AggregateHashPresent, [](const Notification& notification, const ValidatorContext& context) {
-		if (model::Entity_Type_Aggregate_Bonded != notification.TransactionType)
+		if (!model::RequiresHashLock(notification.TransactionType))
 			return ValidationResult::Success;
 
 		const auto& cache = context.Cache.sub<cache::HashLockInfoCache>();
@@ -0,0 +1,39 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/model/HashLockUtils.h"
+#include "src/model/HashLockEntityType.h"
+#include "plugins/txes/aggregate/src/model/AggregateEntityType.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS HashLockUtilsTests
+
+	TEST(TEST_CLASS, RequiresHashLockReturnsTrueForBondedAggregate) {
+		EXPECT_TRUE(RequiresHashLock(Entity_Type_Aggregate_Bonded));
+	}
+
+	TEST(TEST_CLASS, RequiresHashLockReturnsFalseForOtherTransactionTypes) {
+		for (auto transactionType : { Entity_Type_Aggregate_Complete, Entity_Type_Hash_Lock, static_cast<EntityType>(0xFFFF) })
+			EXPECT_FALSE(RequiresHashLock(transactionType)) << transactionType;
+	}
+}}
@@ -22,6 +22,7 @@
 #include "SecretLockPlugin.h"
 #include "src/cache/SecretLockInfoCache.h"
 #include "src/config/SecretLockConfiguration.h"
+#include "src/model/LockHashUtils.h"
 #include "src/model/SecretLockReceiptType.h"
 #include "src/observers/Observers.h"
 #include "src/plugins/SecretLockTransactionPlugin.h"
@@ -32,6 +33,26 @@
 
 namespace catapult { namespace plugins {
 
+	namespace {
+		template<typename TNotification>
+		Hash256 CalculateSecretLockInfoHash(const TNotification& notification, const model::ResolverContext& resolvers) {
+			return model::CalculateSecretLockInfoHash(notification.Secret, resolvers.resolve(notification.Recipient));
+		}
+
+		void CollectLockHashes(
+				const model::Notification& notification,
+				const model::ResolverContext& resolvers,
+				std::vector<Hash256>& hashes) {
+			if (model::SecretLockNotification::Notification_Type == notification.Type) {
+				const auto& lockNotification = static_cast<const model::SecretLockNotification&>(notification);
+				hashes.push_back(CalculateSecretLockInfoHash(lockNotification, resolvers));
+			} else if (model::ProofPublicationNotification::Notification_Type == notification.Type) {
+				const auto& proofNotification = static_cast<const model::ProofPublicationNotification&>(notification);
+				hashes.push_back(CalculateSecretLockInfoHash(proofNotification, resolvers));
+			}
+		}
+	}
+
 	void RegisterSecretLockSubsystem(PluginManager& manager) {
 		manager.addTransactionSupport(CreateSecretProofTransactionPlugin());
 		manager.addTransactionSupport(CreateSecretLockTransactionPlugin());
@@ -42,6 +63,10 @@ namespace catapult { namespace plugins {
 		using CacheHandlers = CacheHandlers<cache::SecretLockInfoCacheDescriptor>;
 		CacheHandlers::Register<model::FacilityCode::LockSecret>(manager);
 
+		manager.addCachePrefetcher(cache::CreateCachePrefetcherFactory<cache::SecretLockInfoCache, Hash256>(
+				cache::CachePrefetchPhase::Default,
+				CollectLockHashes));
+
 		manager.addDiagnosticCounterHook([](auto& counters, const cache::CatapultCache& cache) {
 			counters.emplace_back(utils::DiagnosticCounterId("SECRETLOCK C"), [&cache]() {
 				return cache.sub<cache::SecretLockInfoCache>().createView()->size();
@@ -43,6 +43,7 @@ namespace catapult { namespace cache {
 			, public LockInfoCacheDeltaMixins<TDescriptor, TCacheTypes>::Contains
 			, public LockInfoCacheDeltaMixins<TDescriptor, TCacheTypes>::ConstAccessor
 			, public LockInfoCacheDeltaMixins<TDescriptor, TCacheTypes>::MutableAccessor
+			, public LockInfoCacheDeltaMixins<TDescriptor, TCacheTypes>::Prefetch
 			, public LockInfoCacheDeltaMixins<TDescriptor, TCacheTypes>::PatriciaTreeDelta
 			, public LockInfoCacheDeltaMixins<TDescriptor, TCacheTypes>::ActivePredicate
 			, public LockInfoCacheDeltaMixins<TDescriptor, TCacheTypes>::Pruning
@@ -60,6 +61,7 @@ namespace catapult { namespace cache {
 				, LockInfoCacheDeltaMixins<TDescriptor, TCacheTypes>::Contains(*lockInfoSets.pPrimary)
 				, LockInfoCacheDeltaMixins<TDescriptor, TCacheTypes>::ConstAccessor(*lockInfoSets.pPrimary)
 				, LockInfoCacheDeltaMixins<TDescriptor, TCacheTypes>::MutableAccessor(*lockInfoSets.pPrimary)
+				, LockInfoCacheDeltaMixins<TDescriptor, TCacheTypes>::Prefetch(*lockInfoSets.pPrimary)
 				, LockInfoCacheDeltaMixins<TDescriptor, TCacheTypes>::PatriciaTreeDelta(*lockInfoSets.pPrimary, lockInfoSets.pPatriciaTree)
 				, LockInfoCacheDeltaMixins<TDescriptor, TCacheTypes>::ActivePredicate(*lockInfoSets.pPrimary)
 				, LockInfoCacheDeltaMixins<TDescriptor, TCacheTypes>::Pruning(*lockInfoSets.pPrimary, *lockInfoSets.pHeightGrouping)
@@ -44,6 +44,7 @@ namespace catapult { namespace cache {
 			, public MosaicCacheDeltaMixins::Contains
 			, public MosaicCacheDeltaMixins::ConstAccessor
 			, public MosaicCacheDeltaMixins::MutableAccessor
+			, public MosaicCacheDeltaMixins::Prefetch
 			, public MosaicCacheDeltaMixins::PatriciaTreeDelta
 			, public MosaicCacheDeltaMixins::ActivePredicate
 			, public MosaicCacheDeltaMixins::BasicInsertRemove
@@ -53,6 +53,23 @@ namespace catapult { namespace plugins {
 		auto GetMosaicView(const cache::CatapultCache& cache) {
 			return cache.sub<cache::MosaicCache>().createView();
 		}
+
+		void CollectMosaicIds(
+				const model::Notification& notification,
+				const model::ResolverContext& resolvers,
+				std::vector<MosaicId>& mosaicIds) {
+			if (model::BalanceTransferNotification::Notification_Type == notification.Type) {
+				mosaicIds.push_back(resolvers.resolve(static_cast<const model::BalanceTransferNotification&>(notification).MosaicId));
+			} else if (model::BalanceDebitNotification::Notification_Type == notification.Type) {
+				mosaicIds.push_back(resolvers.resolve(static_cast<const model::BalanceDebitNotification&>(notification).MosaicId));
+			} else if (model::MosaicRequiredNotification::Notification_Type == notification.Type) {
+				mosaicIds.push_back(static_cast<const model::MosaicRequiredNotification&>(notification).MosaicId.resolved(resolvers));
+			} else if (model::MosaicDefinitionNotification::Notification_Type == notification.Type) {
+				mosaicIds.push_back(static_cast<const model::MosaicDefinitionNotification&>(notification).MosaicId);
+			} else if (model::MosaicSupplyChangeNotification::Notification_Type == notification.Type) {
+				mosaicIds.push_back(resolvers.resolve(static_cast<const model::MosaicSupplyChangeNotification&>(notification).MosaicId));
+			}
+		}
 	}
 
 	void RegisterMosaicSubsystem(PluginManager& manager) {
@@ -68,6 +85,10 @@ namespace catapult { namespace plugins {
 		using CacheHandlers = CacheHandlers<cache::MosaicCacheDescriptor>;
 		CacheHandlers::Register<model::FacilityCode::Mosaic>(manager);
 
+		manager.addCachePrefetcher(cache::CreateCachePrefetcherFactory<cache::MosaicCache, MosaicId>(
+				cache::CachePrefetchPhase::Default,
+				CollectMosaicIds));
+
 		manager.addDiagnosticCounterHook([](auto& counters, const cache::CatapultCache& cache) {
 			counters.emplace_back(utils::DiagnosticCounterId("MOSAIC C"), [&cache]() { return GetMosaicView(cache)->size(); });
 		});
@@ -62,6 +62,23 @@ namespace catapult { namespace cache {
 		return m_gracePeriodDuration;
 	}
 
+	void BasicNamespaceCacheDelta::prefetch(const std::vector<NamespaceId>& ids) const {
+		// root ids are only known after the namespaces themselves have been loaded
+		const auto& namespaceById = *m_pNamespaceById;
+		namespaceById.prefetch(ids);
+
+		std::vector<NamespaceId> rootIds;
+		std::unordered_set<NamespaceId, utils::BaseValueHasher<NamespaceId>> uniqueRootIds;
+		for (auto id : ids) {
+			auto namespaceIter = namespaceById.find(id);
+			const auto* pNamespace = namespaceIter.get();
+			if (pNamespace && uniqueRootIds.insert(pNamespace->rootId()).second)
+				rootIds.push_back(pNamespace->rootId());
+		}
+
+		m_pHistoryById->prefetch(rootIds);
+	}
+
 	void BasicNamespaceCacheDelta::insert(const state::RootNamespace& ns) {
 		// register the namespace for expiration at the end of its lifetime (if its lifetime changes later, it will not be pruned)
 		AddIdentifierWithGroup(*m_pRootNamespaceIdsByExpiryHeight, ns.lifetime().End, ns.id());
@@ -75,6 +75,9 @@ namespace catapult { namespace cache {
 		/// Gets the grace period duration.
 		BlockDuration gracePeriodDuration() const;
 
+		/// Prefetches the namespaces identified by \a ids and their root namespace histories.
+		void prefetch(const std::vector<NamespaceId>& ids) const;
+
 	public:
 		/// Inserts the root namespace \a ns into the cache.
 		void insert(const state::RootNamespace& ns);
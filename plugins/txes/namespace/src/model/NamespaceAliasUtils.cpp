@@ -0,0 +1,45 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "NamespaceAliasUtils.h"
+#include <cstring>
+
+namespace catapult { namespace model {
+
+	bool TryGetAliasNamespaceId(UnresolvedMosaicId mosaicId, NamespaceId& namespaceId) {
+		// namespace ids always have their high bit set
+		constexpr uint64_t Namespace_Flag = 1ull << 63;
+		if (0 == (Namespace_Flag & mosaicId.unwrap()))
+			return false;
+
+		namespaceId = NamespaceId(mosaicId.unwrap());
+		return true;
+	}
+
+	bool TryGetAliasNamespaceId(const UnresolvedAddress& address, NamespaceId& namespaceId) {
+		// aliased addresses have the low bit of the network byte set and store the namespace id immediately after it
+		if (0 == (1 & address[0]))
+			return false;
+
+		std::memcpy(static_cast<void*>(&namespaceId), address.data() + 1, sizeof(NamespaceId));
+		return true;
+	}
+}}
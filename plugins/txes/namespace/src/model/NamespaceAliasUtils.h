@@ -0,0 +1,34 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "plugins/txes/namespace/src/types.h"
+
+namespace catapult { namespace model {
+
+	/// Tries to extract the aliasing namespace id from \a mosaicId into \a namespaceId.
+	/// Returns \c false if \a mosaicId is not an alias.
+	bool TryGetAliasNamespaceId(UnresolvedMosaicId mosaicId, NamespaceId& namespaceId);
+
+	/// Tries to extract the aliasing namespace id from \a address into \a namespaceId.
+	/// Returns \c false if \a address is not an alias.
+	bool TryGetAliasNamespaceId(const UnresolvedAddress& address, NamespaceId& namespaceId);
+}}
@@ -27,6 +27,7 @@
 #include "src/cache/NamespaceCacheStorage.h"
 #include "src/cache/NamespaceCacheSubCachePlugin.h"
 #include "src/config/NamespaceConfiguration.h"
+#include "src/model/NamespaceAliasUtils.h"
 #include "src/model/NamespaceLifetimeConstraints.h"
 #include "src/model/NamespaceReceiptType.h"
 #include "src/observers/Observers.h"
@@ -105,8 +106,8 @@ namespace catapult { namespace plugins {
 
 		void RegisterNamespaceAliasResolvers(PluginManager& manager) {
 			manager.addMosaicResolver([](const auto&, const auto& unresolved, auto& resolved) {
-				constexpr uint64_t Namespace_Flag = 1ull << 63;
-				if (0 == (Namespace_Flag & unresolved.unwrap())) {
+				NamespaceId namespaceId;
+				if (!model::TryGetAliasNamespaceId(unresolved, namespaceId)) {
 					resolved = model::ResolverContext().resolve(unresolved);
 					return true;
 				}
@@ -115,15 +116,19 @@ namespace catapult { namespace plugins {
 			});
 
 			manager.addMosaicResolver([](const auto& cache, const auto& unresolved, auto& resolved) {
+				NamespaceId namespaceId;
+				if (!model::TryGetAliasNamespaceId(unresolved, namespaceId))
+					return false;
+
 				auto namespaceCache = cache.template sub<cache::NamespaceCache>();
-				auto namespaceId = NamespaceId(unresolved.unwrap());
 				return RunNamespaceResolver(namespaceCache, namespaceId, state::AliasType::Mosaic, resolved, [](const auto& alias) {
 					return alias.mosaicId();
 				});
 			});
 
 			manager.addAddressResolver([](const auto&, const auto& unresolved, auto& resolved) {
-				if (0 == (1 & unresolved[0])) {
+				NamespaceId namespaceId;
+				if (!model::TryGetAliasNamespaceId(unresolved, namespaceId)) {
 					resolved = model::ResolverContext().resolve(unresolved);
 					return true;
 				}
@@ -132,15 +137,57 @@ namespace catapult { namespace plugins {
 			});
 
 			manager.addAddressResolver([](const auto& cache, const auto& unresolved, auto& resolved) {
-				auto namespaceCache = cache.template sub<cache::NamespaceCache>();
 				NamespaceId namespaceId;
-				std::memcpy(static_cast<void*>(&namespaceId), unresolved.data() + 1, sizeof(NamespaceId));
+				if (!model::TryGetAliasNamespaceId(unresolved, namespaceId))
+					return false;
+
+				auto namespaceCache = cache.template sub<cache::NamespaceCache>();
 				return RunNamespaceResolver(namespaceCache, namespaceId, state::AliasType::Address, resolved, [](const auto& alias) {
 					return alias.address();
 				});
 			});
 		}
 
+		template<typename TUnresolved>
+		void CollectAliasNamespaceId(const TUnresolved& unresolved, std::vector<NamespaceId>& namespaceIds) {
+			NamespaceId namespaceId;
+			if (model::TryGetAliasNamespaceId(unresolved, namespaceId))
+				namespaceIds.push_back(namespaceId);
+		}
+
+		template<typename TUnresolved, typename TResolved>
+		void CollectAliasNamespaceId(const model::Resolvable<TUnresolved, TResolved>& resolvable, std::vector<NamespaceId>& namespaceIds) {
+			if (!resolvable.isResolved())
+				CollectAliasNamespaceId(resolvable.unresolved(), namespaceIds);
+		}
+
+		void CollectNamespaceIds(const model::Notification& notification, const model::ResolverContext&, std::vector<NamespaceId>& ids) {
+			// collect all namespaces that are needed to resolve aliases in addition to all explicitly referenced namespaces
+			if (model::AccountAddressNotification::Notification_Type == notification.Type) {
+				CollectAliasNamespaceId(static_cast<const model::AccountAddressNotification&>(notification).Address, ids);
+			} else if (model::BalanceTransferNotification::Notification_Type == notification.Type) {
+				const auto& transferNotification = static_cast<const model::BalanceTransferNotification&>(notification);
+				CollectAliasNamespaceId(transferNotification.MosaicId, ids);
+				CollectAliasNamespaceId(transferNotification.Recipient, ids);
+			} else if (model::BalanceDebitNotification::Notification_Type == notification.Type) {
+				CollectAliasNamespaceId(static_cast<const model::BalanceDebitNotification&>(notification).MosaicId, ids);
+			} else if (model::MosaicRequiredNotification::Notification_Type == notification.Type) {
+				const auto& mosaicRequiredNotification = static_cast<const model::MosaicRequiredNotification&>(notification);
+				CollectAliasNamespaceId(mosaicRequiredNotification.Owner, ids);
+				CollectAliasNamespaceId(mosaicRequiredNotification.MosaicId, ids);
+			} else if (model::RootNamespaceNotification::Notification_Type == notification.Type) {
+				ids.push_back(static_cast<const model::RootNamespaceNotification&>(notification).NamespaceId);
+			} else if (model::ChildNamespaceNotification::Notification_Type == notification.Type) {
+				const auto& childNotification = static_cast<const model::ChildNamespaceNotification&>(notification);
+				ids.push_back(childNotification.NamespaceId);
+				ids.push_back(childNotification.ParentId);
+			} else if (model::NamespaceRequiredNotification::Notification_Type == notification.Type) {
+				ids.push_back(static_cast<const model::NamespaceRequiredNotification&>(notification).NamespaceId);
+			} else if (model::AliasLinkNotification::Notification_Type == notification.Type) {
+				ids.push_back(static_cast<const model::AliasLinkNotification&>(notification).NamespaceId);
+			}
+		}
+
 		auto GetNamespaceView(const cache::CatapultCache& cache) {
 			return cache.sub<cache::NamespaceCache>().createView();
 		}
@@ -163,6 +210,11 @@ namespace catapult { namespace plugins {
 			using CacheHandlers = CacheHandlers<cache::NamespaceCacheDescriptor>;
 			CacheHandlers::Register<model::FacilityCode::Namespace>(manager);
 
+			// namespaces need to be loaded before any aliases can be resolved
+			manager.addCachePrefetcher(cache::CreateCachePrefetcherFactory<cache::NamespaceCache, NamespaceId>(
+					cache::CachePrefetchPhase::Resolution,
+					CollectNamespaceIds));
+
 			manager.addDiagnosticCounterHook([](auto& counters, const cache::CatapultCache& cache) {
 				counters.emplace_back(utils::DiagnosticCounterId("NS C"), [&cache]() { return GetNamespaceView(cache)->size(); });
 				counters.emplace_back(utils::DiagnosticCounterId("NS C AS"), [&cache]() { return GetNamespaceView(cache)->activeSize(); });
@@ -0,0 +1,88 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/model/NamespaceAliasUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS NamespaceAliasUtilsTests
+
+	namespace {
+		constexpr uint64_t Unresolved_Flag = 1ull << 63;
+	}
+
+	// region mosaic id
+
+	TEST(TEST_CLASS, CannotGetAliasNamespaceIdFromResolvedMosaicId) {
+		// Arrange:
+		auto namespaceId = NamespaceId(987);
+
+		// Act:
+		auto result = TryGetAliasNamespaceId(UnresolvedMosaicId(0x1234), namespaceId);
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(NamespaceId(987), namespaceId);
+	}
+
+	TEST(TEST_CLASS, CanGetAliasNamespaceIdFromUnresolvedMosaicId) {
+		// Arrange:
+		NamespaceId namespaceId;
+
+		// Act:
+		auto result = TryGetAliasNamespaceId(UnresolvedMosaicId(Unresolved_Flag | 0x1234), namespaceId);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(NamespaceId(Unresolved_Flag | 0x1234), namespaceId);
+	}
+
+	// endregion
+
+	// region address
+
+	TEST(TEST_CLASS, CannotGetAliasNamespaceIdFromResolvedAddress) {
+		// Arrange:
+		auto namespaceId = NamespaceId(987);
+
+		// Act: unset bit 0 of first byte indicates a resolved address
+		auto result = TryGetAliasNamespaceId(UnresolvedAddress{ { 0x44, 0x33, 0x22, 0x11, 0x00, 0x00, 0x00, 0x00, 0x80 } }, namespaceId);
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(NamespaceId(987), namespaceId);
+	}
+
+	TEST(TEST_CLASS, CanGetAliasNamespaceIdFromUnresolvedAddress) {
+		// Arrange:
+		NamespaceId namespaceId;
+
+		// Act:
+		auto result = TryGetAliasNamespaceId(UnresolvedAddress{ { 0x01, 0x33, 0x22, 0x11, 0x00, 0x00, 0x00, 0x00, 0x80 } }, namespaceId);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(NamespaceId(Unresolved_Flag | 0x112233), namespaceId);
+	}
+
+	// endregion
+}}
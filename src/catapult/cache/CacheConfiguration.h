@@ -20,8 +20,10 @@
 **/
 
 #pragma once
+#include "catapult/cache_db/RocksGroupCommitter.h"
 #include "catapult/config/NodeConfiguration.h"
 #include "catapult/utils/FileSize.h"
+#include <memory>
 #include <string>
 
 namespace catapult { namespace cache {
@@ -72,5 +74,8 @@ namespace catapult { namespace cache {
 
 		/// \c true if patricia trees should be stored, \c false otherwise.
 		bool ShouldStorePatriciaTrees;
+
+		/// Group committer shared by all cache databases (optional).
+		std::shared_ptr<RocksGroupCommitter> pCacheDatabaseGroupCommitter;
 	};
 }}
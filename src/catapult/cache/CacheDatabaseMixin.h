@@ -40,7 +40,8 @@ namespace catapult { namespace cache {
 								config.CacheDatabaseDirectory,
 								config.CacheDatabaseConfig,
 								GetAdjustedColumnFamilyNames(config, columnFamilyNames),
-								pruningMode))
+								pruningMode,
+								config.pCacheDatabaseGroupCommitter))
 						: std::make_unique<CacheDatabase>())
 				, m_containerMode(GetContainerMode(config))
 				, m_hasPatriciaTreeSupport(config.ShouldStorePatriciaTrees)
@@ -114,6 +114,11 @@ namespace catapult { namespace cache {
 			public:
 				StorageSetType(CacheDatabase&, size_t)
 				{}
+
+			public:
+				/// Discards all prefetched elements (no-op because all elements are always in memory).
+				void discardPrefetched()
+				{}
 			};
 
 			using MemorySetType = std::set<ElementType>;
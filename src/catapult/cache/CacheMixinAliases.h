@@ -35,6 +35,7 @@ namespace catapult { namespace cache {
 
 		using ConstAccessor = ConstAccessorMixin<TSet, TCacheDescriptor>;
 		using MutableAccessor = MutableAccessorMixin<TSet, TCacheDescriptor>;
+		using Prefetch = PrefetchMixin<TSet, TCacheDescriptor>;
 
 		template<typename TValueAdapter>
 		using ConstAccessorWithAdapter = ConstAccessorMixin<TSet, TCacheDescriptor, TValueAdapter>;
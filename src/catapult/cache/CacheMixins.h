@@ -246,6 +246,27 @@ namespace catapult { namespace cache {
 		TSet& m_set;
 	};
 
+	/// Mixin for adding prefetch support to a cache.
+	template<typename TSet, typename TCacheDescriptor>
+	class PrefetchMixin {
+	private:
+		using KeyType = typename TCacheDescriptor::KeyType;
+
+	public:
+		/// Creates a mixin around \a set.
+		explicit PrefetchMixin(const TSet& set) : m_set(set)
+		{}
+
+	public:
+		/// Prefetches the cache values identified by \a keys so that subsequent finds of them are cheaper.
+		void prefetch(const std::vector<KeyType>& keys) const {
+			m_set.prefetch(keys);
+		}
+
+	private:
+		const TSet& m_set;
+	};
+
 	/// Mixin for adding active querying support to a cache.
 	template<typename TSet, typename TCacheDescriptor>
 	class ActivePredicateMixin {
@@ -0,0 +1,111 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "CatapultCacheDelta.h"
+#include "catapult/model/Notifications.h"
+#include "catapult/model/ResolverContext.h"
+#include "catapult/functions.h"
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	/// Phases in which cache prefetchers are run.
+	enum class CachePrefetchPhase {
+		/// Prefetchers of caches that are accessed when resolving unresolved values.
+		Resolution,
+
+		/// Prefetchers of all other caches, which are run after all resolution prefetchers.
+		Default
+	};
+
+	/// Collects cache keys referenced by notifications and prefetches them into a cache delta.
+	class CachePrefetcher {
+	public:
+		virtual ~CachePrefetcher() = default;
+
+	public:
+		/// Gets the phase in which the prefetcher is run.
+		virtual CachePrefetchPhase phase() const = 0;
+
+		/// Collects all keys referenced by \a notification, using \a resolvers to resolve unresolved values.
+		virtual void collect(const model::Notification& notification, const model::ResolverContext& resolvers) = 0;
+
+		/// Prefetches all collected keys into \a cache.
+		/// \note This function can be called concurrently with other prefetchers that access different sub caches.
+		virtual void prefetch(const CatapultCacheDelta& cache) const = 0;
+	};
+
+	/// Factory for creating cache prefetchers.
+	using CachePrefetcherFactory = supplier<std::unique_ptr<CachePrefetcher>>;
+
+	/// Cache prefetcher implementation that collects keys with a function and prefetches them into sub cache \a TCache.
+	template<typename TCache, typename TKey>
+	class FunctionalCachePrefetcher : public CachePrefetcher {
+	public:
+		/// Function signature for collecting keys referenced by a notification.
+		using KeyCollector = consumer<const model::Notification&, const model::ResolverContext&, std::vector<TKey>&>;
+
+	public:
+		/// Creates a prefetcher that runs in \a phase and uses \a keyCollector to collect keys.
+		FunctionalCachePrefetcher(CachePrefetchPhase phase, const KeyCollector& keyCollector)
+				: m_phase(phase)
+				, m_keyCollector(keyCollector)
+		{}
+
+	public:
+		CachePrefetchPhase phase() const override {
+			return m_phase;
+		}
+
+		void collect(const model::Notification& notification, const model::ResolverContext& resolvers) override {
+			m_keyCollector(notification, resolvers, m_keys);
+		}
+
+		void prefetch(const CatapultCacheDelta& cache) const override {
+			if (m_keys.empty())
+				return;
+
+			// the same keys are typically referenced by many notifications, so only prefetch each one once
+			auto keys = m_keys;
+			std::sort(keys.begin(), keys.end());
+			keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+			cache.sub<TCache>().prefetch(keys);
+		}
+
+	private:
+		CachePrefetchPhase m_phase;
+		KeyCollector m_keyCollector;
+		std::vector<TKey> m_keys;
+	};
+
+	/// Creates a factory of cache prefetchers for sub cache \a TCache that run in \a phase and use \a keyCollector to collect keys.
+	template<typename TCache, typename TKey>
+	CachePrefetcherFactory CreateCachePrefetcherFactory(
+			CachePrefetchPhase phase,
+			const typename FunctionalCachePrefetcher<TCache, TKey>::KeyCollector& keyCollector) {
+		return [phase, keyCollector]() {
+			return std::make_unique<FunctionalCachePrefetcher<TCache, TKey>>(phase, keyCollector);
+		};
+	}
+}}
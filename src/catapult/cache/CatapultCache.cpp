@@ -28,7 +28,10 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/NetworkIdentifier.h"
 #include "catapult/state/CatapultState.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
+#include <cstring>
 
 namespace catapult { namespace cache {
 
@@ -48,15 +51,72 @@ namespace catapult { namespace cache {
 			return readOnlyViews;
 		}
 
-		template<typename TSubCacheViews, typename TUpdateMerkleRoot>
-		std::vector<Hash256> CollectSubCacheMerkleRoots(TSubCacheViews& subViews, TUpdateMerkleRoot updateMerkleRoot) {
-			std::vector<Hash256> merkleRoots;
+		std::string GetSubCacheName(const SubCacheView& subView) {
+			const auto& cacheName = subView.id().CacheName;
+			return std::string(cacheName.data(), strnlen(cacheName.data(), cacheName.size()));
+		}
+
+		template<typename TSubCacheViews>
+		auto FindMerkleRootSubViews(TSubCacheViews& subViews) {
+			std::vector<typename TSubCacheViews::value_type::element_type*> merkleRootSubViews;
 			for (const auto& pSubView : subViews) {
-				Hash256 merkleRoot;
-				if (!pSubView)
-					continue;
+				if (pSubView && pSubView->supportsMerkleRoot())
+					merkleRootSubViews.push_back(&*pSubView);
+			}
+
+			return merkleRootSubViews;
+		}
 
+		template<typename TSubCacheView, typename TUpdateMerkleRoot>
+		void UpdateSubCacheMerkleRoots(
+				const std::vector<TSubCacheView*>& subViews,
+				TUpdateMerkleRoot updateMerkleRoot,
+				utils::SlowOperationLogger& logger) {
+			for (auto* pSubView : subViews) {
+				utils::StackTimer stopwatch;
 				updateMerkleRoot(*pSubView);
+				logger.addConcurrentSubOperation(GetSubCacheName(*pSubView), stopwatch.millis());
+			}
+		}
+
+		template<typename TSubCacheView, typename TUpdateMerkleRoot>
+		void UpdateSubCacheMerkleRoots(
+				const std::vector<TSubCacheView*>& subViews,
+				TUpdateMerkleRoot updateMerkleRoot,
+				thread::IoThreadPool& pool,
+				utils::SlowOperationLogger& logger) {
+			// each sub cache has an independent merkle tree, so all trees can be updated at the same time
+			std::vector<uint64_t> elapsedMillis(subViews.size());
+			std::vector<std::exception_ptr> exceptions(subViews.size());
+			auto numPartitions = std::min<size_t>(pool.numWorkerThreads(), subViews.size());
+			thread::ParallelFor(pool.ioContext(), subViews, numPartitions, [updateMerkleRoot, &elapsedMillis, &exceptions](
+					auto* pSubView,
+					auto index) {
+				utils::StackTimer stopwatch;
+				try {
+					updateMerkleRoot(*pSubView);
+				} catch (...) {
+					exceptions[index] = std::current_exception();
+				}
+
+				elapsedMillis[index] = stopwatch.millis();
+				return true;
+			}).get();
+
+			for (auto i = 0u; i < subViews.size(); ++i) {
+				if (exceptions[i])
+					std::rethrow_exception(exceptions[i]);
+
+				logger.addConcurrentSubOperation(GetSubCacheName(*subViews[i]), elapsedMillis[i]);
+			}
+		}
+
+		template<typename TSubCacheView>
+		std::vector<Hash256> CollectSubCacheMerkleRoots(const std::vector<TSubCacheView*>& subViews) {
+			// merkle roots are always collected in sub cache order, independent of the order in which they were updated
+			std::vector<Hash256> merkleRoots;
+			for (auto* pSubView : subViews) {
+				Hash256 merkleRoot;
 				if (pSubView->tryGetMerkleRoot(merkleRoot))
 					merkleRoots.push_back(merkleRoot);
 			}
@@ -79,12 +139,15 @@ namespace catapult { namespace cache {
 			return stateHash;
 		}
 
-		template<typename TSubCacheViews, typename TUpdateMerkleRoot>
-		StateHashInfo CalculateStateHashInfo(const TSubCacheViews& subViews, TUpdateMerkleRoot updateMerkleRoot) {
+		template<typename TSubCacheViews, typename... TUpdateArgs>
+		StateHashInfo CalculateStateHashInfo(const TSubCacheViews& subViews, TUpdateArgs&&... updateArgs) {
 			utils::SlowOperationLogger logger("CalculateStateHashInfo", utils::LogLevel::warning);
 
+			auto merkleRootSubViews = FindMerkleRootSubViews(subViews);
+			UpdateSubCacheMerkleRoots(merkleRootSubViews, std::forward<TUpdateArgs>(updateArgs)..., logger);
+
 			StateHashInfo stateHashInfo;
-			stateHashInfo.SubCacheMerkleRoots = CollectSubCacheMerkleRoots(subViews, updateMerkleRoot);
+			stateHashInfo.SubCacheMerkleRoots = CollectSubCacheMerkleRoots(merkleRootSubViews);
 			stateHashInfo.StateHash = CalculateStateHash(stateHashInfo.SubCacheMerkleRoots);
 			return stateHashInfo;
 		}
@@ -158,6 +221,10 @@ namespace catapult { namespace cache {
 		return CalculateStateHashInfo(m_subViews, [height](auto& subView) { subView.updateMerkleRoot(height); });
 	}
 
+	StateHashInfo CatapultCacheDelta::calculateStateHash(Height height, thread::IoThreadPool& pool) const {
+		return CalculateStateHashInfo(m_subViews, [height](auto& subView) { subView.updateMerkleRoot(height); }, pool);
+	}
+
 	void CatapultCacheDelta::setSubCacheMerkleRoots(const std::vector<Hash256>& subCacheMerkleRoots) {
 		auto merkleRootIndex = 0u;
 		for (const auto& pSubView : m_subViews) {
@@ -50,6 +50,7 @@ namespace catapult { namespace cache {
 			, AccountStateCacheDeltaMixins::ContainsKey(*accountStateSets.pKeyLookupMap)
 			, AccountStateCacheDeltaMixins::ConstAccessorAddress(*accountStateSets.pPrimary)
 			, AccountStateCacheDeltaMixins::ConstAccessorKey(*pKeyLookupAdapter)
+			, AccountStateCacheDeltaMixins::PrefetchAddress(*accountStateSets.pPrimary)
 			, AccountStateCacheDeltaMixins::PatriciaTreeDelta(*accountStateSets.pPrimary, accountStateSets.pPatriciaTree)
 			, AccountStateCacheDeltaMixins::DeltaElements(*accountStateSets.pPrimary)
 			, m_pStateByAddress(accountStateSets.pPrimary)
@@ -22,23 +22,144 @@
 #include "RdbColumnContainer.h"
 #include "RocksDatabase.h"
 #include "RocksInclude.h"
+#include "catapult/utils/SpinReaderWriterLock.h"
+#include <atomic>
+#include <unordered_map>
 
 namespace catapult { namespace cache {
 
 	namespace {
+		constexpr size_t Default_Max_Prefetched_Values = 100'000;
+
 		auto ToSlice(const RawBuffer& key) {
 			return rocksdb::Slice(reinterpret_cast<const char*>(key.pData), key.Size);
 		}
 
+		auto ToString(const RawBuffer& key) {
+			return std::string(reinterpret_cast<const char*>(key.pData), key.Size);
+		}
+
 		void VerifyName(const std::string& propertyName) {
 			if (propertyName.size() >= Special_Key_Max_Length)
 				CATAPULT_THROW_INVALID_ARGUMENT_1("property name too long", propertyName);
 		}
 	}
 
+	// region PrefetchedValues
+
+	// note: inserts, removes and prunes only happen during commits, which are never concurrent with reads,
+	// so prefetched values cannot be replaced by stale values loaded concurrently;
+	// all values are discarded when the owning delta is committed or rebased, so they never outlive a single block
+	class RdbColumnContainer::PrefetchedValues {
+	private:
+		struct Value {
+			bool IsFound;
+			std::string Data;
+		};
+
+	public:
+		explicit PrefetchedValues(size_t maxValues)
+				: m_maxValues(maxValues)
+				, m_size(0)
+		{}
+
+	public:
+		size_t maxValues() const {
+			return m_maxValues;
+		}
+
+		std::vector<std::string> selectUnknown(const std::vector<RawBuffer>& keys) const {
+			std::vector<std::string> unknownKeys;
+			unknownKeys.reserve(keys.size());
+			if (0 == m_size) {
+				for (const auto& key : keys)
+					unknownKeys.push_back(ToString(key));
+
+				return unknownKeys;
+			}
+
+			// check all keys under a single lock and only allocate storage for keys that are unknown
+			std::string encodedKey;
+			auto readLock = m_lock.acquireReader();
+			for (const auto& key : keys) {
+				encodedKey.assign(reinterpret_cast<const char*>(key.pData), key.Size);
+				if (m_values.cend() == m_values.find(encodedKey))
+					unknownKeys.push_back(std::move(encodedKey));
+			}
+
+			return unknownKeys;
+		}
+
+		bool tryFind(const RawBuffer& key, RdbDataIterator& iterator) const {
+			if (0 == m_size)
+				return false;
+
+			auto readLock = m_lock.acquireReader();
+			auto iter = m_values.find(ToString(key));
+			if (m_values.cend() == iter)
+				return false;
+
+			iterator.setFound(iter->second.IsFound);
+			if (iter->second.IsFound)
+				iterator.storage().PinSelf(iter->second.Data);
+
+			return true;
+		}
+
+	public:
+		void add(std::vector<std::string>&& keys, const std::vector<RdbDataIterator>& iterators) {
+			auto writeLock = m_lock.acquireWriter();
+
+			// bound memory usage by discarding all previously prefetched values when limit is reached
+			if (m_values.size() + keys.size() > m_maxValues)
+				m_values.clear();
+
+			// even after discarding, a single batch can exceed the limit, so only add values while there is space
+			for (auto i = 0u; i < keys.size() && m_values.size() < m_maxValues; ++i) {
+				auto isFound = RdbDataIterator::End() != iterators[i];
+				m_values[std::move(keys[i])] = Value{ isFound, isFound ? iterators[i].storage().ToString() : std::string() };
+			}
+
+			m_size = m_values.size();
+		}
+
+		void remove(const RawBuffer& key) {
+			if (0 == m_size)
+				return;
+
+			auto writeLock = m_lock.acquireWriter();
+			m_values.erase(ToString(key));
+			m_size = m_values.size();
+		}
+
+		void clear() {
+			if (0 == m_size)
+				return;
+
+			auto writeLock = m_lock.acquireWriter();
+			m_values.clear();
+			m_size = 0;
+		}
+
+	private:
+		size_t m_maxValues;
+		std::unordered_map<std::string, Value> m_values;
+		std::atomic<size_t> m_size;
+		mutable utils::SpinReaderWriterLock m_lock;
+	};
+
+	// endregion
+
+	// region RdbColumnContainer
+
 	RdbColumnContainer::RdbColumnContainer(RocksDatabase& database, size_t columnId)
+			: RdbColumnContainer(database, columnId, Default_Max_Prefetched_Values)
+	{}
+
+	RdbColumnContainer::RdbColumnContainer(RocksDatabase& database, size_t columnId, size_t maxPrefetchedValues)
 			: m_database(database)
-			, m_columnId(columnId) {
+			, m_columnId(columnId)
+			, m_pPrefetchedValues(std::make_unique<PrefetchedValues>(maxPrefetchedValues)) {
 		uint64_t size = 0;
 		load("size", [&size](const char* buffer) {
 			if (!buffer)
@@ -50,6 +171,8 @@ namespace catapult { namespace cache {
 		m_size = static_cast<size_t>(size);
 	}
 
+	RdbColumnContainer::~RdbColumnContainer() = default;
+
 	void RdbColumnContainer::save(const std::string& propertyName, const std::string& strValue) {
 		VerifyName(propertyName);
 		m_database.put(m_columnId, propertyName, strValue);
@@ -72,18 +195,54 @@ namespace catapult { namespace cache {
 	}
 
 	void RdbColumnContainer::find(const RawBuffer& key, RdbDataIterator& iterator) const {
+		if (m_pPrefetchedValues->tryFind(key, iterator))
+			return;
+
 		m_database.get(m_columnId, ToSlice(key), iterator);
 	}
 
+	void RdbColumnContainer::find(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const {
+		std::vector<rocksdb::Slice> slices;
+		slices.reserve(keys.size());
+		for (const auto& key : keys)
+			slices.push_back(ToSlice(key));
+
+		m_database.multiGet(m_columnId, slices, iterators);
+	}
+
+	void RdbColumnContainer::prefetch(const std::vector<RawBuffer>& keys) const {
+		auto unknownKeys = m_pPrefetchedValues->selectUnknown(keys);
+		if (unknownKeys.empty())
+			return;
+
+		// skip loading values that cannot be prefetched
+		if (unknownKeys.size() > m_pPrefetchedValues->maxValues())
+			unknownKeys.resize(m_pPrefetchedValues->maxValues());
+
+		std::vector<rocksdb::Slice> slices(unknownKeys.cbegin(), unknownKeys.cend());
+		std::vector<RdbDataIterator> iterators;
+		m_database.multiGet(m_columnId, slices, iterators);
+		m_pPrefetchedValues->add(std::move(unknownKeys), iterators);
+	}
+
+	void RdbColumnContainer::discardPrefetched() {
+		m_pPrefetchedValues->clear();
+	}
+
 	void RdbColumnContainer::insert(const RawBuffer& key, const std::string& value) {
+		m_pPrefetchedValues->remove(key);
 		m_database.put(m_columnId, ToSlice(key), value);
 	}
 
 	void RdbColumnContainer::remove(const RawBuffer& key) {
+		m_pPrefetchedValues->remove(key);
 		m_database.del(m_columnId, ToSlice(key));
 	}
 
 	size_t RdbColumnContainer::prune(uint64_t pruningBoundary) {
+		m_pPrefetchedValues->clear();
 		return m_database.prune(m_columnId, pruningBoundary);
 	}
+
+	// endregion
 }}
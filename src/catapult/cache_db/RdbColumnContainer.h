@@ -23,6 +23,8 @@
 #include "catapult/exceptions.h"
 #include "catapult/functions.h"
 #include "catapult/types.h"
+#include <memory>
+#include <vector>
 
 namespace catapult {
 	namespace cache {
@@ -39,6 +41,12 @@ namespace catapult { namespace cache {
 		/// Creates an adapter around \a database and \a columnId.
 		RdbColumnContainer(RocksDatabase& database, size_t columnId);
 
+		/// Creates an adapter around \a database and \a columnId that prefetches at most \a maxPrefetchedValues elements.
+		RdbColumnContainer(RocksDatabase& database, size_t columnId, size_t maxPrefetchedValues);
+
+		/// Destroys the adapter.
+		~RdbColumnContainer();
+
 	public:
 		/// Gets the size of the column.
 		size_t size() const;
@@ -79,6 +87,20 @@ namespace catapult { namespace cache {
 		/// Finds element with \a key, storing result in \a iterator.
 		void find(const RawBuffer& key, RdbDataIterator& iterator) const;
 
+		/// Finds elements with \a keys using a single batched lookup, storing results in \a iterators.
+		/// \note \a iterators is resized to the number of keys and is ordered consistently with \a keys.
+		void find(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const;
+
+		/// Loads elements with \a keys using a single batched lookup so that subsequent finds of them are served from memory.
+		/// \note Prefetched elements are discarded when they are inserted, removed or pruned.
+		///       All prefetched elements are discarded when \a keys do not fit, and keys beyond the limit are not prefetched.
+		void prefetch(const std::vector<RawBuffer>& keys) const;
+
+		/// Discards all prefetched elements.
+		/// \note Owners are expected to call this whenever the pending changes of a delta are committed or discarded,
+		///       so that prefetched elements never outlive the delta they were loaded for.
+		void discardPrefetched();
+
 		/// Inserts element with \a key and \a value.
 		void insert(const RawBuffer& key, const std::string& value);
 
@@ -93,9 +115,13 @@ namespace catapult { namespace cache {
 
 		void save(const std::string& propertyName, const std::string& strValue);
 
+	private:
+		class PrefetchedValues;
+
 	private:
 		RocksDatabase& m_database;
 		size_t m_columnId;
 		size_t m_size;
+		std::unique_ptr<PrefetchedValues> m_pPrefetchedValues;
 	};
 }}
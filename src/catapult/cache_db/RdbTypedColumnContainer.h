@@ -25,6 +25,7 @@
 #include "RocksDatabase.h"
 #include "catapult/exceptions.h"
 #include "catapult/types.h"
+#include <vector>
 
 namespace catapult { namespace cache {
 
@@ -127,6 +128,29 @@ namespace catapult { namespace cache {
 			return iter;
 		}
 
+		/// Finds elements with \a keys using a single batched lookup.
+		/// \note Returned iterators are ordered consistently with \a keys and are equal to cend() for keys that have not been found.
+		std::vector<const_iterator> find(const std::vector<KeyType>& keys) const {
+			std::vector<RdbDataIterator> dbIterators;
+			TContainer::find(SerializeKeys(keys), dbIterators);
+
+			std::vector<const_iterator> iterators(dbIterators.size());
+			for (auto i = 0u; i < dbIterators.size(); ++i)
+				iterators[i].dbIterator() = std::move(dbIterators[i]);
+
+			return iterators;
+		}
+
+		/// Prefetches elements with \a keys so that subsequent finds of them do not access the database.
+		void prefetch(const std::vector<KeyType>& keys) const {
+			TContainer::prefetch(SerializeKeys(keys));
+		}
+
+		/// Discards all prefetched elements.
+		void discardPrefetched() {
+			TContainer::discardPrefetched();
+		}
+
 		/// Prunes elements with keys smaller than \a key. Returns number of pruned elements.
 		size_t prune(const KeyType& key) {
 			return TContainer::prune(TDescriptor::Serializer::KeyToBoundary(key));
@@ -141,5 +165,15 @@ namespace catapult { namespace cache {
 		const_iterator cend() const {
 			return const_iterator();
 		}
+
+	private:
+		static std::vector<RawBuffer> SerializeKeys(const std::vector<KeyType>& keys) {
+			std::vector<RawBuffer> serializedKeys;
+			serializedKeys.reserve(keys.size());
+			for (const auto& key : keys)
+				serializedKeys.push_back(SerializeKey(key));
+
+			return serializedKeys;
+		}
 	};
 }}
@@ -98,10 +98,20 @@ namespace catapult { namespace cache {
 			const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig,
 			const std::vector<std::string>& columnFamilyNames,
 			FilterPruningMode pruningMode)
+			: RocksDatabaseSettings(databaseDirectory, databaseConfig, columnFamilyNames, pruningMode, nullptr)
+	{}
+
+	RocksDatabaseSettings::RocksDatabaseSettings(
+			const std::string& databaseDirectory,
+			const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig,
+			const std::vector<std::string>& columnFamilyNames,
+			FilterPruningMode pruningMode,
+			const std::shared_ptr<RocksGroupCommitter>& pGroupCommitterParam)
 			: DatabaseDirectory(databaseDirectory)
 			, DatabaseConfig(databaseConfig)
 			, ColumnFamilyNames(columnFamilyNames)
 			, PruningMode(pruningMode)
+			, pGroupCommitter(pGroupCommitterParam)
 	{}
 
 	// endregion
@@ -170,6 +180,9 @@ namespace catapult { namespace cache {
 	}
 
 	RocksDatabase::~RocksDatabase() {
+		if (m_pDb && m_settings.pGroupCommitter)
+			m_settings.pGroupCommitter->remove(*m_pDb);
+
 		for (auto* pHandle : m_handles)
 			m_pDb->DestroyColumnFamilyHandle(pHandle);
 	}
@@ -207,6 +220,33 @@ namespace catapult { namespace cache {
 			CATAPULT_THROW_DB_KEY_ERROR("could not retrieve value");
 	}
 
+	void RocksDatabase::multiGet(size_t columnId, const std::vector<rocksdb::Slice>& keys, std::vector<RdbDataIterator>& results) {
+		if (!m_pDb)
+			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
+
+		auto numKeys = keys.size();
+		std::vector<rocksdb::PinnableSlice> values(numKeys);
+		std::vector<rocksdb::Status> statuses(numKeys);
+		m_pDb->MultiGet(rocksdb::ReadOptions(), m_handles[columnId], numKeys, keys.data(), values.data(), statuses.data());
+
+		results.resize(numKeys);
+		for (auto i = 0u; i < numKeys; ++i) {
+			const auto& key = keys[i];
+			const auto& status = statuses[i];
+			auto& result = results[i];
+			result.setFound(status.ok());
+
+			if (status.ok()) {
+				result.storage().PinSelf(values[i]);
+				continue;
+			}
+
+			// note: this is intentional, in case of not found status will be set via `setFound` above
+			if (!status.IsNotFound())
+				CATAPULT_THROW_DB_KEY_ERROR("could not retrieve value");
+		}
+	}
+
 	void RocksDatabase::put(size_t columnId, const rocksdb::Slice& key, const std::string& value) {
 		if (!m_pDb)
 			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
@@ -244,8 +284,9 @@ namespace catapult { namespace cache {
 		if (0 == m_pWriteBatch->GetDataSize())
 			return;
 
+		// when group commit is enabled, the batch is synced later (together with batches written to other databases)
 		rocksdb::WriteOptions writeOptions;
-		writeOptions.sync = true;
+		writeOptions.sync = !m_settings.pGroupCommitter;
 
 		auto directory = m_settings.DatabaseDirectory + "/";
 		utils::SlowOperationLogger logger(utils::ExtractDirectoryName(directory.c_str()).pData, utils::LogLevel::warning);
@@ -254,6 +295,9 @@ namespace catapult { namespace cache {
 			CATAPULT_THROW_RUNTIME_ERROR_1("could not store batch in db", status.ToString());
 
 		m_pWriteBatch->Clear();
+
+		if (m_settings.pGroupCommitter)
+			m_settings.pGroupCommitter->markDirty(*m_pDb);
 	}
 
 	void RocksDatabase::saveIfBatchFull() {
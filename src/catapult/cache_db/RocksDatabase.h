@@ -20,6 +20,7 @@
 **/
 
 #pragma once
+#include "RocksGroupCommitter.h"
 #include "RocksPruningFilter.h"
 #include "catapult/config/NodeConfiguration.h"
 #include "catapult/utils/FileSize.h"
@@ -112,6 +113,15 @@ namespace catapult { namespace cache {
 				const std::vector<std::string>& columnFamilyNames,
 				FilterPruningMode pruningMode);
 
+		/// Creates database settings around \a databaseDirectory, \a databaseConfig, column family names (\a columnFamilyNames),
+		/// \a pruningMode and optional group committer (\a pGroupCommitterParam).
+		RocksDatabaseSettings(
+				const std::string& databaseDirectory,
+				const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig,
+				const std::vector<std::string>& columnFamilyNames,
+				FilterPruningMode pruningMode,
+				const std::shared_ptr<RocksGroupCommitter>& pGroupCommitterParam);
+
 	public:
 		/// Database directory.
 		const std::string DatabaseDirectory;
@@ -124,6 +134,10 @@ namespace catapult { namespace cache {
 
 		/// Database pruning mode.
 		const FilterPruningMode PruningMode;
+
+		/// Group committer that syncs written batches (optional).
+		/// \note When not set, every batch is synced when it is written.
+		const std::shared_ptr<RocksGroupCommitter> pGroupCommitter;
 	};
 
 	// endregion
@@ -153,6 +167,10 @@ namespace catapult { namespace cache {
 		/// Gets the value associated with \a key from \a columnId and sets \a result.
 		void get(size_t columnId, const rocksdb::Slice& key, RdbDataIterator& result);
 
+		/// Gets the values associated with \a keys from \a columnId using a single batched lookup and sets \a results.
+		/// \note \a results is resized to the number of keys and is ordered consistently with \a keys.
+		void multiGet(size_t columnId, const std::vector<rocksdb::Slice>& keys, std::vector<RdbDataIterator>& results);
+
 		/// Puts the \a value associated with \a key in \a columnId.
 		void put(size_t columnId, const rocksdb::Slice& key, const std::string& value);
 
@@ -163,6 +181,7 @@ namespace catapult { namespace cache {
 		size_t prune(size_t columnId, uint64_t boundary);
 
 		/// Finalize batched operations.
+		/// \note When a group committer is configured, the written batch is not synced until the committer syncs it.
 		void flush();
 
 	private:
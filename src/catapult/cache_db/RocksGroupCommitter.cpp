@@ -0,0 +1,204 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "RocksGroupCommitter.h"
+#include "RocksInclude.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/exceptions.h"
+#include <boost/exception_ptr.hpp>
+
+namespace catapult { namespace cache {
+
+	RocksGroupCommitter::RocksGroupCommitter(const utils::TimeSpan& interval)
+			: m_interval(interval)
+			, m_writeId(0)
+			, m_syncedId(0)
+			, m_numSyncs(0)
+			, m_isSyncing(false)
+			, m_isSyncRequested(false)
+			, m_isStopped(false)
+			, m_isExecutingDurableActions(false)
+			, m_thread([this]() { run(); })
+	{}
+
+	RocksGroupCommitter::~RocksGroupCommitter() {
+		{
+			std::lock_guard<std::mutex> guard(m_mutex);
+			m_isStopped = true;
+		}
+
+		m_syncRequestedCondition.notify_one();
+		m_thread.join();
+	}
+
+	size_t RocksGroupCommitter::numSyncs() const {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		return m_numSyncs;
+	}
+
+	void RocksGroupCommitter::markDirty(rocksdb::DB& database) {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		rethrowIfSyncFailed();
+
+		m_dirtyDatabases.insert(&database);
+		++m_writeId;
+	}
+
+	void RocksGroupCommitter::remove(rocksdb::DB& database) {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_syncCompletedCondition.wait(lock, [this]() { return !m_isSyncing; });
+		if (0 == m_dirtyDatabases.erase(&database))
+			return;
+
+		// sync while holding the lock so that no durable actions can be released before the removed database is synced
+		auto status = database.SyncWAL();
+		if (!status.ok())
+			CATAPULT_LOG(error) << "could not sync database before removal: " << status.ToString();
+	}
+
+	void RocksGroupCommitter::sync() {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		auto writeId = m_writeId;
+		if (m_syncedId < writeId && !m_pSyncException) {
+			m_isSyncRequested = true;
+			m_syncRequestedCondition.notify_one();
+		}
+
+		// wait for all actions released by the sync to complete too
+		m_syncCompletedCondition.wait(lock, [this, writeId]() {
+			return (m_syncedId >= writeId || !!m_pSyncException) && !m_isExecutingDurableActions;
+		});
+
+		rethrowIfSyncFailed();
+	}
+
+	void RocksGroupCommitter::whenDurable(const action& durableAction) {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		rethrowIfSyncFailed();
+		rethrowIfActionFailed();
+
+		// action is executed immediately (by this thread or the thread currently executing actions) when nothing is outstanding
+		m_durableActions.emplace_back(m_writeId, durableAction);
+		executeDurableActions(lock);
+		rethrowIfActionFailed();
+	}
+
+	void RocksGroupCommitter::run() {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		for (;;) {
+			m_syncRequestedCondition.wait_for(lock, std::chrono::milliseconds(m_interval.millis()), [this]() {
+				return m_isStopped || m_isSyncRequested;
+			});
+
+			syncAll(lock);
+			if (m_isStopped)
+				break;
+		}
+	}
+
+	void RocksGroupCommitter::syncAll(std::unique_lock<std::mutex>& lock) {
+		m_isSyncRequested = false;
+		if (m_pSyncException || m_syncedId == m_writeId)
+			return;
+
+		auto writeId = m_writeId;
+		auto dirtyDatabases = std::move(m_dirtyDatabases);
+		m_dirtyDatabases.clear();
+		m_isSyncing = true;
+
+		// sync without holding the lock so that writers are not blocked by slow syncs
+		lock.unlock();
+
+		rocksdb::Status status;
+		for (auto* pDatabase : dirtyDatabases) {
+			status = pDatabase->SyncWAL();
+			if (!status.ok())
+				break;
+		}
+
+		lock.lock();
+		m_isSyncing = false;
+
+		if (status.ok()) {
+			m_syncedId = writeId;
+			if (!dirtyDatabases.empty())
+				++m_numSyncs;
+
+			executeDurableActions(lock);
+		} else {
+			CATAPULT_LOG(fatal) << "could not sync databases: " << status.ToString();
+			try {
+				CATAPULT_THROW_RUNTIME_ERROR_1("could not sync databases", status.ToString());
+			} catch (...) {
+				m_pSyncException = std::current_exception();
+			}
+		}
+
+		m_syncCompletedCondition.notify_all();
+	}
+
+	void RocksGroupCommitter::executeDurableActions(std::unique_lock<std::mutex>& lock) {
+		// only a single thread executes actions at a time, which guarantees they are executed in order;
+		// any other thread leaves its released actions to that thread
+		if (m_isExecutingDurableActions)
+			return;
+
+		m_isExecutingDurableActions = true;
+		while (!m_durableActions.empty() && m_durableActions.front().first <= m_syncedId) {
+			auto durableAction = std::move(m_durableActions.front().second);
+			m_durableActions.pop_front();
+
+			// execute action without holding the lock so that writers are not blocked by slow actions (e.g. file I/O)
+			lock.unlock();
+
+			std::exception_ptr pActionException;
+			try {
+				durableAction();
+			} catch (...) {
+				CATAPULT_LOG(error) << "durable action failed: " << boost::diagnostic_information(boost::current_exception());
+				pActionException = std::current_exception();
+			}
+
+			lock.lock();
+
+			// action failures do not affect durability of writes, so they are only reported to whenDurable callers
+			if (pActionException && !m_pActionException)
+				m_pActionException = pActionException;
+		}
+
+		m_isExecutingDurableActions = false;
+		m_syncCompletedCondition.notify_all();
+	}
+
+	void RocksGroupCommitter::rethrowIfSyncFailed() const {
+		if (m_pSyncException)
+			std::rethrow_exception(m_pSyncException);
+	}
+
+	void RocksGroupCommitter::rethrowIfActionFailed() {
+		if (!m_pActionException)
+			return;
+
+		auto pActionException = std::move(m_pActionException);
+		m_pActionException = nullptr;
+		std::rethrow_exception(pActionException);
+	}
+}}
@@ -0,0 +1,93 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/TimeSpan.h"
+#include "catapult/functions.h"
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+namespace rocksdb { class DB; }
+
+namespace catapult { namespace cache {
+
+	/// Group committer that allows batches to be written to rocks databases without syncing
+	/// and syncs all outstanding writes together on a background thread.
+	class RocksGroupCommitter {
+	public:
+		/// Creates a committer that syncs all outstanding writes every \a interval.
+		explicit RocksGroupCommitter(const utils::TimeSpan& interval);
+
+		/// Destroys the committer after syncing all outstanding writes.
+		~RocksGroupCommitter();
+
+	public:
+		/// Gets the number of sync passes that synced at least one database.
+		size_t numSyncs() const;
+
+	public:
+		/// Registers an unsynced write to \a database.
+		void markDirty(rocksdb::DB& database);
+
+		/// Syncs all unsynced writes to \a database and stops tracking it.
+		/// \note This must be called before \a database is destroyed.
+		void remove(rocksdb::DB& database);
+
+		/// Blocks until all writes registered before this call are durable and all actions released by them are executed.
+		void sync();
+
+		/// Schedules \a durableAction to be executed once all writes registered before this call are durable.
+		/// \note Actions are executed in order of scheduling without holding any locks, either immediately or on the background thread.
+		///       Action failures do not fail writes but are rethrown by the next call to this function.
+		void whenDurable(const action& durableAction);
+
+	private:
+		void run();
+		void syncAll(std::unique_lock<std::mutex>& lock);
+		void executeDurableActions(std::unique_lock<std::mutex>& lock);
+		void rethrowIfSyncFailed() const;
+		void rethrowIfActionFailed();
+
+	private:
+		const utils::TimeSpan m_interval;
+
+		uint64_t m_writeId;
+		uint64_t m_syncedId;
+		size_t m_numSyncs;
+		bool m_isSyncing;
+		bool m_isSyncRequested;
+		bool m_isStopped;
+		bool m_isExecutingDurableActions;
+		std::exception_ptr m_pSyncException;
+		std::exception_ptr m_pActionException;
+		std::unordered_set<rocksdb::DB*> m_dirtyDatabases;
+		std::deque<std::pair<uint64_t, action>> m_durableActions;
+
+		mutable std::mutex m_mutex;
+		std::condition_variable m_syncRequestedCondition;
+		std::condition_variable m_syncCompletedCondition;
+		std::thread m_thread;
+	};
+}}
@@ -32,8 +32,14 @@ namespace catapult { namespace cache {
 
 		/// Creates options with custom \a maxResponseSize and \a maxCacheSize.
 		constexpr MemoryCacheOptions(utils::FileSize maxResponseSize, utils::FileSize maxCacheSize)
+				: MemoryCacheOptions(maxResponseSize, maxCacheSize, 1)
+		{}
+
+		/// Creates options with custom \a maxResponseSize, \a maxCacheSize and \a numShards.
+		constexpr MemoryCacheOptions(utils::FileSize maxResponseSize, utils::FileSize maxCacheSize, uint32_t numShards)
 				: MaxResponseSize(maxResponseSize)
 				, MaxCacheSize(maxCacheSize)
+				, NumShards(numShards)
 		{}
 
 	public:
@@ -42,5 +48,9 @@ namespace catapult { namespace cache {
 
 		/// Maximum size of the cache.
 		utils::FileSize MaxCacheSize;
+
+		/// Number of independently locked shards.
+		/// \note This is only used by sharded caches.
+		uint32_t NumShards = 1;
 	};
 }}
@@ -24,6 +24,13 @@
 #include "CacheSizeLogger.h"
 #include "catapult/model/EntityInfo.h"
 #include "catapult/model/FeeUtils.h"
+#include "catapult/utils/ShortHash.h"
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace catapult { namespace cache {
 
@@ -37,6 +44,7 @@ namespace catapult { namespace cache {
 		TransactionData(const model::TransactionInfo& transactionInfo, size_t id)
 				: model::TransactionInfo(transactionInfo.copy())
 				, Id(id)
+				, MaxFeeMultiplier(model::CalculateTransactionMaxFeeMultiplier(*pEntity))
 		{}
 
 	public:
@@ -46,47 +54,351 @@ namespace catapult { namespace cache {
 
 	public:
 		size_t Id;
+
+		// cached because it is used by multiple indexes and filters
+		BlockFeeMultiplier MaxFeeMultiplier;
 	};
 
+	namespace {
+		struct MaxFeeMultiplierIndexKey {
+		public:
+			BlockFeeMultiplier MaxFeeMultiplier;
+			size_t Id;
+			const TransactionData* pData;
+
+		public:
+			bool operator<(const MaxFeeMultiplierIndexKey& rhs) const {
+				return MaxFeeMultiplier != rhs.MaxFeeMultiplier ? MaxFeeMultiplier < rhs.MaxFeeMultiplier : Id < rhs.Id;
+			}
+		};
+
+		// compact (cache friendly) summary of the transaction properties checked by unknownTransactions
+		struct TransactionSummary {
+			size_t Id;
+			utils::ShortHash ShortHash;
+			BlockFeeMultiplier MaxFeeMultiplier;
+			Timestamp Deadline;
+
+			// pointer to transaction data or nullptr when transaction has been removed
+			const TransactionData* pData;
+		};
+
+		using TransactionDataContainer = std::set<TransactionData>;
+		using MaxFeeMultiplierIndex = std::set<MaxFeeMultiplierIndexKey>;
+		using TransactionSummaries = std::vector<TransactionSummary>;
+		using IdLookup = std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>>;
+
+		MaxFeeMultiplierIndexKey CreateMaxFeeMultiplierIndexKey(const TransactionData& data) {
+			return { data.MaxFeeMultiplier, data.Id, &data };
+		}
+
+		TransactionSummary CreateTransactionSummary(const TransactionData& data) {
+			return { data.Id, utils::ToShortHash(data.EntityHash), data.MaxFeeMultiplier, data.pEntity->Deadline, &data };
+		}
+	}
+
+	struct MemoryUtCacheShard {
+		cache::TransactionDataContainer TransactionDataContainer;
+		utils::FileSize CacheSize;
+
+		cache::IdLookup IdLookup;
+		cache::MaxFeeMultiplierIndex MaxFeeMultiplierIndex;
+
+		// summaries are ordered by id; removed transactions are lazily compacted
+		cache::TransactionSummaries TransactionSummaries;
+		size_t NumRemovedTransactionSummaries = 0;
+
+		utils::SpinReaderWriterLock Lock;
+	};
+
+	namespace {
+		// region shard utils
+
+		size_t GetShardIndex(const MemoryUtCacheShards& shards, const Hash256& hash) {
+			// use trailing bytes because IdLookup buckets are selected by leading bytes
+			uint32_t value;
+			std::memcpy(&value, &hash[Hash256::Size - sizeof(uint32_t)], sizeof(uint32_t));
+			return value % shards.size();
+		}
+
+		const MemoryUtCacheShard& GetShard(const MemoryUtCacheShards& shards, const Hash256& hash) {
+			return *shards[GetShardIndex(shards, hash)];
+		}
+
+		void RemoveTransactionSummary(MemoryUtCacheShard& shard, size_t id) {
+			auto& summaries = shard.TransactionSummaries;
+			auto iter = std::lower_bound(summaries.begin(), summaries.end(), id, [](const auto& summary, auto value) {
+				return summary.Id < value;
+			});
+			iter->pData = nullptr;
+
+			// compact summaries when at least half of them have been removed
+			if (++shard.NumRemovedTransactionSummaries * 2 < summaries.size())
+				return;
+
+			summaries.erase(
+					std::remove_if(summaries.begin(), summaries.end(), [](const auto& summary) { return !summary.pData; }),
+					summaries.end());
+			shard.NumRemovedTransactionSummaries = 0;
+		}
+
+		void AddTransaction(MemoryUtCacheShard& shard, const model::TransactionInfo& transactionInfo, size_t id) {
+			shard.IdLookup.emplace(transactionInfo.EntityHash, id);
+			auto dataIter = shard.TransactionDataContainer.emplace(transactionInfo, id).first;
+			shard.MaxFeeMultiplierIndex.insert(CreateMaxFeeMultiplierIndexKey(*dataIter));
+			shard.TransactionSummaries.push_back(CreateTransactionSummary(*dataIter));
+			shard.CacheSize = utils::FileSize::FromBytes(shard.CacheSize.bytes() + transactionInfo.pEntity->Size);
+		}
+
+		void RemoveTransaction(MemoryUtCacheShard& shard, const Hash256& hash) {
+			auto iter = shard.IdLookup.find(hash);
+			auto dataIter = shard.TransactionDataContainer.find(TransactionData(iter->second));
+
+			shard.CacheSize = utils::FileSize::FromBytes(shard.CacheSize.bytes() - dataIter->pEntity->Size);
+			shard.MaxFeeMultiplierIndex.erase(CreateMaxFeeMultiplierIndexKey(*dataIter));
+			RemoveTransactionSummary(shard, dataIter->Id);
+			shard.TransactionDataContainer.erase(dataIter);
+			shard.IdLookup.erase(iter);
+		}
+
+		void ClearShard(MemoryUtCacheShard& shard) {
+			shard.CacheSize = utils::FileSize();
+			shard.MaxFeeMultiplierIndex.clear();
+			shard.TransactionSummaries.clear();
+			shard.NumRemovedTransactionSummaries = 0;
+			shard.TransactionDataContainer.clear();
+			shard.IdLookup.clear();
+		}
+
+		// endregion
+
+		// region shard cursors
+
+		class InsertionOrderCursor {
+		public:
+			explicit InsertionOrderCursor(const MemoryUtCacheShard& shard)
+					: m_iter(shard.TransactionDataContainer.cbegin())
+					, m_end(shard.TransactionDataContainer.cend())
+			{}
+
+		public:
+			bool isValid() const {
+				return m_end != m_iter;
+			}
+
+			const TransactionData& current() const {
+				return *m_iter;
+			}
+
+			bool isBefore(const InsertionOrderCursor& rhs) const {
+				return m_iter->Id < rhs.m_iter->Id;
+			}
+
+			void next() {
+				++m_iter;
+			}
+
+		private:
+			TransactionDataContainer::const_iterator m_iter;
+			TransactionDataContainer::const_iterator m_end;
+		};
+
+		class TransactionSummaryCursor {
+		public:
+			explicit TransactionSummaryCursor(const MemoryUtCacheShard& shard)
+					: m_iter(shard.TransactionSummaries.cbegin())
+					, m_end(shard.TransactionSummaries.cend()) {
+				skipRemoved();
+			}
+
+		public:
+			bool isValid() const {
+				return m_end != m_iter;
+			}
+
+			const TransactionSummary& current() const {
+				return *m_iter;
+			}
+
+			bool isBefore(const TransactionSummaryCursor& rhs) const {
+				return m_iter->Id < rhs.m_iter->Id;
+			}
+
+			void next() {
+				++m_iter;
+				skipRemoved();
+			}
+
+		private:
+			void skipRemoved() {
+				while (m_end != m_iter && !m_iter->pData)
+					++m_iter;
+			}
+
+		private:
+			TransactionSummaries::const_iterator m_iter;
+			TransactionSummaries::const_iterator m_end;
+		};
+
+		class AscendingMaxFeeMultiplierCursor {
+		public:
+			explicit AscendingMaxFeeMultiplierCursor(const MemoryUtCacheShard& shard)
+					: m_iter(shard.MaxFeeMultiplierIndex.cbegin())
+					, m_end(shard.MaxFeeMultiplierIndex.cend())
+			{}
+
+		public:
+			bool isValid() const {
+				return m_end != m_iter;
+			}
+
+			const TransactionData& current() const {
+				return *m_iter->pData;
+			}
+
+			bool isBefore(const AscendingMaxFeeMultiplierCursor& rhs) const {
+				return *m_iter < *rhs.m_iter;
+			}
+
+			void next() {
+				++m_iter;
+			}
+
+		private:
+			MaxFeeMultiplierIndex::const_iterator m_iter;
+			MaxFeeMultiplierIndex::const_iterator m_end;
+		};
+
+		class DescendingMaxFeeMultiplierCursor {
+		public:
+			explicit DescendingMaxFeeMultiplierCursor(const MemoryUtCacheShard& shard)
+					: m_pIndex(&shard.MaxFeeMultiplierIndex)
+					, m_groupEnd(m_pIndex->cend()) {
+				moveToNextGroup();
+			}
+
+		public:
+			bool isValid() const {
+				return m_groupEnd != m_iter;
+			}
+
+			const TransactionData& current() const {
+				return *m_iter->pData;
+			}
+
+			bool isBefore(const DescendingMaxFeeMultiplierCursor& rhs) const {
+				return m_iter->MaxFeeMultiplier != rhs.m_iter->MaxFeeMultiplier
+						? m_iter->MaxFeeMultiplier > rhs.m_iter->MaxFeeMultiplier
+						: m_iter->Id < rhs.m_iter->Id;
+			}
+
+			void next() {
+				if (m_groupEnd != ++m_iter)
+					return;
+
+				m_groupEnd = m_groupBegin;
+				moveToNextGroup();
+			}
+
+		private:
+			void moveToNextGroup() {
+				// visit groups of equal max fee multipliers from largest to smallest, but visit each group from oldest to newest
+				if (m_pIndex->cbegin() == m_groupEnd) {
+					m_iter = m_groupEnd;
+					return;
+				}
+
+				m_groupBegin = m_pIndex->lower_bound({ std::prev(m_groupEnd)->MaxFeeMultiplier, 0, nullptr });
+				m_iter = m_groupBegin;
+			}
+
+		private:
+			const MaxFeeMultiplierIndex* m_pIndex;
+			MaxFeeMultiplierIndex::const_iterator m_groupBegin;
+			MaxFeeMultiplierIndex::const_iterator m_groupEnd;
+			MaxFeeMultiplierIndex::const_iterator m_iter;
+		};
+
+		template<typename TCursor, typename TConsumer>
+		void ForEachMerged(const MemoryUtCacheShards& shards, TConsumer consumer) {
+			std::vector<TCursor> cursors;
+			cursors.reserve(shards.size());
+			for (const auto& pShard : shards) {
+				TCursor cursor(*pShard);
+				if (cursor.isValid())
+					cursors.push_back(cursor);
+			}
+
+			// the number of shards is small, so a linear scan for the next transaction is sufficient
+			while (!cursors.empty()) {
+				auto nextIter = cursors.begin();
+				for (auto iter = cursors.begin() + 1; cursors.end() != iter; ++iter) {
+					if (iter->isBefore(*nextIter))
+						nextIter = iter;
+				}
+
+				if (!consumer(nextIter->current()))
+					return;
+
+				nextIter->next();
+				if (!nextIter->isValid())
+					cursors.erase(nextIter);
+			}
+		}
+
+		// endregion
+	}
+
 	// region MemoryUtCacheView
 
 	MemoryUtCacheView::MemoryUtCacheView(
 			utils::FileSize maxResponseSize,
-			utils::FileSize cacheSize,
-			const TransactionDataContainer& transactionDataContainer,
-			const IdLookup& idLookup,
-			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+			const MemoryUtCacheShards& shards,
+			ReaderLockGuards&& readLocks)
 			: m_maxResponseSize(maxResponseSize)
-			, m_cacheSize(cacheSize)
-			, m_transactionDataContainer(transactionDataContainer)
-			, m_idLookup(idLookup)
-			, m_readLock(std::move(readLock))
+			, m_shards(shards)
+			, m_readLocks(std::move(readLocks))
 	{}
 
 	size_t MemoryUtCacheView::size() const {
-		return m_transactionDataContainer.size();
+		size_t size = 0;
+		for (const auto& pShard : m_shards)
+			size += pShard->TransactionDataContainer.size();
+
+		return size;
 	}
 
 	utils::FileSize MemoryUtCacheView::memorySize() const {
-		return m_cacheSize;
+		uint64_t cacheSize = 0;
+		for (const auto& pShard : m_shards)
+			cacheSize += pShard->CacheSize.bytes();
+
+		return utils::FileSize::FromBytes(cacheSize);
 	}
 
 	bool MemoryUtCacheView::contains(const Hash256& hash) const {
-		return m_idLookup.cend() != m_idLookup.find(hash);
+		const auto& idLookup = GetShard(m_shards, hash).IdLookup;
+		return idLookup.cend() != idLookup.find(hash);
 	}
 
 	void MemoryUtCacheView::forEach(const TransactionInfoConsumer& consumer) const {
-		for (const auto& data : m_transactionDataContainer) {
-			if (!consumer(data))
-				return;
-		}
+		ForEachMerged<InsertionOrderCursor>(m_shards, consumer);
+	}
+
+	void MemoryUtCacheView::forEach(MaxFeeMultiplierOrder order, const TransactionInfoConsumer& consumer) const {
+		if (MaxFeeMultiplierOrder::Ascending == order)
+			ForEachMerged<AscendingMaxFeeMultiplierCursor>(m_shards, consumer);
+		else
+			ForEachMerged<DescendingMaxFeeMultiplierCursor>(m_shards, consumer);
 	}
 
 	model::ShortHashRange MemoryUtCacheView::shortHashes() const {
-		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(m_transactionDataContainer.size());
+		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(size());
 		auto shortHashesIter = shortHashes.begin();
-		for (const auto& data : m_transactionDataContainer)
-			*shortHashesIter++ = utils::ToShortHash(data.EntityHash);
+		ForEachMerged<TransactionSummaryCursor>(m_shards, [&shortHashesIter](const auto& summary) {
+			*shortHashesIter++ = summary.ShortHash;
+			return true;
+		});
 
 		return shortHashes;
 	}
@@ -95,26 +407,29 @@ namespace catapult { namespace cache {
 			Timestamp minDeadline,
 			BlockFeeMultiplier minFeeMultiplier,
 			const utils::ShortHashesSet& knownShortHashes) const {
+		// only transaction summaries need to be inspected until a transaction is known to be returned
 		uint64_t totalSize = 0;
 		UnknownTransactions transactions;
-		for (const auto& data : m_transactionDataContainer) {
-			if (data.pEntity->Deadline < minDeadline)
-				continue;
+		auto maxResponseSize = m_maxResponseSize.bytes();
+		auto isCandidate = [minDeadline, minFeeMultiplier, &knownShortHashes](const auto& summary) {
+			if (summary.Deadline < minDeadline || summary.MaxFeeMultiplier < minFeeMultiplier)
+				return false;
 
-			if (data.pEntity->MaxFee < model::CalculateTransactionFee(minFeeMultiplier, *data.pEntity))
-				continue;
+			return knownShortHashes.cend() == knownShortHashes.find(summary.ShortHash);
+		};
 
-			auto shortHash = utils::ToShortHash(data.EntityHash);
-			auto iter = knownShortHashes.find(shortHash);
-			if (knownShortHashes.cend() == iter) {
-				auto pTransaction = data.pEntity;
-				totalSize += pTransaction->Size;
-				if (totalSize > m_maxResponseSize.bytes())
-					break;
+		ForEachMerged<TransactionSummaryCursor>(m_shards, [isCandidate, maxResponseSize, &totalSize, &transactions](const auto& summary) {
+			if (!isCandidate(summary))
+				return true;
 
-				transactions.push_back(pTransaction);
-			}
-		}
+			const auto& pTransaction = summary.pData->pEntity;
+			totalSize += pTransaction->Size;
+			if (totalSize > maxResponseSize)
+				return false;
+
+			transactions.push_back(pTransaction);
+			return true;
+		});
 
 		return transactions;
 	}
@@ -126,29 +441,42 @@ namespace catapult { namespace cache {
 	namespace {
 		class MemoryUtCacheModifier : public UtCacheModifier {
 		private:
-			using IdLookup = std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>>;
+			using HashSet = std::unordered_set<Hash256, utils::ArrayHasher<Hash256>>;
 
 		public:
 			MemoryUtCacheModifier(
 					utils::FileSize maxCacheSize,
 					utils::FileSize& cacheSize,
 					size_t& idSequence,
-					TransactionDataContainer& transactionDataContainer,
-					IdLookup& idLookup,
+					MemoryUtCacheShards& shards,
 					AccountWeights& weights,
-					utils::SpinReaderWriterLock::WriterLockGuard&& writeLock)
+					utils::SpinReaderWriterLock::WriterLockGuard&& modifierLock)
 					: m_maxCacheSize(maxCacheSize)
 					, m_cacheSize(cacheSize)
 					, m_idSequence(idSequence)
-					, m_transactionDataContainer(transactionDataContainer)
-					, m_idLookup(idLookup)
+					, m_shards(shards)
 					, m_weights(weights)
-					, m_writeLock(std::move(writeLock))
+					, m_modifierLock(std::move(modifierLock))
+					, m_isRemoveAllStaged(false)
 			{}
 
+			~MemoryUtCacheModifier() noexcept(false) override {
+				publish();
+			}
+
 		public:
+			// notice that shards are only changed by the (exclusive) modifier, so they can be read without acquiring shard locks;
+			// all changes are staged and published when the modifier is destroyed, so views never observe partial changes
+
 			size_t size() const override {
-				return m_transactionDataContainer.size();
+				size_t size = m_stagedTransactionInfos.size();
+				if (m_isRemoveAllStaged)
+					return size;
+
+				for (const auto& pShard : m_shards)
+					size += pShard->TransactionDataContainer.size();
+
+				return size - m_stagedRemovedHashes.size();
 			}
 
 			utils::FileSize memorySize() const override {
@@ -160,12 +488,12 @@ namespace catapult { namespace cache {
 				if (m_maxCacheSize.bytes() - m_cacheSize.bytes() < transactionSize)
 					return false;
 
-				if (m_idLookup.cend() != m_idLookup.find(transactionInfo.EntityHash))
+				const auto& hash = transactionInfo.EntityHash;
+				if (m_stagedIds.cend() != m_stagedIds.find(hash) || isPublished(hash))
 					return false;
 
-				m_idLookup.emplace(transactionInfo.EntityHash, ++m_idSequence);
-				m_transactionDataContainer.emplace(transactionInfo, m_idSequence);
-
+				m_stagedIds.emplace(hash, ++m_idSequence);
+				m_stagedTransactionInfos.emplace(m_idSequence, transactionInfo.copy());
 				m_weights.increment(transactionInfo.pEntity->SignerPublicKey, transactionSize);
 
 				auto oldCacheSize = m_cacheSize;
@@ -175,19 +503,26 @@ namespace catapult { namespace cache {
 			}
 
 			model::TransactionInfo remove(const Hash256& hash) override {
-				auto iter = m_idLookup.find(hash);
-				if (m_idLookup.cend() == iter)
-					return model::TransactionInfo();
-
-				auto dataIter = m_transactionDataContainer.find(TransactionData(iter->second));
-				auto erasedInfo = dataIter->copy();
-
-				auto transactionSize = dataIter->pEntity->Size;
-				m_weights.decrement(dataIter->pEntity->SignerPublicKey, transactionSize);
+				model::TransactionInfo erasedInfo;
+				auto stagedIdIter = m_stagedIds.find(hash);
+				if (m_stagedIds.cend() != stagedIdIter) {
+					auto stagedIter = m_stagedTransactionInfos.find(stagedIdIter->second);
+					erasedInfo = std::move(stagedIter->second);
+					m_stagedTransactionInfos.erase(stagedIter);
+					m_stagedIds.erase(stagedIdIter);
+				} else {
+					if (!isPublished(hash))
+						return model::TransactionInfo();
+
+					const auto& shard = GetShard(m_shards, hash);
+					auto dataIter = shard.TransactionDataContainer.find(TransactionData(shard.IdLookup.find(hash)->second));
+					erasedInfo = dataIter->copy();
+					m_stagedRemovedHashes.insert(hash);
+				}
+
+				auto transactionSize = erasedInfo.pEntity->Size;
+				m_weights.decrement(erasedInfo.pEntity->SignerPublicKey, transactionSize);
 				m_cacheSize = utils::FileSize::FromBytes(m_cacheSize.bytes() - transactionSize);
-
-				m_transactionDataContainer.erase(dataIter);
-				m_idLookup.erase(iter);
 				return erasedInfo;
 			}
 
@@ -196,31 +531,85 @@ namespace catapult { namespace cache {
 			}
 
 			std::vector<model::TransactionInfo> removeAll() override {
-				if (!m_transactionDataContainer.empty())
-					CATAPULT_LOG(debug) << "removing " << m_transactionDataContainer.size() << " elements from ut cache";
+				auto numTransactions = size();
+				if (0 != numTransactions)
+					CATAPULT_LOG(debug) << "removing " << numTransactions << " elements from ut cache";
 
-				// unfortunately cannot just move m_transactionDataContainer because it contains a different (derived) type
+				// unfortunately cannot just move transaction data containers because they contain a different (derived) type
 				std::vector<model::TransactionInfo> transactionInfosCopy;
-				transactionInfosCopy.reserve(m_transactionDataContainer.size());
+				transactionInfosCopy.reserve(numTransactions);
+
+				if (!m_isRemoveAllStaged) {
+					ForEachMerged<InsertionOrderCursor>(m_shards, [this, &transactionInfosCopy](const auto& data) {
+						if (m_stagedRemovedHashes.cend() == m_stagedRemovedHashes.find(data.EntityHash))
+							transactionInfosCopy.emplace_back(data.copy());
+
+						return true;
+					});
+				}
 
-				for (const auto& data : m_transactionDataContainer)
-					transactionInfosCopy.emplace_back(data.copy());
+				// staged transactions always have larger ids than published transactions
+				for (auto& pair : m_stagedTransactionInfos)
+					transactionInfosCopy.push_back(std::move(pair.second));
+
+				m_isRemoveAllStaged = true;
+				m_stagedRemovedHashes.clear();
+				m_stagedTransactionInfos.clear();
+				m_stagedIds.clear();
 
 				m_cacheSize = utils::FileSize();
-				m_transactionDataContainer.clear();
-				m_idLookup.clear();
 				m_weights.reset();
 				return transactionInfosCopy;
 			}
 
+		private:
+			bool isPublished(const Hash256& hash) const {
+				if (m_isRemoveAllStaged || m_stagedRemovedHashes.cend() != m_stagedRemovedHashes.find(hash))
+					return false;
+
+				const auto& idLookup = GetShard(m_shards, hash).IdLookup;
+				return idLookup.cend() != idLookup.find(hash);
+			}
+
+			void publish() {
+				// lock all changed shards (in order) so that all changes are published atomically
+				std::vector<bool> isShardChanged(m_shards.size(), m_isRemoveAllStaged);
+				for (const auto& hash : m_stagedRemovedHashes)
+					isShardChanged[GetShardIndex(m_shards, hash)] = true;
+
+				for (const auto& pair : m_stagedTransactionInfos)
+					isShardChanged[GetShardIndex(m_shards, pair.second.EntityHash)] = true;
+
+				std::vector<utils::SpinReaderWriterLock::WriterLockGuard> shardLocks;
+				for (auto i = 0u; i < m_shards.size(); ++i) {
+					if (isShardChanged[i])
+						shardLocks.push_back(m_shards[i]->Lock.acquireWriter());
+				}
+
+				if (m_isRemoveAllStaged) {
+					for (auto& pShard : m_shards)
+						ClearShard(*pShard);
+				}
+
+				for (const auto& hash : m_stagedRemovedHashes)
+					RemoveTransaction(*m_shards[GetShardIndex(m_shards, hash)], hash);
+
+				for (const auto& pair : m_stagedTransactionInfos)
+					AddTransaction(*m_shards[GetShardIndex(m_shards, pair.second.EntityHash)], pair.second, pair.first);
+			}
+
 		private:
 			utils::FileSize m_maxCacheSize;
 			utils::FileSize& m_cacheSize;
 			size_t& m_idSequence;
-			TransactionDataContainer& m_transactionDataContainer;
-			IdLookup& m_idLookup;
+			MemoryUtCacheShards& m_shards;
 			AccountWeights& m_weights;
-			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
+			utils::SpinReaderWriterLock::WriterLockGuard m_modifierLock;
+
+			bool m_isRemoveAllStaged;
+			HashSet m_stagedRemovedHashes;
+			IdLookup m_stagedIds;
+			std::map<size_t, model::TransactionInfo> m_stagedTransactionInfos;
 		};
 	}
 
@@ -229,41 +618,44 @@ namespace catapult { namespace cache {
 	// region MemoryUtCache
 
 	struct MemoryUtCache::Impl {
-		cache::TransactionDataContainer TransactionDataContainer;
-		utils::FileSize CacheSize;
+	public:
+		explicit Impl(uint32_t numShards) : IdSequence(0) {
+			for (auto i = 0u; i < std::max<uint32_t>(1, numShards); ++i)
+				Shards.push_back(std::make_unique<MemoryUtCacheShard>());
+		}
 
-		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
+	public:
+		MemoryUtCacheShards Shards;
+		utils::FileSize CacheSize;
+		size_t IdSequence;
 		AccountWeights Weights;
 	};
 
 	MemoryUtCache::MemoryUtCache(const MemoryCacheOptions& options)
 			: m_options(options)
-			, m_idSequence(0)
-			, m_pImpl(std::make_unique<Impl>())
+			, m_pImpl(std::make_unique<Impl>(m_options.NumShards))
 	{}
 
 	MemoryUtCache::~MemoryUtCache() = default;
 
 	MemoryUtCacheView MemoryUtCache::view() const {
-		auto readLock = m_lock.acquireReader();
-		return MemoryUtCacheView(
-				m_options.MaxResponseSize,
-				m_pImpl->CacheSize,
-				m_pImpl->TransactionDataContainer,
-				m_pImpl->IdLookup,
-				std::move(readLock));
+		std::vector<utils::SpinReaderWriterLock::ReaderLockGuard> readLocks;
+		readLocks.reserve(m_pImpl->Shards.size());
+		for (auto& pShard : m_pImpl->Shards)
+			readLocks.push_back(pShard->Lock.acquireReader());
+
+		return MemoryUtCacheView(m_options.MaxResponseSize, m_pImpl->Shards, std::move(readLocks));
 	}
 
 	UtCacheModifierProxy MemoryUtCache::modifier() {
-		auto writeLock = m_lock.acquireWriter();
+		auto modifierLock = m_modifierLock.acquireWriter();
 		return UtCacheModifierProxy(std::make_unique<MemoryUtCacheModifier>(
 				m_options.MaxCacheSize,
 				m_pImpl->CacheSize,
-				m_idSequence,
-				m_pImpl->TransactionDataContainer,
-				m_pImpl->IdLookup,
+				m_pImpl->IdSequence,
+				m_pImpl->Shards,
 				m_pImpl->Weights,
-				std::move(writeLock)));
+				std::move(modifierLock)));
 	}
 
 	// endregion
@@ -26,33 +26,36 @@
 #include "catapult/model/RangeTypes.h"
 #include "catapult/utils/Hashers.h"
 #include "catapult/utils/SpinReaderWriterLock.h"
-#include <set>
-#include <unordered_map>
+#include <vector>
 
-namespace catapult { namespace cache { struct TransactionData; } }
+namespace catapult { namespace cache { struct MemoryUtCacheShard; } }
 
 namespace catapult { namespace cache {
 
-	/// Internal container wrapped by MemoryUtCache.
-	/// \note std::set is used to allow incomplete type.
-	using TransactionDataContainer = std::set<TransactionData>;
+	/// Internal shards wrapped by MemoryUtCache.
+	/// \note Transactions are assigned to shards by entity hash.
+	using MemoryUtCacheShards = std::vector<std::unique_ptr<MemoryUtCacheShard>>;
+
+	/// Ordering of unconfirmed transactions by max fee multiplier.
+	enum class MaxFeeMultiplierOrder {
+		/// Transactions with smaller max fee multipliers are first.
+		Ascending,
+
+		/// Transactions with larger max fee multipliers are first.
+		Descending
+	};
 
 	/// Read only view on top of unconfirmed transactions cache.
 	class MemoryUtCacheView {
 	private:
 		using UnknownTransactions = std::vector<std::shared_ptr<const model::Transaction>>;
-		using IdLookup = std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>>;
 		using TransactionInfoConsumer = predicate<const model::TransactionInfo&>;
+		using ReaderLockGuards = std::vector<utils::SpinReaderWriterLock::ReaderLockGuard>;
 
 	public:
-		/// Creates a view around a maximum response size (\a maxResponseSize), current cache size (\a cacheSize),
-		/// a transaction data container (\a transactionDataContainer) and an id lookup (\a idLookup) with lock context \a readLock.
-		MemoryUtCacheView(
-				utils::FileSize maxResponseSize,
-				utils::FileSize cacheSize,
-				const TransactionDataContainer& transactionDataContainer,
-				const IdLookup& idLookup,
-				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
+		/// Creates a view around a maximum response size (\a maxResponseSize) and transaction shards (\a shards)
+		/// with per shard lock contexts \a readLocks.
+		MemoryUtCacheView(utils::FileSize maxResponseSize, const MemoryUtCacheShards& shards, ReaderLockGuards&& readLocks);
 
 	public:
 		/// Gets the number of unconfirmed transactions in the cache.
@@ -67,6 +70,11 @@ namespace catapult { namespace cache {
 		/// Calls \a consumer with all transaction infos until all are consumed or \c false is returned by consumer.
 		void forEach(const TransactionInfoConsumer& consumer) const;
 
+		/// Calls \a consumer with all transaction infos ordered by max fee multiplier according to \a order
+		/// until all are consumed or \c false is returned by consumer.
+		/// \note Older transactions are consumed first when max fee multipliers are equal.
+		void forEach(MaxFeeMultiplierOrder order, const TransactionInfoConsumer& consumer) const;
+
 		/// Gets a range of short hashes of all transactions in the cache.
 		/// \note Each short hash consists of the first 4 bytes of the complete hash.
 		model::ShortHashRange shortHashes() const;
@@ -80,10 +88,8 @@ namespace catapult { namespace cache {
 
 	private:
 		utils::FileSize m_maxResponseSize;
-		utils::FileSize m_cacheSize;
-		const TransactionDataContainer& m_transactionDataContainer;
-		const IdLookup& m_idLookup;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		const MemoryUtCacheShards& m_shards;
+		ReaderLockGuards m_readLocks;
 	};
 
 	/// Interface (read write) for caching unconfirmed transactions.
@@ -94,6 +100,9 @@ namespace catapult { namespace cache {
 	};
 
 	/// Cache for all unconfirmed transactions.
+	/// \note Transactions are partitioned into independently locked shards.
+	///       Modifiers are exclusive and stage their changes, which are published (atomically) when they are destroyed,
+	///       so views can be acquired while a modifier is outstanding and never observe partially applied changes.
 	class MemoryUtCache : public ReadWriteUtCache {
 	public:
 		using CacheWriteOnlyInterface = UtCache;
@@ -116,9 +125,8 @@ namespace catapult { namespace cache {
 
 	private:
 		MemoryCacheOptions m_options;
-		size_t m_idSequence;
 		std::unique_ptr<Impl> m_pImpl;
-		mutable utils::SpinReaderWriterLock m_lock;
+		utils::SpinReaderWriterLock m_modifierLock;
 	};
 
 	/// Delegating proxy around a MemoryUtCache.
@@ -23,6 +23,38 @@
 
 namespace catapult { namespace cache {
 
+	namespace {
+		template<typename TForEach>
+		std::vector<const model::TransactionInfo*> SelectFirstTransactionInfoPointers(
+				const MemoryUtCacheView& utCacheView,
+				uint32_t transactionLimit,
+				const EmbeddedCountRetriever& countRetriever,
+				const predicate<const model::TransactionInfo&>& filter,
+				TForEach forEach) {
+			std::vector<const model::TransactionInfo*> transactionInfoPointers;
+			transactionInfoPointers.reserve(std::min<size_t>(utCacheView.size(), transactionLimit));
+
+			if (0 != transactionLimit) {
+				uint32_t totalTransactionsCount = 0;
+				forEach([transactionLimit, &countRetriever, &filter, &transactionInfoPointers, &totalTransactionsCount](
+						const auto& transactionInfo) {
+					auto currentTransactionsCount = countRetriever(*transactionInfo.pEntity);
+					if (totalTransactionsCount + currentTransactionsCount > transactionLimit)
+						return false;
+
+					if (filter(transactionInfo)) {
+						totalTransactionsCount += currentTransactionsCount;
+						transactionInfoPointers.push_back(&transactionInfo);
+					}
+
+					return true;
+				});
+			}
+
+			return transactionInfoPointers;
+		}
+	}
+
 	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
 			const MemoryUtCacheView& utCacheView,
 			uint32_t transactionLimit,
@@ -35,27 +67,23 @@ namespace catapult { namespace cache {
 			uint32_t transactionLimit,
 			const EmbeddedCountRetriever& countRetriever,
 			const predicate<const model::TransactionInfo&>& filter) {
-		std::vector<const model::TransactionInfo*> transactionInfoPointers;
-		transactionInfoPointers.reserve(std::min<size_t>(utCacheView.size(), transactionLimit));
-
-		if (0 != transactionLimit) {
-			uint32_t totalTransactionsCount = 0;
-			utCacheView.forEach([transactionLimit, countRetriever, filter, &transactionInfoPointers, &totalTransactionsCount](
-					const auto& transactionInfo) {
-				auto currentTransactionsCount = countRetriever(*transactionInfo.pEntity);
-				if (totalTransactionsCount + currentTransactionsCount > transactionLimit)
-					return false;
-
-				if (filter(transactionInfo)) {
-					totalTransactionsCount += currentTransactionsCount;
-					transactionInfoPointers.push_back(&transactionInfo);
-				}
-
-				return true;
-			});
-		}
+		return SelectFirstTransactionInfoPointers(utCacheView, transactionLimit, countRetriever, filter, [&utCacheView](
+				const auto& consumer) {
+			utCacheView.forEach(consumer);
+		});
+	}
 
-		return transactionInfoPointers;
+	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
+			const MemoryUtCacheView& utCacheView,
+			uint32_t transactionLimit,
+			const EmbeddedCountRetriever& countRetriever,
+			MaxFeeMultiplierOrder order,
+			const predicate<const model::TransactionInfo&>& filter) {
+		// walk the incrementally maintained index, so only transactions that can fit into the block are visited
+		return SelectFirstTransactionInfoPointers(utCacheView, transactionLimit, countRetriever, filter, [&utCacheView, order](
+				const auto& consumer) {
+			utCacheView.forEach(order, consumer);
+		});
 	}
 
 	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
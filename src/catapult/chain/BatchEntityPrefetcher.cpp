@@ -0,0 +1,142 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BatchEntityPrefetcher.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+
+namespace catapult { namespace chain {
+
+	namespace {
+		using CachePrefetchers = std::vector<cache::CachePrefetcher*>;
+
+		class CollectingNotificationSubscriber : public model::NotificationSubscriber {
+		public:
+			CollectingNotificationSubscriber(const CachePrefetchers& prefetchers, const model::ResolverContext& resolvers)
+					: m_prefetchers(prefetchers)
+					, m_resolvers(resolvers)
+			{}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				for (auto* pPrefetcher : m_prefetchers)
+					pPrefetcher->collect(notification, m_resolvers);
+			}
+
+		private:
+			const CachePrefetchers& m_prefetchers;
+			const model::ResolverContext& m_resolvers;
+		};
+
+		class DefaultBatchEntityPrefetcher {
+		public:
+			DefaultBatchEntityPrefetcher(
+					const ExecutionConfiguration& config,
+					const std::vector<cache::CachePrefetcherFactory>& prefetcherFactories,
+					thread::IoThreadPool& pool)
+					: m_config(config)
+					, m_prefetcherFactories(prefetcherFactories)
+					, m_pool(pool)
+			{}
+
+		public:
+			void operator()(const model::WeakEntityInfos& entityInfos, cache::CatapultCacheDelta& cache) const {
+				if (entityInfos.empty() || m_prefetcherFactories.empty())
+					return;
+
+				std::vector<std::unique_ptr<cache::CachePrefetcher>> prefetchers;
+				for (const auto& prefetcherFactory : m_prefetcherFactories)
+					prefetchers.push_back(prefetcherFactory());
+
+				auto readOnlyCache = cache.toReadOnly();
+				auto resolvers = m_config.ResolverContextFactory(readOnlyCache);
+
+				// resolution prefetchers need to complete first so that resolving values during the second pass is fast
+				prefetch(cache::CachePrefetchPhase::Resolution, prefetchers, entityInfos, resolvers, cache);
+				prefetch(cache::CachePrefetchPhase::Default, prefetchers, entityInfos, resolvers, cache);
+			}
+
+		private:
+			void prefetch(
+					cache::CachePrefetchPhase phase,
+					const std::vector<std::unique_ptr<cache::CachePrefetcher>>& prefetchers,
+					const model::WeakEntityInfos& entityInfos,
+					const model::ResolverContext& resolvers,
+					const cache::CatapultCacheDelta& cache) const {
+				CachePrefetchers phasePrefetchers;
+				for (const auto& pPrefetcher : prefetchers) {
+					if (phase == pPrefetcher->phase())
+						phasePrefetchers.push_back(pPrefetcher.get());
+				}
+
+				if (phasePrefetchers.empty())
+					return;
+
+				CollectingNotificationSubscriber sub(phasePrefetchers, resolvers);
+				for (const auto& entityInfo : entityInfos)
+					m_config.pNotificationPublisher->publish(entityInfo, sub);
+
+				// each prefetcher accesses a different sub cache, so all prefetchers can run at the same time
+				std::vector<std::exception_ptr> exceptions(phasePrefetchers.size());
+				auto numPartitions = std::min<size_t>(m_pool.numWorkerThreads(), phasePrefetchers.size());
+				thread::ParallelFor(m_pool.ioContext(), phasePrefetchers, numPartitions, [&cache, &exceptions](
+						const auto* pPrefetcher,
+						auto index) {
+					try {
+						pPrefetcher->prefetch(cache);
+					} catch (...) {
+						exceptions[index] = std::current_exception();
+					}
+
+					return true;
+				}).get();
+
+				for (const auto& pException : exceptions) {
+					if (pException)
+						std::rethrow_exception(pException);
+				}
+			}
+
+		private:
+			ExecutionConfiguration m_config;
+			std::vector<cache::CachePrefetcherFactory> m_prefetcherFactories;
+			thread::IoThreadPool& m_pool;
+		};
+	}
+
+	BatchEntityPrefetcher CreateBatchEntityPrefetcher(
+			const ExecutionConfiguration& config,
+			const std::vector<cache::CachePrefetcherFactory>& prefetcherFactories,
+			thread::IoThreadPool& pool) {
+		return DefaultBatchEntityPrefetcher(config, prefetcherFactories, pool);
+	}
+
+	BatchEntityProcessor CreatePrefetchingBatchEntityProcessor(
+			const BatchEntityPrefetcher& prefetcher,
+			const BatchEntityProcessor& processor) {
+		return [prefetcher, processor](auto height, auto timestamp, const auto& entityInfos, auto& state) {
+			prefetcher(entityInfos, state.Cache);
+			return processor(height, timestamp, entityInfos, state);
+		};
+	}
+}}
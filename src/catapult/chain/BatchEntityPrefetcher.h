@@ -0,0 +1,46 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "BatchEntityProcessor.h"
+#include "catapult/cache/CachePrefetcher.h"
+
+namespace catapult { namespace thread { class IoThreadPool; } }
+
+namespace catapult { namespace chain {
+
+	/// Function signature for loading all cache entries referenced by a batch of entity infos into a cache delta.
+	using BatchEntityPrefetcher = consumer<const model::WeakEntityInfos&, cache::CatapultCacheDelta&>;
+
+	/// Creates a batch entity prefetcher around \a config and \a prefetcherFactories that prefetches sub caches in parallel
+	/// using \a pool.
+	/// \note All prefetchers in the same phase are expected to access different sub caches.
+	BatchEntityPrefetcher CreateBatchEntityPrefetcher(
+			const ExecutionConfiguration& config,
+			const std::vector<cache::CachePrefetcherFactory>& prefetcherFactories,
+			thread::IoThreadPool& pool);
+
+	/// Creates a batch entity processor that uses \a prefetcher to load all referenced cache entries before forwarding
+	/// to \a processor.
+	BatchEntityProcessor CreatePrefetchingBatchEntityProcessor(
+			const BatchEntityPrefetcher& prefetcher,
+			const BatchEntityProcessor& processor);
+}}
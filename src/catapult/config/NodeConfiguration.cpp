@@ -43,8 +43,10 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(EnableSingleThreadPool);
 		LOAD_NODE_PROPERTY(EnableCacheDatabaseStorage);
 		LOAD_NODE_PROPERTY(EnableAutoSyncCleanup);
+		LOAD_NODE_PROPERTY(EnableParallelStateHashCalculation);
 
 		LOAD_NODE_PROPERTY(FileDatabaseBatchSize);
+		LOAD_NODE_PROPERTY(BlockStorageMaxMappedFiles);
 
 		LOAD_NODE_PROPERTY(EnableTransactionSpamThrottling);
 		LOAD_NODE_PROPERTY(TransactionSpamThrottlingMaxBoostFee);
@@ -63,6 +65,7 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(TransactionSelectionStrategy);
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxResponseSize);
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxSize);
+		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheNumShards);
 
 		LOAD_NODE_PROPERTY(ConnectTimeout);
 		LOAD_NODE_PROPERTY(SyncTimeout);
@@ -103,6 +106,7 @@ namespace catapult { namespace config {
 		LOAD_CACHE_DATABASE_PROPERTY(MemtableMemoryBudget);
 
 		LOAD_CACHE_DATABASE_PROPERTY(MaxWriteBatchSize);
+		LOAD_CACHE_DATABASE_PROPERTY(GroupCommitInterval);
 
 #undef LOAD_CACHE_DATABASE_PROPERTY
 
@@ -150,7 +154,7 @@ namespace catapult { namespace config {
 
 #undef LOAD_BANNING_PROPERTY
 
-		utils::VerifyBagSizeExact(bag, 40 + 7 + 4 + 4 + 5 + 9);
+		utils::VerifyBagSizeExact(bag, 43 + 8 + 4 + 4 + 5 + 9);
 		return config;
 	}
 
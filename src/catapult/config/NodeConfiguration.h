@@ -53,10 +53,17 @@ namespace catapult { namespace config {
 		/// \note This should be \c false if broker process is running.
 		bool EnableAutoSyncCleanup;
 
+		/// \c true if sub cache merkle roots should be updated concurrently when calculating state hashes.
+		bool EnableParallelStateHashCalculation;
+
 		/// Maximum number of payloads to store in each file database disk file.
 		/// \note This is recommended to be a factor of 10000.
 		uint32_t FileDatabaseBatchSize;
 
+		/// Maximum number of recently read block storage files to keep memory mapped.
+		/// \note Block storage files are read via streams when this is zero.
+		uint32_t BlockStorageMaxMappedFiles;
+
 		/// \c true if transaction spam throttling should be enabled.
 		bool EnableTransactionSpamThrottling;
 
@@ -100,6 +107,9 @@ namespace catapult { namespace config {
 		/// Maximum size of the unconfirmed transactions cache.
 		utils::FileSize UnconfirmedTransactionsCacheMaxSize;
 
+		/// Number of independently locked shards in the unconfirmed transactions cache.
+		uint32_t UnconfirmedTransactionsCacheNumShards;
+
 		/// Timeout for connecting to a peer.
 		utils::TimeSpan ConnectTimeout;
 
@@ -183,6 +193,10 @@ namespace catapult { namespace config {
 
 			/// Maximum write batch size.
 			utils::FileSize MaxWriteBatchSize;
+
+			/// Interval between background syncs of written batches.
+			/// \note Every batch is synced when written when zero.
+			utils::TimeSpan GroupCommitInterval;
 		};
 
 	public:
@@ -21,9 +21,9 @@
 
 #include "BlockConsumers.h"
 #include "ConsumerResults.h"
+#include "SignatureInputCollector.h"
 #include "TransactionConsumers.h"
 #include "ValidationConsumerUtils.h"
-#include "catapult/model/NotificationSubscriber.h"
 #include "catapult/thread/IoThreadPool.h"
 #include "catapult/thread/ParallelFor.h"
 #include "catapult/validators/AggregateValidationResult.h"
@@ -31,59 +31,11 @@
 namespace catapult { namespace consumers {
 
 	namespace {
-		class SignatureCapturingNotificationSubscriber : public model::NotificationSubscriber {
-		public:
-			explicit SignatureCapturingNotificationSubscriber(const GenerationHashSeed& generationHashSeed)
-					: m_generationHashSeed(generationHashSeed)
-					, m_entityIndex(0)
-			{}
-
-		public:
-			const auto& notificationToEntityIndexMap() const {
-				return m_notificationToEntityIndexMap;
-			}
-
-			const auto& inputs() const {
-				return m_inputs;
-			}
-
-		public:
-			void next() {
-				++m_entityIndex;
-			}
-
-		public:
-			void notify(const model::Notification& notification) override {
-				if (model::SignatureNotification::Notification_Type != notification.Type)
-					return;
-
-				m_notificationToEntityIndexMap.push_back(m_entityIndex);
-				add(static_cast<const model::SignatureNotification&>(notification));
-			}
-
-		private:
-			void add(const model::SignatureNotification& notification) {
-				std::vector<RawBuffer> buffers;
-				if (model::SignatureNotification::ReplayProtectionMode::Enabled == notification.DataReplayProtectionMode)
-					buffers.push_back(m_generationHashSeed);
-
-				buffers.push_back(notification.Data);
-
-				m_inputs.push_back({ notification.SignerPublicKey, buffers, notification.Signature });
-			}
-
-		private:
-			const GenerationHashSeed& m_generationHashSeed;
-			size_t m_entityIndex;
-			std::vector<size_t> m_notificationToEntityIndexMap;
-			std::vector<crypto::SignatureInput> m_inputs;
-		};
-
-		std::unique_ptr<SignatureCapturingNotificationSubscriber> ExtractAllSignatureNotifications(
+		std::unique_ptr<SignatureInputCollector> ExtractAllSignatureNotifications(
 				const GenerationHashSeed& generationHashSeed,
 				const model::NotificationPublisher& publisher,
 				const model::WeakEntityInfos& entityInfos) {
-			auto pSub = std::make_unique<SignatureCapturingNotificationSubscriber>(generationHashSeed);
+			auto pSub = std::make_unique<SignatureInputCollector>(generationHashSeed, entityInfos.size());
 			for (const auto& entityInfo : entityInfos) {
 				publisher.publish(entityInfo, *pSub);
 				pSub->next();
@@ -115,7 +67,7 @@ namespace catapult { namespace consumers {
 		return MakeBlockValidationConsumer(requiresValidationPredicate, [&pool, generationHashSeed, randomFiller, pPublisher](
 				const auto& entityInfos) {
 			// find all signature notifications
-			auto inputs = ExtractAllSignatureNotifications(generationHashSeed, *pPublisher, entityInfos)->inputs();
+			auto pSub = ExtractAllSignatureNotifications(generationHashSeed, *pPublisher, entityInfos);
 
 			// process signatures in batches
 			std::atomic<validators::ValidationResult> aggregateResult(validators::ValidationResult::Success);
@@ -125,7 +77,7 @@ namespace catapult { namespace consumers {
 					validators::AggregateValidationResult(aggregateResult, Failure_Consumer_Batch_Signature_Not_Verifiable);
 			};
 
-			thread::ParallelForPartition(pool.ioContext(), inputs, pool.numWorkerThreads(), partitionCallback).get();
+			thread::ParallelForPartition(pool.ioContext(), pSub->inputs(), pool.numWorkerThreads(), partitionCallback).get();
 			return aggregateResult.load();
 		});
 	}
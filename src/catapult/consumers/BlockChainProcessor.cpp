@@ -97,10 +97,12 @@ namespace catapult { namespace consumers {
 			DefaultBlockChainProcessor(
 					const BlockHitPredicateFactory& blockHitPredicateFactory,
 					const chain::BatchEntityProcessor& batchEntityProcessor,
-					ReceiptValidationMode receiptValidationMode)
+					ReceiptValidationMode receiptValidationMode,
+					thread::IoThreadPool* pStateHashPool)
 					: m_blockHitPredicateFactory(blockHitPredicateFactory)
 					, m_batchEntityProcessor(batchEntityProcessor)
 					, m_receiptValidationMode(receiptValidationMode)
+					, m_pStateHashPool(pStateHashPool)
 			{}
 
 		public:
@@ -122,7 +124,7 @@ namespace catapult { namespace consumers {
 
 				// initial cache state will be either last cache state or unwound cache state
 				std::vector<std::string> cacheStateLogs;
-				cacheStateLogs.push_back(FormatCacheStateLog(pParent->Height, state.Cache.calculateStateHash(pParent->Height)));
+				cacheStateLogs.push_back(FormatCacheStateLog(pParent->Height, calculateStateHash(state.Cache, pParent->Height)));
 
 				for (auto& element : elements) {
 					// 1. check generation hash
@@ -158,6 +160,12 @@ namespace catapult { namespace consumers {
 			}
 
 		private:
+			cache::StateHashInfo calculateStateHash(const cache::CatapultCacheDelta& cacheDelta, Height height) const {
+				return m_pStateHashPool
+						? cacheDelta.calculateStateHash(height, *m_pStateHashPool)
+						: cacheDelta.calculateStateHash(height);
+			}
+
 			observers::ObserverState createBlockDependentObserverState(
 					observers::ObserverState& state,
 					model::BlockStatementBuilder& blockStatementBuilder) const {
@@ -209,12 +217,12 @@ namespace catapult { namespace consumers {
 				return validators::ValidationResult::Success;
 			}
 
-			static bool CheckStateHash(
+			bool CheckStateHash(
 					model::BlockElement& element,
 					cache::CatapultCacheDelta& cacheDelta,
-					std::vector<std::string>& cacheStateLogs) {
+					std::vector<std::string>& cacheStateLogs) const {
 				const auto& block = element.Block;
-				auto cacheStateHashInfo = cacheDelta.calculateStateHash(block.Height);
+				auto cacheStateHashInfo = calculateStateHash(cacheDelta, block.Height);
 				cacheStateLogs.push_back(FormatCacheStateLog(block.Height, cacheStateHashInfo));
 
 				if (block.StateHash != cacheStateHashInfo.StateHash) {
@@ -264,6 +272,7 @@ namespace catapult { namespace consumers {
 			BlockHitPredicateFactory m_blockHitPredicateFactory;
 			chain::BatchEntityProcessor m_batchEntityProcessor;
 			ReceiptValidationMode m_receiptValidationMode;
+			thread::IoThreadPool* m_pStateHashPool;
 		};
 	}
 
@@ -271,6 +280,14 @@ namespace catapult { namespace consumers {
 			const BlockHitPredicateFactory& blockHitPredicateFactory,
 			const chain::BatchEntityProcessor& batchEntityProcessor,
 			ReceiptValidationMode receiptValidationMode) {
-		return DefaultBlockChainProcessor(blockHitPredicateFactory, batchEntityProcessor, receiptValidationMode);
+		return DefaultBlockChainProcessor(blockHitPredicateFactory, batchEntityProcessor, receiptValidationMode, nullptr);
+	}
+
+	BlockChainProcessor CreateBlockChainProcessor(
+			const BlockHitPredicateFactory& blockHitPredicateFactory,
+			const chain::BatchEntityProcessor& batchEntityProcessor,
+			ReceiptValidationMode receiptValidationMode,
+			thread::IoThreadPool& stateHashPool) {
+		return DefaultBlockChainProcessor(blockHitPredicateFactory, batchEntityProcessor, receiptValidationMode, &stateHashPool);
 	}
 }}
@@ -44,6 +44,15 @@ namespace catapult { namespace consumers {
 			const GenerationHashSeed& generationHashSeed,
 			const model::TransactionRegistry& transactionRegistry);
 
+	/// Creates a consumer that calculates hashes of all entities using \a transactionRegistry for the network with the specified
+	/// generation hash seed (\a generationHashSeed). Transactions merkle tree levels with at least \a minMerklePartitionSize pairs
+	/// are hashed in parallel using \a pool.
+	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
+			const GenerationHashSeed& generationHashSeed,
+			const model::TransactionRegistry& transactionRegistry,
+			thread::IoThreadPool& pool,
+			size_t minMerklePartitionSize);
+
 	/// Creates a consumer that checks entities for previous processing based on their hash.
 	/// \a timeSupplier is used for generating timestamps and \a options specifies additional cache options.
 	disruptor::ConstBlockConsumer CreateBlockHashCheckConsumer(const chain::TimeSupplier& timeSupplier, const HashCheckOptions& options);
@@ -25,6 +25,7 @@
 #include "catapult/crypto/Hashes.h"
 #include "catapult/crypto/MerkleHashBuilder.h"
 #include "catapult/model/EntityHasher.h"
+#include "catapult/thread/ParallelMerkleLevelHasher.h"
 
 namespace catapult { namespace consumers {
 
@@ -33,9 +34,11 @@ namespace catapult { namespace consumers {
 		public:
 			BlockHashCalculatorConsumer(
 					const GenerationHashSeed& generationHashSeed,
-					const model::TransactionRegistry& transactionRegistry)
+					const model::TransactionRegistry& transactionRegistry,
+					const crypto::MerkleLevelHasher& merkleLevelHasher)
 					: m_generationHashSeed(generationHashSeed)
 					, m_transactionRegistry(transactionRegistry)
+					, m_merkleLevelHasher(merkleLevelHasher)
 			{}
 
 		public:
@@ -46,7 +49,7 @@ namespace catapult { namespace consumers {
 				for (auto& element : elements) {
 					// note that disruptor input elements have been extracted from a packet (or created within this
 					// process), so their sizes have already been validated
-					crypto::MerkleHashBuilder transactionsHashBuilder;
+					auto transactionsHashBuilder = createMerkleHashBuilder();
 					for (const auto& transaction : element.Block.Transactions()) {
 						model::TransactionElement transactionElement(transaction);
 						model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, transactionElement);
@@ -66,16 +69,31 @@ namespace catapult { namespace consumers {
 				return Continue();
 			}
 
+		private:
+			crypto::MerkleHashBuilder createMerkleHashBuilder() const {
+				return m_merkleLevelHasher ? crypto::MerkleHashBuilder(0, m_merkleLevelHasher) : crypto::MerkleHashBuilder();
+			}
+
 		private:
 			GenerationHashSeed m_generationHashSeed;
 			const model::TransactionRegistry& m_transactionRegistry;
+			crypto::MerkleLevelHasher m_merkleLevelHasher;
 		};
 	}
 
 	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
 			const GenerationHashSeed& generationHashSeed,
 			const model::TransactionRegistry& transactionRegistry) {
-		return BlockHashCalculatorConsumer(generationHashSeed, transactionRegistry);
+		return BlockHashCalculatorConsumer(generationHashSeed, transactionRegistry, crypto::MerkleLevelHasher());
+	}
+
+	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
+			const GenerationHashSeed& generationHashSeed,
+			const model::TransactionRegistry& transactionRegistry,
+			thread::IoThreadPool& pool,
+			size_t minMerklePartitionSize) {
+		auto merkleLevelHasher = thread::CreateParallelMerkleLevelHasher(pool, minMerklePartitionSize);
+		return BlockHashCalculatorConsumer(generationHashSeed, transactionRegistry, merkleLevelHasher);
 	}
 
 	namespace {
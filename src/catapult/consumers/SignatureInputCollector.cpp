@@ -0,0 +1,83 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "SignatureInputCollector.h"
+#include <algorithm>
+
+namespace catapult { namespace consumers {
+
+	namespace {
+		// signature notifications contain at most two buffers (generation hash seed prefix and data)
+		constexpr size_t Max_Buffers_Per_Signature = 2;
+	}
+
+	SignatureInputCollector::SignatureInputCollector(const GenerationHashSeed& generationHashSeed, size_t numEntitiesHint)
+			: m_generationHashSeedBuffer(generationHashSeed)
+			, m_entityIndex(0) {
+		m_notificationToEntityIndexMap.reserve(numEntitiesHint);
+		m_buffers.reserve(Max_Buffers_Per_Signature * numEntitiesHint);
+		m_inputs.reserve(numEntitiesHint);
+	}
+
+	const std::vector<size_t>& SignatureInputCollector::notificationToEntityIndexMap() const {
+		return m_notificationToEntityIndexMap;
+	}
+
+	const std::vector<crypto::SignatureInputView>& SignatureInputCollector::inputs() const {
+		return m_inputs;
+	}
+
+	void SignatureInputCollector::next() {
+		++m_entityIndex;
+	}
+
+	void SignatureInputCollector::notify(const model::Notification& notification) {
+		if (model::SignatureNotification::Notification_Type != notification.Type)
+			return;
+
+		m_notificationToEntityIndexMap.push_back(m_entityIndex);
+		add(static_cast<const model::SignatureNotification&>(notification));
+	}
+
+	void SignatureInputCollector::add(const model::SignatureNotification& notification) {
+		auto isReplayProtected = model::SignatureNotification::ReplayProtectionMode::Enabled == notification.DataReplayProtectionMode;
+		auto numBuffers = isReplayProtected ? Max_Buffers_Per_Signature : 1;
+		reserveBuffers(m_buffers.size() + numBuffers);
+
+		const auto* pBuffers = m_buffers.data() + m_buffers.size();
+		if (isReplayProtected)
+			m_buffers.push_back(m_generationHashSeedBuffer);
+
+		m_buffers.push_back(notification.Data);
+		m_inputs.push_back({ notification.SignerPublicKey, pBuffers, numBuffers, notification.Signature });
+	}
+
+	void SignatureInputCollector::reserveBuffers(size_t size) {
+		if (size <= m_buffers.capacity())
+			return;
+
+		// rebase all collected views onto the reallocated arena
+		const auto* pOldBuffers = m_buffers.data();
+		m_buffers.reserve(std::max(size, 2 * m_buffers.capacity()));
+		for (auto& input : m_inputs)
+			input.pBuffers = m_buffers.data() + (input.pBuffers - pOldBuffers);
+	}
+}}
@@ -0,0 +1,63 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/crypto/Signer.h"
+#include "catapult/model/NotificationSubscriber.h"
+
+namespace catapult { namespace consumers {
+
+	/// Notification subscriber that collects signature notifications as signature input views.
+	/// \note All buffers are stored in a single collector-owned arena, so collection requires a constant number of allocations
+	///       when the number of signatures does not exceed the entity hint passed to the constructor.
+	class SignatureInputCollector : public model::NotificationSubscriber {
+	public:
+		/// Creates a collector around \a generationHashSeed that reserves space for signatures from \a numEntitiesHint entities.
+		SignatureInputCollector(const GenerationHashSeed& generationHashSeed, size_t numEntitiesHint);
+
+	public:
+		/// Gets the index of the originating entity for each collected signature.
+		const std::vector<size_t>& notificationToEntityIndexMap() const;
+
+		/// Gets the collected signature inputs.
+		/// \note Returned views are invalidated by subsequent notifications.
+		const std::vector<crypto::SignatureInputView>& inputs() const;
+
+	public:
+		/// Advances to the next entity.
+		void next();
+
+	public:
+		void notify(const model::Notification& notification) override;
+
+	private:
+		void add(const model::SignatureNotification& notification);
+
+		void reserveBuffers(size_t size);
+
+	private:
+		RawBuffer m_generationHashSeedBuffer;
+		size_t m_entityIndex;
+		std::vector<size_t> m_notificationToEntityIndexMap;
+		std::vector<RawBuffer> m_buffers;
+		std::vector<crypto::SignatureInputView> m_inputs;
+	};
+}}
@@ -77,7 +77,13 @@ namespace catapult { namespace crypto {
 	}
 
 	void Sha3_256(const RawBuffer& dataBuffer, Hash256& hash) {
-		HashSingleBuffer(EVP_sha3_256(), dataBuffer, hash);
+		Sha3_256_Context context;
+		context.update(dataBuffer);
+		context.final(hash);
+	}
+
+	void Sha3_256Multi(const RawBuffer* pDataBuffers, Hash256* pHashes, size_t count) {
+		Sha3_256Multi(pDataBuffers, pHashes, count, GetMaxKeccakParallelism());
 	}
 
 	void Hmac_Sha256(const RawBuffer& key, const RawBuffer& input, Hash256& output) {
@@ -111,23 +117,48 @@ namespace catapult { namespace crypto {
 			return EVP_sha512();
 		}
 
-		const EVP_MD* GetMessageDigest(Sha3ModeTag, Hash256_tag) {
-			return EVP_sha3_256();
+		// sha3 builders use the native keccak context instead of openssl
+
+		void InitContext(OpensslDigestContext& context, Sha2ModeTag modeTag, Hash512_tag hashTag) {
+			context.dispatch(EVP_DigestInit_ex, GetMessageDigest(modeTag, hashTag), nullptr);
+		}
+
+		template<typename THashTag>
+		void InitContext(Sha3_256_Context&, Sha3ModeTag, THashTag)
+		{}
+
+		void UpdateContext(OpensslDigestContext& context, const RawBuffer& dataBuffer) {
+			context.dispatch(EVP_DigestUpdate, dataBuffer.pData, dataBuffer.Size);
+		}
+
+		void UpdateContext(Sha3_256_Context& context, const RawBuffer& dataBuffer) {
+			context.update(dataBuffer);
 		}
 
-		const EVP_MD* GetMessageDigest(Sha3ModeTag, GenerationHash_tag) {
-			return EVP_sha3_256();
+		template<typename TOutput>
+		void FinalContext(OpensslDigestContext& context, TOutput& output) {
+			auto outputSize = static_cast<unsigned int>(output.size());
+			context.dispatch(EVP_DigestFinal_ex, output.data(), &outputSize);
+		}
+
+		template<typename TOutput>
+		void FinalContext(Sha3_256_Context& context, TOutput& output) {
+			static_assert(Hash256::Size == TOutput::Size, "sha3 builder output must be 256 bits");
+
+			Hash256 hash;
+			context.final(hash);
+			utils::memcpy_cond(output.data(), hash.data(), hash.size());
 		}
 	}
 
 	template<typename TModeTag, typename THashTag>
 	HashBuilderT<TModeTag, THashTag>::HashBuilderT() {
-		m_context.dispatch(EVP_DigestInit_ex, GetMessageDigest(TModeTag(), THashTag()), nullptr);
+		InitContext(m_context, TModeTag(), THashTag());
 	}
 
 	template<typename TModeTag, typename THashTag>
 	void HashBuilderT<TModeTag, THashTag>::update(const RawBuffer& dataBuffer) {
-		m_context.dispatch(EVP_DigestUpdate, dataBuffer.pData, dataBuffer.Size);
+		UpdateContext(m_context, dataBuffer);
 	}
 
 	template<typename TModeTag, typename THashTag>
@@ -138,8 +169,7 @@ namespace catapult { namespace crypto {
 
 	template<typename TModeTag, typename THashTag>
 	void HashBuilderT<TModeTag, THashTag>::final(OutputType& output) {
-		auto outputSize = static_cast<unsigned int>(output.size());
-		m_context.dispatch(EVP_DigestFinal_ex, output.data(), &outputSize);
+		FinalContext(m_context, output);
 	}
 
 	template class HashBuilderT<Sha2ModeTag, Hash512_tag>;
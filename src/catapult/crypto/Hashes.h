@@ -20,6 +20,7 @@
 **/
 
 #pragma once
+#include "Keccak.h"
 #include "OpensslContexts.h"
 #include "catapult/types.h"
 
@@ -45,6 +46,10 @@ namespace catapult { namespace crypto {
 	/// Calculates the 256-bit SHA3 hash of \a dataBuffer into \a hash.
 	void Sha3_256(const RawBuffer& dataBuffer, Hash256& hash);
 
+	/// Calculates the 256-bit SHA3 hashes of \a count buffers (\a pDataBuffers) into \a pHashes.
+	/// \note Multiple buffers are hashed at once when supported by the cpu.
+	void Sha3_256Multi(const RawBuffer* pDataBuffers, Hash256* pHashes, size_t count);
+
 	/// Calculates the sha256 HMAC of \a input with \a key, producing \a output.
 	void Hmac_Sha256(const RawBuffer& key, const RawBuffer& input, Hash256& output);
 
@@ -64,6 +69,19 @@ namespace catapult { namespace crypto {
 	/// Use with HashBuilderT to generate SHA3 hashes.
 	struct Sha3ModeTag {};
 
+	namespace detail {
+		/// Gets the hash context type used by HashBuilderT for \a TModeTag.
+		template<typename TModeTag>
+		struct HashBuilderContext {
+			using type = OpensslDigestContext;
+		};
+
+		template<>
+		struct HashBuilderContext<Sha3ModeTag> {
+			using type = Sha3_256_Context;
+		};
+	}
+
 	/// Builder for building a keccak hash.
 	template<typename TModeTag, typename THashTag>
 	class HashBuilderT {
@@ -85,7 +103,7 @@ namespace catapult { namespace crypto {
 		void final(OutputType& output);
 
 	private:
-		OpensslDigestContext m_context;
+		typename detail::HashBuilderContext<TModeTag>::type m_context;
 	};
 
 	/// Sha512_Builder.
@@ -0,0 +1,414 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Keccak.h"
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CATAPULT_KECCAK_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace catapult { namespace crypto {
+
+	namespace {
+		// region keccak constants
+
+		constexpr size_t Num_Rounds = 24;
+
+		constexpr uint64_t Round_Constants[Num_Rounds] = {
+			0x0000000000000001, 0x0000000000008082, 0x800000000000808A, 0x8000000080008000,
+			0x000000000000808B, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+			0x000000000000008A, 0x0000000000000088, 0x0000000080008009, 0x000000008000000A,
+			0x000000008000808B, 0x800000000000008B, 0x8000000000008089, 0x8000000000008003,
+			0x8000000000008002, 0x8000000000000080, 0x000000000000800A, 0x800000008000000A,
+			0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008
+		};
+
+		// rho rotation offsets in the order lanes are visited by the pi step
+		constexpr int Rho_Offsets[Num_Rounds] = {
+			1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14, 27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44
+		};
+
+		// order in which lanes are visited by the pi step (starting with lane 1)
+		constexpr size_t Pi_Lanes[Num_Rounds] = {
+			10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4, 15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1
+		};
+
+		// endregion
+
+		// region permutations
+
+		// all permutations are written against raw lanes (instead of using a shared template) because simd intrinsics can only
+		// be inlined into functions that target the corresponding instruction set
+
+		constexpr uint64_t Rotl(uint64_t value, int count) {
+			return (value << count) | (value >> (64 - count));
+		}
+
+		// scalar permutation is fully unrolled (with the state held in locals) because it is on the hot path of every hash
+		void Permute(uint64_t* pLanes) {
+			uint64_t a[25];
+			std::memcpy(a, pLanes, sizeof(a));
+
+			for (auto round = 0u; round < Num_Rounds; ++round) {
+				// theta
+				uint64_t c[5];
+				c[0] = a[0] ^ a[5] ^ a[10] ^ a[15] ^ a[20];
+				c[1] = a[1] ^ a[6] ^ a[11] ^ a[16] ^ a[21];
+				c[2] = a[2] ^ a[7] ^ a[12] ^ a[17] ^ a[22];
+				c[3] = a[3] ^ a[8] ^ a[13] ^ a[18] ^ a[23];
+				c[4] = a[4] ^ a[9] ^ a[14] ^ a[19] ^ a[24];
+
+				uint64_t d[5];
+				d[0] = c[4] ^ Rotl(c[1], 1);
+				d[1] = c[0] ^ Rotl(c[2], 1);
+				d[2] = c[1] ^ Rotl(c[3], 1);
+				d[3] = c[2] ^ Rotl(c[4], 1);
+				d[4] = c[3] ^ Rotl(c[0], 1);
+
+				// rho + pi (combined with theta application)
+				uint64_t b[25];
+				b[0] = a[0] ^ d[0];
+				b[1] = Rotl(a[6] ^ d[1], 44);
+				b[2] = Rotl(a[12] ^ d[2], 43);
+				b[3] = Rotl(a[18] ^ d[3], 21);
+				b[4] = Rotl(a[24] ^ d[4], 14);
+				b[5] = Rotl(a[3] ^ d[3], 28);
+				b[6] = Rotl(a[9] ^ d[4], 20);
+				b[7] = Rotl(a[10] ^ d[0], 3);
+				b[8] = Rotl(a[16] ^ d[1], 45);
+				b[9] = Rotl(a[22] ^ d[2], 61);
+				b[10] = Rotl(a[1] ^ d[1], 1);
+				b[11] = Rotl(a[7] ^ d[2], 6);
+				b[12] = Rotl(a[13] ^ d[3], 25);
+				b[13] = Rotl(a[19] ^ d[4], 8);
+				b[14] = Rotl(a[20] ^ d[0], 18);
+				b[15] = Rotl(a[4] ^ d[4], 27);
+				b[16] = Rotl(a[5] ^ d[0], 36);
+				b[17] = Rotl(a[11] ^ d[1], 10);
+				b[18] = Rotl(a[17] ^ d[2], 15);
+				b[19] = Rotl(a[23] ^ d[3], 56);
+				b[20] = Rotl(a[2] ^ d[2], 62);
+				b[21] = Rotl(a[8] ^ d[3], 55);
+				b[22] = Rotl(a[14] ^ d[4], 39);
+				b[23] = Rotl(a[15] ^ d[0], 41);
+				b[24] = Rotl(a[21] ^ d[1], 2);
+
+				// chi
+				for (auto y = 0u; y < 25; y += 5) {
+					a[y + 0] = b[y + 0] ^ (~b[y + 1] & b[y + 2]);
+					a[y + 1] = b[y + 1] ^ (~b[y + 2] & b[y + 3]);
+					a[y + 2] = b[y + 2] ^ (~b[y + 3] & b[y + 4]);
+					a[y + 3] = b[y + 3] ^ (~b[y + 4] & b[y + 0]);
+					a[y + 4] = b[y + 4] ^ (~b[y + 0] & b[y + 1]);
+				}
+
+				// iota
+				a[0] ^= Round_Constants[round];
+			}
+
+			std::memcpy(pLanes, a, sizeof(a));
+		}
+
+#ifdef CATAPULT_KECCAK_X86_SIMD
+		__attribute__((target("avx2")))
+		inline __m256i RotlX4(__m256i value, int count) {
+			return _mm256_or_si256(_mm256_slli_epi64(value, count), _mm256_srli_epi64(value, 64 - count));
+		}
+
+		// permutes four states; lane i of state j is at index 4 * i + j
+		__attribute__((target("avx2")))
+		void PermuteX4(uint64_t* pInterleavedLanes) {
+			__m256i lanes[25];
+			for (auto i = 0u; i < 25; ++i)
+				lanes[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pInterleavedLanes + 4 * i));
+
+			for (auto round = 0u; round < Num_Rounds; ++round) {
+				__m256i columns[5];
+				for (auto x = 0u; x < 5; ++x) {
+					columns[x] = _mm256_xor_si256(
+							_mm256_xor_si256(lanes[x], lanes[x + 5]),
+							_mm256_xor_si256(_mm256_xor_si256(lanes[x + 10], lanes[x + 15]), lanes[x + 20]));
+				}
+
+				for (auto x = 0u; x < 5; ++x) {
+					auto delta = _mm256_xor_si256(columns[(x + 4) % 5], RotlX4(columns[(x + 1) % 5], 1));
+					for (auto y = 0u; y < 25; y += 5)
+						lanes[y + x] = _mm256_xor_si256(lanes[y + x], delta);
+				}
+
+				auto current = lanes[1];
+				for (auto i = 0u; i < Num_Rounds; ++i) {
+					auto next = lanes[Pi_Lanes[i]];
+					lanes[Pi_Lanes[i]] = RotlX4(current, Rho_Offsets[i]);
+					current = next;
+				}
+
+				for (auto y = 0u; y < 25; y += 5) {
+					__m256i row[5];
+					for (auto x = 0u; x < 5; ++x)
+						row[x] = lanes[y + x];
+
+					for (auto x = 0u; x < 5; ++x)
+						lanes[y + x] = _mm256_xor_si256(row[x], _mm256_andnot_si256(row[(x + 1) % 5], row[(x + 2) % 5]));
+				}
+
+				lanes[0] = _mm256_xor_si256(lanes[0], _mm256_set1_epi64x(static_cast<int64_t>(Round_Constants[round])));
+			}
+
+			for (auto i = 0u; i < 25; ++i)
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(pInterleavedLanes + 4 * i), lanes[i]);
+		}
+
+		__attribute__((target("avx512f")))
+		inline __m512i RotlX8(__m512i value, int count) {
+			return _mm512_rolv_epi64(value, _mm512_set1_epi64(count));
+		}
+
+		// permutes eight states; lane i of state j is at index 8 * i + j
+		__attribute__((target("avx512f")))
+		void PermuteX8(uint64_t* pInterleavedLanes) {
+			__m512i lanes[25];
+			for (auto i = 0u; i < 25; ++i)
+				lanes[i] = _mm512_loadu_si512(pInterleavedLanes + 8 * i);
+
+			for (auto round = 0u; round < Num_Rounds; ++round) {
+				__m512i columns[5];
+				for (auto x = 0u; x < 5; ++x) {
+					// 0x96 is the truth table of a three way xor
+					columns[x] = _mm512_ternarylogic_epi64(lanes[x], lanes[x + 5], lanes[x + 10], 0x96);
+					columns[x] = _mm512_ternarylogic_epi64(columns[x], lanes[x + 15], lanes[x + 20], 0x96);
+				}
+
+				for (auto x = 0u; x < 5; ++x) {
+					auto delta = _mm512_xor_si512(columns[(x + 4) % 5], RotlX8(columns[(x + 1) % 5], 1));
+					for (auto y = 0u; y < 25; y += 5)
+						lanes[y + x] = _mm512_xor_si512(lanes[y + x], delta);
+				}
+
+				auto current = lanes[1];
+				for (auto i = 0u; i < Num_Rounds; ++i) {
+					auto next = lanes[Pi_Lanes[i]];
+					lanes[Pi_Lanes[i]] = RotlX8(current, Rho_Offsets[i]);
+					current = next;
+				}
+
+				for (auto y = 0u; y < 25; y += 5) {
+					__m512i row[5];
+					for (auto x = 0u; x < 5; ++x)
+						row[x] = lanes[y + x];
+
+					// 0xD2 is the truth table of a ^ (~b & c)
+					for (auto x = 0u; x < 5; ++x)
+						lanes[y + x] = _mm512_ternarylogic_epi64(row[x], row[(x + 1) % 5], row[(x + 2) % 5], 0xD2);
+				}
+
+				lanes[0] = _mm512_xor_si512(lanes[0], _mm512_set1_epi64(static_cast<int64_t>(Round_Constants[round])));
+			}
+
+			for (auto i = 0u; i < 25; ++i)
+				_mm512_storeu_si512(pInterleavedLanes + 8 * i, lanes[i]);
+		}
+#endif
+
+		// endregion
+
+		// region sponge utils
+
+		// keccak lanes are little endian, which matches the byte order of all supported platforms
+		constexpr size_t Rate_Lanes = Sha3_256_Context::Rate / sizeof(uint64_t);
+
+		size_t CalculateNumBlocks(size_t size) {
+			// the final block always contains padding
+			return size / Sha3_256_Context::Rate + 1;
+		}
+
+		void CopyPaddedFinalBlock(const uint8_t* pData, size_t size, uint8_t* pBlock) {
+			std::memcpy(pBlock, pData, size);
+			std::memset(pBlock + size, 0, Sha3_256_Context::Rate - size);
+			pBlock[size] = 0x06; // sha3 domain separation and first padding bit
+			pBlock[Sha3_256_Context::Rate - 1] |= 0x80; // last padding bit
+		}
+
+		void AbsorbBlock(const uint8_t* pBlock, uint64_t* pLanes, size_t stride) {
+			for (auto i = 0u; i < Rate_Lanes; ++i) {
+				uint64_t lane;
+				std::memcpy(&lane, pBlock + i * sizeof(uint64_t), sizeof(uint64_t));
+				pLanes[i * stride] ^= lane;
+			}
+		}
+
+		void Squeeze(const uint64_t* pLanes, size_t stride, Hash256& hash) {
+			for (auto i = 0u; i < Hash256::Size / sizeof(uint64_t); ++i)
+				std::memcpy(hash.data() + i * sizeof(uint64_t), &pLanes[i * stride], sizeof(uint64_t));
+		}
+
+		// endregion
+
+		// region multi
+
+		using Permutation = void (*)(uint64_t*);
+
+		// hashes up to \a parallelism buffers, each consisting of \a numBlocks blocks, with a single sequence of permutations
+		template<size_t Parallelism>
+		void HashInterleaved(
+				Permutation permute,
+				const RawBuffer* pDataBuffers,
+				Hash256* pHashes,
+				const size_t* pIndexes,
+				size_t count,
+				size_t numBlocks) {
+			alignas(64) uint64_t interleavedLanes[Keccak_State_Lanes * Parallelism] = {};
+			uint8_t finalBlock[Sha3_256_Context::Rate];
+
+			for (auto block = 0u; block < numBlocks; ++block) {
+				for (auto j = 0u; j < count; ++j) {
+					const auto& dataBuffer = pDataBuffers[pIndexes[j]];
+					const auto* pBlock = dataBuffer.pData + block * Sha3_256_Context::Rate;
+					if (block + 1 == numBlocks) {
+						CopyPaddedFinalBlock(pBlock, dataBuffer.Size - block * Sha3_256_Context::Rate, finalBlock);
+						pBlock = finalBlock;
+					}
+
+					AbsorbBlock(pBlock, interleavedLanes + j, Parallelism);
+				}
+
+				permute(interleavedLanes);
+			}
+
+			for (auto j = 0u; j < count; ++j)
+				Squeeze(interleavedLanes + j, Parallelism, pHashes[pIndexes[j]]);
+		}
+
+		template<size_t Parallelism>
+		void HashMulti(Permutation permute, const RawBuffer* pDataBuffers, Hash256* pHashes, size_t count) {
+			// only buffers with the same number of blocks can share permutations, so group them together
+			std::vector<size_t> indexes(count);
+			std::iota(indexes.begin(), indexes.end(), 0);
+			std::stable_sort(indexes.begin(), indexes.end(), [pDataBuffers](auto lhs, auto rhs) {
+				return CalculateNumBlocks(pDataBuffers[lhs].Size) < CalculateNumBlocks(pDataBuffers[rhs].Size);
+			});
+
+			for (auto i = 0u; i < count;) {
+				auto numBlocks = CalculateNumBlocks(pDataBuffers[indexes[i]].Size);
+				auto groupSize = 1u;
+				while (groupSize < Parallelism && i + groupSize < count
+						&& numBlocks == CalculateNumBlocks(pDataBuffers[indexes[i + groupSize]].Size))
+					++groupSize;
+
+				// a sparsely populated group is cheaper to hash sequentially
+				if (groupSize * 2 < Parallelism) {
+					groupSize = 1;
+					HashInterleaved<1>(Permute, pDataBuffers, pHashes, &indexes[i], groupSize, numBlocks);
+				} else {
+					HashInterleaved<Parallelism>(permute, pDataBuffers, pHashes, &indexes[i], groupSize, numBlocks);
+				}
+
+				i += groupSize;
+			}
+		}
+
+		// endregion
+	}
+
+	void KeccakF1600(std::array<uint64_t, Keccak_State_Lanes>& state) {
+		Permute(state.data());
+	}
+
+	size_t GetMaxKeccakParallelism() {
+#ifdef CATAPULT_KECCAK_X86_SIMD
+		static const size_t maxParallelism = __builtin_cpu_supports("avx512f")
+				? 8
+				: __builtin_cpu_supports("avx2") ? 4 : 1;
+		return maxParallelism;
+#else
+		return 1;
+#endif
+	}
+
+	// region Sha3_256_Context
+
+	Sha3_256_Context::Sha3_256_Context()
+			: m_state()
+			, m_position(0)
+	{}
+
+	void Sha3_256_Context::update(const RawBuffer& dataBuffer) {
+		auto* pStateBytes = reinterpret_cast<uint8_t*>(m_state.data());
+		const auto* pData = dataBuffer.pData;
+		auto remainingSize = dataBuffer.Size;
+
+		// absorb full blocks directly when the current block is empty
+		if (0 == m_position) {
+			for (; remainingSize >= Rate; remainingSize -= Rate, pData += Rate) {
+				AbsorbBlock(pData, m_state.data(), 1);
+				Permute(m_state.data());
+			}
+		}
+
+		while (0 != remainingSize) {
+			auto size = std::min(remainingSize, Rate - m_position);
+			for (auto i = 0u; i < size; ++i)
+				pStateBytes[m_position + i] ^= pData[i];
+
+			m_position += size;
+			pData += size;
+			remainingSize -= size;
+			if (Rate == m_position) {
+				Permute(m_state.data());
+				m_position = 0;
+			}
+		}
+	}
+
+	void Sha3_256_Context::final(Hash256& hash) {
+		auto* pStateBytes = reinterpret_cast<uint8_t*>(m_state.data());
+		pStateBytes[m_position] ^= 0x06;
+		pStateBytes[Rate - 1] ^= 0x80;
+		Permute(m_state.data());
+
+		Squeeze(m_state.data(), 1, hash);
+	}
+
+	// endregion
+
+	void Sha3_256Multi(const RawBuffer* pDataBuffers, Hash256* pHashes, size_t count, size_t maxParallelism) {
+		auto parallelism = std::min(maxParallelism, GetMaxKeccakParallelism());
+
+#ifdef CATAPULT_KECCAK_X86_SIMD
+		if (parallelism >= 8)
+			return HashMulti<8>(PermuteX8, pDataBuffers, pHashes, count);
+
+		if (parallelism >= 4)
+			return HashMulti<4>(PermuteX4, pDataBuffers, pHashes, count);
+#endif
+
+		for (auto i = 0u; i < count; ++i) {
+			Sha3_256_Context context;
+			context.update(pDataBuffers[i]);
+			context.final(pHashes[i]);
+		}
+	}
+}}
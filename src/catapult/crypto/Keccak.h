@@ -0,0 +1,63 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/types.h"
+#include <array>
+
+namespace catapult { namespace crypto {
+
+	/// Number of 64-bit lanes in a keccak-f[1600] state.
+	constexpr size_t Keccak_State_Lanes = 25;
+
+	/// Applies the keccak-f[1600] permutation to \a state.
+	void KeccakF1600(std::array<uint64_t, Keccak_State_Lanes>& state);
+
+	/// Gets the maximum number of keccak-f[1600] permutations that can be calculated at once on the current cpu.
+	size_t GetMaxKeccakParallelism();
+
+	/// Incremental sha3-256 hash context (keccak-f[1600] sponge with a 136 byte rate).
+	class Sha3_256_Context {
+	public:
+		/// Number of bytes absorbed by each permutation.
+		static constexpr size_t Rate = 136;
+
+	public:
+		/// Creates a context.
+		Sha3_256_Context();
+
+	public:
+		/// Absorbs data inside \a dataBuffer.
+		void update(const RawBuffer& dataBuffer);
+
+		/// Finalizes hash calculation. Returns result in \a hash.
+		void final(Hash256& hash);
+
+	private:
+		std::array<uint64_t, Keccak_State_Lanes> m_state;
+		size_t m_position;
+	};
+
+	/// Calculates the 256-bit SHA3 hashes of \a count buffers pointed to by \a pDataBuffers into \a pHashes
+	/// by calculating at most \a maxParallelism permutations at once.
+	/// \note \a maxParallelism is capped by GetMaxKeccakParallelism.
+	void Sha3_256Multi(const RawBuffer* pDataBuffers, Hash256* pHashes, size_t count, size_t maxParallelism);
+}}
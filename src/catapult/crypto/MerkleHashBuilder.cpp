@@ -21,71 +21,111 @@
 
 #include "MerkleHashBuilder.h"
 #include "Hashes.h"
-#include "catapult/functions.h"
+#include "catapult/exceptions.h"
 
 namespace catapult { namespace crypto {
 
 	namespace {
-		Hash256 Final(std::vector<Hash256>& hashes, const consumer<const Hash256*, size_t>& hashConsumer) {
-			if (hashes.empty()) {
-				Hash256 hash{};
-				hashConsumer(&hash, 1);
-				return hash;
-			}
+		// merkle tree needs padding in case of an odd number of hashes, the padding is stored after the level hashes
+		// so that nodes with same depth are consecutive entries in the tree
+		size_t GetPaddedLevelSize(size_t levelSize) {
+			return 1 == levelSize ? 1 : levelSize + levelSize % 2;
+		}
 
-			// build the merkle tree
-			auto numRemainingHashes = hashes.size();
-			hashConsumer(hashes.data(), hashes.size());
-			while (numRemainingHashes > 1) {
-				// merkle tree needs padding in case of an odd number of hashes, need to do before the next round of hashes is
-				// pushed into the vector because nodes with same depth should be consecutive entries in the vector
-				if (1 == numRemainingHashes % 2)
-					hashConsumer(&hashes[numRemainingHashes - 1], 1);
-
-				auto i = 0u;
-				for (; i < numRemainingHashes; i += 2) {
-					if (i + 1 < numRemainingHashes) {
-						Sha3_256({ hashes[i].data(), 2 * Hash256::Size }, hashes[i / 2]);
-						hashConsumer(&hashes[i / 2], 1);
-						continue;
-					}
-
-					// if there is an odd number of hashes, duplicate the last one
-					Sha3_256_Builder builder;
-					builder.update(hashes[i]);
-					builder.update(hashes[i]);
-					builder.final(hashes[i / 2]);
-					hashConsumer(&hashes[i / 2], 1);
-					++numRemainingHashes;
-				}
-
-				numRemainingHashes /= 2;
-			}
+		size_t CalculatePaddedTreeSize(size_t leafCount) {
+			size_t size = 0;
+			for (auto levelSize = leafCount; levelSize > 1; levelSize = GetPaddedLevelSize(levelSize) / 2)
+				size += GetPaddedLevelSize(levelSize);
 
-			return hashes[0];
+			return size + 1;
+		}
+
+		void HashLevel(const std::vector<RawBuffer>& pairBuffers, Hash256* pHashes) {
+			Sha3_256Multi(pairBuffers.data(), pHashes, pairBuffers.size());
 		}
 	}
 
-	MerkleHashBuilder::MerkleHashBuilder(size_t capacity) {
+	MerkleHashBuilder::MerkleHashBuilder(size_t capacity) : MerkleHashBuilder(capacity, HashLevel)
+	{}
+
+	MerkleHashBuilder::MerkleHashBuilder(size_t capacity, const MerkleLevelHasher& levelHasher)
+			: m_levelHasher(levelHasher)
+			, m_numLeaves(0)
+			, m_isBuilt(false) {
 		m_hashes.reserve(capacity);
 	}
 
 	void MerkleHashBuilder::update(const Hash256& hash) {
+		if (m_isBuilt)
+			CATAPULT_THROW_RUNTIME_ERROR("cannot update finalized merkle hash builder");
+
 		m_hashes.push_back(hash);
 	}
 
 	void MerkleHashBuilder::final(Hash256& hash) {
 		// build the merkle root
-		hash = Final(m_hashes, [](const auto*, auto) {});
+		build();
+		hash = m_hashes.back();
 	}
 
 	void MerkleHashBuilder::final(std::vector<Hash256>& tree) {
 		// build the complete merkle tree
-		tree.reserve(TreeSize(m_hashes.size()));
-		Final(m_hashes, [&tree](const Hash256* pHash, size_t count) {
-			for (auto i = 0u; i < count; ++i)
-				tree.push_back(*pHash++);
-		});
+		build();
+		tree.insert(tree.end(), m_hashes.cbegin(), m_hashes.cend());
+	}
+
+	std::vector<Hash256> MerkleHashBuilder::path(size_t index) const {
+		if (!m_isBuilt)
+			CATAPULT_THROW_RUNTIME_ERROR("cannot retrieve path from unfinalized merkle hash builder");
+
+		if (index >= m_numLeaves)
+			CATAPULT_THROW_INVALID_ARGUMENT_2("leaf index out of range", index, m_numLeaves);
+
+		std::vector<Hash256> path;
+		size_t levelOffset = 0;
+		for (auto levelSize = m_numLeaves; levelSize > 1; levelSize = GetPaddedLevelSize(levelSize) / 2) {
+			// padding guarantees that every node has a sibling
+			path.push_back(m_hashes[levelOffset + (index ^ 1)]);
+			levelOffset += GetPaddedLevelSize(levelSize);
+			index /= 2;
+		}
+
+		return path;
+	}
+
+	void MerkleHashBuilder::build() {
+		if (m_isBuilt)
+			return;
+
+		m_isBuilt = true;
+		m_numLeaves = m_hashes.size();
+		if (m_hashes.empty()) {
+			m_hashes.push_back(Hash256());
+			return;
+		}
+
+		// reserve space for the complete tree so that level hashes can be written directly into it
+		m_hashes.reserve(CalculatePaddedTreeSize(m_numLeaves));
+
+		size_t levelOffset = 0;
+		std::vector<RawBuffer> pairBuffers;
+		for (auto levelSize = m_numLeaves; levelSize > 1;) {
+			// if there is an odd number of hashes, duplicate the last one
+			if (1 == levelSize % 2) {
+				m_hashes.push_back(m_hashes.back());
+				++levelSize;
+			}
+
+			// hash all pairs of the current level at once
+			pairBuffers.clear();
+			for (auto i = 0u; i < levelSize; i += 2)
+				pairBuffers.push_back({ m_hashes[levelOffset + i].data(), 2 * Hash256::Size });
+
+			levelOffset += levelSize;
+			levelSize /= 2;
+			m_hashes.resize(levelOffset + levelSize);
+			m_levelHasher(pairBuffers, &m_hashes[levelOffset]);
+		}
 	}
 
 	size_t MerkleHashBuilder::TreeSize(size_t leafCount) {
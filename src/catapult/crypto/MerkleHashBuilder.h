@@ -21,16 +21,24 @@
 
 #pragma once
 #include "catapult/types.h"
+#include <functional>
 #include <vector>
 
 namespace catapult { namespace crypto {
 
+	/// Hashes all (64-byte) pairs of hashes in \a pairBuffers into \a pHashes.
+	using MerkleLevelHasher = std::function<void (const std::vector<RawBuffer>& pairBuffers, Hash256* pHashes)>;
+
 	/// Builder for creating a merkle hash.
+	/// \note All tree levels are kept after finalization, so merkle paths can be retrieved without rebuilding the tree.
 	class MerkleHashBuilder {
 	public:
 		/// Creates a new merkle hash builder with the specified initial \a capacity.
 		explicit MerkleHashBuilder(size_t capacity = 0);
 
+		/// Creates a new merkle hash builder with the specified initial \a capacity around a custom \a levelHasher.
+		MerkleHashBuilder(size_t capacity, const MerkleLevelHasher& levelHasher);
+
 	public:
 		/// Adds \a hash to the merkle hash.
 		void update(const Hash256& hash);
@@ -41,11 +49,21 @@ namespace catapult { namespace crypto {
 		/// Finalizes the complete merkle tree into \a tree.
 		void final(std::vector<Hash256>& tree);
 
+		/// Gets the merkle path (sibling hashes ordered from leaf to root) of the leaf at \a index.
+		/// \note This can only be called after the builder is finalized.
+		std::vector<Hash256> path(size_t index) const;
+
 	public:
 		/// Calculates the number of nodes in a merkle tree with \a leafCount leaves.
 		static size_t TreeSize(size_t leafCount);
 
+	private:
+		void build();
+
 	private:
 		std::vector<Hash256> m_hashes;
+		MerkleLevelHasher m_levelHasher;
+		size_t m_numLeaves;
+		bool m_isBuilt;
 	};
 }}
@@ -139,50 +139,56 @@ namespace catapult { namespace crypto {
 
 	// region Verify
 
+	namespace {
+		bool VerifyBuffers(const Key& publicKey, const RawBuffer* pBuffers, size_t numBuffers, const Signature& signature) {
+			const uint8_t *RESTRICT encodedR = signature.data();
+			const uint8_t *RESTRICT encodedS = signature.data() + Encoded_Size;
+
+			// reject if not canonical
+			if (!IsCanonicalS(encodedS))
+				return false;
+
+			// reject zero public key, which is known weak key
+			if (Key() == publicKey)
+				return false;
+
+			// h = H(encodedR || public || data)
+			Hash512 hash_h;
+			Sha512_Builder hasher_h;
+			hasher_h.update({ { encodedR, Encoded_Size }, publicKey });
+			for (auto i = 0u; i < numBuffers; ++i)
+				hasher_h.update(pBuffers[i]);
+
+			hasher_h.final(hash_h);
+
+			bignum256modm h;
+			expand256_modm(h, hash_h.data(), 64);
+
+			// A = -pub
+			ge25519 ALIGN(16) A;
+			if (!UnpackNegativeAndCheckSubgroup(A, publicKey))
+				return false;
+
+			bignum256modm S;
+			expand256_modm(S, encodedS, 32);
+
+			// R = encodedS * B - h * A
+			ge25519 ALIGN(16) R;
+			ge25519_double_scalarmult_vartime(&R, &A, h, S);
+
+			// compare calculated R to given R
+			uint8_t checkr[Encoded_Size];
+			ge25519_pack(checkr, &R);
+			return 1 == ed25519_verify(encodedR, checkr, 32);
+		}
+	}
+
 	bool Verify(const Key& publicKey, const RawBuffer& dataBuffer, const Signature& signature) {
-		return Verify(publicKey, std::vector<RawBuffer>{ dataBuffer }, signature);
+		return VerifyBuffers(publicKey, &dataBuffer, 1, signature);
 	}
 
 	bool Verify(const Key& publicKey, const std::vector<RawBuffer>& buffers, const Signature& signature) {
-		const uint8_t *RESTRICT encodedR = signature.data();
-		const uint8_t *RESTRICT encodedS = signature.data() + Encoded_Size;
-
-		// reject if not canonical
-		if (!IsCanonicalS(encodedS))
-			return false;
-
-		// reject zero public key, which is known weak key
-		if (Key() == publicKey)
-			return false;
-
-		// h = H(encodedR || public || data)
-		Hash512 hash_h;
-		Sha512_Builder hasher_h;
-		hasher_h.update({ { encodedR, Encoded_Size }, publicKey });
-		for (const auto& buffer : buffers)
-			hasher_h.update(buffer);
-
-		hasher_h.final(hash_h);
-
-		bignum256modm h;
-		expand256_modm(h, hash_h.data(), 64);
-
-		// A = -pub
-		ge25519 ALIGN(16) A;
-		if (!UnpackNegativeAndCheckSubgroup(A, publicKey))
-			return false;
-
-		bignum256modm S;
-		expand256_modm(S, encodedS, 32);
-
-		// R = encodedS * B - h * A
-		ge25519 ALIGN(16) R;
-		ge25519_double_scalarmult_vartime(&R, &A, h, S);
-
-		// compare calculated R to given R
-		uint8_t checkr[Encoded_Size];
-		ge25519_pack(checkr, &R);
-		return 1 == ed25519_verify(encodedR, checkr, 32);
+		return VerifyBuffers(publicKey, buffers.data(), buffers.size(), signature);
 	}
 
 	// endregion
@@ -190,7 +196,24 @@ namespace catapult { namespace crypto {
 	// region VerifyMulti
 
 	namespace {
-		std::pair<std::vector<bool>, bool> CheckForCanonicalFormAndNonzeroKeys(const SignatureInput* pSignatureInputs, size_t count) {
+		const RawBuffer* GetBuffers(const SignatureInput& signatureInput) {
+			return signatureInput.Buffers.data();
+		}
+
+		size_t GetNumBuffers(const SignatureInput& signatureInput) {
+			return signatureInput.Buffers.size();
+		}
+
+		const RawBuffer* GetBuffers(const SignatureInputView& signatureInput) {
+			return signatureInput.pBuffers;
+		}
+
+		size_t GetNumBuffers(const SignatureInputView& signatureInput) {
+			return signatureInput.NumBuffers;
+		}
+
+		template<typename TSignatureInput>
+		std::pair<std::vector<bool>, bool> CheckForCanonicalFormAndNonzeroKeys(const TSignatureInput* pSignatureInputs, size_t count) {
 			// reject if not canonical or public key is zero
 			auto aggregateResult = true;
 			std::vector<bool> valid(count, true);
@@ -204,19 +227,26 @@ namespace catapult { namespace crypto {
 			return std::make_pair(valid, aggregateResult);
 		}
 
-		bool VerifySingle(const SignatureInput* pSignatureInputs, size_t offset, size_t count, std::vector<bool>& valid) {
+		template<typename TSignatureInput>
+		bool VerifySingle(const TSignatureInput* pSignatureInputs, size_t offset, size_t count, std::vector<bool>& valid) {
 			bool aggregateResult = true;
 			for (auto i = 0u; i < count; ++i) {
-				valid[offset + i] = Verify(pSignatureInputs[i].PublicKey, pSignatureInputs[i].Buffers, pSignatureInputs[i].Signature);
+				const auto& signatureInput = pSignatureInputs[offset + i];
+				valid[offset + i] = VerifyBuffers(
+						signatureInput.PublicKey,
+						GetBuffers(signatureInput),
+						GetNumBuffers(signatureInput),
+						signatureInput.Signature);
 				aggregateResult &= valid[offset + i];
 			}
 
 			return aggregateResult;
 		}
 
+		template<typename TSignatureInput>
 		bool VerifyBatches(
 				const RandomFiller& randomFiller,
-				const SignatureInput* pSignatureInputs,
+				const TSignatureInput* pSignatureInputs,
 				size_t count,
 				std::pair<std::vector<bool>, bool>& result,
 				const predicate<size_t, size_t>& fallback) {
@@ -249,8 +279,8 @@ namespace catapult { namespace crypto {
 					Sha512_Builder hasher_h;
 					const auto& signatureInput = pSignatureInputs[offset + i];
 					hasher_h.update({ { signatureInput.Signature.data(), Encoded_Size }, signatureInput.PublicKey });
-					for (const auto& buffer : signatureInput.Buffers)
-						hasher_h.update(buffer);
+					for (auto j = 0u; j < GetNumBuffers(signatureInput); ++j)
+						hasher_h.update(GetBuffers(signatureInput)[j]);
 
 					hasher_h.final(hash_h);
 
@@ -263,7 +293,7 @@ namespace catapult { namespace crypto {
 				bool success = true;
 				for (auto i = 0u; i < batchSize; ++i) {
 					const auto& signatureInput = pSignatureInputs[offset + i];
-					auto R = signatureInput.Signature.copyTo<Key>();
+					auto R = signatureInput.Signature.template copyTo<Key>();
 					success &= UnpackNegativeAndCheckSubgroup(batch.points[i + 1], signatureInput.PublicKey);
 					success &= UnpackNegativeAndCheckSubgroup(batch.points[batchSize + i + 1], R);
 					if (!success)
@@ -286,25 +316,49 @@ namespace catapult { namespace crypto {
 			aggregateResult &= VerifySingle(pSignatureInputs, offset, count, result.first);
 			return aggregateResult;
 		}
+
+		template<typename TSignatureInput>
+		std::pair<std::vector<bool>, bool> VerifyMultiImpl(
+				const RandomFiller& randomFiller,
+				const TSignatureInput* pSignatureInputs,
+				size_t count) {
+			auto result = CheckForCanonicalFormAndNonzeroKeys(pSignatureInputs, count);
+			VerifyBatches(randomFiller, pSignatureInputs, count, result, [&pSignatureInputs, &result](auto offset, auto batchSize) {
+				result.second &= VerifySingle(pSignatureInputs, offset, batchSize, result.first);
+				return true;
+			});
+			return result;
+		}
+
+		template<typename TSignatureInput>
+		bool VerifyMultiShortCircuitImpl(const RandomFiller& randomFiller, const TSignatureInput* pSignatureInputs, size_t count) {
+			auto result = CheckForCanonicalFormAndNonzeroKeys(pSignatureInputs, count);
+			return result.second && VerifyBatches(randomFiller, pSignatureInputs, count, result, [](auto, auto) {
+				return false;
+			});
+		}
 	}
 
 	std::pair<std::vector<bool>, bool> VerifyMulti(
 			const RandomFiller& randomFiller,
 			const SignatureInput* pSignatureInputs,
 			size_t count) {
-		auto result = CheckForCanonicalFormAndNonzeroKeys(pSignatureInputs, count);
-		VerifyBatches(randomFiller, pSignatureInputs, count, result, [&pSignatureInputs, &result](auto offset, auto batchSize) {
-			result.second &= VerifySingle(pSignatureInputs, offset, batchSize, result.first);
-			return true;
-		});
-		return result;
+		return VerifyMultiImpl(randomFiller, pSignatureInputs, count);
 	}
 
 	bool VerifyMultiShortCircuit(const RandomFiller& randomFiller, const SignatureInput* pSignatureInputs, size_t count) {
-		auto result = CheckForCanonicalFormAndNonzeroKeys(pSignatureInputs, count);
-		return result.second && VerifyBatches(randomFiller, pSignatureInputs, count, result, [](auto, auto) {
-			return false;
-		});
+		return VerifyMultiShortCircuitImpl(randomFiller, pSignatureInputs, count);
+	}
+
+	std::pair<std::vector<bool>, bool> VerifyMulti(
+			const RandomFiller& randomFiller,
+			const SignatureInputView* pSignatureInputs,
+			size_t count) {
+		return VerifyMultiImpl(randomFiller, pSignatureInputs, count);
+	}
+
+	bool VerifyMultiShortCircuit(const RandomFiller& randomFiller, const SignatureInputView* pSignatureInputs, size_t count) {
+		return VerifyMultiShortCircuitImpl(randomFiller, pSignatureInputs, count);
 	}
 
 	// endregion
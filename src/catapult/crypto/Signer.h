@@ -37,6 +37,21 @@ namespace catapult { namespace crypto {
 		const catapult::Signature& Signature;
 	};
 
+	/// Signature input that references buffers owned by the caller.
+	struct SignatureInputView {
+		/// Public key.
+		const Key& PublicKey;
+
+		/// Pointer to the first buffer.
+		const RawBuffer* pBuffers;
+
+		/// Number of buffers.
+		size_t NumBuffers;
+
+		/// Signature.
+		const catapult::Signature& Signature;
+	};
+
 	/// Signs data pointed by \a dataBuffer using \a keyPair, placing resulting signature in \a computedSignature.
 	/// \note The function will throw if the generated S part of the signature is not less than the group order.
 	void Sign(const KeyPair& keyPair, const RawBuffer& dataBuffer, Signature& computedSignature);
@@ -66,4 +81,18 @@ namespace catapult { namespace crypto {
 	/// \a randomFiller is used to generate random bytes.
 	/// Collates and returns an aggregate result that is \c true when all signatures are valid.
 	bool VerifyMultiShortCircuit(const RandomFiller& randomFiller, const SignatureInput* pSignatureInputs, size_t count);
+
+	/// Verifies that all \a count signatures pointed to by \a pSignatureInputs are valid.
+	/// \a randomFiller is used to generate random bytes.
+	/// Collates and returns a pair consisting of an aggregate result that is \c true when all signatures are valid
+	/// and a vector of bools that indicates the verification result for each individual signature.
+	std::pair<std::vector<bool>, bool> VerifyMulti(
+			const RandomFiller& randomFiller,
+			const SignatureInputView* pSignatureInputs,
+			size_t count);
+
+	/// Verifies that all \a count signatures pointed to by \a pSignatureInputs are valid.
+	/// \a randomFiller is used to generate random bytes.
+	/// Collates and returns an aggregate result that is \c true when all signatures are valid.
+	bool VerifyMultiShortCircuit(const RandomFiller& randomFiller, const SignatureInputView* pSignatureInputs, size_t count);
 }}
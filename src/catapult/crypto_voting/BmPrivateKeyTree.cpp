@@ -24,6 +24,7 @@
 #include "catapult/crypto/SecureRandomGenerator.h"
 #include "catapult/io/PodIoUtils.h"
 #include "catapult/exceptions.h"
+#include <array>
 #include <type_traits>
 
 namespace catapult { namespace crypto {
@@ -391,5 +392,57 @@ namespace catapult { namespace crypto {
 		return true;
 	}
 
+	std::pair<std::vector<bool>, bool> VerifyMulti(
+			const RandomFiller& randomFiller,
+			const BmTreeSignatureInput* pSignatureInputs,
+			size_t count) {
+		// each tree signature is composed of two ed25519 signatures that need to be converted to ed25519 types
+		std::vector<Key> publicKeys;
+		std::vector<Signature> signatures;
+		std::vector<std::array<RawBuffer, 2>> rootBuffersList;
+		publicKeys.reserve(2 * count);
+		signatures.reserve(2 * count);
+		rootBuffersList.reserve(count);
+
+		for (auto i = 0u; i < count; ++i) {
+			const auto& signatureInput = pSignatureInputs[i];
+			for (const auto* pPair : { &signatureInput.Signature.Root, &signatureInput.Signature.Bottom }) {
+				publicKeys.push_back(pPair->ParentPublicKey.copyTo<Key>());
+				signatures.push_back(pPair->Signature.copyTo<Signature>());
+			}
+
+			rootBuffersList.push_back({ signatureInput.Signature.Bottom.ParentPublicKey, ToBuffer(signatureInput.KeyIdentifier.KeyId) });
+		}
+
+		// root signatures that are already verified are excluded from the batch
+		std::vector<SignatureInputView> ed25519SignatureInputs;
+		std::vector<size_t> ed25519StartIndexes;
+		ed25519SignatureInputs.reserve(2 * count);
+		ed25519StartIndexes.reserve(count);
+		for (auto i = 0u; i < count; ++i) {
+			ed25519StartIndexes.push_back(ed25519SignatureInputs.size());
+			if (!pSignatureInputs[i].IsRootVerified)
+				ed25519SignatureInputs.push_back({ publicKeys[2 * i], rootBuffersList[i].data(), 2, signatures[2 * i] });
+
+			ed25519SignatureInputs.push_back({ publicKeys[2 * i + 1], &pSignatureInputs[i].Buffer, 1, signatures[2 * i + 1] });
+		}
+
+		auto ed25519ResultPair = VerifyMulti(randomFiller, ed25519SignatureInputs.data(), ed25519SignatureInputs.size());
+
+		std::pair<std::vector<bool>, bool> resultPair;
+		resultPair.first.reserve(count);
+		resultPair.second = ed25519ResultPair.second;
+		for (auto i = 0u; i < count; ++i) {
+			auto index = ed25519StartIndexes[i];
+			auto isRootValid = true;
+			if (!pSignatureInputs[i].IsRootVerified)
+				isRootValid = ed25519ResultPair.first[index++];
+
+			resultPair.first.push_back(isRootValid && ed25519ResultPair.first[index]);
+		}
+
+		return resultPair;
+	}
+
 	// endregion
 }}
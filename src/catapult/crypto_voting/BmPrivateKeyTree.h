@@ -23,6 +23,7 @@
 #include "BmOptions.h"
 #include "BmTreeSignature.h"
 #include "catapult/crypto/KeyPair.h"
+#include "catapult/crypto/Signer.h"
 #include "catapult/io/SeekableStream.h"
 #include <memory>
 
@@ -88,4 +89,29 @@ namespace catapult { namespace crypto {
 
 	/// Verifies \a signature of \a buffer at \a keyIdentifier.
 	bool Verify(const BmTreeSignature& signature, const BmKeyIdentifier& keyIdentifier, const RawBuffer& buffer);
+
+	/// Bellare-Miner tree signature input.
+	struct BmTreeSignatureInput {
+		/// Signature.
+		const BmTreeSignature& Signature;
+
+		/// Key identifier.
+		BmKeyIdentifier KeyIdentifier;
+
+		/// Signed buffer.
+		RawBuffer Buffer;
+
+		/// \c true if the root signature is already known to be valid and does not need to be verified.
+		bool IsRootVerified;
+	};
+
+	/// Verifies that all \a count signatures pointed to by \a pSignatureInputs are valid.
+	/// \a randomFiller is used to generate random bytes.
+	/// Collates and returns a pair consisting of an aggregate result that is \c true when all signatures are valid
+	/// and a vector of bools that indicates the verification result for each individual signature.
+	/// \note Root (unless already verified) and bottom signatures of all inputs are verified together in a single batch.
+	std::pair<std::vector<bool>, bool> VerifyMulti(
+			const RandomFiller& randomFiller,
+			const BmTreeSignatureInput* pSignatureInputs,
+			size_t count);
 }}
@@ -97,6 +97,9 @@ namespace catapult { namespace deltaset {
 			if (m_pWeakDelta.lock())
 				CATAPULT_THROW_RUNTIME_ERROR("only a single attached delta is allowed at a time");
 
+			// elements prefetched for a previous (possibly discarded) delta must not leak into a new one
+			DiscardPrefetchedElements(m_elements);
+
 			auto pDelta = std::make_shared<DeltaType>(m_elements);
 			m_pWeakDelta = pDelta;
 			return pDelta;
@@ -119,6 +122,7 @@ namespace catapult { namespace deltaset {
 
 			auto deltas = pDelta->deltas();
 			TCommitPolicy::Update(m_elements, deltas, std::forward<TArgs>(args)...);
+			DiscardPrefetchedElements(m_elements);
 			pDelta->reset();
 		}
 
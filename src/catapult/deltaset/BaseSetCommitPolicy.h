@@ -44,6 +44,12 @@ namespace catapult { namespace deltaset {
 			elements.erase(TKeyTraits::ToKey(element));
 	}
 
+	/// Discards all elements prefetched into \a elements.
+	/// \note This is a no-op for sets that do not support prefetching.
+	template<typename TSet>
+	void DiscardPrefetchedElements(TSet&)
+	{}
+
 	/// Default policy for committing changes to a base set.
 	template<typename TSetTraits>
 	struct BaseSetCommitPolicy {
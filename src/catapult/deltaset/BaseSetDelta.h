@@ -28,6 +28,7 @@
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace catapult { namespace deltaset {
 
@@ -182,6 +183,20 @@ namespace catapult { namespace deltaset {
 			return !Contains(m_removedElements, key) && (Contains(m_addedElements, key) || Contains(m_originalElements, key));
 		}
 
+		/// Prefetches original elements identified by \a keys from the underlying set.
+		/// \note Keys with pending changes are skipped because they are never looked up in the underlying set.
+		void prefetch(const std::vector<KeyType>& keys) const {
+			std::vector<KeyType> originalKeys;
+			originalKeys.reserve(keys.size());
+			for (const auto& key : keys) {
+				if (!Contains(m_addedElements, key) && !Contains(m_removedElements, key) && !Contains(m_copiedElements, key))
+					originalKeys.push_back(key);
+			}
+
+			if (!originalKeys.empty())
+				m_originalElements.prefetch(originalKeys);
+		}
+
 	private:
 		template<typename TSet> // SetType or MemorySetType
 		static constexpr bool Contains(const TSet& set, const KeyType& key) {
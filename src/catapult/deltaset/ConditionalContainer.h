@@ -23,6 +23,7 @@
 #include "BaseSetCommitPolicy.h"
 #include "DeltaElements.h"
 #include <memory>
+#include <vector>
 
 namespace catapult { namespace deltaset {
 
@@ -155,6 +156,20 @@ namespace catapult { namespace deltaset {
 					: ConditionalIterator(m_pContainer2->find(key), MemoryFlag());
 		}
 
+		/// Prefetches elements identified by \a keys so that subsequent finds of them are cheaper.
+		/// \note This is a no-op for memory-based containers.
+		void prefetch(const std::vector<typename TKeyTraits::KeyType>& keys) const {
+			if (m_pContainer1)
+				m_pContainer1->prefetch(keys);
+		}
+
+		/// Discards all prefetched elements.
+		/// \note This is a no-op for memory-based containers.
+		void discardPrefetched() {
+			if (m_pContainer1)
+				m_pContainer1->discardPrefetched();
+		}
+
 	public:
 		/// Applies all changes in \a deltas to the underlying container.
 		void update(const DeltaElements<MemorySetType>& deltas) {
@@ -210,6 +225,13 @@ namespace catapult { namespace deltaset {
 		container.update(deltas);
 	}
 
+	/// Discards all elements prefetched into \a container.
+	/// \note Specialization for ConditionalContainer.
+	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet>
+	void DiscardPrefetchedElements(ConditionalContainer<TKeyTraits, TStorageSet, TMemorySet>& container) {
+		container.discardPrefetched();
+	}
+
 	/// Optionally prunes \a elements using \a pruningBoundary, which indicates the upper bound of elements to remove.
 	/// \note Specialization for ConditionalContainer.
 	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet, typename TPruningBoundary>
@@ -23,7 +23,6 @@
 #include "ConsumerEntry.h"
 #include "catapult/thread/ThreadInfo.h"
 #include "catapult/utils/Functional.h"
-#include <thread>
 
 namespace catapult { namespace disruptor {
 
@@ -45,6 +44,10 @@ namespace catapult { namespace disruptor {
 					<< "completing processing of " << element
 					<< ", last consumer is " << (maxPosition - minPosition) << " elements behind";
 		}
+
+		uint64_t ToMicros(DisruptorElement::Clock::duration duration) {
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+		}
 	}
 
 	ConsumerDispatcher::ConsumerDispatcher(const ConsumerDispatcherOptions& options, const std::vector<DisruptorConsumer>& consumers)
@@ -58,11 +61,12 @@ namespace catapult { namespace disruptor {
 			: NamedObjectMixin(CheckOptions(options).DispatcherName)
 			, m_options(options)
 			, m_keepRunning(true)
-			, m_barriers(consumers.size() + 1)
+			, m_barriers(consumers.size() + 1, m_options.ConsumerWaitStrategy)
 			, m_disruptor(m_options.DisruptorSlotCount, m_options.ElementTraceInterval)
 			, m_inspector(inspector)
 			, m_numActiveElements(0)
-			, m_memorySize(0) {
+			, m_memorySize(0)
+			, m_latencies(consumers.size()) {
 		auto currentLevel = 0u;
 		for (const auto& consumer : consumers) {
 			ConsumerEntry consumerEntry(currentLevel++);
@@ -71,11 +75,20 @@ namespace catapult { namespace disruptor {
 				while (pThis->m_keepRunning) {
 					auto* pDisruptorElement = pThis->tryNext(consumerEntry);
 					if (!pDisruptorElement) {
-						std::this_thread::sleep_for(std::chrono::milliseconds(10));
+						pThis->m_barriers[consumerEntry.level()].wait(consumerEntry.position(), pThis->m_keepRunning);
 						continue;
 					}
 
+					auto& latencies = pThis->m_latencies[consumerEntry.level()];
+					auto startTime = DisruptorElement::Clock::now();
+					latencies.QueueWait.add(ToMicros(startTime - pDisruptorElement->availableTime()));
+
 					auto result = consumer(pDisruptorElement->input());
+
+					auto endTime = DisruptorElement::Clock::now();
+					latencies.Processing.add(ToMicros(endTime - startTime));
+					pDisruptorElement->markAvailable(endTime);
+
 					if (CompletionStatus::Aborted == result.CompletionStatus)
 						pThis->m_disruptor.markSkipped(consumerEntry.position(), result);
 
@@ -93,6 +106,9 @@ namespace catapult { namespace disruptor {
 
 	void ConsumerDispatcher::shutdown() {
 		m_keepRunning = false;
+		for (auto i = 0u; i < m_barriers.size(); ++i)
+			m_barriers[i].interrupt();
+
 		m_threads.join();
 	}
 
@@ -116,6 +132,10 @@ namespace catapult { namespace disruptor {
 		return utils::FileSize::FromBytes(m_memorySize.load());
 	}
 
+	const ConsumerLatencies& ConsumerDispatcher::latencies(size_t level) const {
+		return m_latencies[level];
+	}
+
 	DisruptorElement* ConsumerDispatcher::tryNext(ConsumerEntry& consumerEntry) {
 		while (true) {
 			auto consumerBarrierPosition = m_barriers[consumerEntry.level()].position();
@@ -25,6 +25,7 @@
 #include "DisruptorConsumer.h"
 #include "DisruptorInspector.h"
 #include "catapult/thread/ThreadGroup.h"
+#include "catapult/utils/LatencyHistogram.h"
 #include "catapult/utils/NamedObject.h"
 #include <atomic>
 
@@ -32,6 +33,15 @@ namespace catapult { namespace disruptor { class ConsumerEntry; } }
 
 namespace catapult { namespace disruptor {
 
+	/// Latency histograms (in microseconds) of a single consumer.
+	struct ConsumerLatencies {
+		/// Time elements waited for the consumer after being released by the previous consumer.
+		utils::LatencyHistogram QueueWait;
+
+		/// Time the consumer spent processing elements.
+		utils::LatencyHistogram Processing;
+	};
+
 	/// Dispatcher for disruptor consumers.
 	class ConsumerDispatcher final : public utils::NamedObjectMixin {
 	public:
@@ -74,6 +84,9 @@ namespace catapult { namespace disruptor {
 		/// Gets the cumulative size of all elements currently in the disruptor.
 		utils::FileSize memorySize() const;
 
+		/// Gets the latencies of the consumer at \a level.
+		const ConsumerLatencies& latencies(size_t level) const;
+
 	private:
 		DisruptorElement* tryNext(ConsumerEntry& consumerEntry);
 
@@ -92,6 +105,7 @@ namespace catapult { namespace disruptor {
 		thread::ThreadGroup m_threads;
 		std::atomic<size_t> m_numActiveElements;
 		std::atomic<uint64_t> m_memorySize;
+		std::vector<ConsumerLatencies> m_latencies;
 
 		utils::SpinLock m_addSpinLock; // lock to serialize access to Disruptor::add
 	};
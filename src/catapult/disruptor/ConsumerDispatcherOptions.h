@@ -20,6 +20,7 @@
 **/
 
 #pragma once
+#include "DisruptorTypes.h"
 #include "catapult/utils/FileSize.h"
 
 namespace catapult { namespace disruptor {
@@ -34,6 +35,7 @@ namespace catapult { namespace disruptor {
 				, DisruptorMaxMemorySize(utils::FileSize::FromMegabytes(1024))
 				, ElementTraceInterval(1)
 				, ShouldThrowWhenFull(true)
+				, ConsumerWaitStrategy(WaitStrategy::Blocking)
 		{}
 
 	public:
@@ -51,5 +53,8 @@ namespace catapult { namespace disruptor {
 
 		/// \c true if the dispatcher should throw when full, \c false if it should return an error.
 		bool ShouldThrowWhenFull;
+
+		/// Strategy used by consumers when waiting for new elements.
+		WaitStrategy ConsumerWaitStrategy;
 	};
 }}
@@ -23,6 +23,10 @@
 #include "DisruptorTypes.h"
 #include "catapult/utils/Logging.h"
 #include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <thread>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -31,16 +35,30 @@ namespace catapult { namespace disruptor {
 	/// DisruptorBarrier represents a consumer barrier (possibly shared by multiple consumers)
 	/// at a given level.
 	class DisruptorBarrier {
+	private:
+		static constexpr uint32_t Max_Spin_Iterations = 1000;
+
 	public:
 		/// Creates a barrier given its \a level and position (\a barrierEndPosition).
-		DisruptorBarrier(size_t level, PositionType position)
+		DisruptorBarrier(size_t level, PositionType position) : DisruptorBarrier(level, position, WaitStrategy::Blocking)
+		{}
+
+		/// Creates a barrier given its \a level, position (\a barrierEndPosition) and \a waitStrategy.
+		DisruptorBarrier(size_t level, PositionType position, WaitStrategy waitStrategy)
 				: m_level(level)
 				, m_position(position)
+				, m_waitStrategy(waitStrategy)
+				, m_numWaiters(0)
 		{}
 
-		/// Advances the barrier.
+		/// Advances the barrier and wakes up all consumers waiting for it.
 		inline void advance() {
 			++m_position;
+
+			// only pay for locking when there is at least one blocked waiter;
+			// waiters register themselves before checking position, so a concurrent advance cannot be missed
+			if (WaitStrategy::Blocking == m_waitStrategy && 0 != m_numWaiters)
+				notifyAll();
 		}
 
 		/// Gets the level of the barrier.
@@ -53,8 +71,82 @@ namespace catapult { namespace disruptor {
 			return m_position;
 		}
 
+		/// Gets the wait strategy of the barrier.
+		inline WaitStrategy waitStrategy() const {
+			return m_waitStrategy;
+		}
+
+	public:
+		/// Waits until the barrier position is different from \a position or \a keepWaiting is cleared.
+		/// Returns \c true if the barrier has moved.
+		bool wait(PositionType position, const std::atomic_bool& keepWaiting) {
+			switch (m_waitStrategy) {
+			case WaitStrategy::Busy_Spin:
+				return spin(position, keepWaiting, std::numeric_limits<uint32_t>::max());
+
+			case WaitStrategy::Spin_Then_Yield:
+				while (!spin(position, keepWaiting, Max_Spin_Iterations)) {
+					if (!keepWaiting)
+						return false;
+
+					std::this_thread::yield();
+				}
+
+				return true;
+
+			case WaitStrategy::Blocking:
+				break;
+			}
+
+			return block(position, keepWaiting);
+		}
+
+		/// Wakes up all consumers waiting for the barrier.
+		/// \note This should be called after clearing the \c keepWaiting flag passed to wait in order to unblock all waiters.
+		void interrupt() {
+			notifyAll();
+		}
+
+	private:
+		bool spin(PositionType position, const std::atomic_bool& keepWaiting, uint32_t maxIterations) const {
+			for (auto i = 0u; i < maxIterations; ++i) {
+				if (position != m_position)
+					return true;
+
+				if (!keepWaiting)
+					return false;
+			}
+
+			return position != m_position;
+		}
+
+		bool block(PositionType position, const std::atomic_bool& keepWaiting) {
+			++m_numWaiters;
+
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_condition.wait(lock, [this, position, &keepWaiting]() {
+					return position != m_position || !keepWaiting;
+				});
+			}
+
+			--m_numWaiters;
+			return position != m_position;
+		}
+
+		void notifyAll() {
+			// lock is required to prevent a waiter from missing the notification between checking its predicate and blocking
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_condition.notify_all();
+		}
+
 	private:
 		const size_t m_level;
 		std::atomic<PositionType> m_position;
+		const WaitStrategy m_waitStrategy;
+
+		std::atomic<uint32_t> m_numWaiters;
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
 	};
 }}
@@ -24,8 +24,11 @@
 
 namespace catapult { namespace disruptor {
 
-	DisruptorBarriers::DisruptorBarriers(size_t levelsCount) {
+	DisruptorBarriers::DisruptorBarriers(size_t levelsCount) : DisruptorBarriers(levelsCount, WaitStrategy::Blocking)
+	{}
+
+	DisruptorBarriers::DisruptorBarriers(size_t levelsCount, WaitStrategy waitStrategy) {
 		for (size_t i = 0; i < levelsCount; ++i)
-			m_barriers.emplace_back(std::make_unique<DisruptorBarrier>(i, 0));
+			m_barriers.emplace_back(std::make_unique<DisruptorBarrier>(i, 0, waitStrategy));
 	}
 }}
@@ -32,6 +32,9 @@ namespace catapult { namespace disruptor {
 		/// Creates \a levelsCount barriers with consecutive levels.
 		explicit DisruptorBarriers(size_t levelsCount);
 
+		/// Creates \a levelsCount barriers with consecutive levels that use \a waitStrategy.
+		DisruptorBarriers(size_t levelsCount, WaitStrategy waitStrategy);
+
 	public:
 		/// Gets the number of barriers.
 		inline size_t size() const {
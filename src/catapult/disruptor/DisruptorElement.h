@@ -22,17 +22,23 @@
 #pragma once
 #include "ConsumerInput.h"
 #include "catapult/utils/SpinLock.h"
+#include <chrono>
 
 namespace catapult { namespace disruptor {
 
 	/// Augments consumer input with disruptor metadata.
 	class DisruptorElement {
+	public:
+		/// Clock used for timing element processing.
+		using Clock = std::chrono::steady_clock;
+
 	public:
 		/// Creates a default disruptor element.
 		DisruptorElement()
 				: m_id(static_cast<uint64_t>(-1))
 				, m_processingComplete([](auto, auto) {})
 				, m_pSpinLock(std::make_unique<utils::SpinLock>())
+				, m_availableTime(Clock::now())
 		{}
 
 		/// Creates a disruptor element around \a input with \a id and a completion handler \a processingComplete.
@@ -41,6 +47,7 @@ namespace catapult { namespace disruptor {
 				, m_id(id)
 				, m_processingComplete(processingComplete)
 				, m_pSpinLock(std::make_unique<utils::SpinLock>())
+				, m_availableTime(Clock::now())
 		{}
 
 	public:
@@ -71,6 +78,11 @@ namespace catapult { namespace disruptor {
 			return m_result;
 		}
 
+		/// Gets the time at which the element became available to the next consumer.
+		Clock::time_point availableTime() const {
+			return m_availableTime;
+		}
+
 	public:
 		/// Marks the element as skipped at \a position with \a result.
 		void markSkipped(PositionType position, const ConsumerResult& result) {
@@ -81,6 +93,12 @@ namespace catapult { namespace disruptor {
 			m_result.FinalConsumerPosition = position;
 		}
 
+		/// Marks the element as available to the next consumer at \a time.
+		/// \note This must be called before the consumer barrier is advanced.
+		void markAvailable(Clock::time_point time) {
+			m_availableTime = time;
+		}
+
 		/// Calls the completion handler for the element.
 		void markProcessingComplete() {
 			m_processingComplete(m_id, m_result);
@@ -92,6 +110,7 @@ namespace catapult { namespace disruptor {
 		ProcessingCompleteFunc m_processingComplete;
 		ConsumerCompletionResult m_result;
 		std::unique_ptr<utils::SpinLock> m_pSpinLock; // unique_ptr to allow moving of element
+		Clock::time_point m_availableTime;
 	};
 
 	/// Insertion operator for outputting \a element to \a out.
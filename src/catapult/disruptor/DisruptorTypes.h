@@ -63,6 +63,19 @@ namespace catapult { namespace disruptor {
 		Fatal
 	};
 
+	/// Strategy used by a consumer to wait for its barrier to advance.
+	enum class WaitStrategy : uint8_t {
+		/// Consumer spins continuously.
+		/// \note This strategy has the lowest latency but keeps a core busy.
+		Busy_Spin,
+
+		/// Consumer spins for a bounded number of iterations and then yields its time slice.
+		Spin_Then_Yield,
+
+		/// Consumer blocks until the barrier is advanced.
+		Blocking
+	};
+
 	/// Result of a consumer operation.
 	struct ConsumerResult {
 	public:
@@ -20,14 +20,21 @@
 **/
 
 #include "CommitStepHandler.h"
+#include "catapult/cache_db/RocksGroupCommitter.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/io/IndexFile.h"
 
 namespace catapult { namespace extensions {
 
+	namespace {
+		void SaveCommitStep(const config::CatapultDataDirectory& dataDirectory, consumers::CommitOperationStep step) {
+			io::IndexFile(dataDirectory.rootDir().file("commit_step.dat")).set(utils::to_underlying_type(step));
+		}
+	}
+
 	consumers::BlockChainSyncHandlers::CommitStepFunc CreateCommitStepHandler(const config::CatapultDataDirectory& dataDirectory) {
 		return [dataDirectory](auto step) {
-			io::IndexFile(dataDirectory.rootDir().file("commit_step.dat")).set(utils::to_underlying_type(step));
+			SaveCommitStep(dataDirectory, step);
 
 			if (consumers::CommitOperationStep::All_Updated != step)
 				return;
@@ -40,4 +47,33 @@ namespace catapult { namespace extensions {
 			io::IndexFile(stateChangeDirectory.file("index.dat")).set(syncIndexWriterFile.get());
 		};
 	}
+
+	consumers::BlockChainSyncHandlers::CommitStepFunc CreateCommitStepHandler(
+			const config::CatapultDataDirectory& dataDirectory,
+			cache::RocksGroupCommitter& groupCommitter) {
+		return [dataDirectory, &groupCommitter](auto step) {
+			if (consumers::CommitOperationStep::All_Updated != step) {
+				SaveCommitStep(dataDirectory, step);
+				return;
+			}
+
+			auto stateChangeDirectory = dataDirectory.spoolDir("state_change");
+			auto syncIndexWriterFile = io::IndexFile(stateChangeDirectory.file("index_server.dat"));
+			if (!syncIndexWriterFile.exists()) {
+				SaveCommitStep(dataDirectory, step);
+				return;
+			}
+
+			// messages in (index.dat, index_updated.dat] are committed but might not be durable, so they are replayed by
+			// recovery; index_updated.dat needs to be set before the commit step so that it is never behind All_Updated
+			auto syncIndexWriterValue = syncIndexWriterFile.get();
+			io::IndexFile(stateChangeDirectory.file("index_updated.dat")).set(syncIndexWriterValue);
+			SaveCommitStep(dataDirectory, step);
+
+			// index.dat can only be advanced after all cache database writes corresponding to the messages are durable
+			groupCommitter.whenDurable([stateChangeDirectory, syncIndexWriterValue]() {
+				io::IndexFile(stateChangeDirectory.file("index.dat")).set(syncIndexWriterValue);
+			});
+		};
+	}
 }}
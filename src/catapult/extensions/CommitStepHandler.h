@@ -22,10 +22,20 @@
 #pragma once
 #include "catapult/consumers/BlockChainSyncHandlers.h"
 
-namespace catapult { namespace config { class CatapultDataDirectory; } }
+namespace catapult {
+	namespace cache { class RocksGroupCommitter; }
+	namespace config { class CatapultDataDirectory; }
+}
 
 namespace catapult { namespace extensions {
 
 	/// Creates a commit step handler around \a dataDirectory.
 	consumers::BlockChainSyncHandlers::CommitStepFunc CreateCommitStepHandler(const config::CatapultDataDirectory& dataDirectory);
+
+	/// Creates a commit step handler around \a dataDirectory that defers advancing the state change index until all
+	/// cache database writes tracked by \a groupCommitter are durable.
+	/// \note The last committed state change index is tracked separately so that recovery can replay all committed changes.
+	consumers::BlockChainSyncHandlers::CommitStepFunc CreateCommitStepHandler(
+			const config::CatapultDataDirectory& dataDirectory,
+			cache::RocksGroupCommitter& groupCommitter);
 }}
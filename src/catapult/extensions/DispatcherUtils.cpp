@@ -55,6 +55,50 @@ namespace catapult { namespace extensions {
 		});
 	}
 
+	namespace {
+		using LatencyHistogramPointer = utils::LatencyHistogram disruptor::ConsumerLatencies::*;
+
+		void AddLatencyHistogramCounters(
+				ServiceLocator& locator,
+				const std::string& dispatcherName,
+				const std::string& counterPrefix,
+				size_t level,
+				LatencyHistogramPointer pHistogram) {
+			using disruptor::ConsumerDispatcher;
+
+			auto addCounter = [&locator, &dispatcherName, &counterPrefix, level, pHistogram](const auto& name, auto supplier) {
+				auto counterName = counterPrefix + " " + name;
+				locator.registerServiceCounter<ConsumerDispatcher>(dispatcherName, counterName, [level, pHistogram, supplier](
+						const auto& dispatcher) {
+					// consumer is not present in this dispatcher
+					if (level >= dispatcher.size())
+						return ServiceLocator::Sentinel_Counter_Value;
+
+					return supplier(dispatcher.latencies(level).*pHistogram);
+				});
+			};
+
+			addCounter("MED", [](const auto& histogram) { return histogram.percentile(50); });
+			addCounter("HI", [](const auto& histogram) { return histogram.percentile(99); });
+			addCounter("MAX", [](const auto& histogram) { return histogram.max(); });
+		}
+	}
+
+	void AddDispatcherLatencyCounters(
+			ServiceLocator& locator,
+			const std::string& dispatcherName,
+			const std::string& counterPrefix,
+			size_t numConsumers) {
+		if (numConsumers > 'Z' - 'A' + 1)
+			CATAPULT_THROW_INVALID_ARGUMENT_1("too many consumers for latency counters", numConsumers);
+
+		for (auto level = 0u; level < numConsumers; ++level) {
+			auto consumerPrefix = counterPrefix + " " + static_cast<char>('A' + level);
+			AddLatencyHistogramCounters(locator, dispatcherName, consumerPrefix + " W", level, &disruptor::ConsumerLatencies::QueueWait);
+			AddLatencyHistogramCounters(locator, dispatcherName, consumerPrefix + " P", level, &disruptor::ConsumerLatencies::Processing);
+		}
+	}
+
 	thread::Task CreateBatchTransactionTask(TransactionBatchRangeDispatcher& dispatcher, const std::string& name) {
 		return thread::CreateNamedTask("batch " + name + " task", [&dispatcher]() {
 			dispatcher.dispatch();
@@ -42,6 +42,16 @@ namespace catapult { namespace extensions {
 	/// Adds dispatcher counters with prefix \a counterPrefix to \a locator for a dispatcher named \a dispatcherName.
 	void AddDispatcherCounters(ServiceLocator& locator, const std::string& dispatcherName, const std::string& counterPrefix);
 
+	/// Adds latency counters with prefix \a counterPrefix to \a locator for the first \a numConsumers consumers
+	/// of a dispatcher named \a dispatcherName.
+	/// \note Counters are named "<prefix> <consumer> <W|P> <MED|HI|MAX>", where consumers are identified by letter (A is the first),
+	///       W and P select queue wait and processing time and MED, HI and MAX select p50, p99 and max (in microseconds).
+	void AddDispatcherLatencyCounters(
+			ServiceLocator& locator,
+			const std::string& dispatcherName,
+			const std::string& counterPrefix,
+			size_t numConsumers);
+
 	/// Transaction batch range dispatcher.
 	using TransactionBatchRangeDispatcher = disruptor::BatchRangeDispatcher<model::AnnotatedTransactionRange>;
 
@@ -20,6 +20,7 @@
 **/
 
 #include "BlockElementSerializer.h"
+#include "BufferInputStreamAdapter.h"
 #include "PodIoUtils.h"
 #include "Stream.h"
 #include "catapult/utils/MemoryUtils.h"
@@ -115,5 +116,45 @@ namespace catapult { namespace io {
 		return pBlockElement;
 	}
 
+	namespace {
+		struct SharedBufferBlockElement {
+			SharedBufferBlockElement(const model::Block& block, const std::shared_ptr<const void>& pBufferOwnerParam)
+					: pBufferOwner(pBufferOwnerParam)
+					, Element(block)
+			{}
+
+			std::shared_ptr<const void> pBufferOwner;
+			model::BlockElement Element;
+		};
+	}
+
+	std::shared_ptr<model::BlockElement> ReadBlockElementInPlace(const RawBuffer& buffer, const std::shared_ptr<const void>& pBufferOwner) {
+		BufferInputStreamAdapter<RawBuffer> blockSizeStream(buffer);
+		auto size = Read32(blockSizeStream);
+		if (size < sizeof(model::Block) || size > buffer.Size) {
+			std::ostringstream out;
+			out << "buffer with size " << buffer.Size << " cannot contain block with size " << size;
+			CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
+		}
+
+		// point the block element directly at the block data and tie the buffer lifetime to the block element
+		const auto& block = reinterpret_cast<const model::Block&>(*buffer.pData);
+		auto pSharedBufferBlockElement = std::make_shared<SharedBufferBlockElement>(block, pBufferOwner);
+		auto pBlockElement = std::shared_ptr<model::BlockElement>(pSharedBufferBlockElement, &pSharedBufferBlockElement->Element);
+
+		// read metadata
+		RawBuffer metadataBuffer(buffer.pData + size, buffer.Size - size);
+		BufferInputStreamAdapter<RawBuffer> metadataStream(metadataBuffer);
+		metadataStream.read(pBlockElement->EntityHash);
+		metadataStream.read(pBlockElement->GenerationHash);
+		ReadTransactionHashes(metadataStream, *pBlockElement);
+		ReadSubCacheMerkleRoots(metadataStream, pBlockElement->SubCacheMerkleRoots);
+
+		if (!metadataStream.eof())
+			CATAPULT_THROW_RUNTIME_ERROR_1("additional data after block element", metadataBuffer.Size - metadataStream.position());
+
+		return pBlockElement;
+	}
+
 	// endregion
 }}
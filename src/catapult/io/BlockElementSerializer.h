@@ -38,4 +38,8 @@ namespace catapult { namespace io {
 	/// Reads block element from \a inputStream into an allocated block element.
 	/// \note Shared pointer is returned for memory management reasons.
 	std::shared_ptr<model::BlockElement> ReadBlockElement(InputStream& inputStream);
+
+	/// Reads block element from \a buffer without copying the block, which continues to reference \a buffer.
+	/// \note Returned block element shares ownership of \a pBufferOwner, which must keep \a buffer alive.
+	std::shared_ptr<model::BlockElement> ReadBlockElementInPlace(const RawBuffer& buffer, const std::shared_ptr<const void>& pBufferOwner);
 }}
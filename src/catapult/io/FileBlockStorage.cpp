@@ -22,6 +22,7 @@
 #include "FileBlockStorage.h"
 #include "BlockElementSerializer.h"
 #include "BlockStatementSerializer.h"
+#include "BufferInputStreamAdapter.h"
 #include "BufferedFileStream.h"
 #include "FilesystemUtils.h"
 #include "PodIoUtils.h"
@@ -33,10 +34,15 @@ namespace catapult { namespace io {
 
 	// region ctor
 
-	FileBlockStorage::FileBlockStorage(const std::string& dataDirectory, uint32_t fileDatabaseBatchSize, FileBlockStorageMode mode)
+	FileBlockStorage::FileBlockStorage(
+			const std::string& dataDirectory,
+			uint32_t fileDatabaseBatchSize,
+			FileBlockStorageMode mode,
+			uint32_t maxMappedFiles)
 			: m_dataDirectory(dataDirectory)
 			, m_mode(mode)
-			, m_blockDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".dat" })
+			, m_isMemoryMapped(0 != maxMappedFiles)
+			, m_blockDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".dat", maxMappedFiles })
 			, m_statementDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".stmt" })
 			, m_hashFile(dataDirectory, "hashes")
 			, m_indexFile((std::filesystem::path(dataDirectory) / "index.dat").generic_string())
@@ -108,16 +114,36 @@ namespace catapult { namespace io {
 			blockStream.read({ reinterpret_cast<uint8_t*>(pBlock.get()) + sizeof(uint32_t), size - sizeof(uint32_t) });
 			return pBlock;
 		}
+
+		std::shared_ptr<const model::Block> ReadMappedBlock(const FileDatabase::MappedPayload& payload) {
+			BufferInputStreamAdapter<RawBuffer> blockSizeStream(payload.Data);
+			auto size = Read32(blockSizeStream);
+			if (size < sizeof(model::Block) || size > payload.Data.Size) {
+				std::ostringstream out;
+				out << "mapped payload with size " << payload.Data.Size << " cannot contain block with size " << size;
+				CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
+			}
+
+			return std::shared_ptr<const model::Block>(payload.pFile, reinterpret_cast<const model::Block*>(payload.Data.pData));
+		}
 	}
 
 	std::shared_ptr<const model::Block> FileBlockStorage::loadBlock(Height height) const {
 		requireHeight(height, "block");
+		if (m_isMemoryMapped)
+			return ReadMappedBlock(m_blockDatabase.mappedPayload(height.unwrap()));
+
 		auto pBlockStream = m_blockDatabase.inputStream(height.unwrap());
 		return ReadBlock(*pBlockStream);
 	}
 
 	std::shared_ptr<const model::BlockElement> FileBlockStorage::loadBlockElement(Height height) const {
 		requireHeight(height, "block element");
+		if (m_isMemoryMapped) {
+			auto payload = m_blockDatabase.mappedPayload(height.unwrap());
+			return ReadBlockElementInPlace(payload.Data, payload.pFile);
+		}
+
 		auto pBlockStream = m_blockDatabase.inputStream(height.unwrap());
 		auto pBlockElement = ReadBlockElement(*pBlockStream);
 
@@ -43,10 +43,13 @@ namespace catapult { namespace io {
 	public:
 		/// Creates a file-based block storage, where blocks will be stored inside \a dataDirectory
 		/// with a file database batch size of \a fileDatabaseBatchSize and specified storage \a mode.
+		/// When \a maxMappedFiles is nonzero, up to that many recently read block files are kept memory mapped
+		/// and loaded blocks reference the mapped data directly.
 		FileBlockStorage(
 				const std::string& dataDirectory,
 				uint32_t fileDatabaseBatchSize,
-				FileBlockStorageMode mode = FileBlockStorageMode::Hash_Index);
+				FileBlockStorageMode mode = FileBlockStorageMode::Hash_Index,
+				uint32_t maxMappedFiles = 0);
 
 	public:
 		// LightBlockStorage
@@ -69,6 +72,7 @@ namespace catapult { namespace io {
 	private:
 		std::string m_dataDirectory;
 		FileBlockStorageMode m_mode;
+		bool m_isMemoryMapped;
 		FileDatabase m_blockDatabase;
 		FileDatabase m_statementDatabase;
 
@@ -21,9 +21,14 @@
 
 #include "FileDatabase.h"
 #include "FileStream.h"
+#include "MemoryMappedFile.h"
 #include "PodIoUtils.h"
 #include "catapult/exceptions.h"
 #include "catapult/preprocessor.h"
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <mutex>
 
 namespace catapult { namespace io {
 
@@ -61,8 +66,83 @@ namespace catapult { namespace io {
 		};
 
 		// endregion
+
+		[[noreturn]]
+		void ThrowUnwrittenPayload(uint64_t id) {
+			std::ostringstream out;
+			out << "cannot read payload at " << id << " that has not been written";
+			CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
+		}
 	}
 
+	// region MappedFileCache
+
+	class FileDatabase::MappedFileCache {
+	private:
+		struct Entry {
+			std::string FilePath;
+			uint64_t FileSize;
+			std::filesystem::file_time_type LastWriteTime;
+			std::shared_ptr<const MemoryMappedFile> pFile;
+		};
+
+	public:
+		explicit MappedFileCache(size_t maxFiles) : m_maxFiles(maxFiles)
+		{}
+
+	public:
+		std::shared_ptr<const MemoryMappedFile> get(const std::string& filePath) {
+			// files can be modified by other processes, so a mapping is only reused when the file is unchanged
+			std::error_code fileSizeError;
+			std::error_code lastWriteTimeError;
+			auto fileSize = std::filesystem::file_size(filePath, fileSizeError);
+			auto lastWriteTime = std::filesystem::last_write_time(filePath, lastWriteTimeError);
+			auto isFileUnchanged = [&](const auto& entry) {
+				return !fileSizeError && !lastWriteTimeError && fileSize == entry.FileSize && lastWriteTime == entry.LastWriteTime;
+			};
+
+			std::lock_guard<std::mutex> guard(m_mutex);
+			auto iter = find(filePath);
+			if (m_entries.end() != iter) {
+				if (isFileUnchanged(*iter)) {
+					m_entries.splice(m_entries.begin(), m_entries, iter);
+					return iter->pFile;
+				}
+
+				m_entries.erase(iter);
+			}
+
+			// mapping throws when the file cannot be opened
+			auto pFile = std::make_shared<const MemoryMappedFile>(filePath);
+			m_entries.push_front(Entry{ filePath, fileSize, lastWriteTime, pFile });
+			if (m_entries.size() > m_maxFiles)
+				m_entries.pop_back();
+
+			return pFile;
+		}
+
+		void remove(const std::string& filePath) {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			auto iter = find(filePath);
+			if (m_entries.end() != iter)
+				m_entries.erase(iter);
+		}
+
+	private:
+		std::list<Entry>::iterator find(const std::string& filePath) {
+			return std::find_if(m_entries.begin(), m_entries.end(), [&filePath](const auto& entry) {
+				return filePath == entry.FilePath;
+			});
+		}
+
+	private:
+		size_t m_maxFiles;
+		std::list<Entry> m_entries; // most recently used first
+		std::mutex m_mutex;
+	};
+
+	// endregion
+
 	// region FileDatabase
 
 	FileDatabase::FileDatabase(const config::CatapultDirectory& directory, const Options& options)
@@ -70,8 +150,15 @@ namespace catapult { namespace io {
 			, m_options(options) {
 		if (0 == m_options.BatchSize)
 			CATAPULT_THROW_INVALID_ARGUMENT("batch size must be nonzero");
+
+		if (0 != m_options.MaxMappedFiles)
+			m_pMappedFileCache = std::make_unique<MappedFileCache>(m_options.MaxMappedFiles);
 	}
 
+	FileDatabase::FileDatabase(FileDatabase&&) = default;
+
+	FileDatabase::~FileDatabase() = default;
+
 	bool FileDatabase::contains(uint64_t id) const {
 		auto filePath = getFilePath(id, false);
 		if (!std::filesystem::exists(filePath))
@@ -104,11 +191,8 @@ namespace catapult { namespace io {
 		rawFile.seek(headerOffset);
 		auto bodyStartOffset = Read64(rawFile);
 
-		if (0 == bodyStartOffset) {
-			std::ostringstream out;
-			out << "cannot read payload at " << id << " that has not been written";
-			CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
-		}
+		if (0 == bodyStartOffset)
+			ThrowUnwrittenPayload(id);
 
 		uint64_t bodyEndOffset = 0;
 		if (m_options.BatchSize - 1 != id % m_options.BatchSize)
@@ -125,8 +209,52 @@ namespace catapult { namespace io {
 		return std::make_unique<InputStreamSlice>(std::move(pBodyStream), bodyEndOffset);
 	}
 
+	FileDatabase::MappedPayload FileDatabase::mappedPayload(uint64_t id) const {
+		if (!m_pMappedFileCache)
+			CATAPULT_THROW_INVALID_ARGUMENT("mappedPayload is not supported when memory mapping is disabled");
+
+		auto pFile = m_pMappedFileCache->get(getFilePath(id, false));
+		auto fileBuffer = pFile->buffer();
+		if (bypassHeader())
+			return { pFile, fileBuffer };
+
+		auto readHeaderValue = [id, &fileBuffer](auto offset) {
+			if (offset + sizeof(uint64_t) > fileBuffer.Size)
+				ThrowUnwrittenPayload(id);
+
+			uint64_t value;
+			std::memcpy(&value, fileBuffer.pData + offset, sizeof(uint64_t));
+			return value;
+		};
+
+		auto headerOffset = getHeaderOffset(id);
+		auto bodyStartOffset = readHeaderValue(headerOffset);
+		if (0 == bodyStartOffset)
+			ThrowUnwrittenPayload(id);
+
+		uint64_t bodyEndOffset = 0;
+		if (m_options.BatchSize - 1 != id % m_options.BatchSize)
+			bodyEndOffset = readHeaderValue(headerOffset + sizeof(uint64_t));
+
+		if (0 == bodyEndOffset) // payload extends to end of file
+			bodyEndOffset = fileBuffer.Size;
+
+		if (bodyStartOffset > bodyEndOffset || bodyEndOffset > fileBuffer.Size) {
+			std::ostringstream out;
+			out
+					<< "mapped payload at " << id << " has invalid bounds (start = " << bodyStartOffset
+					<< ", end = " << bodyEndOffset << ", file-size = " << fileBuffer.Size << ")";
+			CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
+		}
+
+		auto bodySize = static_cast<size_t>(bodyEndOffset - bodyStartOffset);
+		return { pFile, { fileBuffer.pData + bodyStartOffset, bodySize } };
+	}
+
 	std::unique_ptr<OutputStream> FileDatabase::outputStream(uint64_t id) {
 		auto filePath = getFilePath(id, true);
+		if (m_pMappedFileCache)
+			detachMappedFile(filePath, id);
 
 		auto isNewFile = !std::filesystem::exists(filePath) || bypassHeader();
 		auto rawFile = RawFile(filePath, isNewFile ? OpenMode::Read_Write : OpenMode::Read_Append);
@@ -164,6 +292,42 @@ namespace catapult { namespace io {
 		return std::make_unique<FileStream>(std::move(rawFile));
 	}
 
+	void FileDatabase::detachMappedFile(const std::string& filePath, uint64_t id) {
+		// a mapped file must never shrink because reading past its end raises a signal,
+		// so any file that would be truncated is replaced with a copy of its retained prefix instead
+		m_pMappedFileCache->remove(filePath);
+		if (!std::filesystem::exists(filePath))
+			return;
+
+		if (bypassHeader()) {
+			std::filesystem::remove(filePath);
+			return;
+		}
+
+		std::vector<uint8_t> retainedData;
+		{
+			auto rawFile = RawFile(filePath, OpenMode::Read_Only);
+			rawFile.seek(getHeaderOffset(id));
+			auto bodyStartOffset = Read64(rawFile);
+			if (0 == bodyStartOffset || rawFile.size() == bodyStartOffset)
+				return;
+
+			retainedData.resize(bodyStartOffset);
+			rawFile.seek(0);
+			rawFile.read(retainedData);
+		}
+
+		// temp file must be durable before it replaces the original, otherwise a crash could leave an empty or truncated file
+		auto tempFilePath = filePath + ".tmp";
+		{
+			auto tempFile = RawFile(tempFilePath, OpenMode::Read_Write);
+			tempFile.write(retainedData);
+			tempFile.sync();
+		}
+
+		std::filesystem::rename(tempFilePath, filePath);
+	}
+
 	bool FileDatabase::bypassHeader() const {
 		// skip header when batch size is one to preserve old behavior
 		return 1 == m_options.BatchSize;
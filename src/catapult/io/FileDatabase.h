@@ -22,6 +22,9 @@
 #pragma once
 #include "Stream.h"
 #include "catapult/config/CatapultDataDirectory.h"
+#include <memory>
+
+namespace catapult { namespace io { class MemoryMappedFile; } }
 
 namespace catapult { namespace io {
 
@@ -35,12 +38,31 @@ namespace catapult { namespace io {
 
 			/// Extension of created files.
 			std::string FileExtension;
+
+			/// Maximum number of recently read files to keep memory mapped.
+			/// \note Memory mapping is disabled when zero.
+			size_t MaxMappedFiles = 0;
+		};
+
+		/// View of a payload within a memory mapped file.
+		struct MappedPayload {
+			/// Memory mapped file containing the payload.
+			std::shared_ptr<const MemoryMappedFile> pFile;
+
+			/// Payload data.
+			RawBuffer Data;
 		};
 
 	public:
 		/// Creates a database in \a directory with \a options.
 		FileDatabase(const config::CatapultDirectory& directory, const Options& options);
 
+		/// Move constructs a database from \a rhs.
+		FileDatabase(FileDatabase&& rhs);
+
+		/// Destroys the database.
+		~FileDatabase();
+
 	public:
 		/// Returns \c true if a payload for \a id is contained.
 		bool contains(uint64_t id) const;
@@ -48,16 +70,26 @@ namespace catapult { namespace io {
 		/// Gets an input stream for \a id and optionally returns the stream size (\a pSize).
 		std::unique_ptr<InputStream> inputStream(uint64_t id, size_t* pSize = nullptr) const;
 
+		/// Gets a memory mapped view of the payload for \a id.
+		/// \note The view shares ownership of the mapping, so it remains valid even after the file is rewritten.
+		MappedPayload mappedPayload(uint64_t id) const;
+
 		/// Gets an output stream for \a id.
+		/// \note When memory mapping is enabled, rewritten files are replaced instead of being truncated in place.
 		std::unique_ptr<OutputStream> outputStream(uint64_t id);
 
 	private:
+		void detachMappedFile(const std::string& filePath, uint64_t id);
 		bool bypassHeader() const;
 		uint64_t getHeaderOffset(uint64_t id) const;
 		std::string getFilePath(uint64_t id, bool createDirectories) const;
 
+	private:
+		class MappedFileCache;
+
 	private:
 		config::CatapultDirectory m_directory;
 		Options m_options;
+		std::unique_ptr<MappedFileCache> m_pMappedFileCache;
 	};
 }}
@@ -20,6 +20,7 @@
 **/
 
 #include "FileQueue.h"
+#include "PodIoUtils.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/utils/HexFormatter.h"
 #include "catapult/exceptions.h"
@@ -29,6 +30,20 @@
 namespace catapult { namespace io {
 
 	namespace {
+		// segment file layout:
+		// - uint64_t index of first message written to segment
+		// - uint64_t[Messages_Per_Segment + 1] start offset of each message slot (last entry is end of last message)
+		// - message data
+		constexpr uint64_t Messages_Per_Segment = 1024;
+		constexpr uint64_t Segment_Header_Size = (Messages_Per_Segment + 2) * sizeof(uint64_t);
+		constexpr auto Default_Segment_Size = utils::FileSize::FromMegabytes(8);
+		constexpr uint64_t Max_Recycled_Segment_Size = Default_Segment_Size.bytes();
+		constexpr uint64_t Max_Read_Chunk_Size = 4 * 1024 * 1024;
+		constexpr size_t Max_Recycled_Segments = 2;
+
+		constexpr auto Segment_Extension = ".seg";
+		constexpr auto Recycled_Segment_Extension = ".free";
+
 		const std::filesystem::path& CreateDirectory(const std::filesystem::path& directory) {
 			config::CatapultDirectory(directory).create();
 			return directory;
@@ -42,11 +57,55 @@ namespace catapult { namespace io {
 			return true;
 		}
 
-		std::string GetFilename(uint64_t value) {
+		std::string GetFilename(uint64_t value, const char* extension = ".dat") {
 			std::ostringstream out;
-			out << utils::HexFormat(value) << ".dat";
+			out << utils::HexFormat(value) << extension;
 			return out.str();
 		}
+
+		uint64_t GetSegmentSlot(uint64_t index) {
+			return index % Messages_Per_Segment;
+		}
+
+		uint64_t GetSlotOffsetPosition(uint64_t slot) {
+			return (slot + 1) * sizeof(uint64_t);
+		}
+
+		size_t CountRecycledSegments(const std::filesystem::path& directory) {
+			size_t numRecycledSegments = 0;
+			for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+				if (Recycled_Segment_Extension == entry.path().extension())
+					++numRecycledSegments;
+			}
+
+			return numRecycledSegments;
+		}
+
+		bool TryReuseRecycledSegment(const std::filesystem::path& directory, const std::filesystem::path& segmentPath) {
+			for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+				if (Recycled_Segment_Extension != entry.path().extension())
+					continue;
+
+				std::filesystem::rename(entry.path(), segmentPath);
+				return true;
+			}
+
+			return false;
+		}
+
+		void RecycleSegment(const std::filesystem::path& directory, uint64_t segmentBaseIndex) {
+			auto segmentPath = directory / GetFilename(segmentBaseIndex, Segment_Extension);
+			if (CountRecycledSegments(directory) >= Max_Recycled_Segments) {
+				std::filesystem::remove(segmentPath);
+				return;
+			}
+
+			// keep preallocated space (which reflects the volume of the queue) but drop any growth beyond the default segment size
+			if (std::filesystem::file_size(segmentPath) > Max_Recycled_Segment_Size)
+				std::filesystem::resize_file(segmentPath, Max_Recycled_Segment_Size);
+
+			std::filesystem::rename(segmentPath, directory / GetFilename(segmentBaseIndex, Recycled_Segment_Extension));
+		}
 	}
 
 	// region FileQueueWriter
@@ -55,12 +114,35 @@ namespace catapult { namespace io {
 	{}
 
 	FileQueueWriter::FileQueueWriter(const std::string& directory, const std::string& indexFilename)
+			: FileQueueWriter(directory, indexFilename, FileQueueLayout::File_Per_Message)
+	{}
+
+	FileQueueWriter::FileQueueWriter(const std::string& directory, const std::string& indexFilename, FileQueueLayout layout)
+			: FileQueueWriter(directory, indexFilename, layout, Default_Segment_Size)
+	{}
+
+	FileQueueWriter::FileQueueWriter(
+			const std::string& directory,
+			const std::string& indexFilename,
+			FileQueueLayout layout,
+			utils::FileSize segmentSize)
 			: m_directory(CreateDirectory(directory))
 			, m_indexFile((m_directory / indexFilename).generic_string(), LockMode::None)
 			, m_indexValue(CreateIfNotExists(m_indexFile) ? 0 : m_indexFile.get())
+			, m_layout(layout)
+			, m_segmentSize(segmentSize)
+			, m_hasPendingMessage(false)
+			, m_segmentBaseIndex(0)
+			, m_segmentDataOffset(0)
 	{}
 
 	void FileQueueWriter::write(const RawBuffer& buffer) {
+		if (FileQueueLayout::Segmented == m_layout) {
+			m_pendingMessage.insert(m_pendingMessage.end(), buffer.pData, buffer.pData + buffer.Size);
+			m_hasPendingMessage = true;
+			return;
+		}
+
 		if (!m_pOutputStream) {
 			auto filename = (m_directory / GetFilename(m_indexValue)).generic_string();
 			RawFile outputFile(filename, OpenMode::Read_Write);
@@ -71,25 +153,234 @@ namespace catapult { namespace io {
 	}
 
 	void FileQueueWriter::flush() {
-		if (!m_pOutputStream)
-			return;
+		if (FileQueueLayout::Segmented == m_layout) {
+			if (!m_hasPendingMessage)
+				return;
+
+			appendToSegment();
+			m_pendingMessage.clear();
+			m_hasPendingMessage = false;
+		} else {
+			if (!m_pOutputStream)
+				return;
+
+			m_pOutputStream->flush();
+			m_pOutputStream.reset();
+		}
 
-		m_pOutputStream->flush();
-		m_pOutputStream.reset();
 		m_indexValue = m_indexFile.increment();
 	}
 
+	void FileQueueWriter::appendToSegment() {
+		auto slot = GetSegmentSlot(m_indexValue);
+		if (!m_pSegmentFile || m_indexValue - slot != m_segmentBaseIndex)
+			openSegment();
+
+		// write message data before its end offset so that readers never observe a partial message
+		m_pSegmentFile->seek(m_segmentDataOffset);
+		m_pSegmentFile->write(m_pendingMessage);
+		m_segmentDataOffset += m_pendingMessage.size();
+
+		m_pSegmentFile->seek(GetSlotOffsetPosition(slot + 1));
+		Write64(*m_pSegmentFile, m_segmentDataOffset);
+	}
+
+	void FileQueueWriter::openSegment() {
+		auto slot = GetSegmentSlot(m_indexValue);
+		m_segmentBaseIndex = m_indexValue - slot;
+		m_pSegmentFile.reset();
+
+		auto segmentPath = m_directory / GetFilename(m_segmentBaseIndex, Segment_Extension);
+		if (0 != slot && std::filesystem::exists(segmentPath)) {
+			// continue existing segment (e.g. after restart) when it already contains the preceding message
+			auto pSegmentFile = std::make_unique<RawFile>(segmentPath.generic_string(), OpenMode::Read_Append, LockMode::None);
+			auto firstIndex = Read64(*pSegmentFile);
+			pSegmentFile->seek(GetSlotOffsetPosition(slot));
+			auto dataOffset = Read64(*pSegmentFile);
+			if (firstIndex <= m_indexValue && Segment_Header_Size <= dataOffset && dataOffset <= pSegmentFile->size()) {
+				m_pSegmentFile = std::move(pSegmentFile);
+				m_segmentDataOffset = dataOffset;
+				return;
+			}
+		}
+
+		// otherwise, (re)initialize segment starting at the current message, which also discards rewound messages
+		if (!std::filesystem::exists(segmentPath))
+			TryReuseRecycledSegment(m_directory, segmentPath);
+
+		// preallocate new segments and extend (but never shrink) reused segments to the configured size
+		m_pSegmentFile = std::make_unique<RawFile>(segmentPath.generic_string(), OpenMode::Read_Append, LockMode::None);
+		m_pSegmentFile->reserve(m_segmentSize.bytes());
+		Write64(*m_pSegmentFile, m_indexValue);
+		m_pSegmentFile->seek(GetSlotOffsetPosition(slot));
+		Write64(*m_pSegmentFile, Segment_Header_Size);
+		m_segmentDataOffset = Segment_Header_Size;
+	}
+
 	// endregion
 
 	// region FileQueueReader
 
 	namespace {
+		using MessageConsumer = consumer<const std::vector<uint8_t>&>;
+
 		std::vector<uint8_t> ReadAllContents(const std::string& filename) {
 			RawFile outputFile(filename, OpenMode::Read_Only);
 			std::vector<uint8_t> buffer(outputFile.size());
 			outputFile.read(buffer);
 			return buffer;
 		}
+
+		std::unique_ptr<RawFile> TryOpenSegment(const std::filesystem::path& segmentPath, uint64_t index) {
+			if (!std::filesystem::exists(segmentPath))
+				return nullptr;
+
+			auto pSegmentFile = std::make_unique<RawFile>(segmentPath.generic_string(), OpenMode::Read_Only, LockMode::None);
+			auto firstIndex = Read64(*pSegmentFile);
+
+			// message is not in segment when segment was (re)initialized after it was written
+			return firstIndex <= index ? std::move(pSegmentFile) : nullptr;
+		}
+
+		std::vector<uint64_t> ReadSlotOffsets(RawFile& segmentFile, const std::filesystem::path& segmentPath, uint64_t slot, size_t count) {
+			std::vector<uint64_t> offsets(count + 1);
+			segmentFile.seek(GetSlotOffsetPosition(slot));
+			segmentFile.read({ reinterpret_cast<uint8_t*>(offsets.data()), offsets.size() * sizeof(uint64_t) });
+
+			auto previousOffset = Segment_Header_Size;
+			for (auto offset : offsets) {
+				if (offset < previousOffset || offset > segmentFile.size())
+					CATAPULT_THROW_RUNTIME_ERROR_1("reading from file queue failed due to corrupt segment file", segmentPath);
+
+				previousOffset = offset;
+			}
+
+			return offsets;
+		}
+
+		// reader index is only advanced in memory while messages are consumed and is persisted once per batch;
+		// consumed message files and segments are removed afterwards so that a persisted index never references them
+		class ConsumedMessagesCommitter {
+		public:
+			ConsumedMessagesCommitter(const std::filesystem::path& directory, IndexFile& readerIndexFile)
+					: m_directory(directory)
+					, m_readerIndexFile(readerIndexFile)
+					, m_persistedReaderIndexValue(m_readerIndexFile.get())
+					, m_readerIndexValue(m_persistedReaderIndexValue)
+			{}
+
+		public:
+			uint64_t readerIndexValue() const {
+				return m_readerIndexValue;
+			}
+
+		public:
+			void consumeMessage() {
+				++m_readerIndexValue;
+			}
+
+			void consumeMessageFile(const std::filesystem::path& messageFilename) {
+				consumeMessage();
+				m_consumedMessageFilenames.push_back(messageFilename);
+			}
+
+			void consumeSegment(uint64_t segmentBaseIndex) {
+				m_consumedSegmentBaseIndexes.push_back(segmentBaseIndex);
+			}
+
+			void commit() {
+				if (m_persistedReaderIndexValue != m_readerIndexValue) {
+					m_readerIndexFile.set(m_readerIndexValue);
+					m_persistedReaderIndexValue = m_readerIndexValue;
+				}
+
+				for (const auto& messageFilename : m_consumedMessageFilenames)
+					std::filesystem::remove(messageFilename);
+
+				for (auto segmentBaseIndex : m_consumedSegmentBaseIndexes)
+					RecycleSegment(m_directory, segmentBaseIndex);
+
+				m_consumedMessageFilenames.clear();
+				m_consumedSegmentBaseIndexes.clear();
+			}
+
+		private:
+			const std::filesystem::path& m_directory;
+			IndexFile& m_readerIndexFile;
+			uint64_t m_persistedReaderIndexValue;
+			uint64_t m_readerIndexValue;
+			std::vector<std::filesystem::path> m_consumedMessageFilenames;
+			std::vector<uint64_t> m_consumedSegmentBaseIndexes;
+		};
+
+		size_t ProcessMessages(
+				const std::filesystem::path& directory,
+				uint64_t writerIndexValue,
+				size_t maxMessages,
+				const MessageConsumer* pConsumer,
+				ConsumedMessagesCommitter& committer) {
+			size_t numProcessed = 0;
+			while (numProcessed < maxMessages && committer.readerIndexValue() < writerIndexValue) {
+				auto readerIndexValue = committer.readerIndexValue();
+				auto slot = GetSegmentSlot(readerIndexValue);
+				auto segmentBaseIndex = readerIndexValue - slot;
+				auto segmentPath = directory / GetFilename(segmentBaseIndex, Segment_Extension);
+				auto pSegmentFile = TryOpenSegment(segmentPath, readerIndexValue);
+				if (!pSegmentFile) {
+					// fall back to message file written with File_Per_Message layout
+					auto nextMessageFilename = directory / GetFilename(readerIndexValue);
+					if (!std::filesystem::exists(nextMessageFilename))
+						CATAPULT_THROW_RUNTIME_ERROR_1("reading from file queue failed due to missing message file", nextMessageFilename);
+
+					if (pConsumer)
+						(*pConsumer)(ReadAllContents(nextMessageFilename.generic_string()));
+
+					committer.consumeMessageFile(nextMessageFilename);
+					++numProcessed;
+					continue;
+				}
+
+				// process all requested messages stored in the segment using as few reads as possible
+				auto numSegmentMessages = static_cast<size_t>(std::min<uint64_t>({
+					maxMessages - numProcessed,
+					writerIndexValue - readerIndexValue,
+					Messages_Per_Segment - slot
+				}));
+				auto offsets = ReadSlotOffsets(*pSegmentFile, segmentPath, slot, numSegmentMessages);
+
+				for (auto chunkStart = 0u; chunkStart < numSegmentMessages;) {
+					auto chunkEnd = chunkStart + 1;
+					while (chunkEnd < numSegmentMessages && offsets[chunkEnd + 1] - offsets[chunkStart] <= Max_Read_Chunk_Size)
+						++chunkEnd;
+
+					std::vector<uint8_t> chunk;
+					if (pConsumer) {
+						chunk.resize(offsets[chunkEnd] - offsets[chunkStart]);
+						pSegmentFile->seek(offsets[chunkStart]);
+						pSegmentFile->read(chunk);
+					}
+
+					for (auto i = chunkStart; i < chunkEnd; ++i) {
+						if (pConsumer) {
+							auto chunkIter = chunk.cbegin() + static_cast<std::ptrdiff_t>(offsets[i] - offsets[chunkStart]);
+							auto messageSize = static_cast<std::ptrdiff_t>(offsets[i + 1] - offsets[i]);
+							(*pConsumer)(std::vector<uint8_t>(chunkIter, chunkIter + messageSize));
+						}
+
+						committer.consumeMessage();
+						++numProcessed;
+					}
+
+					chunkStart = chunkEnd;
+				}
+
+				// segment is recycled after its last message is consumed
+				if (0 == GetSegmentSlot(committer.readerIndexValue()))
+					committer.consumeSegment(segmentBaseIndex);
+			}
+
+			return numProcessed;
+		}
 	}
 
 	FileQueueReader::FileQueueReader(const std::string& directory) : FileQueueReader(directory, "index_reader.dat", "index.dat")
@@ -112,31 +403,33 @@ namespace catapult { namespace io {
 	}
 
 	bool FileQueueReader::tryReadNextMessage(const consumer<const std::vector<uint8_t>&>& consumer) {
-		return process([consumer](const auto& nextMessageFilename) {
-			auto buffer = ReadAllContents(nextMessageFilename);
-			consumer(buffer);
-		});
+		return 1 == process(1, &consumer);
 	}
 
-	void FileQueueReader::skip(uint32_t count) {
-		for (auto i = 0u; i < count; ++i)
-			process([](const auto&) {});
+	size_t FileQueueReader::tryReadNextMessages(size_t maxMessages, const consumer<const std::vector<uint8_t>&>& consumer) {
+		return process(maxMessages, &consumer);
 	}
 
-	bool FileQueueReader::process(const consumer<const std::string&>& processFilename) {
-		auto readerIndexValue = m_readerIndexFile.get();
-		if (!m_writerIndexFile.exists() || readerIndexValue >= m_writerIndexFile.get())
-			return false;
+	void FileQueueReader::skip(uint32_t count) {
+		process(count, nullptr);
+	}
 
-		auto nextMessageFilename = m_directory / GetFilename(readerIndexValue);
-		if (!std::filesystem::exists(nextMessageFilename))
-			CATAPULT_THROW_RUNTIME_ERROR_1("reading from file queue failed due to missing message file", nextMessageFilename);
+	size_t FileQueueReader::process(size_t maxMessages, const consumer<const std::vector<uint8_t>&>* pConsumer) {
+		if (!m_writerIndexFile.exists())
+			return 0;
 
-		processFilename(nextMessageFilename.generic_string());
+		ConsumedMessagesCommitter committer(m_directory, m_readerIndexFile);
+		size_t numProcessed = 0;
+		try {
+			numProcessed = ProcessMessages(m_directory, m_writerIndexFile.get(), maxMessages, pConsumer, committer);
+		} catch (...) {
+			// persist progress of all messages consumed before the failure
+			committer.commit();
+			throw;
+		}
 
-		m_readerIndexFile.increment();
-		std::filesystem::remove(nextMessageFilename);
-		return true;
+		committer.commit();
+		return numProcessed;
 	}
 
 	// endregion
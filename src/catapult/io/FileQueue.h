@@ -22,13 +22,23 @@
 #pragma once
 #include "BufferedFileStream.h"
 #include "IndexFile.h"
+#include "catapult/utils/FileSize.h"
 #include "catapult/functions.h"
 #include <filesystem>
 
 namespace catapult { namespace io {
 
-	/// File based queue writer where each message is represented by a file (with incrementing names) in a directory.
-	/// \note Each call to flush will additionally create a new file.
+	/// Storage layouts of file based queue messages.
+	enum class FileQueueLayout {
+		/// Each message is represented by a file (with incrementing names) in a directory.
+		File_Per_Message,
+
+		/// Messages are appended to preallocated segment files that each hold a fixed number of consecutive messages.
+		Segmented
+	};
+
+	/// File based queue writer where each message is appended to a directory according to a storage layout.
+	/// \note Each call to flush will additionally complete the current message.
 	class FileQueueWriter final : public OutputStream {
 	public:
 		/// Creates a file queue writer around \a directory.
@@ -37,18 +47,43 @@ namespace catapult { namespace io {
 		/// Creates a file queue writer around \a directory containing a (writer) index file (\a indexFilename).
 		FileQueueWriter(const std::string& directory, const std::string& indexFilename);
 
+		/// Creates a file queue writer around \a directory containing a (writer) index file (\a indexFilename)
+		/// that stores messages using \a layout.
+		FileQueueWriter(const std::string& directory, const std::string& indexFilename, FileQueueLayout layout);
+
+		/// Creates a file queue writer around \a directory containing a (writer) index file (\a indexFilename)
+		/// that stores messages using \a layout and preallocates \a segmentSize bytes for each new segment.
+		FileQueueWriter(
+				const std::string& directory,
+				const std::string& indexFilename,
+				FileQueueLayout layout,
+				utils::FileSize segmentSize);
+
 	public:
 		void write(const RawBuffer& buffer) override;
 		void flush() override;
 
+	private:
+		void appendToSegment();
+		void openSegment();
+
 	private:
 		std::filesystem::path m_directory;
 		IndexFile m_indexFile;
 		uint64_t m_indexValue;
+		FileQueueLayout m_layout;
+		utils::FileSize m_segmentSize;
 		std::unique_ptr<BufferedOutputFileStream> m_pOutputStream;
+
+		// segmented layout state
+		bool m_hasPendingMessage;
+		std::vector<uint8_t> m_pendingMessage;
+		std::unique_ptr<RawFile> m_pSegmentFile;
+		uint64_t m_segmentBaseIndex;
+		uint64_t m_segmentDataOffset;
 	};
 
-	/// File based queue reader where each message is represented by a file (with incrementing names) in a directory.
+	/// File based queue reader that consumes messages stored using any file queue layout.
 	class FileQueueReader final {
 	public:
 		/// Creates a file queue reader around \a directory.
@@ -66,11 +101,17 @@ namespace catapult { namespace io {
 		/// Tries to read the next message and forwards it to \a consumer if successful.
 		bool tryReadNextMessage(const consumer<const std::vector<uint8_t>&>& consumer);
 
+		/// Tries to read at most the next \a maxMessages messages and forwards each one to \a consumer.
+		/// Returns the number of messages read.
+		/// \note Reader index is persisted once after all messages are consumed (or a consumer fails)
+		///       and only includes successfully consumed messages.
+		size_t tryReadNextMessages(size_t maxMessages, const consumer<const std::vector<uint8_t>&>& consumer);
+
 		/// Skips at most the next \a count messages.
 		void skip(uint32_t count);
 
 	private:
-		bool process(const consumer<const std::string&>& processFilename);
+		size_t process(size_t maxMessages, const consumer<const std::vector<uint8_t>&>* pConsumer);
 
 	private:
 		std::filesystem::path m_directory;
@@ -0,0 +1,161 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MemoryMappedFile.h"
+#include "catapult/exceptions.h"
+#include <sstream>
+
+#ifdef _MSC_VER
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace catapult { namespace io {
+
+	namespace {
+		[[noreturn]]
+		void ThrowMapError(const char* message, const std::string& filePath) {
+			std::ostringstream out;
+			out << message << " (" << filePath << ")";
+			CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
+		}
+
+#ifdef _MSC_VER
+		class HandleGuard {
+		public:
+			explicit HandleGuard(HANDLE handle) : m_handle(handle)
+			{}
+
+			~HandleGuard() {
+				if (m_handle && INVALID_HANDLE_VALUE != m_handle)
+					::CloseHandle(m_handle);
+			}
+
+		public:
+			HANDLE get() const {
+				return m_handle;
+			}
+
+		private:
+			HANDLE m_handle;
+		};
+
+		const uint8_t* MapFile(const std::string& filePath, size_t& size) {
+			// allow the file to be appended, replaced or deleted while it is mapped
+			auto shareMode = FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE;
+			auto fileHandle = ::CreateFile(filePath.c_str(), GENERIC_READ, shareMode, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			HandleGuard file(fileHandle);
+			if (INVALID_HANDLE_VALUE == file.get())
+				ThrowMapError("couldn't open the file", filePath);
+
+			LARGE_INTEGER fileSize;
+			if (!::GetFileSizeEx(file.get(), &fileSize))
+				ThrowMapError("couldn't determine file size", filePath);
+
+			size = static_cast<size_t>(fileSize.QuadPart);
+			if (0 == size)
+				return nullptr;
+
+			// the view keeps the mapping alive, so both handles can be closed after mapping
+			HandleGuard mapping(::CreateFileMapping(file.get(), nullptr, PAGE_READONLY, 0, 0, nullptr));
+			if (!mapping.get())
+				ThrowMapError("couldn't map the file", filePath);
+
+			auto* pData = ::MapViewOfFile(mapping.get(), FILE_MAP_READ, 0, 0, 0);
+			if (!pData)
+				ThrowMapError("couldn't map the file", filePath);
+
+			return static_cast<const uint8_t*>(pData);
+		}
+
+		void UnmapFile(const uint8_t* pData, size_t) {
+			::UnmapViewOfFile(pData);
+		}
+#else
+		class DescriptorGuard {
+		public:
+			explicit DescriptorGuard(int fd) : m_fd(fd)
+			{}
+
+			~DescriptorGuard() {
+				if (-1 != m_fd)
+					::close(m_fd);
+			}
+
+		public:
+			int get() const {
+				return m_fd;
+			}
+
+		private:
+			int m_fd;
+		};
+
+		const uint8_t* MapFile(const std::string& filePath, size_t& size) {
+			DescriptorGuard fd(::open(filePath.c_str(), O_RDONLY | O_CLOEXEC));
+			if (-1 == fd.get())
+				ThrowMapError("couldn't open the file", filePath);
+
+			struct stat fileStat;
+			if (0 != ::fstat(fd.get(), &fileStat))
+				ThrowMapError("couldn't determine file size", filePath);
+
+			size = static_cast<size_t>(fileStat.st_size);
+			if (0 == size)
+				return nullptr;
+
+			// the mapping holds a reference to the file, so the descriptor can be closed after mapping
+			auto* pData = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd.get(), 0);
+			if (MAP_FAILED == pData)
+				ThrowMapError("couldn't map the file", filePath);
+
+			return static_cast<const uint8_t*>(pData);
+		}
+
+		void UnmapFile(const uint8_t* pData, size_t size) {
+			::munmap(const_cast<uint8_t*>(pData), size);
+		}
+#endif
+	}
+
+	MemoryMappedFile::MemoryMappedFile(const std::string& filePath)
+			: m_pData(nullptr)
+			, m_size(0) {
+		m_pData = MapFile(filePath, m_size);
+	}
+
+	MemoryMappedFile::~MemoryMappedFile() {
+		if (m_pData)
+			UnmapFile(m_pData, m_size);
+	}
+
+	size_t MemoryMappedFile::size() const {
+		return m_size;
+	}
+
+	RawBuffer MemoryMappedFile::buffer() const {
+		return { m_pData, m_size };
+	}
+}}
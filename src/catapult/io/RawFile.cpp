@@ -52,6 +52,8 @@ namespace catapult { namespace io {
 		constexpr const char* Error_Seek = "couldn't seek in file";
 		constexpr const char* Error_Seek_Outside = "couldn't seek past end of file";
 		constexpr const char* Error_Truncate = "couldn't truncate file";
+		constexpr const char* Error_Sync = "couldn't sync file";
+		constexpr const char* Error_Reserve = "couldn't reserve space for file";
 		constexpr const char* Error_Desc = "invalid file descriptor";
 		constexpr const char* Error_Close = "couldn't close the file";
 
@@ -100,6 +102,7 @@ namespace catapult { namespace io {
 		constexpr auto read = ::_read;
 		constexpr auto lseek = ::_lseeki64;
 		constexpr auto ftruncate = _chsize_s;
+		constexpr auto fsync = ::_commit;
 		constexpr auto fstat = ::_fstati64;
 		using StatStruct = struct ::_stat64;
 
@@ -224,6 +227,26 @@ namespace catapult { namespace io {
 			return -1 == ftruncate(fd, offset) ? MakeFailureResult(false) : MakeSuccessResult(true);
 		}
 
+		FileOperationResult<bool> nemSync(int fd) {
+			return -1 == fsync(fd) ? MakeFailureResult(false) : MakeSuccessResult(true);
+		}
+
+		FileOperationResult<bool> nemReserve(int fd, int64_t size) {
+#ifdef __linux__
+			// allocate blocks up front, but fall back to extending the file when the filesystem does not support it
+			auto result = ::posix_fallocate(fd, 0, size);
+			if (0 == result)
+				return MakeSuccessResult(true);
+
+			if (EOPNOTSUPP != result && EINVAL != result) {
+				errno = result;
+				return MakeFailureResult(false);
+			}
+#endif
+
+			return nemTruncate(fd, size);
+		}
+
 		FileOperationResult<bool> nemFileSize(int fd, uint64_t& fileSize) {
 			StatStruct st;
 			fileSize = 0;
@@ -359,5 +382,20 @@ namespace catapult { namespace io {
 		m_fileSize = m_position;
 	}
 
+	void RawFile::reserve(uint64_t size) {
+		if (size <= m_fileSize)
+			return;
+
+		auto reserveResult = nemReserve(m_fd.raw(), static_cast<int64_t>(size));
+		CATAPULT_CHECK_FILE_OPERATION_RESULT(Error_Reserve, reserveResult);
+
+		m_fileSize = size;
+	}
+
+	void RawFile::sync() {
+		auto syncResult = nemSync(m_fd.raw());
+		CATAPULT_CHECK_FILE_OPERATION_RESULT(Error_Sync, syncResult);
+	}
+
 	// endregion
 }}
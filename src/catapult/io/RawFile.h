@@ -82,6 +82,15 @@ namespace catapult { namespace io {
 		/// Truncates the file at its current position.
 		void truncate();
 
+		/// Extends the file to \a size bytes and, where supported, allocates storage for all of them
+		/// so that subsequent writes within the file cannot run out of space.
+		/// \note Position is unchanged and files that are already at least \a size bytes are not changed.
+		void reserve(uint64_t size);
+
+		/// Flushes all written data to the underlying storage device.
+		/// Throws catapult_file_io_error exception if flush has failed.
+		void sync();
+
 	private:
 		class FileDescriptorHolder final {
 		public:
@@ -20,6 +20,7 @@
 **/
 
 #include "BufferedPacketIo.h"
+#include "BatchPacketWriter.h"
 #include "PacketIo.h"
 #include "catapult/utils/Logging.h"
 #include <deque>
@@ -37,6 +38,10 @@ namespace catapult { namespace ionet {
 			{}
 
 		public:
+			const PacketPayload& payload() const {
+				return m_payload;
+			}
+
 			template<typename TCallback>
 			void invoke(TCallback callback) {
 				m_io.write(m_payload, callback);
@@ -130,18 +135,107 @@ namespace catapult { namespace ionet {
 
 		// endregion
 
+		// region CoalescingWriteQueue
+
+		// write queue that coalesces all pending writes into gathered writes
+		template<typename TCallbackWrapper>
+		class CoalescingWriteQueue {
+		public:
+			CoalescingWriteQueue(TCallbackWrapper& wrapper, const std::shared_ptr<BatchPacketWriter>& pWriter, uint32_t maxWriteSize)
+					: m_wrapper(wrapper)
+					, m_pWriter(pWriter)
+					, m_maxWriteSize(maxWriteSize)
+					, m_isWriteInProgress(false)
+					, m_numUncoalescedWrites(0)
+			{}
+
+		public:
+			void push(const WriteRequest& request, const PacketIo::WriteCallback& callback) {
+				m_requests.emplace_back(request.payload(), callback);
+
+				if (m_isWriteInProgress) {
+					CATAPULT_LOG(trace) << "queuing work because in progress operation detected";
+					return;
+				}
+
+				next();
+			}
+
+		private:
+			void next() {
+				std::vector<PacketPayload> payloads;
+				std::vector<PacketIo::WriteCallback> callbacks;
+
+				uint64_t numBytes = 0;
+				auto maxPayloads = 0 == m_numUncoalescedWrites ? m_requests.size() : 1;
+				while (!m_requests.empty() && payloads.size() < maxPayloads) {
+					numBytes += m_requests.front().first.header().Size;
+					if (!payloads.empty() && numBytes > m_maxWriteSize)
+						break;
+
+					payloads.push_back(std::move(m_requests.front().first));
+					callbacks.push_back(std::move(m_requests.front().second));
+					m_requests.pop_front();
+				}
+
+				if (0 != m_numUncoalescedWrites)
+					--m_numUncoalescedWrites;
+
+				m_isWriteInProgress = true;
+				m_pWriter->writeMultiple(payloads, m_wrapper.wrap([this, payloads, callbacks](auto code) {
+					m_isWriteInProgress = false;
+					complete(code, payloads, callbacks);
+
+					// if requests are pending, start the next one
+					if (!m_requests.empty())
+						next();
+				}));
+			}
+
+			void complete(
+					SocketOperationCode code,
+					const std::vector<PacketPayload>& payloads,
+					const std::vector<PacketIo::WriteCallback>& callbacks) {
+				if (SocketOperationCode::Malformed_Data == code && payloads.size() > 1) {
+					// nothing was written, so requeue the coalesced writes and retry them individually
+					// in order to only fail the malformed one(s)
+					CATAPULT_LOG(debug) << "retrying " << payloads.size() << " coalesced writes individually";
+					for (auto i = payloads.size(); i > 0; --i)
+						m_requests.emplace_front(payloads[i - 1], callbacks[i - 1]);
+
+					m_numUncoalescedWrites = payloads.size();
+					return;
+				}
+
+				for (const auto& callback : callbacks)
+					callback(code);
+			}
+
+		private:
+			TCallbackWrapper& m_wrapper;
+			std::shared_ptr<BatchPacketWriter> m_pWriter;
+			uint32_t m_maxWriteSize;
+			bool m_isWriteInProgress;
+			size_t m_numUncoalescedWrites;
+			std::deque<std::pair<PacketPayload, PacketIo::WriteCallback>> m_requests;
+		};
+
+		// endregion
+
 		// region QueuedOperation
 
-		// protects RequestQueue via a strand
-		template<typename TRequest, typename TCallback>
+		// protects a request queue via a strand
+		template<typename TRequestQueue>
 		class QueuedOperation {
 		public:
-			explicit QueuedOperation(boost::asio::io_context::strand& strand)
+			template<typename... TArgs>
+			explicit QueuedOperation(boost::asio::io_context::strand& strand, TArgs&&... requestQueueArgs)
 					: m_strand(strand)
-					, m_requests(m_strand)
+					, m_requests(m_strand, std::forward<TArgs>(requestQueueArgs)...)
 			{}
 
 		public:
+			template<typename TRequest, typename TCallback>
 			void push(const TRequest& request, const TCallback& callback) {
 				boost::asio::post(m_strand, [this, request, callback] {
 					m_requests.push(request, callback);
@@ -150,38 +244,42 @@ namespace catapult { namespace ionet {
 
 		private:
 			boost::asio::io_context::strand& m_strand;
-			RequestQueue<TRequest, TCallback, boost::asio::io_context::strand> m_requests;
+			TRequestQueue m_requests;
 		};
 
-		using QueuedWriteOperation = QueuedOperation<WriteRequest, PacketIo::WriteCallback>;
-		using QueuedReadOperation = QueuedOperation<ReadRequest, PacketIo::ReadCallback>;
+		using Strand = boost::asio::io_context::strand;
+		using QueuedWriteOperation = QueuedOperation<RequestQueue<WriteRequest, PacketIo::WriteCallback, Strand>>;
+		using QueuedCoalescingWriteOperation = QueuedOperation<CoalescingWriteQueue<Strand>>;
+		using QueuedReadOperation = QueuedOperation<RequestQueue<ReadRequest, PacketIo::ReadCallback, Strand>>;
 
 		// endregion
 
 		// region BufferedPacketIo
 
+		template<typename TQueuedWriteOperation>
 		class BufferedPacketIo
 				: public PacketIo
-				, public std::enable_shared_from_this<BufferedPacketIo> {
+				, public std::enable_shared_from_this<BufferedPacketIo<TQueuedWriteOperation>> {
 		public:
-			BufferedPacketIo(const std::shared_ptr<PacketIo>& pIo, boost::asio::io_context::strand& strand)
+			template<typename... TArgs>
+			BufferedPacketIo(const std::shared_ptr<PacketIo>& pIo, boost::asio::io_context::strand& strand, TArgs&&... writeQueueArgs)
 					: m_pIo(pIo)
 					, m_strand(strand)
-					, m_pWriteOperation(std::make_unique<QueuedWriteOperation>(m_strand))
+					, m_pWriteOperation(std::make_unique<TQueuedWriteOperation>(m_strand, std::forward<TArgs>(writeQueueArgs)...))
 					, m_pReadOperation(std::make_unique<QueuedReadOperation>(m_strand))
 			{}
 
 		public:
 			void write(const PacketPayload& payload, const WriteCallback& callback) override {
 				auto request = WriteRequest(*m_pIo, payload);
-				m_pWriteOperation->push(request, [pThis = shared_from_this(), callback](auto code) {
+				m_pWriteOperation->push(request, [pThis = this->shared_from_this(), callback](auto code) {
 					callback(code);
 				});
 			}
 
 			void read(const ReadCallback& callback) override {
 				auto request = ReadRequest(*m_pIo);
-				m_pReadOperation->push(request, [pThis = shared_from_this(), callback](auto code, const auto* pPacket) {
+				m_pReadOperation->push(request, [pThis = this->shared_from_this(), callback](auto code, const auto* pPacket) {
 					callback(code, pPacket);
 				});
 			}
@@ -189,7 +287,7 @@ namespace catapult { namespace ionet {
 		private:
 			std::shared_ptr<PacketIo> m_pIo;
 			boost::asio::io_context::strand& m_strand;
-			std::unique_ptr<QueuedWriteOperation> m_pWriteOperation;
+			std::unique_ptr<TQueuedWriteOperation> m_pWriteOperation;
 			std::unique_ptr<QueuedReadOperation> m_pReadOperation;
 		};
 
@@ -197,6 +295,14 @@ namespace catapult { namespace ionet {
 	}
 
 	std::shared_ptr<PacketIo> CreateBufferedPacketIo(const std::shared_ptr<PacketIo>& pIo, boost::asio::io_context::strand& strand) {
-		return std::make_shared<BufferedPacketIo>(pIo, strand);
+		return std::make_shared<BufferedPacketIo<QueuedWriteOperation>>(pIo, strand);
+	}
+
+	std::shared_ptr<PacketIo> CreateBufferedPacketIo(
+			const std::shared_ptr<PacketIo>& pIo,
+			const std::shared_ptr<BatchPacketWriter>& pWriter,
+			boost::asio::io_context::strand& strand,
+			uint32_t maxCoalescedWriteSize) {
+		return std::make_shared<BufferedPacketIo<QueuedCoalescingWriteOperation>>(pIo, strand, pWriter, maxCoalescedWriteSize);
 	}
 }}
@@ -22,10 +22,24 @@
 #pragma once
 #include "IoTypes.h"
 
-namespace catapult { namespace ionet { class PacketIo; } }
+namespace catapult {
+	namespace ionet {
+		class BatchPacketWriter;
+		class PacketIo;
+	}
+}
 
 namespace catapult { namespace ionet {
 
 	/// Adds buffering to \a pIo using \a strand for synchronization.
 	std::shared_ptr<PacketIo> CreateBufferedPacketIo(const std::shared_ptr<PacketIo>& pIo, boost::asio::io_context::strand& strand);
+
+	/// Adds buffering to \a pIo using \a strand for synchronization.
+	/// All queued writes are coalesced into gathered writes of at most \a maxCoalescedWriteSize bytes that are issued via \a pWriter.
+	/// \note A single write larger than \a maxCoalescedWriteSize is never split.
+	std::shared_ptr<PacketIo> CreateBufferedPacketIo(
+			const std::shared_ptr<PacketIo>& pIo,
+			const std::shared_ptr<BatchPacketWriter>& pWriter,
+			boost::asio::io_context::strand& strand,
+			uint32_t maxCoalescedWriteSize);
 }}
@@ -20,6 +20,7 @@
 **/
 
 #include "PacketSocket.h"
+#include "BatchPacketWriter.h"
 #include "BufferedPacketIo.h"
 #include "Node.h"
 #include "WorkingBuffer.h"
@@ -158,6 +159,65 @@ namespace catapult { namespace ionet {
 
 		// region BasicPacketSocket(Writer)
 
+		// gathers payloads into a single buffer sequence that can be written with one async_write
+		// \note asio ssl streams encrypt at most one buffer of a sequence per record, so runs of small buffers (including all
+		//       packet headers) are copied into a contiguous staging area to avoid emitting a separate tls record for each of them
+		class GatheredWriteBuffers {
+		private:
+			static constexpr size_t Max_Staged_Buffer_Size = 4 * 1024;
+
+			struct Segment {
+				const uint8_t* pData; // nullptr when segment is staged
+				size_t StagingOffset;
+				size_t Size;
+			};
+
+		public:
+			explicit GatheredWriteBuffers(const std::vector<PacketPayload>& payloads) {
+				for (const auto& payload : payloads) {
+					const auto& header = payload.header();
+					append(reinterpret_cast<const uint8_t*>(&header), sizeof(PacketHeader));
+
+					for (const auto& buffer : payload.buffers())
+						append(buffer.pData, buffer.Size);
+				}
+
+				// staging area is complete, so segments can be converted into buffers that point into it
+				m_buffers.reserve(m_segments.size());
+				for (const auto& segment : m_segments) {
+					const auto* pSegmentData = segment.pData ? segment.pData : m_staging.data() + segment.StagingOffset;
+					m_buffers.emplace_back(pSegmentData, segment.Size);
+				}
+			}
+
+		public:
+			const std::vector<boost::asio::const_buffer>& buffers() const {
+				return m_buffers;
+			}
+
+		private:
+			void append(const uint8_t* pData, size_t size) {
+				if (0 == size)
+					return;
+
+				if (size > Max_Staged_Buffer_Size) {
+					m_segments.push_back({ pData, 0, size });
+					return;
+				}
+
+				if (m_segments.empty() || m_segments.back().pData)
+					m_segments.push_back({ nullptr, m_staging.size(), 0 });
+
+				m_segments.back().Size += size;
+				m_staging.insert(m_staging.end(), pData, pData + size);
+			}
+
+		private:
+			std::vector<Segment> m_segments;
+			std::vector<uint8_t> m_staging;
+			std::vector<boost::asio::const_buffer> m_buffers;
+		};
+
 		template<typename TSocketCallbackWrapper>
 		class BasicPacketSocketWriter {
 		public:
@@ -169,64 +229,38 @@ namespace catapult { namespace ionet {
 
 		public:
 			void write(const PacketPayload& payload, const PacketSocket::WriteCallback& callback) {
-				if (!IsPacketDataSizeValid(payload.header(), m_maxPacketDataSize)) {
-					CATAPULT_LOG(warning) << "bypassing write of malformed " << payload.header();
-					callback(SocketOperationCode::Malformed_Data);
-					return;
+				writeMultiple({ payload }, callback);
+			}
+
+			void writeMultiple(const std::vector<PacketPayload>& payloads, const PacketSocket::WriteCallback& callback) {
+				for (const auto& payload : payloads) {
+					if (!IsPacketDataSizeValid(payload.header(), m_maxPacketDataSize)) {
+						CATAPULT_LOG(warning) << "bypassing write of malformed " << payload.header();
+						callback(SocketOperationCode::Malformed_Data);
+						return;
+					}
 				}
 
-				auto pContext = std::make_shared<WriteContext>(payload, callback);
-				boost::asio::async_write(m_socket, pContext->headerBuffer(), m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
+				// payloads need to be captured because they own the (unstaged) data referenced by the gathered buffers
+				auto pContext = std::make_shared<WriteContext>(payloads);
+				boost::asio::async_write(m_socket, pContext->Buffers.buffers(), m_wrapper.wrap([pContext, callback](const auto& ec, auto) {
+					callback(mapWriteErrorCodeToSocketOperationCode(ec));
 				}));
 			}
 
 		private:
 			struct WriteContext {
 			public:
-				WriteContext(const PacketPayload& payload, const PacketSocket::WriteCallback& callback)
-						: m_payload(payload)
-						, m_callback(callback)
-						, m_nextBufferIndex(0)
+				explicit WriteContext(const std::vector<PacketPayload>& payloads)
+						: Payloads(payloads)
+						, Buffers(Payloads)
 				{}
 
 			public:
-				auto headerBuffer() const {
-					const auto& header = m_payload.header();
-					return boost::asio::buffer(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
-				}
-
-				auto nextDataBuffer() {
-					auto rawBuffer = m_payload.buffers()[m_nextBufferIndex++];
-					return boost::asio::buffer(rawBuffer.pData, rawBuffer.Size);
-				}
-
-				bool tryComplete(const boost::system::error_code& ec) {
-					auto lastCode = mapWriteErrorCodeToSocketOperationCode(ec);
-					if (SocketOperationCode::Success != lastCode || m_nextBufferIndex >= m_payload.buffers().size()) {
-						m_callback(lastCode);
-						return true;
-					}
-
-					return false;
-				}
-
-			private:
-				const PacketPayload m_payload;
-				const PacketSocket::WriteCallback m_callback;
-				size_t m_nextBufferIndex;
+				const std::vector<PacketPayload> Payloads;
+				const GatheredWriteBuffers Buffers;
 			};
 
-			void writeNext(const boost::system::error_code& lastEc, const std::shared_ptr<WriteContext>& pContext) {
-				if (pContext->tryComplete(lastEc))
-					return;
-
-				auto buffer = pContext->nextDataBuffer();
-				boost::asio::async_write(m_socket, buffer, m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
-				}));
-			}
-
 		private:
 			Socket& m_socket;
 			TSocketCallbackWrapper& m_wrapper;
@@ -486,9 +520,13 @@ namespace catapult { namespace ionet {
 			utils::StackTimer m_timer;
 		};
 
+		// maximum number of bytes of queued buffered writes that can be coalesced into a single write
+		constexpr uint32_t Max_Coalesced_Write_Size = 64 * 1024;
+
 		// implements PacketSocket using an explicit strand and ensures deterministic shutdown by using enable_shared_from_this
 		class StrandedPacketSocket final
 				: public PacketSocket
+				, public BatchPacketWriter
 				, public std::enable_shared_from_this<StrandedPacketSocket> {
 		private:
 			using SocketType = BasicPacketSocket<StrandedPacketSocket>;
@@ -519,6 +557,10 @@ namespace catapult { namespace ionet {
 				post([payload, callback](auto& socket) { socket.write(payload, callback); });
 			}
 
+			void writeMultiple(const std::vector<PacketPayload>& payloads, const WriteCallback& callback) override {
+				post([payloads, callback](auto& socket) { socket.writeMultiple(payloads, callback); });
+			}
+
 			void read(const ReadCallback& callback) override {
 				post([callback](auto& socket) { socket.read(callback, false); });
 			}
@@ -548,7 +590,8 @@ namespace catapult { namespace ionet {
 			}
 
 			std::shared_ptr<PacketIo> buffered() override {
-				return CreateBufferedPacketIo(shared_from_this(), strand());
+				auto pThis = shared_from_this();
+				return CreateBufferedPacketIo(pThis, pThis, strand(), Max_Coalesced_Write_Size);
 			}
 
 		public:
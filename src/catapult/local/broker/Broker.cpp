@@ -20,9 +20,11 @@
 **/
 
 #include "Broker.h"
+#include "QueueDrainer.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/extensions/ProcessBootstrapper.h"
 #include "catapult/io/FileQueue.h"
+#include "catapult/io/IndexFile.h"
 #include "catapult/local/HostUtils.h"
 #include "catapult/subscribers/BlockChangeReader.h"
 #include "catapult/subscribers/BrokerMessageReaders.h"
@@ -33,10 +35,13 @@
 #include "catapult/subscribers/UtChangeReader.h"
 #include "catapult/thread/Scheduler.h"
 #include "catapult/utils/StackLogger.h"
+#include <sstream>
 
 namespace catapult { namespace local {
 
 	namespace {
+		constexpr size_t Max_Messages_Per_Batch = 1024;
+
 		class DefaultBroker final : public Broker {
 		public:
 			explicit DefaultBroker(std::unique_ptr<extensions::ProcessBootstrapper>&& pBootstrapper)
@@ -75,40 +80,103 @@ namespace catapult { namespace local {
 				m_pBootstrapper->pool().shutdown();
 			}
 
+		public:
+			const std::vector<utils::DiagnosticCounter>& counters() const override {
+				return m_counters;
+			}
+
 		private:
 			void startIngestion() {
 				using namespace catapult::subscribers;
 
 				auto pServiceGroup = m_pBootstrapper->pool().pushServiceGroup("scheduler");
-				auto pScheduler = pServiceGroup->pushService(thread::CreateScheduler);
-				pScheduler->addTask(createIngestionTask("block_change", *m_pBlockChangeSubscriber, ReadNextBlockChange));
-				pScheduler->addTask(createIngestionTask("unconfirmed_transactions_change", *m_pUtChangeSubscriber, ReadNextUtChange));
-				pScheduler->addTask(createIngestionTask("partial_transactions_change", *m_pPtChangeSubscriber, ReadNextPtChange));
-				pScheduler->addTask(createIngestionTask("finalization", *m_pFinalizationSubscriber, ReadNextFinalization));
-				pScheduler->addTask(createIngestionTask("state_change", *m_pStateChangeSubscriber, [&catapultCache = m_catapultCache](
+				auto pDrainer = pServiceGroup->pushService(CreateQueueDrainer);
+				addQueue(*pDrainer, "block_change", "BLOCK LAG", *m_pBlockChangeSubscriber, ReadNextBlockChange);
+				addQueue(*pDrainer, "unconfirmed_transactions_change", "UT LAG", *m_pUtChangeSubscriber, ReadNextUtChange);
+				addQueue(*pDrainer, "partial_transactions_change", "PT LAG", *m_pPtChangeSubscriber, ReadNextPtChange);
+				addQueue(*pDrainer, "finalization", "FIN LAG", *m_pFinalizationSubscriber, ReadNextFinalization);
+				addQueue(*pDrainer, "state_change", "STATE LAG", *m_pStateChangeSubscriber, [&catapultCache = m_catapultCache](
 						auto& inputStream,
 						auto& subscriber) {
 					return ReadNextStateChange(inputStream, catapultCache.changesStorages(), subscriber);
-				}));
-				pScheduler->addTask(createIngestionTask("transaction_status", *m_pTransactionStatusSubscriber, ReadNextTransactionStatus));
+				});
+				addQueue(*pDrainer, "transaction_status", "TX STATUS LAG", *m_pTransactionStatusSubscriber, ReadNextTransactionStatus);
+				pDrainer->start();
+
+				// polling is only a safety net when writes are signaled by file change notifications
+				auto pScheduler = pServiceGroup->pushService(thread::CreateScheduler);
+				pScheduler->addTask(createDrainTask(pDrainer));
 			}
 
 			template<typename TSubscriber, typename TMessageReader>
-			thread::Task createIngestionTask(const std::string& queueName, TSubscriber& subscriber, TMessageReader readNextMessage) {
+			void addQueue(
+					QueueDrainer& drainer,
+					const std::string& queueName,
+					const std::string& counterName,
+					TSubscriber& subscriber,
+					TMessageReader readNextMessage) {
+				// queue directory must exist before it can be watched
+				auto queueDirectory = m_dataDirectory.spoolDir(queueName);
+				queueDirectory.create();
+
+				auto queuePath = queueDirectory.str();
+				drainer.addQueue(queuePath, "index.dat", [&subscriber, readNextMessage, queuePath]() {
+					io::FileQueueReader reader(queuePath, "index_broker_r.dat", "index.dat");
+					return Max_Messages_Per_Batch == subscribers::ReadBatch(reader, Max_Messages_Per_Batch, subscriber, readNextMessage);
+				});
+
+				m_counters.emplace_back(utils::DiagnosticCounterId(counterName), [queueDirectory]() {
+					return CalculateQueueLag(queueDirectory);
+				});
+			}
+
+			thread::Task createDrainTask(const std::shared_ptr<QueueDrainer>& pDrainer) {
+				auto nextDelay = pDrainer->isChangeNotificationSupported()
+						? utils::TimeSpan::FromSeconds(5)
+						: utils::TimeSpan::FromMilliseconds(500);
+
 				thread::Task task;
 				task.StartDelay = utils::TimeSpan::FromMilliseconds(100);
-				task.NextDelay = thread::CreateUniformDelayGenerator(utils::TimeSpan::FromMilliseconds(500));
-				task.Name = queueName;
-
-				auto queuePath = m_dataDirectory.spoolDir(queueName).str();
-				task.Callback = [&subscriber, readNextMessage, queuePath]() {
-					subscribers::ReadAll({ queuePath, "index_broker_r.dat", "index.dat" }, subscriber, readNextMessage);
+				task.NextDelay = thread::CreateUniformDelayGenerator(nextDelay);
+				task.Name = "drain queues";
+				task.Callback = [pDrainerWeak = std::weak_ptr<QueueDrainer>(pDrainer), counters = m_counters]() {
+					auto pDrainerShared = pDrainerWeak.lock();
+					if (!pDrainerShared)
+						return thread::make_ready_future(thread::TaskResult::Break);
+
+					// log lag before draining so that messages missed by change notifications are visible
+					LogQueueLags(counters);
+					pDrainerShared->drainAll();
 					return thread::make_ready_future(thread::TaskResult::Continue);
 				};
 
 				return task;
 			}
 
+			static void LogQueueLags(const std::vector<utils::DiagnosticCounter>& counters) {
+				std::ostringstream table;
+				table << "--- broker queue lag ---";
+
+				auto hasLag = false;
+				for (const auto& counter : counters) {
+					auto value = counter.value();
+					hasLag = hasLag || 0 != value;
+
+					table.width(utils::DiagnosticCounterId::Max_Counter_Name_Size);
+					table << std::endl << counter.id().name() << " : " << value;
+				}
+
+				CATAPULT_LOG_LEVEL(hasLag ? utils::LogLevel::info : utils::LogLevel::debug) << table.str();
+			}
+
+			static uint64_t CalculateQueueLag(const config::CatapultDirectory& queueDirectory) {
+				io::IndexFile writerIndexFile(queueDirectory.file("index.dat"), io::LockMode::None);
+				io::IndexFile readerIndexFile(queueDirectory.file("index_broker_r.dat"), io::LockMode::None);
+				auto writerIndex = writerIndexFile.exists() ? writerIndexFile.get() : 0;
+				auto readerIndex = readerIndexFile.exists() ? readerIndexFile.get() : 0;
+				return writerIndex > readerIndex ? writerIndex - readerIndex : 0;
+			}
+
 		private:
 			// make sure modules are unloaded last
 			std::vector<plugins::PluginModule> m_pluginModules;
@@ -126,6 +194,7 @@ namespace catapult { namespace local {
 			std::unique_ptr<subscribers::TransactionStatusSubscriber> m_pTransactionStatusSubscriber;
 
 			plugins::PluginManager& m_pluginManager;
+			std::vector<utils::DiagnosticCounter> m_counters;
 		};
 	}
 
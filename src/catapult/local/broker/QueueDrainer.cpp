@@ -0,0 +1,252 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "QueueDrainer.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/utils/Logging.h"
+#include <boost/asio.hpp>
+#include <array>
+#include <atomic>
+#include <unordered_map>
+#include <vector>
+
+#ifdef __linux__
+#include <boost/asio/posix/stream_descriptor.hpp>
+#include <sys/inotify.h>
+#endif
+
+namespace catapult { namespace local {
+
+	namespace {
+		// region QueueState
+
+		// drain requests are coalesced so that at most one drain of a queue is active at any time
+		class QueueState {
+		public:
+			QueueState(const std::string& directory, const std::string& indexFilename, const predicate<>& drainBatch)
+					: m_directory(directory)
+					, m_indexFilename(indexFilename)
+					, m_drainBatch(drainBatch)
+					, m_isDraining(false)
+					, m_isDirty(false)
+			{}
+
+		public:
+			const std::string& directory() const {
+				return m_directory;
+			}
+
+			const std::string& indexFilename() const {
+				return m_indexFilename;
+			}
+
+		public:
+			// marks the queue as changed and returns \c true if the caller should schedule a drain.
+			bool tryStartDrain() {
+				m_isDirty = true;
+				return !m_isDraining.exchange(true);
+			}
+
+			// drains a single batch and returns \c true if the caller should schedule another drain.
+			bool drainBatch() {
+				m_isDirty = false;
+				if (m_drainBatch())
+					return true;
+
+				m_isDraining = false;
+
+				// a change raised while the last batch was being drained might not have been observed
+				return m_isDirty && !m_isDraining.exchange(true);
+			}
+
+		private:
+			std::string m_directory;
+			std::string m_indexFilename;
+			predicate<> m_drainBatch;
+			std::atomic_bool m_isDraining;
+			std::atomic_bool m_isDirty;
+		};
+
+		// endregion
+
+		// region DefaultQueueDrainer
+
+		class DefaultQueueDrainer
+				: public QueueDrainer
+				, public std::enable_shared_from_this<DefaultQueueDrainer> {
+		public:
+			explicit DefaultQueueDrainer(thread::IoThreadPool& pool)
+					: m_ioContext(pool.ioContext())
+					, m_strand(m_ioContext)
+					, m_isStopped(false)
+#ifdef __linux__
+					, m_descriptor(m_ioContext)
+#endif
+			{
+#ifdef __linux__
+				auto fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+				if (-1 == fd) {
+					CATAPULT_LOG(warning) << "queue change notifications are not available, queues will only be polled";
+					return;
+				}
+
+				m_descriptor.assign(fd);
+#endif
+			}
+
+		public:
+			bool isChangeNotificationSupported() const override {
+#ifdef __linux__
+				return m_descriptor.is_open();
+#else
+				return false;
+#endif
+			}
+
+		public:
+			void addQueue(const std::string& directory, const std::string& indexFilename, const predicate<>& drainBatch) override {
+				m_queues.push_back(std::make_unique<QueueState>(directory, indexFilename, drainBatch));
+
+#ifdef __linux__
+				if (!isChangeNotificationSupported())
+					return;
+
+				// index files are rewritten (open, write, close) by writers, so close-write events are sufficient
+				auto watchDescriptor = inotify_add_watch(m_descriptor.native_handle(), directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+				if (-1 == watchDescriptor) {
+					CATAPULT_LOG(warning) << "unable to watch queue directory " << directory << ", it will only be polled";
+					return;
+				}
+
+				m_watchedQueues[watchDescriptor].push_back(m_queues.back().get());
+#endif
+			}
+
+			void start() override {
+#ifdef __linux__
+				if (isChangeNotificationSupported())
+					boost::asio::post(m_strand, [pThis = shared_from_this()]() { pThis->readEvents(); });
+#endif
+
+				drainAll();
+			}
+
+			void drainAll() override {
+				for (const auto& pQueue : m_queues)
+					trigger(*pQueue);
+			}
+
+			void shutdown() override {
+				if (m_isStopped.exchange(true))
+					return;
+
+#ifdef __linux__
+				// close on strand because pending reads are initiated on strand
+				boost::asio::post(m_strand, [pThis = shared_from_this()]() {
+					boost::system::error_code ignoredEc;
+					pThis->m_descriptor.close(ignoredEc);
+				});
+#endif
+			}
+
+		private:
+			void trigger(QueueState& queue) {
+				if (m_isStopped || !queue.tryStartDrain())
+					return;
+
+				postDrain(queue);
+			}
+
+			void postDrain(QueueState& queue) {
+				// drain each batch in a separate handler so that a busy queue does not starve other queues
+				boost::asio::post(m_ioContext, [pThis = shared_from_this(), &queue]() {
+					if (pThis->m_isStopped)
+						return;
+
+					if (queue.drainBatch())
+						pThis->postDrain(queue);
+				});
+			}
+
+#ifdef __linux__
+			void readEvents() {
+				m_descriptor.async_read_some(boost::asio::buffer(m_eventBuffer), m_strand.wrap([pThis = shared_from_this()](
+						const auto& ec,
+						auto numBytes) {
+					pThis->handleEvents(ec, numBytes);
+				}));
+			}
+
+			void handleEvents(const boost::system::error_code& ec, size_t numBytes) {
+				if (ec) {
+					if (boost::asio::error::operation_aborted != ec)
+						CATAPULT_LOG(warning) << "queue change notifications stopped due to error: " << ec.message();
+
+					return;
+				}
+
+				size_t offset = 0;
+				while (offset + sizeof(inotify_event) <= numBytes) {
+					const auto& event = reinterpret_cast<const inotify_event&>(m_eventBuffer[offset]);
+					offset += sizeof(inotify_event) + event.len;
+
+					// when events were dropped, any queue might have changed
+					if (IN_Q_OVERFLOW & event.mask) {
+						drainAll();
+						continue;
+					}
+
+					auto iter = m_watchedQueues.find(event.wd);
+					if (m_watchedQueues.cend() == iter || 0 == event.len)
+						continue;
+
+					std::string filename(event.name);
+					for (auto* pQueue : iter->second) {
+						if (pQueue->indexFilename() == filename)
+							trigger(*pQueue);
+					}
+				}
+
+				if (!m_isStopped)
+					readEvents();
+			}
+#endif
+
+		private:
+			boost::asio::io_context& m_ioContext;
+			boost::asio::io_context::strand m_strand;
+			std::atomic_bool m_isStopped;
+			std::vector<std::unique_ptr<QueueState>> m_queues;
+
+#ifdef __linux__
+			boost::asio::posix::stream_descriptor m_descriptor;
+			std::unordered_map<int, std::vector<QueueState*>> m_watchedQueues;
+			alignas(inotify_event) std::array<uint8_t, 4096> m_eventBuffer;
+#endif
+		};
+
+		// endregion
+	}
+
+	std::shared_ptr<QueueDrainer> CreateQueueDrainer(thread::IoThreadPool& pool) {
+		return std::make_shared<DefaultQueueDrainer>(pool);
+	}
+}}
@@ -0,0 +1,59 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/functions.h"
+#include <memory>
+#include <string>
+
+namespace catapult { namespace thread { class IoThreadPool; } }
+
+namespace catapult { namespace local {
+
+	/// Drains file queues in bounded batches as soon as their (writer) index files are written.
+	/// \note When file change notifications are not supported, queues are only drained by explicit requests.
+	class QueueDrainer {
+	public:
+		virtual ~QueueDrainer() = default;
+
+	public:
+		/// Returns \c true if queues are drained in response to file change notifications.
+		virtual bool isChangeNotificationSupported() const = 0;
+
+	public:
+		/// Adds a queue in \a directory with (writer) index file \a indexFilename that is drained by repeatedly calling
+		/// \a drainBatch, which returns \c true when more messages might be pending.
+		/// \note All queues must be added before start is called.
+		virtual void addQueue(const std::string& directory, const std::string& indexFilename, const predicate<>& drainBatch) = 0;
+
+		/// Starts watching all queues for changes and drains all queues.
+		virtual void start() = 0;
+
+		/// Requests all queues to be drained.
+		virtual void drainAll() = 0;
+
+		/// Shuts down the drainer.
+		virtual void shutdown() = 0;
+	};
+
+	/// Creates a queue drainer around \a pool.
+	std::shared_ptr<QueueDrainer> CreateQueueDrainer(thread::IoThreadPool& pool);
+}}
@@ -51,7 +51,10 @@ namespace catapult { namespace local {
 				const cache::CatapultCache& catapultCache,
 				const config::CatapultDataDirectory& dataDirectory) {
 			subscriptionManager.addStateChangeSubscriber(CreateFileStateChangeStorage(
-					std::make_unique<io::FileQueueWriter>(dataDirectory.spoolDir("state_change").str(), "index_server.dat"),
+					std::make_unique<io::FileQueueWriter>(
+							dataDirectory.spoolDir("state_change").str(),
+							"index_server.dat",
+							io::FileQueueLayout::Segmented),
 					[&catapultCache]() { return catapultCache.changesStorages(); }));
 			return subscriptionManager.createStateChangeSubscriber();
 		}
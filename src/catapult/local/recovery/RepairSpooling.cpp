@@ -60,6 +60,25 @@ namespace catapult { namespace local {
 				destinationIndexFile.set(sourceIndexFile.get());
 			}
 
+			void reindex(
+					const std::string& queueName,
+					const std::string& destinationIndexFilename,
+					const std::string& sourceIndexFilename,
+					const std::string& overrideIndexFilename) {
+				auto directory = m_dataDirectory.spoolDir(queueName);
+				io::IndexFile overrideIndexFile(directory.file(overrideIndexFilename));
+				io::IndexFile sourceIndexFile(directory.file(sourceIndexFilename));
+
+				// override index is ignored when it is stale (behind source index)
+				if (!overrideIndexFile.exists() || (sourceIndexFile.exists() && overrideIndexFile.get() <= sourceIndexFile.get())) {
+					reindex(queueName, destinationIndexFilename, sourceIndexFilename);
+					return;
+				}
+
+				CATAPULT_LOG(debug) << " - setting " << destinationIndexFilename << " to " << overrideIndexFilename;
+				io::IndexFile(directory.file(destinationIndexFilename)).set(overrideIndexFile.get());
+			}
+
 		private:
 			config::CatapultDataDirectory m_dataDirectory;
 		};
@@ -91,11 +110,14 @@ namespace catapult { namespace local {
 		repairer.purge("block_sync");
 
 		// state_change data has not been completely written
-		// remember the three index files in place:
+		// remember the index files in place:
 		// - index_server.dat               | incremented by StateChange handler in commitAll
+		// - >= index_updated.dat           | incremented by CommitStep(All_Updated) handler in commitAll (group commit only)
 		// - >= index.dat                   | incremented by CommitStep(All_Updated) handler in commitAll
 		// - >= index_(server|broker)_r.dat | incremented by cleanup consumer or broker consumption
-		// data in range (index.dat, index_server.dat] is safe to ignore
-		repairer.reindex("state_change", "index_server.dat", "index.dat");
+		// data in range (index.dat, index_server.dat] is safe to ignore unless cache database group commit is enabled,
+		// in which case data in range (index.dat, index_updated.dat] is committed but might not be durable and needs to be
+		// replayed by RepairState
+		repairer.reindex("state_change", "index_server.dat", "index.dat", "index_updated.dat");
 	}
 }}
@@ -155,7 +155,10 @@ namespace catapult { namespace local {
 				const cache::CatapultCache& catapultCache,
 				const config::CatapultDataDirectory& dataDirectory) {
 			subscriptionManager.addStateChangeSubscriber(CreateFileStateChangeStorage(
-					std::make_unique<io::FileQueueWriter>(dataDirectory.spoolDir("state_change").str(), "index_server.dat"),
+					std::make_unique<io::FileQueueWriter>(
+							dataDirectory.spoolDir("state_change").str(),
+							"index_server.dat",
+							io::FileQueueLayout::Segmented),
 					[&catapultCache]() { return catapultCache.changesStorages(); }));
 			subscriptionManager.addStateChangeSubscriber(std::make_unique<CommitImportanceFilesStateChangeSubscriber>(dataDirectory));
 			return subscriptionManager.createStateChangeSubscriber();
@@ -232,6 +235,10 @@ namespace catapult { namespace local {
 
 		public:
 			void boot() {
+				// plugins parallelize expensive work (e.g. importance recalculation) on a pool that lives as long as the node
+				// (notice that it needs to be created before any services so that it is shutdown after all of them)
+				m_pluginManager.setWorkerPool(m_pBootstrapper->pool().pushIsolatedPool("plugin worker"));
+
 				CATAPULT_LOG(info) << "registering system plugins";
 				m_pluginModules = LoadAllPlugins(*m_pBootstrapper);
 
@@ -0,0 +1,102 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NotificationType.h"
+#include <vector>
+
+namespace catapult { namespace model {
+
+	/// Dense lookup table of values keyed by notification type excluding channel.
+	/// \note Facility and code are used as direct indexes because notification codes are small and mostly contiguous.
+	template<typename TValue>
+	class NotificationTypeTable {
+	public:
+		/// Creates a table around a default value (\a defaultValue) that is associated with all types without explicit values.
+		explicit NotificationTypeTable(const TValue& defaultValue = TValue()) : m_values{ defaultValue }
+		{}
+
+	public:
+		/// Returns \c true if an explicit value is associated with \a type.
+		bool contains(NotificationType type) const {
+			return 0 != findIndex(type);
+		}
+
+		/// Gets the value associated with \a type.
+		const TValue& operator[](NotificationType type) const {
+			return m_values[findIndex(type)];
+		}
+
+		/// Gets the explicit value associated with \a type, associating a copy of the default value when none is present.
+		/// \note Returned reference is invalidated by subsequent insertions.
+		TValue& findOrInsert(NotificationType type) {
+			auto index = findIndex(type);
+			if (0 != index)
+				return m_values[index];
+
+			auto rawType = utils::to_underlying_type(type);
+			auto facility = GetFacility(rawType);
+			if (facility >= m_indexes.size())
+				m_indexes.resize(facility + 1);
+
+			auto& codeIndexes = m_indexes[facility];
+			auto code = GetCode(rawType);
+			if (code >= codeIndexes.size())
+				codeIndexes.resize(code + 1, 0);
+
+			codeIndexes[code] = static_cast<uint32_t>(m_values.size());
+			auto value = m_values[0];
+			m_values.push_back(std::move(value));
+			return m_values.back();
+		}
+
+		/// Calls \a consumer with all values, including the default value.
+		template<typename TConsumer>
+		void forEachValue(TConsumer consumer) {
+			for (auto& value : m_values)
+				consumer(value);
+		}
+
+	private:
+		static uint32_t GetFacility(uint32_t rawType) {
+			return (rawType >> 16) & 0xFF;
+		}
+
+		static uint32_t GetCode(uint32_t rawType) {
+			return rawType & 0xFFFF;
+		}
+
+		size_t findIndex(NotificationType type) const {
+			auto rawType = utils::to_underlying_type(type);
+			auto facility = GetFacility(rawType);
+			if (facility >= m_indexes.size())
+				return 0;
+
+			const auto& codeIndexes = m_indexes[facility];
+			auto code = GetCode(rawType);
+			return code < codeIndexes.size() ? codeIndexes[code] : 0;
+		}
+
+	private:
+		std::vector<TValue> m_values; // default value is always first
+		std::vector<std::vector<uint32_t>> m_indexes;
+	};
+}}
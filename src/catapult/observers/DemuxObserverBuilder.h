@@ -20,41 +20,59 @@
 **/
 
 #pragma once
-#include "AggregateObserverBuilder.h"
 #include "ObserverTypes.h"
-#include <functional>
+#include "catapult/model/NotificationTypeTable.h"
+#include "catapult/utils/NamedObject.h"
 #include <vector>
 
 namespace catapult { namespace observers {
 
 	/// Demultiplexing observer builder.
+	/// \note Built observer dispatches each notification only to the observers registered for its type (excluding channel).
 	class DemuxObserverBuilder {
 	private:
-		using NotificationObserverPredicate = predicate<const model::Notification&>;
+		using NotificationObserverPointer = NotificationObserverPointerT<model::Notification>;
+		using NotificationObserverPointerVector = std::vector<NotificationObserverPointer>;
+		using DispatchTable = model::NotificationTypeTable<std::vector<const NotificationObserver*>>;
 
 	public:
 		/// Adds an observer (\a pObserver) to the builder that is invoked only when matching notifications are processed.
 		template<typename TNotification>
 		DemuxObserverBuilder& add(NotificationObserverPointerT<TNotification>&& pObserver) {
-			auto predicate = [type = TNotification::Notification_Type](const auto& notification) {
-				return model::AreEqualExcludingChannel(type, notification.Type);
-			};
-			m_builder.add(std::make_unique<ConditionalObserver<TNotification>>(std::move(pObserver), predicate));
+			m_observers.push_back(std::make_unique<TypedObserver<TNotification>>(std::move(pObserver)));
+			m_filters.push_back({ true, TNotification::Notification_Type });
 			return *this;
 		}
 
 		/// Builds a demultiplexing observer.
 		AggregateNotificationObserverPointerT<model::Notification> build() {
-			return m_builder.build();
+			// observers that are always invoked are added to all dispatch lists, so registration order is preserved in each
+			DispatchTable dispatchTable;
+			for (auto i = 0u; i < m_observers.size(); ++i) {
+				const auto* pObserver = m_observers[i].get();
+				if (m_filters[i].IsFiltered) {
+					dispatchTable.findOrInsert(m_filters[i].Type).push_back(pObserver);
+				} else {
+					dispatchTable.forEachValue([pObserver](auto& observers) {
+						observers.push_back(pObserver);
+					});
+				}
+			}
+
+			m_filters.clear();
+			return std::make_unique<DemuxAggregateNotificationObserver>(std::move(m_observers), std::move(dispatchTable));
 		}
 
 	private:
+		struct NotificationTypeFilter {
+			bool IsFiltered;
+			model::NotificationType Type;
+		};
+
 		template<typename TNotification>
-		class ConditionalObserver : public NotificationObserver {
+		class TypedObserver : public NotificationObserver {
 		public:
-			ConditionalObserver(NotificationObserverPointerT<TNotification>&& pObserver, const NotificationObserverPredicate& predicate)
-					: m_pObserver(std::move(pObserver))
-					, m_predicate(predicate)
+			explicit TypedObserver(NotificationObserverPointerT<TNotification>&& pObserver) : m_pObserver(std::move(pObserver))
 			{}
 
 		public:
@@ -63,25 +81,61 @@ namespace catapult { namespace observers {
 			}
 
 			void notify(const model::Notification& notification, ObserverContext& context) const override {
-				if (!m_predicate(notification))
-					return;
-
 				m_pObserver->notify(static_cast<const TNotification&>(notification), context);
 			}
 
 		private:
 			NotificationObserverPointerT<TNotification> m_pObserver;
-			NotificationObserverPredicate m_predicate;
+		};
+
+		class DemuxAggregateNotificationObserver : public AggregateNotificationObserverT<model::Notification> {
+		public:
+			DemuxAggregateNotificationObserver(NotificationObserverPointerVector&& observers, DispatchTable&& dispatchTable)
+					: m_observers(std::move(observers))
+					, m_dispatchTable(std::move(dispatchTable))
+					, m_name(utils::ReduceNames(utils::ExtractNames(m_observers)))
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return utils::ExtractNames(m_observers);
+			}
+
+			void notify(const model::Notification& notification, ObserverContext& context) const override {
+				const auto& observers = m_dispatchTable[notification.Type];
+				if (NotifyMode::Commit == context.Mode)
+					notifyAll(observers.cbegin(), observers.cend(), notification, context);
+				else
+					notifyAll(observers.crbegin(), observers.crend(), notification, context);
+			}
+
+		private:
+			template<typename TIter>
+			void notifyAll(TIter begin, TIter end, const model::Notification& notification, ObserverContext& context) const {
+				for (auto iter = begin; end != iter; ++iter)
+					(*iter)->notify(notification, context);
+			}
+
+		private:
+			NotificationObserverPointerVector m_observers;
+			DispatchTable m_dispatchTable;
+			std::string m_name;
 		};
 
 	private:
-		AggregateObserverBuilder<model::Notification> m_builder;
+		NotificationObserverPointerVector m_observers;
+		std::vector<NotificationTypeFilter> m_filters;
 	};
 
 	/// Adds an observer (\a pObserver) to the builder that is always invoked.
 	template<>
 	inline DemuxObserverBuilder& DemuxObserverBuilder::add(NotificationObserverPointerT<model::Notification>&& pObserver) {
-		m_builder.add(std::move(pObserver));
+		m_observers.push_back(std::move(pObserver));
+		m_filters.push_back({ false, model::NotificationType() });
 		return *this;
 	}
 }}
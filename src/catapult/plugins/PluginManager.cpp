@@ -33,7 +33,11 @@ namespace catapult { namespace plugins {
 			, m_storageConfig(storageConfig)
 			, m_userConfig(userConfig)
 			, m_inflationConfig(inflationConfig)
-	{}
+			, m_pWorkerPool(nullptr) {
+		auto groupCommitInterval = m_storageConfig.CacheDatabaseConfig.GroupCommitInterval;
+		if (m_storageConfig.PreferCacheDatabase && utils::TimeSpan() != groupCommitInterval)
+			m_pCacheDatabaseGroupCommitter = std::make_shared<cache::RocksGroupCommitter>(groupCommitInterval);
+	}
 
 	// region config
 
@@ -57,10 +61,28 @@ namespace catapult { namespace plugins {
 		if (!m_storageConfig.PreferCacheDatabase)
 			return cache::CacheConfiguration();
 
-		return cache::CacheConfiguration(
+		auto cacheConfig = cache::CacheConfiguration(
 				(std::filesystem::path(m_storageConfig.CacheDatabaseDirectory) / name).generic_string(),
 				m_storageConfig.CacheDatabaseConfig,
 				m_config.EnableVerifiableState ? cache::PatriciaTreeStorageMode::Enabled : cache::PatriciaTreeStorageMode::Disabled);
+		cacheConfig.pCacheDatabaseGroupCommitter = m_pCacheDatabaseGroupCommitter;
+		return cacheConfig;
+	}
+
+	cache::RocksGroupCommitter* PluginManager::cacheDatabaseGroupCommitter() const {
+		return m_pCacheDatabaseGroupCommitter.get();
+	}
+
+	// endregion
+
+	// region worker pool
+
+	void PluginManager::setWorkerPool(thread::IoThreadPool* pPool) {
+		m_pWorkerPool = pPool;
+	}
+
+	thread::IoThreadPool* PluginManager::workerPool() const {
+		return m_pWorkerPool;
 	}
 
 	// endregion
@@ -189,6 +211,18 @@ namespace catapult { namespace plugins {
 
 	// endregion
 
+	// region prefetchers
+
+	void PluginManager::addCachePrefetcher(const cache::CachePrefetcherFactory& factory) {
+		m_cachePrefetcherFactories.push_back(factory);
+	}
+
+	const std::vector<cache::CachePrefetcherFactory>& PluginManager::cachePrefetcherFactories() const {
+		return m_cachePrefetcherFactories;
+	}
+
+	// endregion
+
 	// region resolvers
 
 	void PluginManager::addMosaicResolver(const MosaicResolver& resolver) {
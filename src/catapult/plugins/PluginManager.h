@@ -21,6 +21,7 @@
 
 #pragma once
 #include "catapult/cache/CacheConfiguration.h"
+#include "catapult/cache/CachePrefetcher.h"
 #include "catapult/cache/CatapultCacheBuilder.h"
 #include "catapult/config/InflationConfiguration.h"
 #include "catapult/config/UserConfiguration.h"
@@ -35,6 +36,8 @@
 #include "catapult/validators/ValidatorTypes.h"
 #include "catapult/plugins.h"
 
+namespace catapult { namespace thread { class IoThreadPool; } }
+
 namespace catapult { namespace plugins {
 
 	/// Additional storage configuration.
@@ -108,6 +111,19 @@ namespace catapult { namespace plugins {
 		/// Gets the cache configuration for cache with \a name.
 		cache::CacheConfiguration cacheConfig(const std::string& name) const;
 
+		/// Gets the group committer shared by all cache databases or \c nullptr if group commit is disabled.
+		cache::RocksGroupCommitter* cacheDatabaseGroupCommitter() const;
+
+		// endregion
+
+		// region worker pool
+
+		/// Sets the worker thread pool (\a pPool) that plugins can use to parallelize work.
+		void setWorkerPool(thread::IoThreadPool* pPool);
+
+		/// Gets the worker thread pool or \c nullptr if work should not be parallelized.
+		thread::IoThreadPool* workerPool() const;
+
 		// endregion
 
 		// region transactions
@@ -200,6 +216,16 @@ namespace catapult { namespace plugins {
 
 		// endregion
 
+		// region prefetchers
+
+		/// Adds a cache prefetcher \a factory.
+		void addCachePrefetcher(const cache::CachePrefetcherFactory& factory);
+
+		/// Gets all cache prefetcher factories.
+		const std::vector<cache::CachePrefetcherFactory>& cachePrefetcherFactories() const;
+
+		// endregion
+
 		// region resolvers
 
 		/// Adds a mosaic \a resolver.
@@ -226,6 +252,8 @@ namespace catapult { namespace plugins {
 		config::UserConfiguration m_userConfig;
 		config::InflationConfiguration m_inflationConfig;
 		model::TransactionRegistry m_transactionRegistry;
+		std::shared_ptr<cache::RocksGroupCommitter> m_pCacheDatabaseGroupCommitter;
+		thread::IoThreadPool* m_pWorkerPool;
 		cache::CatapultCacheBuilder m_cacheBuilder;
 
 		std::vector<HandlerHook> m_nonDiagnosticHandlerHooks;
@@ -235,6 +263,7 @@ namespace catapult { namespace plugins {
 		std::vector<StatefulValidatorHook> m_statefulValidatorHooks;
 		std::vector<ObserverHook> m_observerHooks;
 		std::vector<ObserverHook> m_transientObserverHooks;
+		std::vector<cache::CachePrefetcherFactory> m_cachePrefetcherFactories;
 
 		std::vector<MosaicResolver> m_mosaicResolvers;
 		std::vector<AddressResolver> m_addressResolvers;
@@ -54,16 +54,23 @@ namespace catapult { namespace subscribers {
 		detail::Flusher<TSubscriber>::Flush(subscriber);
 	}
 
+	/// Reads at most \a maxMessages messages from \a reader into \a subscriber using \a readNextMessage.
+	/// Returns the number of messages read.
+	template<typename TSubscriber, typename TMessageReader>
+	size_t ReadBatch(io::FileQueueReader& reader, size_t maxMessages, TSubscriber& subscriber, TMessageReader readNextMessage) {
+		return reader.tryReadNextMessages(maxMessages, [&subscriber, readNextMessage](const auto& buffer) {
+			io::BufferInputStreamAdapter<std::vector<uint8_t>> inputStream(buffer);
+			ReadAll(inputStream, subscriber, readNextMessage);
+		});
+	}
+
 	/// Reads all messages from \a reader into \a subscriber using \a readNextMessage.
+	/// \note Messages are read in batches so that segmented queues can be read with few file operations.
 	template<typename TSubscriber, typename TMessageReader>
 	void ReadAll(io::FileQueueReader& reader, TSubscriber& subscriber, TMessageReader readNextMessage) {
-		bool shouldContinue = true;
-		while (shouldContinue) {
-			shouldContinue = reader.tryReadNextMessage([&subscriber, readNextMessage](const auto& buffer) {
-				io::BufferInputStreamAdapter<std::vector<uint8_t>> inputStream(buffer);
-				ReadAll(inputStream, subscriber, readNextMessage);
-			});
-		}
+		constexpr size_t Max_Messages_Per_Batch = 1024;
+		while (0 != ReadBatch(reader, Max_Messages_Per_Batch, subscriber, readNextMessage))
+		{}
 	}
 
 	/// Describes a message queue.
@@ -21,12 +21,14 @@
 
 #pragma once
 #include "Future.h"
+#include "detail/WorkStealingContext.h"
 #include <boost/asio.hpp>
 
 namespace catapult { namespace thread {
 
 	/// Uses \a ioContext to process \a items in \a numPartitions batches and calls \a callback for each partition.
 	/// Future is returned that is resolved when all items have been processed.
+	/// \note Partitions are fixed, so \a callback is called exactly once for each batch index.
 	template<typename TItems, typename TWorkCallback>
 	thread::future<bool> ParallelForPartition(
 			boost::asio::io_context& ioContext,
@@ -114,16 +116,37 @@ namespace catapult { namespace thread {
 		return pParallelContext->future();
 	}
 
-	/// Uses \a ioContext to process \a items in \a numPartitions batches and calls \a callback for each item.
+	/// Uses \a ioContext to process \a items with (at most) \a numPartitions workers and calls \a callback for each item.
 	/// Future is returned that is resolved when all items have been processed.
+	/// \note Items are split into chunks and idle workers steal chunks from busy ones, so slow items do not stall other items.
+	///       Processing of all remaining items is stopped when \a callback returns \c false.
 	template<typename TItems, typename TWorkCallback>
 	thread::future<bool> ParallelFor(boost::asio::io_context& ioContext, TItems& items, size_t numPartitions, TWorkCallback callback) {
-		return ParallelForPartition(ioContext, items, numPartitions, [callback](auto itBegin, auto itEnd, auto startIndex, auto) {
-			auto i = 0u;
-			for (auto iter = itBegin; itEnd != iter; ++iter, ++i) {
-				if (!callback(*iter, startIndex + i))
-					break;
-			}
-		});
+		auto numItems = items.size();
+		if (0 == numItems)
+			return thread::make_ready_future(true);
+
+		auto numWorkers = std::min(numPartitions, numItems);
+		using ContextType = detail::WorkStealingContext<decltype(items.begin())>;
+		auto pContext = std::make_shared<ContextType>(detail::CreateWorkChunks(items, numWorkers), numWorkers);
+		auto future = pContext->future();
+
+		for (auto i = 0u; i < numWorkers; ++i) {
+			// each thread captures pContext by value, which keeps that object alive
+			boost::asio::post(ioContext, [callback, pContext, workerIndex = i]() {
+				detail::WorkerCompletionGuard<ContextType> workerGuard(*pContext);
+				while (const auto* pChunk = pContext->next(workerIndex)) {
+					auto index = pChunk->StartIndex;
+					for (auto iter = pChunk->Begin; pChunk->End != iter; ++iter, ++index) {
+						if (!callback(*iter, index)) {
+							pContext->abort();
+							break;
+						}
+					}
+				}
+			});
+		}
+
+		return future;
 	}
 }}
@@ -0,0 +1,46 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ParallelMerkleLevelHasher.h"
+#include "IoThreadPool.h"
+#include "ParallelFor.h"
+#include "catapult/crypto/Hashes.h"
+#include <algorithm>
+#include <iterator>
+
+namespace catapult { namespace thread {
+
+	crypto::MerkleLevelHasher CreateParallelMerkleLevelHasher(IoThreadPool& pool, size_t minPartitionSize) {
+		return [&pool, minPartitionSize = std::max<size_t>(1, minPartitionSize)](const auto& pairBuffers, auto* pHashes) {
+			auto numPartitions = std::min<size_t>(pool.numWorkerThreads(), pairBuffers.size() / minPartitionSize);
+			if (numPartitions < 2) {
+				crypto::Sha3_256Multi(pairBuffers.data(), pHashes, pairBuffers.size());
+				return;
+			}
+
+			// each partition writes to a disjoint range of level hashes
+			ParallelForPartition(pool.ioContext(), pairBuffers, numPartitions, [pHashes](auto itBegin, auto itEnd, auto startIndex, auto) {
+				auto count = static_cast<size_t>(std::distance(itBegin, itEnd));
+				crypto::Sha3_256Multi(&*itBegin, pHashes + startIndex, count);
+			}).get();
+		};
+	}
+}}
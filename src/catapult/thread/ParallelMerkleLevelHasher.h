@@ -0,0 +1,32 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/crypto/MerkleHashBuilder.h"
+
+namespace catapult { namespace thread { class IoThreadPool; } }
+
+namespace catapult { namespace thread {
+
+	/// Creates a merkle level hasher that splits levels with at least \a minPartitionSize pairs across \a pool.
+	/// \note Smaller levels are hashed on the calling thread, which must not be a \a pool thread.
+	crypto::MerkleLevelHasher CreateParallelMerkleLevelHasher(IoThreadPool& pool, size_t minPartitionSize);
+}}
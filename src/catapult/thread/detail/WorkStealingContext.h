@@ -0,0 +1,166 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/thread/Future.h"
+#include "catapult/utils/SpinLock.h"
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <vector>
+
+namespace catapult { namespace thread { namespace detail {
+
+	/// Number of chunks created for each worker in order to give idle workers something to steal.
+	constexpr size_t Chunks_Per_Worker = 8;
+
+	/// Contiguous range of items that is processed by a single worker.
+	template<typename TIterator>
+	struct WorkChunk {
+		/// First item in the chunk.
+		TIterator Begin;
+
+		/// One past the last item in the chunk.
+		TIterator End;
+
+		/// Index of the first item in the chunk.
+		size_t StartIndex;
+	};
+
+	/// Splits \a items into chunks so that each of \a numWorkers workers is assigned roughly Chunks_Per_Worker chunks.
+	template<typename TItems>
+	auto CreateWorkChunks(TItems& items, size_t numWorkers) {
+		using IteratorType = decltype(items.begin());
+
+		auto numItems = items.size();
+		auto chunkSize = std::max<size_t>(1, numItems / (numWorkers * Chunks_Per_Worker));
+
+		std::vector<WorkChunk<IteratorType>> chunks;
+		chunks.reserve((numItems + chunkSize - 1) / chunkSize);
+
+		auto itBegin = items.begin();
+		for (size_t startIndex = 0; startIndex < numItems; startIndex += chunkSize) {
+			auto size = std::min<size_t>(chunkSize, numItems - startIndex);
+			auto itEnd = itBegin;
+			std::advance(itEnd, static_cast<typename std::iterator_traits<IteratorType>::difference_type>(size));
+			chunks.push_back({ itBegin, itEnd, startIndex });
+			itBegin = itEnd;
+		}
+
+		return chunks;
+	}
+
+	/// Shared state of a work stealing parallel for.
+	/// \note Each worker owns a deque of chunks; it pops chunks from its front and, once empty, steals chunks from the back of others.
+	template<typename TIterator>
+	class WorkStealingContext {
+	private:
+		using ChunkType = WorkChunk<TIterator>;
+
+		// chunks are assigned up front, so each deque is a [Front, Back) window into m_chunks
+		struct ChunkDeque {
+			utils::SpinLock Lock;
+			size_t Front = 0;
+			size_t Back = 0;
+		};
+
+	public:
+		/// Creates a context around \a chunks that are evenly assigned to \a numWorkers workers.
+		WorkStealingContext(std::vector<ChunkType>&& chunks, size_t numWorkers)
+				: m_chunks(std::move(chunks))
+				, m_deques(numWorkers)
+				, m_numOutstandingWorkers(numWorkers)
+				, m_isAborted(false) {
+			auto numChunks = m_chunks.size();
+			for (auto i = 0u; i < numWorkers; ++i) {
+				m_deques[i].Front = numChunks * i / numWorkers;
+				m_deques[i].Back = numChunks * (i + 1) / numWorkers;
+			}
+		}
+
+	public:
+		/// Gets a future that is resolved when all workers have completed.
+		auto future() {
+			return m_promise.get_future();
+		}
+
+	public:
+		/// Gets the next chunk that should be processed by the worker with index \a workerIndex or \c nullptr if no work remains.
+		const ChunkType* next(size_t workerIndex) {
+			if (m_isAborted)
+				return nullptr;
+
+			auto* pChunk = popFront(m_deques[workerIndex]);
+			for (auto i = 1u; !pChunk && i < m_deques.size(); ++i)
+				pChunk = popBack(m_deques[(workerIndex + i) % m_deques.size()]);
+
+			return pChunk;
+		}
+
+		/// Prevents any further chunks from being handed out.
+		void abort() {
+			m_isAborted = true;
+		}
+
+		/// Signals that a worker has completed.
+		void completeWorker() {
+			if (0 != --m_numOutstandingWorkers)
+				return;
+
+			m_promise.set_value(true);
+		}
+
+	private:
+		const ChunkType* popFront(ChunkDeque& deque) {
+			utils::SpinLockGuard guard(deque.Lock);
+			return deque.Front == deque.Back ? nullptr : &m_chunks[deque.Front++];
+		}
+
+		const ChunkType* popBack(ChunkDeque& deque) {
+			utils::SpinLockGuard guard(deque.Lock);
+			return deque.Front == deque.Back ? nullptr : &m_chunks[--deque.Back];
+		}
+
+	private:
+		const std::vector<ChunkType> m_chunks;
+		std::vector<ChunkDeque> m_deques;
+		std::atomic<size_t> m_numOutstandingWorkers;
+		std::atomic<bool> m_isAborted;
+		thread::promise<bool> m_promise;
+	};
+
+	/// Guard that signals worker completion to a work stealing context when destroyed.
+	template<typename TContext>
+	class WorkerCompletionGuard {
+	public:
+		/// Creates a guard around \a context.
+		explicit WorkerCompletionGuard(TContext& context) : m_context(context)
+		{}
+
+		/// Signals worker completion.
+		~WorkerCompletionGuard() {
+			m_context.completeWorker();
+		}
+
+	private:
+		TContext& m_context;
+	};
+}}}
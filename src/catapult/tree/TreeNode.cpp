@@ -93,9 +93,15 @@ namespace catapult { namespace tree {
 
 	// region BranchTreeNode
 
+	namespace {
+		const Hash256& EmptyHash() {
+			static const Hash256 emptyHash{};
+			return emptyHash;
+		}
+	}
+
 	BranchTreeNode::BranchTreeNode(const TreeNodePath& path)
 			: m_path(path)
-			, m_links() // zero initialize
 			, m_isDirty(true)
 	{}
 
@@ -114,17 +120,19 @@ namespace catapult { namespace tree {
 	}
 
 	bool BranchTreeNode::hasLinkedNode(size_t index) const {
-		return !!m_linkedNodes[index];
+		return hasLink(index) && !!m_links[linkPosition(index)].pLinkedNode;
 	}
 
 	const Hash256& BranchTreeNode::link(size_t index) const {
-		const auto& pLinkedNode = m_linkedNodes[index];
-		return pLinkedNode ? pLinkedNode->hash() : m_links[index];
+		if (!hasLink(index))
+			return EmptyHash();
+
+		const auto& link = m_links[linkPosition(index)];
+		return link.pLinkedNode ? link.pLinkedNode->hash() : link.Hash;
 	}
 
 	TreeNode BranchTreeNode::linkedNode(size_t index) const {
-		const auto& pLinkedNode = m_linkedNodes[index];
-		return pLinkedNode ? pLinkedNode->copy() : TreeNode();
+		return hasLinkedNode(index) ? m_links[linkPosition(index)].pLinkedNode->copy() : TreeNode();
 	}
 
 	uint8_t BranchTreeNode::highestLinkIndex() const {
@@ -151,92 +159,109 @@ namespace catapult { namespace tree {
 	}
 
 	void BranchTreeNode::setLink(const Hash256& link, size_t index) {
-		m_links[index] = link;
-		m_linkedNodes[index].reset();
-		setLink(index);
+		// copy link before modifying m_links because it could alias a link in this node
+		auto linkCopy = link;
+		auto& branchLink = setLink(index);
+		branchLink.Hash = linkCopy;
+		branchLink.pLinkedNode.reset();
 	}
 
 	void BranchTreeNode::setLink(const TreeNode& node, size_t index) {
-		// m_links does not need to be explicitly cleared because m_linkedNodes takes precedence
-		m_linkedNodes[index] = std::make_shared<const TreeNode>(node.copy());
-		setLink(index);
+		// Hash does not need to be explicitly cleared because pLinkedNode takes precedence
+		auto pLinkedNode = std::make_shared<const TreeNode>(node.copy());
+		setLink(index).pLinkedNode = std::move(pLinkedNode);
 	}
 
 	void BranchTreeNode::clearLink(size_t index) {
-		setLink(Hash256(), index);
-		m_linkSet.reset(index);
+		if (hasLink(index)) {
+			m_links.erase(m_links.begin() + static_cast<std::ptrdiff_t>(linkPosition(index)));
+			m_linkSet.reset(index);
+		}
+
+		m_isDirty = true;
 	}
 
 	void BranchTreeNode::compactLinks() {
-		for (auto i = 0u; i < Max_Links; ++i) {
-			auto& pLinkedNode = m_linkedNodes[i];
-			if (!pLinkedNode)
+		for (auto& link : m_links) {
+			if (!link.pLinkedNode)
 				continue;
 
-			m_links[i] = pLinkedNode->hash();
-			pLinkedNode.reset();
+			link.Hash = link.pLinkedNode->hash();
+			link.pLinkedNode.reset();
 		}
 	}
 
-	void BranchTreeNode::setLink(size_t index) {
-		m_linkSet.set(index);
+	size_t BranchTreeNode::linkPosition(size_t index) const {
+		// position is equal to the number of links set at lower indexes
+		auto lowerLinksMask = std::bitset<Max_Links>((1ul << index) - 1);
+		return (m_linkSet & lowerLinksMask).count();
+	}
+
+	BranchTreeNode::Link& BranchTreeNode::setLink(size_t index) {
+		auto position = linkPosition(index);
+		if (!hasLink(index)) {
+			m_links.insert(m_links.begin() + static_cast<std::ptrdiff_t>(position), Link());
+			m_linkSet.set(index);
+		}
+
 		m_isDirty = true;
+		return m_links[position];
 	}
 
 	// endregion
 
 	// region TreeNode
 
-	TreeNode::TreeNode()
-			: m_treeNodeType(TreeNodeType::Empty)
-			, m_emptyHash()
-	{}
+	namespace {
+		const TreeNodePath& EmptyPath() {
+			static const TreeNodePath emptyPath;
+			return emptyPath;
+		}
+	}
+
+	TreeNode::TreeNode() = default;
 
-	TreeNode::TreeNode(const LeafTreeNode& node)
-			: m_leafNode(node)
-			, m_treeNodeType(TreeNodeType::Leaf)
+	TreeNode::TreeNode(const LeafTreeNode& node) : m_node(node)
 	{}
 
-	TreeNode::TreeNode(const BranchTreeNode& node)
-			: m_branchNode(node)
-			, m_treeNodeType(TreeNodeType::Branch)
+	TreeNode::TreeNode(const BranchTreeNode& node) : m_node(node)
 	{}
 
 	bool TreeNode::empty() const {
-		return TreeNodeType::Empty == m_treeNodeType;
+		return std::holds_alternative<std::monostate>(m_node);
 	}
 
 	bool TreeNode::isBranch() const {
-		return TreeNodeType::Branch == m_treeNodeType;
+		return std::holds_alternative<BranchTreeNode>(m_node);
 	}
 
 	bool TreeNode::isLeaf() const {
-		return TreeNodeType::Leaf == m_treeNodeType;
+		return std::holds_alternative<LeafTreeNode>(m_node);
 	}
 
 	const TreeNodePath& TreeNode::path() const {
 		if (isLeaf())
-			return m_leafNode.path();
+			return std::get<LeafTreeNode>(m_node).path();
 		else if (isBranch())
-			return m_branchNode.path();
+			return std::get<BranchTreeNode>(m_node).path();
 		else
-			return m_emptyPath;
+			return EmptyPath();
 	}
 
 	const Hash256& TreeNode::hash() const {
 		if (isLeaf())
-			return m_leafNode.hash();
+			return std::get<LeafTreeNode>(m_node).hash();
 		else if (isBranch())
-			return m_branchNode.hash();
+			return std::get<BranchTreeNode>(m_node).hash();
 		else
-			return m_emptyHash;
+			return EmptyHash();
 	}
 
 	void TreeNode::setPath(const TreeNodePath& path) {
 		if (isLeaf())
-			m_leafNode = LeafTreeNode(path, m_leafNode.value());
+			m_node = LeafTreeNode(path, std::get<LeafTreeNode>(m_node).value());
 		else if (isBranch())
-			m_branchNode.setPath(path);
+			std::get<BranchTreeNode>(m_node).setPath(path);
 		else
 			CATAPULT_THROW_RUNTIME_ERROR("cannot change path of empty node");
 	}
@@ -245,21 +270,21 @@ namespace catapult { namespace tree {
 		if (!isLeaf())
 			CATAPULT_THROW_RUNTIME_ERROR("tree node is not a leaf node");
 
-		return m_leafNode;
+		return std::get<LeafTreeNode>(m_node);
 	}
 
 	const BranchTreeNode& TreeNode::asBranchNode() const {
 		if (!isBranch())
 			CATAPULT_THROW_RUNTIME_ERROR("tree node is not a branch node");
 
-		return m_branchNode;
+		return std::get<BranchTreeNode>(m_node);
 	}
 
 	TreeNode TreeNode::copy() const {
 		if (isLeaf())
-			return TreeNode(m_leafNode);
+			return TreeNode(std::get<LeafTreeNode>(m_node));
 		else if (isBranch())
-			return TreeNode(m_branchNode);
+			return TreeNode(std::get<BranchTreeNode>(m_node));
 		else
 			return TreeNode();
 	}
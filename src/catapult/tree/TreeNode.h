@@ -24,6 +24,8 @@
 #include "catapult/types.h"
 #include <bitset>
 #include <memory>
+#include <variant>
+#include <vector>
 
 namespace catapult { namespace tree { class TreeNode; } }
 
@@ -119,12 +121,19 @@ namespace catapult { namespace tree {
 		void compactLinks();
 
 	private:
-		void setLink(size_t index);
+		struct Link {
+			Hash256 Hash;
+			std::shared_ptr<const TreeNode> pLinkedNode; // shared_ptr to allow copying
+		};
+
+	private:
+		size_t linkPosition(size_t index) const;
+
+		Link& setLink(size_t index);
 
 	private:
 		TreeNodePath m_path;
-		std::array<Hash256, BranchTreeNode::Max_Links> m_links;
-		std::array<std::shared_ptr<const TreeNode>, BranchTreeNode::Max_Links> m_linkedNodes; // shared_ptr to allow copying
+		std::vector<Link> m_links; // only set links are stored (ordered by index)
 		std::bitset<BranchTreeNode::Max_Links> m_linkSet;
 		mutable Hash256 m_hash;
 		mutable bool m_isDirty;
@@ -182,16 +191,7 @@ namespace catapult { namespace tree {
 		TreeNode copy() const;
 
 	private:
-		enum class TreeNodeType { Empty, Leaf, Branch };
-
-	private:
-		LeafTreeNode m_leafNode;
-		BranchTreeNode m_branchNode;
-		TreeNodeType m_treeNodeType;
-
-		// used to return references from path() and hash() when type is Empty
-		TreeNodePath m_emptyPath;
-		Hash256 m_emptyHash;
+		std::variant<std::monostate, LeafTreeNode, BranchTreeNode> m_node;
 	};
 
 	// endregion
@@ -0,0 +1,94 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "LatencyHistogram.h"
+#include "IntegerMath.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		constexpr uint64_t Num_Sub_Buckets = 1u << LatencyHistogram::Sub_Bucket_Bits;
+	}
+
+	LatencyHistogram::LatencyHistogram()
+			: m_count(0)
+			, m_max(0) {
+		for (auto& bucket : m_buckets)
+			bucket = 0;
+	}
+
+	uint64_t LatencyHistogram::count() const {
+		return m_count;
+	}
+
+	uint64_t LatencyHistogram::max() const {
+		return m_max;
+	}
+
+	uint64_t LatencyHistogram::percentile(uint32_t percentile) const {
+		if (0 == percentile || 100 < percentile)
+			CATAPULT_THROW_INVALID_ARGUMENT_1("percentile must be in range [1, 100]", percentile);
+
+		auto count = m_count.load();
+		if (0 == count)
+			return 0;
+
+		// buckets and count are updated independently, so clamp the rank to the number of values observed in the buckets
+		auto rank = std::max<uint64_t>(1, (count * percentile + 99) / 100);
+		uint64_t cumulativeCount = 0;
+		for (auto i = 0u; i < Num_Buckets; ++i) {
+			cumulativeCount += m_buckets[i];
+			if (cumulativeCount >= rank)
+				return std::min(BucketUpperBound(i), max());
+		}
+
+		return max();
+	}
+
+	void LatencyHistogram::add(uint64_t value) {
+		++m_buckets[BucketIndex(value)];
+		++m_count;
+
+		auto currentMax = m_max.load();
+		while (currentMax < value && !m_max.compare_exchange_weak(currentMax, value))
+		{}
+	}
+
+	size_t LatencyHistogram::BucketIndex(uint64_t value) {
+		if (value < Num_Sub_Buckets)
+			return static_cast<size_t>(value);
+
+		// the top Sub_Bucket_Bits + 1 bits of value (including the leading one) select the bucket
+		auto shift = Log2(value) - Sub_Bucket_Bits;
+		return static_cast<size_t>((shift + 1) * Num_Sub_Buckets + (value >> shift) - Num_Sub_Buckets);
+	}
+
+	uint64_t LatencyHistogram::BucketUpperBound(size_t bucketIndex) {
+		if (bucketIndex < Num_Sub_Buckets)
+			return bucketIndex;
+
+		auto shift = bucketIndex / Num_Sub_Buckets - 1;
+		auto lowerBound = (Num_Sub_Buckets + bucketIndex % Num_Sub_Buckets) << shift;
+		return lowerBound + ((uint64_t(1) << shift) - 1);
+	}
+}}
@@ -0,0 +1,73 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NonCopyable.h"
+#include <array>
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace catapult { namespace utils {
+
+	/// Lock-free histogram of latency values.
+	/// \note Values are grouped into buckets by power of two with four linear sub-buckets each,
+	///       so percentiles are accurate to within 25%.
+	class LatencyHistogram : NonCopyable {
+	public:
+		/// Number of bits used to select a sub-bucket within a power of two.
+		static constexpr uint32_t Sub_Bucket_Bits = 2;
+
+		/// Number of buckets.
+		static constexpr size_t Num_Buckets = (64 - Sub_Bucket_Bits + 1) << Sub_Bucket_Bits;
+
+	public:
+		/// Creates an empty histogram.
+		LatencyHistogram();
+
+	public:
+		/// Gets the number of values.
+		uint64_t count() const;
+
+		/// Gets the largest value.
+		uint64_t max() const;
+
+		/// Gets the (approximate) value at \a percentile, which must be in the range [1, 100].
+		/// \note The upper bound of the bucket containing the value is returned, capped at max().
+		uint64_t percentile(uint32_t percentile) const;
+
+	public:
+		/// Adds \a value to the histogram.
+		void add(uint64_t value);
+
+	public:
+		/// Gets the index of the bucket containing \a value.
+		static size_t BucketIndex(uint64_t value);
+
+		/// Gets the largest value contained in the bucket with index \a bucketIndex.
+		static uint64_t BucketUpperBound(size_t bucketIndex);
+
+	private:
+		std::array<std::atomic<uint64_t>, Num_Buckets> m_buckets;
+		std::atomic<uint64_t> m_count;
+		std::atomic<uint64_t> m_max;
+	};
+}}
@@ -74,6 +74,9 @@ namespace catapult { namespace utils {
 				out << std::endl << " + " << pair.second << "ms: '" << pair.first << "' (" << endMillis - pair.second << "ms)";
 			}
 
+			for (const auto& pair : m_concurrentSubOperations)
+				out << std::endl << " * '" << pair.first << "' (" << pair.second << "ms)";
+
 			CATAPULT_LOG_LEVEL(m_level) << out.str();
 		}
 
@@ -83,11 +86,18 @@ namespace catapult { namespace utils {
 			m_subOperations.emplace_back(name, m_timer.millis());
 		}
 
+		/// Adds a sub operation with \a name that took \a elapsedMillis independently of all other sub operations.
+		/// \note This allows tracking of sub operations that are executed concurrently.
+		void addConcurrentSubOperation(const std::string& name, uint64_t elapsedMillis) {
+			m_concurrentSubOperations.emplace_back(name, elapsedMillis);
+		}
+
 	private:
 		const char* m_message;
 		LogLevel m_level;
 		TimeSpan m_threshold;
 		StackTimer m_timer;
 		std::vector<std::pair<const char*, uint64_t>> m_subOperations;
+		std::vector<std::pair<std::string, uint64_t>> m_concurrentSubOperations;
 	};
 }}
@@ -20,20 +20,25 @@
 **/
 
 #pragma once
-#include "AggregateValidatorBuilder.h"
+#include "AggregateValidationResult.h"
 #include "ValidatorTypes.h"
-#include <functional>
+#include "catapult/model/NotificationTypeTable.h"
+#include "catapult/utils/NamedObject.h"
 #include <vector>
 
 namespace catapult { namespace validators {
 
 	/// Demultiplexing validator builder.
+	/// \note Built validator dispatches each notification only to the validators registered for its type (excluding channel).
 	template<typename... TArgs>
 	class DemuxValidatorBuilderT {
 	private:
 		template<typename TNotification>
 		using NotificationValidatorPointerT = std::unique_ptr<const NotificationValidatorT<TNotification, TArgs...>>;
-		using NotificationValidatorPredicate = predicate<const model::Notification&>;
+		using NotificationValidator = NotificationValidatorT<model::Notification, TArgs...>;
+		using NotificationValidatorPointer = NotificationValidatorPointerT<model::Notification>;
+		using NotificationValidatorPointerVector = std::vector<NotificationValidatorPointer>;
+		using DispatchTable = model::NotificationTypeTable<std::vector<const NotificationValidator*>>;
 		using AggregateValidatorPointer = std::unique_ptr<const AggregateNotificationValidatorT<model::Notification, TArgs...>>;
 
 	public:
@@ -41,13 +46,12 @@ namespace catapult { namespace validators {
 		template<typename TNotification>
 		DemuxValidatorBuilderT& add(NotificationValidatorPointerT<TNotification>&& pValidator) {
 			if constexpr (!std::is_same_v<model::Notification, TNotification>) {
-				auto predicate = [type = TNotification::Notification_Type](const auto& notification) {
-					return model::AreEqualExcludingChannel(type, notification.Type);
-				};
-				m_builder.add(std::make_unique<ConditionalValidator<TNotification>>(std::move(pValidator), predicate));
+				m_validators.push_back(std::make_unique<TypedValidator<TNotification>>(std::move(pValidator)));
+				m_filters.push_back({ true, TNotification::Notification_Type });
 				return *this;
 			} else {
-				m_builder.add(std::move(pValidator));
+				m_validators.push_back(std::move(pValidator));
+				m_filters.push_back({ false, model::NotificationType() });
 				return *this;
 			}
 		}
@@ -59,18 +63,36 @@ namespace catapult { namespace validators {
 
 		/// Builds a demultiplexing validator that ignores suppressed failures according to \a isSuppressedFailure.
 		AggregateValidatorPointer build(const ValidationResultPredicate& isSuppressedFailure) {
-			return m_builder.build(isSuppressedFailure);
+			// validators that are always invoked are added to all dispatch lists, so registration order is preserved in each
+			DispatchTable dispatchTable;
+			for (auto i = 0u; i < m_validators.size(); ++i) {
+				const auto* pValidator = m_validators[i].get();
+				if (m_filters[i].IsFiltered) {
+					dispatchTable.findOrInsert(m_filters[i].Type).push_back(pValidator);
+				} else {
+					dispatchTable.forEachValue([pValidator](auto& validators) {
+						validators.push_back(pValidator);
+					});
+				}
+			}
+
+			m_filters.clear();
+			return std::make_unique<DemuxAggregateNotificationValidator>(
+					std::move(m_validators),
+					std::move(dispatchTable),
+					isSuppressedFailure);
 		}
 
 	private:
+		struct NotificationTypeFilter {
+			bool IsFiltered;
+			model::NotificationType Type;
+		};
+
 		template<typename TNotification>
-		class ConditionalValidator : public NotificationValidatorT<model::Notification, TArgs...> {
+		class TypedValidator : public NotificationValidator {
 		public:
-			ConditionalValidator(
-					NotificationValidatorPointerT<TNotification>&& pValidator,
-					const NotificationValidatorPredicate& predicate)
-					: m_pValidator(std::move(pValidator))
-					, m_predicate(predicate)
+			explicit TypedValidator(NotificationValidatorPointerT<TNotification>&& pValidator) : m_pValidator(std::move(pValidator))
 			{}
 
 		public:
@@ -79,18 +101,62 @@ namespace catapult { namespace validators {
 			}
 
 			ValidationResult validate(const model::Notification& notification, TArgs&&... args) const override {
-				if (!m_predicate(notification))
-					return ValidationResult::Success;
-
 				return m_pValidator->validate(static_cast<const TNotification&>(notification), std::forward<TArgs>(args)...);
 			}
 
 		private:
 			NotificationValidatorPointerT<TNotification> m_pValidator;
-			NotificationValidatorPredicate m_predicate;
+		};
+
+		class DemuxAggregateNotificationValidator : public AggregateNotificationValidatorT<model::Notification, TArgs...> {
+		public:
+			DemuxAggregateNotificationValidator(
+					NotificationValidatorPointerVector&& validators,
+					DispatchTable&& dispatchTable,
+					const ValidationResultPredicate& isSuppressedFailure)
+					: m_validators(std::move(validators))
+					, m_dispatchTable(std::move(dispatchTable))
+					, m_isSuppressedFailure(isSuppressedFailure)
+					, m_name(utils::ReduceNames(utils::ExtractNames(m_validators)))
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return utils::ExtractNames(m_validators);
+			}
+
+			ValidationResult validate(const model::Notification& notification, TArgs&&... args) const override {
+				auto aggregateResult = ValidationResult::Success;
+				for (const auto* pValidator : m_dispatchTable[notification.Type]) {
+					auto result = pValidator->validate(notification, std::forward<TArgs>(args)...);
+
+					// ignore suppressed failures
+					if (m_isSuppressedFailure(result))
+						continue;
+
+					// exit on other failures
+					if (IsValidationResultFailure(result))
+						return result;
+
+					AggregateValidationResult(aggregateResult, result);
+				}
+
+				return aggregateResult;
+			}
+
+		private:
+			NotificationValidatorPointerVector m_validators;
+			DispatchTable m_dispatchTable;
+			ValidationResultPredicate m_isSuppressedFailure;
+			std::string m_name;
 		};
 
 	private:
-		AggregateValidatorBuilder<model::Notification, TArgs...> m_builder;
+		NotificationValidatorPointerVector m_validators;
+		std::vector<NotificationTypeFilter> m_filters;
 	};
 }}
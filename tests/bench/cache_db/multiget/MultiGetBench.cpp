@@ -0,0 +1,168 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/RocksDatabase.h"
+#include "catapult/cache_db/RocksInclude.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <filesystem>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr auto Database_Directory = "bench_multiget_db";
+		constexpr auto Num_Keys = 200'000u;
+		constexpr auto Value_Size = 128u;
+
+		// region BenchDatabase
+
+		class BenchDatabase {
+		public:
+			BenchDatabase() : m_pDatabase(CreateDatabase()) {
+				std::string value(Value_Size, 0);
+				for (auto i = 0u; i < Num_Keys; ++i) {
+					auto key = CreateKey(i);
+					bench::FillWithRandomData({ reinterpret_cast<uint8_t*>(&value[0]), value.size() });
+					m_pDatabase->put(0, ToSlice(key), value);
+				}
+
+				m_pDatabase->flush();
+			}
+
+			~BenchDatabase() {
+				m_pDatabase.reset();
+				std::filesystem::remove_all(Database_Directory);
+			}
+
+		public:
+			RocksDatabase& database() {
+				return *m_pDatabase;
+			}
+
+		public:
+			static Hash256 CreateKey(uint64_t seed) {
+				Hash256 key;
+				std::memcpy(key.data(), &seed, sizeof(uint64_t));
+				std::memcpy(key.data() + sizeof(uint64_t), &seed, sizeof(uint64_t));
+				return key;
+			}
+
+			static rocksdb::Slice ToSlice(const Hash256& key) {
+				return rocksdb::Slice(reinterpret_cast<const char*>(key.data()), key.size());
+			}
+
+		private:
+			static std::unique_ptr<RocksDatabase> CreateDatabase() {
+				std::filesystem::remove_all(Database_Directory);
+
+				auto config = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+				config.MaxWriteBatchSize = utils::FileSize::FromMegabytes(5);
+				RocksDatabaseSettings settings(Database_Directory, config, { "default" }, FilterPruningMode::Disabled);
+				return std::make_unique<RocksDatabase>(settings);
+			}
+
+		private:
+			std::unique_ptr<RocksDatabase> m_pDatabase;
+		};
+
+		BenchDatabase& GetBenchDatabase() {
+			static BenchDatabase benchDatabase;
+			return benchDatabase;
+		}
+
+		// endregion
+
+		std::vector<Hash256> CreateRandomKeys(size_t count) {
+			// about one tenth of keys are not present in the database
+			std::vector<Hash256> keys;
+			keys.reserve(count);
+			for (auto i = 0u; i < count; ++i)
+				keys.push_back(BenchDatabase::CreateKey(bench::Random() % (Num_Keys + Num_Keys / 10)));
+
+			return keys;
+		}
+
+		template<typename TLookup>
+		void RunLookupBenchmark(benchmark::State& state, TLookup lookup) {
+			auto& database = GetBenchDatabase().database();
+			auto numKeys = static_cast<size_t>(state.range(0));
+
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto keys = CreateRandomKeys(numKeys);
+				std::vector<rocksdb::Slice> slices;
+				for (const auto& key : keys)
+					slices.push_back(BenchDatabase::ToSlice(key));
+
+				state.ResumeTiming();
+
+				benchmark::DoNotOptimize(lookup(database, slices));
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(numKeys * state.iterations()));
+		}
+
+		void BenchmarkSerialGet(benchmark::State& state) {
+			RunLookupBenchmark(state, [](auto& database, const auto& slices) {
+				auto numFound = 0u;
+				for (const auto& slice : slices) {
+					RdbDataIterator iter;
+					database.get(0, slice, iter);
+					if (RdbDataIterator::End() != iter)
+						++numFound;
+				}
+
+				return numFound;
+			});
+		}
+
+		void BenchmarkBatchedMultiGet(benchmark::State& state) {
+			RunLookupBenchmark(state, [](auto& database, const auto& slices) {
+				std::vector<RdbDataIterator> iters;
+				database.multiGet(0, slices, iters);
+
+				auto numFound = 0u;
+				for (const auto& iter : iters) {
+					if (RdbDataIterator::End() != iter)
+						++numFound;
+				}
+
+				return numFound;
+			});
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkSerialGet", catapult::cache::BenchmarkSerialGet)
+			->UseRealTime()
+			->Arg(100)
+			->Arg(1'000)
+			->Arg(10'000);
+
+	benchmark::RegisterBenchmark("BenchmarkBatchedMultiGet", catapult::cache::BenchmarkBatchedMultiGet)
+			->UseRealTime()
+			->Arg(100)
+			->Arg(1'000)
+			->Arg(10'000);
+}
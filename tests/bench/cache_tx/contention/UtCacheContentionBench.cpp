@@ -0,0 +1,139 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_tx/MemoryUtCache.h"
+#include "catapult/utils/MemoryUtils.h"
+#include "catapult/utils/ShortHash.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <thread>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr uint32_t Transaction_Size = 200;
+		constexpr size_t Num_Seed_Transactions = 10'000;
+		constexpr size_t Num_Transactions_Per_Batch = 100;
+
+		model::TransactionInfo CreateRandomTransactionInfo() {
+			auto pTransaction = utils::MakeSharedWithSize<model::Transaction>(Transaction_Size);
+			bench::FillWithRandomData({ reinterpret_cast<uint8_t*>(pTransaction.get()), Transaction_Size });
+			pTransaction->Size = Transaction_Size;
+			pTransaction->MaxFee = Amount(bench::Random() % 100'000);
+			pTransaction->Deadline = Timestamp(bench::Random());
+
+			Hash256 hash;
+			bench::FillWithRandomData(hash);
+			return model::TransactionInfo(pTransaction, hash);
+		}
+
+		std::vector<model::TransactionInfo> CreateRandomTransactionInfos(size_t count) {
+			std::vector<model::TransactionInfo> transactionInfos;
+			transactionInfos.reserve(count);
+			for (auto i = 0u; i < count; ++i)
+				transactionInfos.push_back(CreateRandomTransactionInfo());
+
+			return transactionInfos;
+		}
+
+		void RunReader(const MemoryUtCache& cache, const std::vector<Hash256>& hashes, const std::atomic_bool& isDone, uint64_t& numReads) {
+			utils::ShortHashesSet knownShortHashes;
+			while (!isDone) {
+				// mix cheap point lookups with an occasional (expensive) pull transactions style scan
+				auto view = cache.view();
+				if (0 == numReads % 64)
+					benchmark::DoNotOptimize(view.unknownTransactions(Timestamp(), BlockFeeMultiplier(), knownShortHashes));
+				else
+					benchmark::DoNotOptimize(view.contains(hashes[bench::Random() % hashes.size()]));
+
+				++numReads;
+			}
+		}
+
+		void BenchmarkConcurrentAddRemove(benchmark::State& state) {
+			auto numShards = static_cast<uint32_t>(state.range(0));
+			auto numReaders = static_cast<size_t>(state.range(1));
+
+			MemoryUtCache cache(MemoryCacheOptions(utils::FileSize::FromMegabytes(1), utils::FileSize::FromMegabytes(1024), numShards));
+			auto seedTransactionInfos = CreateRandomTransactionInfos(Num_Seed_Transactions);
+			{
+				auto modifier = cache.modifier();
+				for (const auto& transactionInfo : seedTransactionInfos)
+					modifier.add(transactionInfo);
+			}
+
+			std::vector<Hash256> seedHashes;
+			for (const auto& transactionInfo : seedTransactionInfos)
+				seedHashes.push_back(transactionInfo.EntityHash);
+
+			std::atomic_bool isDone(false);
+			std::vector<uint64_t> numReadsPerReader(numReaders, 0);
+			std::vector<std::thread> readers;
+			for (auto i = 0u; i < numReaders; ++i) {
+				readers.emplace_back([&cache, &seedHashes, &isDone, &numReads = numReadsPerReader[i]]() {
+					RunReader(cache, seedHashes, isDone, numReads);
+				});
+			}
+
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto transactionInfos = CreateRandomTransactionInfos(Num_Transactions_Per_Batch);
+				state.ResumeTiming();
+
+				// add and then remove a batch of transactions (similar to ut updater processing a block)
+				{
+					auto modifier = cache.modifier();
+					for (const auto& transactionInfo : transactionInfos)
+						modifier.add(transactionInfo);
+				}
+
+				{
+					auto modifier = cache.modifier();
+					for (const auto& transactionInfo : transactionInfos)
+						modifier.remove(transactionInfo.EntityHash);
+				}
+			}
+
+			isDone = true;
+			for (auto& reader : readers)
+				reader.join();
+
+			uint64_t numReads = 0;
+			for (auto numReaderReads : numReadsPerReader)
+				numReads += numReaderReads;
+
+			state.SetItemsProcessed(static_cast<int64_t>(2 * Num_Transactions_Per_Batch * state.iterations()));
+			state.counters["reads"] = benchmark::Counter(static_cast<double>(numReads), benchmark::Counter::kIsRate);
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace catapult::cache;
+
+	// compare a single (globally locked) shard against multiple shards with increasing numbers of concurrent readers
+	benchmark::RegisterBenchmark("BenchmarkConcurrentAddRemove", BenchmarkConcurrentAddRemove)
+			->ArgNames({ "shards", "readers" })
+			->ArgsProduct({ { 1, 4, 16 }, { 0, 2, 8 } })
+			->UseRealTime();
+}
@@ -0,0 +1,144 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_tx/MemoryUtCache.h"
+#include "catapult/model/FeeUtils.h"
+#include "catapult/utils/MemoryUtils.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr uint32_t Transaction_Size = 200;
+		constexpr size_t Num_Cache_Transactions = 100'000;
+		constexpr auto Cache_Options = MemoryCacheOptions(utils::FileSize::FromMegabytes(100), utils::FileSize::FromMegabytes(100), 4);
+
+		model::TransactionInfo CreateRandomTransactionInfo() {
+			auto pTransaction = utils::MakeSharedWithSize<model::Transaction>(Transaction_Size);
+			bench::FillWithRandomData({ reinterpret_cast<uint8_t*>(pTransaction.get()), Transaction_Size });
+			pTransaction->Size = Transaction_Size;
+			pTransaction->MaxFee = Amount(Transaction_Size * (bench::Random() % 200));
+			pTransaction->Deadline = Timestamp(bench::Random());
+
+			Hash256 hash;
+			bench::FillWithRandomData(hash);
+			return model::TransactionInfo(pTransaction, hash);
+		}
+
+		std::vector<model::TransactionInfo> CreateRandomTransactionInfos(size_t count) {
+			std::vector<model::TransactionInfo> transactionInfos;
+			transactionInfos.reserve(count);
+			for (auto i = 0u; i < count; ++i)
+				transactionInfos.push_back(CreateRandomTransactionInfo());
+
+			return transactionInfos;
+		}
+
+		template<typename TAddShortHash>
+		void AddKnownShortHashes(
+				const std::vector<model::TransactionInfo>& transactionInfos,
+				size_t overlapPercentage,
+				TAddShortHash addShortHash) {
+			// peer knows the requested percentage of the local transactions and (about as many) transactions unknown locally
+			for (const auto& transactionInfo : transactionInfos) {
+				if (bench::Random() % 100 < overlapPercentage)
+					addShortHash(utils::ToShortHash(transactionInfo.EntityHash));
+
+				if (bench::Random() % 100 < overlapPercentage) {
+					Hash256 hash;
+					bench::FillWithRandomData(hash);
+					addShortHash(utils::ToShortHash(hash));
+				}
+			}
+		}
+
+		// original strategy that probes the known short hashes for every transaction and recalculates its fee
+		struct LegacyUtTraits {
+			static auto UnknownTransactions(
+					const MemoryUtCacheView& view,
+					BlockFeeMultiplier minFeeMultiplier,
+					const utils::ShortHashesSet& knownShortHashes) {
+				uint64_t totalSize = 0;
+				std::vector<std::shared_ptr<const model::Transaction>> transactions;
+				view.forEach([minFeeMultiplier, &knownShortHashes, &totalSize, &transactions](const auto& transactionInfo) {
+					if (transactionInfo.pEntity->MaxFee < model::CalculateTransactionFee(minFeeMultiplier, *transactionInfo.pEntity))
+						return true;
+
+					if (knownShortHashes.cend() != knownShortHashes.find(utils::ToShortHash(transactionInfo.EntityHash)))
+						return true;
+
+					totalSize += transactionInfo.pEntity->Size;
+					if (totalSize > Cache_Options.MaxResponseSize.bytes())
+						return false;
+
+					transactions.push_back(transactionInfo.pEntity);
+					return true;
+				});
+
+				return transactions;
+			}
+		};
+
+		struct SummaryUtTraits {
+			static auto UnknownTransactions(
+					const MemoryUtCacheView& view,
+					BlockFeeMultiplier minFeeMultiplier,
+					const utils::ShortHashesSet& knownShortHashes) {
+				return view.unknownTransactions(Timestamp(), minFeeMultiplier, knownShortHashes);
+			}
+		};
+
+		template<typename TTraits>
+		void BenchmarkUtUnknownTransactions(benchmark::State& state) {
+			MemoryUtCache cache(Cache_Options);
+			auto transactionInfos = CreateRandomTransactionInfos(Num_Cache_Transactions);
+			{
+				auto modifier = cache.modifier();
+				for (const auto& transactionInfo : transactionInfos)
+					modifier.add(transactionInfo);
+			}
+
+			utils::ShortHashesSet knownShortHashes;
+			AddKnownShortHashes(transactionInfos, static_cast<size_t>(state.range(0)), [&knownShortHashes](auto shortHash) {
+				knownShortHashes.insert(shortHash);
+			});
+
+			auto view = cache.view();
+			for (auto _ : state)
+				benchmark::DoNotOptimize(TTraits::UnknownTransactions(view, BlockFeeMultiplier(10), knownShortHashes));
+
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Cache_Transactions * state.iterations()));
+		}
+
+		void Register(const char* name, void (*benchmarkFunc)(benchmark::State&)) {
+			// percentage of local transactions known by the peer
+			benchmark::RegisterBenchmark(name, benchmarkFunc)->ArgName("overlap")->Arg(0)->Arg(50)->Arg(90)->Arg(99);
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace catapult::cache;
+	Register("BenchmarkUtUnknownTransactions_Legacy", BenchmarkUtUnknownTransactions<LegacyUtTraits>);
+	Register("BenchmarkUtUnknownTransactions_Summary", BenchmarkUtUnknownTransactions<SummaryUtTraits>);
+}
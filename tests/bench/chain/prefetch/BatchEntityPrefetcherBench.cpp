@@ -0,0 +1,256 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache/CatapultCacheBuilder.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/cache_core/AccountStateCacheSubCachePlugin.h"
+#include "catapult/chain/BatchEntityPrefetcher.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <filesystem>
+
+namespace catapult { namespace chain {
+
+	namespace {
+		constexpr auto Database_Directory = "bench_prefetch_db";
+		constexpr auto Num_Accounts = 200'000u;
+		constexpr auto Network_Identifier = model::NetworkIdentifier::Private_Test;
+
+		Address CreateAddress(uint64_t seed) {
+			Address address;
+			std::memcpy(address.data(), &seed, sizeof(uint64_t));
+			std::memcpy(address.data() + sizeof(uint64_t), &seed, sizeof(uint64_t));
+			return address;
+		}
+
+		uint64_t ReadSeed(const Hash256& hash, size_t offset) {
+			uint64_t seed;
+			std::memcpy(&seed, hash.data() + offset, sizeof(uint64_t));
+			return seed % Num_Accounts;
+		}
+
+		// region BenchCache
+
+		// synthetic chain state that contains Num_Accounts accounts stored in a database
+		class BenchCache {
+		public:
+			BenchCache() : m_pCache(CreateCache()) {
+				auto delta = m_pCache->createDelta();
+				auto& accountStateCache = delta.sub<cache::AccountStateCache>();
+				for (auto i = 0u; i < Num_Accounts; ++i)
+					accountStateCache.addAccount(CreateAddress(i), Height(1));
+
+				m_pCache->commit(Height(1));
+			}
+
+			~BenchCache() {
+				m_pCache.reset();
+				std::filesystem::remove_all(Database_Directory);
+			}
+
+		public:
+			cache::CatapultCache& cache() {
+				return *m_pCache;
+			}
+
+		private:
+			static std::unique_ptr<cache::CatapultCache> CreateCache() {
+				std::filesystem::remove_all(Database_Directory);
+
+				auto cacheDatabaseConfig = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+				cacheDatabaseConfig.MaxWriteBatchSize = utils::FileSize::FromMegabytes(5);
+				auto cacheConfig = cache::CacheConfiguration(
+						Database_Directory,
+						cacheDatabaseConfig,
+						cache::PatriciaTreeStorageMode::Disabled);
+
+				auto options = cache::AccountStateCacheTypes::Options{
+					Network_Identifier, 359, 3, Amount(), Amount(), Amount(), MosaicId(1111), MosaicId(2222)
+				};
+
+				cache::CatapultCacheBuilder builder;
+				builder.add(std::make_unique<cache::AccountStateCacheSubCachePlugin>(cacheConfig, options));
+				return std::make_unique<cache::CatapultCache>(builder.build());
+			}
+
+		private:
+			std::unique_ptr<cache::CatapultCache> m_pCache;
+		};
+
+		BenchCache& GetBenchCache() {
+			static BenchCache benchCache;
+			return benchCache;
+		}
+
+		// endregion
+
+		// region TransferNotificationPublisher
+
+		// publishes a single transfer between two accounts derived from the entity hash
+		class TransferNotificationPublisher : public model::NotificationPublisher {
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& sub) const override {
+				auto sender = CreateAddress(ReadSeed(entityInfo.hash(), 0));
+				auto recipient = CreateAddress(ReadSeed(entityInfo.hash(), sizeof(uint64_t)));
+				sub.notify(model::BalanceTransferNotification(
+						sender,
+						recipient.copyTo<UnresolvedAddress>(),
+						UnresolvedMosaicId(1111),
+						Amount(1)));
+			}
+		};
+
+		// endregion
+
+		// region processors
+
+		// executes a transfer by looking up both accounts
+		class AccountLookupSubscriber : public model::NotificationSubscriber {
+		public:
+			explicit AccountLookupSubscriber(const cache::AccountStateCacheDelta& accountStateCache)
+					: m_accountStateCache(accountStateCache)
+					, m_numFound(0)
+			{}
+
+		public:
+			size_t numFound() const {
+				return m_numFound;
+			}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				const auto& transferNotification = static_cast<const model::BalanceTransferNotification&>(notification);
+				lookup(transferNotification.Sender);
+				lookup(transferNotification.Recipient.copyTo<Address>());
+			}
+
+		private:
+			void lookup(const Address& address) {
+				if (m_accountStateCache.find(address).tryGet())
+					++m_numFound;
+			}
+
+		private:
+			const cache::AccountStateCacheDelta& m_accountStateCache;
+			size_t m_numFound;
+		};
+
+		ExecutionConfiguration CreateExecutionConfiguration() {
+			ExecutionConfiguration config;
+			config.Network.Identifier = Network_Identifier;
+			config.ResolverContextFactory = [](const auto&) { return model::ResolverContext(); };
+			config.pNotificationPublisher = std::make_shared<TransferNotificationPublisher>();
+			return config;
+		}
+
+		BatchEntityProcessor CreateAccountLookupProcessor(const ExecutionConfiguration& config) {
+			auto pPublisher = config.pNotificationPublisher;
+			return [pPublisher](auto, auto, const auto& entityInfos, auto& state) {
+				const auto& catapultCache = state.Cache;
+				AccountLookupSubscriber sub(catapultCache.template sub<cache::AccountStateCache>());
+				for (const auto& entityInfo : entityInfos)
+					pPublisher->publish(entityInfo, sub);
+
+				return 2 * entityInfos.size() == sub.numFound()
+						? validators::ValidationResult::Success
+						: validators::ValidationResult::Failure;
+			};
+		}
+
+		std::vector<cache::CachePrefetcherFactory> CreateAccountPrefetcherFactories() {
+			return { cache::CreateCachePrefetcherFactory<cache::AccountStateCache, Address>(
+					cache::CachePrefetchPhase::Default,
+					[](const auto& notification, const auto&, auto& addresses) {
+						const auto& transferNotification = static_cast<const model::BalanceTransferNotification&>(notification);
+						addresses.push_back(transferNotification.Sender);
+						addresses.push_back(transferNotification.Recipient.template copyTo<Address>());
+					}) };
+		}
+
+		// endregion
+
+		template<typename TProcessorFactory>
+		void RunProcessorBenchmark(benchmark::State& state, TProcessorFactory processorFactory) {
+			auto& catapultCache = GetBenchCache().cache();
+			auto pPool = thread::CreateIoThreadPool(std::thread::hardware_concurrency());
+			pPool->start();
+
+			auto config = CreateExecutionConfiguration();
+			auto processor = processorFactory(config, *pPool);
+
+			// each synthetic block contains a single transfer per entity
+			auto numEntities = static_cast<size_t>(state.range(0));
+			model::VerifiableEntity entity{};
+			std::vector<Hash256> hashes(numEntities);
+
+			for (auto _ : state) {
+				state.PauseTiming();
+				model::WeakEntityInfos entityInfos;
+				for (auto& hash : hashes) {
+					bench::FillWithRandomData({ hash.data(), hash.size() });
+					entityInfos.emplace_back(entity, hash);
+				}
+
+				auto delta = catapultCache.createDelta();
+				auto observerState = observers::ObserverState(delta);
+				state.ResumeTiming();
+
+				auto result = processor(Height(2), Timestamp(), entityInfos, observerState);
+				if (validators::ValidationResult::Success != result)
+					state.SkipWithError("not all accounts were found");
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(numEntities * state.iterations()));
+			pPool->join();
+		}
+
+		void BenchmarkProcessWithoutPrefetch(benchmark::State& state) {
+			RunProcessorBenchmark(state, [](const auto& config, auto&) {
+				return CreateAccountLookupProcessor(config);
+			});
+		}
+
+		void BenchmarkProcessWithPrefetch(benchmark::State& state) {
+			RunProcessorBenchmark(state, [](const auto& config, auto& pool) {
+				auto prefetcher = CreateBatchEntityPrefetcher(config, CreateAccountPrefetcherFactories(), pool);
+				return CreatePrefetchingBatchEntityProcessor(prefetcher, CreateAccountLookupProcessor(config));
+			});
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkProcessWithoutPrefetch", catapult::chain::BenchmarkProcessWithoutPrefetch)
+			->UseRealTime()
+			->Arg(100)
+			->Arg(1'000)
+			->Arg(10'000);
+
+	benchmark::RegisterBenchmark("BenchmarkProcessWithPrefetch", catapult::chain::BenchmarkProcessWithPrefetch)
+			->UseRealTime()
+			->Arg(100)
+			->Arg(1'000)
+			->Arg(10'000);
+}
@@ -0,0 +1,183 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/consumers/SignatureInputCollector.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+	std::atomic<uint64_t> g_numAllocations(0);
+}
+
+// count all heap allocations so that allocations per block can be reported
+void* operator new(size_t size) {
+	++g_numAllocations;
+	if (auto* pMemory = std::malloc(0 == size ? 1 : size))
+		return pMemory;
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* pMemory) noexcept {
+	std::free(pMemory);
+}
+
+void operator delete(void* pMemory, size_t) noexcept {
+	std::free(pMemory);
+}
+
+namespace catapult { namespace consumers {
+
+	namespace {
+		constexpr auto Data_Size = 200u;
+
+		// region LegacySignatureCollector
+
+		// original collection strategy that creates a buffers vector for each signature
+		class LegacySignatureCollector : public model::NotificationSubscriber {
+		public:
+			explicit LegacySignatureCollector(const GenerationHashSeed& generationHashSeed)
+					: m_generationHashSeed(generationHashSeed)
+					, m_entityIndex(0)
+			{}
+
+		public:
+			const auto& inputs() const {
+				return m_inputs;
+			}
+
+		public:
+			void next() {
+				++m_entityIndex;
+			}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				if (model::SignatureNotification::Notification_Type != notification.Type)
+					return;
+
+				m_notificationToEntityIndexMap.push_back(m_entityIndex);
+
+				const auto& signatureNotification = static_cast<const model::SignatureNotification&>(notification);
+				std::vector<RawBuffer> buffers;
+				if (model::SignatureNotification::ReplayProtectionMode::Enabled == signatureNotification.DataReplayProtectionMode)
+					buffers.push_back(m_generationHashSeed);
+
+				buffers.push_back(signatureNotification.Data);
+				m_inputs.push_back({ signatureNotification.SignerPublicKey, buffers, signatureNotification.Signature });
+			}
+
+		private:
+			const GenerationHashSeed& m_generationHashSeed;
+			size_t m_entityIndex;
+			std::vector<size_t> m_notificationToEntityIndexMap;
+			std::vector<crypto::SignatureInput> m_inputs;
+		};
+
+		// endregion
+
+		struct BlockData {
+		public:
+			explicit BlockData(size_t numTransactions)
+					: PublicKeys(numTransactions)
+					, Signatures(numTransactions)
+					, Data(numTransactions * Data_Size) {
+				bench::FillWithRandomData(GenerationHashSeed);
+				for (auto i = 0u; i < numTransactions; ++i) {
+					bench::FillWithRandomData(PublicKeys[i]);
+					bench::FillWithRandomData(Signatures[i]);
+				}
+
+				bench::FillWithRandomData(Data);
+			}
+
+		public:
+			catapult::GenerationHashSeed GenerationHashSeed;
+			std::vector<Key> PublicKeys;
+			std::vector<Signature> Signatures;
+			std::vector<uint8_t> Data;
+		};
+
+		template<typename TCollector>
+		void Publish(const BlockData& blockData, TCollector& collector) {
+			for (auto i = 0u; i < blockData.PublicKeys.size(); ++i) {
+				collector.notify(model::SignatureNotification(
+						blockData.PublicKeys[i],
+						blockData.Signatures[i],
+						{ blockData.Data.data() + i * Data_Size, Data_Size },
+						model::SignatureNotification::ReplayProtectionMode::Enabled));
+				collector.next();
+			}
+		}
+
+		template<typename TCreateCollector>
+		void RunCollectionBenchmark(benchmark::State& state, TCreateCollector createCollector) {
+			auto numTransactions = static_cast<size_t>(state.range(0));
+			BlockData blockData(numTransactions);
+
+			uint64_t numAllocations = 0;
+			for (auto _ : state) {
+				auto numAllocationsStart = g_numAllocations.load();
+
+				auto pCollector = createCollector(blockData.GenerationHashSeed, numTransactions);
+				Publish(blockData, *pCollector);
+				benchmark::DoNotOptimize(pCollector->inputs().data());
+
+				numAllocations += g_numAllocations.load() - numAllocationsStart;
+			}
+
+			state.counters["allocations/block"] = static_cast<double>(numAllocations) / static_cast<double>(state.iterations());
+			state.SetItemsProcessed(static_cast<int64_t>(numTransactions * state.iterations()));
+		}
+
+		void BenchmarkCollectLegacy(benchmark::State& state) {
+			RunCollectionBenchmark(state, [](const auto& generationHashSeed, auto) {
+				return std::make_unique<LegacySignatureCollector>(generationHashSeed);
+			});
+		}
+
+		void BenchmarkCollectArena(benchmark::State& state) {
+			RunCollectionBenchmark(state, [](const auto& generationHashSeed, auto numTransactions) {
+				return std::make_unique<SignatureInputCollector>(generationHashSeed, numTransactions);
+			});
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkCollectLegacy", catapult::consumers::BenchmarkCollectLegacy)
+			->UseRealTime()
+			->Arg(1)
+			->Arg(100)
+			->Arg(1'000)
+			->Arg(6'000);
+
+	benchmark::RegisterBenchmark("BenchmarkCollectArena", catapult::consumers::BenchmarkCollectArena)
+			->UseRealTime()
+			->Arg(1)
+			->Arg(100)
+			->Arg(1'000)
+			->Arg(6'000);
+}
@@ -21,6 +21,7 @@
 
 #include "catapult/crypto/Hashes.h"
 #include "tests/bench/nodeps/Random.h"
+#include <openssl/evp.h>
 #include <benchmark/benchmark.h>
 
 namespace catapult { namespace crypto {
@@ -53,6 +54,19 @@ namespace catapult { namespace crypto {
 			static constexpr auto HashFunc = Sha3_256;
 		};
 
+		struct Sha3_256_Openssl_Traits {
+			using HashType = Hash256;
+
+			static void HashFunc(const RawBuffer& dataBuffer, Hash256& hash) {
+				auto outputSize = static_cast<unsigned int>(hash.size());
+
+				OpensslDigestContext context;
+				context.dispatch(EVP_DigestInit_ex, EVP_sha3_256(), nullptr);
+				context.dispatch(EVP_DigestUpdate, dataBuffer.pData, dataBuffer.Size);
+				context.dispatch(EVP_DigestFinal_ex, hash.data(), &outputSize);
+			}
+		};
+
 		// endregion
 
 		template<typename TTraits>
@@ -74,6 +88,38 @@ namespace catapult { namespace crypto {
 			for (auto arg : { 256, 1024, 4096, 16384})
 				benchmark.UseRealTime()->Arg(arg);
 		}
+
+		// region multi
+
+		// hashes 1024 buffers of state.range(0) bytes with at most state.range(1) parallel permutations
+		void BenchmarkSha3_256Multi(benchmark::State& state) {
+			constexpr auto Num_Buffers = 1024u;
+			std::vector<uint8_t> buffer(static_cast<size_t>(state.range(0)) * Num_Buffers);
+			std::vector<RawBuffer> dataBuffers;
+			for (auto i = 0u; i < Num_Buffers; ++i)
+				dataBuffers.push_back({ buffer.data() + i * static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(0)) });
+
+			std::vector<Hash256> hashes(Num_Buffers);
+			for (auto _ : state) {
+				state.PauseTiming();
+				bench::FillWithRandomData(buffer);
+				state.ResumeTiming();
+
+				Sha3_256Multi(dataBuffers.data(), hashes.data(), dataBuffers.size(), static_cast<size_t>(state.range(1)));
+			}
+
+			state.SetBytesProcessed(static_cast<int64_t>(buffer.size() * state.iterations()));
+		}
+
+		void AddMultiArguments(benchmark::internal::Benchmark& benchmark) {
+			// 64 bytes corresponds to a merkle node and ~100 bytes to a typical tree node
+			for (auto size : { 64, 100, 256 }) {
+				for (auto parallelism : { 1, 4, 8 })
+					benchmark.UseRealTime()->Args({ size, parallelism });
+			}
+		}
+
+		// endregion
 	}
 }}
 
@@ -89,4 +135,7 @@ void RegisterTests() {
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha256Double_Traits);
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha512_Traits);
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha3_256_Traits);
+	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha3_256_Openssl_Traits);
+
+	catapult::crypto::AddMultiArguments(*REGISTER_BENCHMARK(catapult::crypto::BenchmarkSha3_256Multi));
 }
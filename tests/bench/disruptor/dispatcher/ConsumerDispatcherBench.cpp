@@ -0,0 +1,80 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/disruptor/ConsumerDispatcher.h"
+#include <benchmark/benchmark.h>
+#include <thread>
+
+namespace catapult { namespace disruptor {
+
+	namespace {
+		ConsumerInput CreateInput() {
+			uint8_t* pData;
+			auto range = model::TransactionRange::PrepareFixed(1, &pData);
+			reinterpret_cast<model::Transaction&>(*pData).Size = sizeof(model::Transaction);
+			return ConsumerInput(std::move(range));
+		}
+
+		void BenchmarkElementLatency(benchmark::State& state, WaitStrategy waitStrategy) {
+			auto options = ConsumerDispatcherOptions("bench dispatcher", 1024);
+			options.ConsumerWaitStrategy = waitStrategy;
+
+			auto numConsumers = static_cast<size_t>(state.range(0));
+			std::vector<DisruptorConsumer> consumers(numConsumers, [](const auto&) { return ConsumerResult::Continue(); });
+			ConsumerDispatcher dispatcher(options, consumers);
+
+			std::atomic_bool isProcessingComplete(false);
+			for (auto _ : state) {
+				auto input = CreateInput();
+				isProcessingComplete = false;
+
+				// measure time from element submission until the last consumer has processed it
+				auto start = std::chrono::steady_clock::now();
+				dispatcher.processElement(std::move(input), [&isProcessingComplete](auto, const auto&) {
+					isProcessingComplete = true;
+				});
+
+				while (!isProcessingComplete)
+					std::this_thread::yield();
+
+				auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::steady_clock::now() - start);
+				state.SetIterationTime(elapsed.count());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+			state.counters["hops"] = static_cast<double>(numConsumers);
+		}
+
+		void RegisterStrategy(const char* name, WaitStrategy waitStrategy) {
+			auto* pBenchmark = benchmark::RegisterBenchmark(name, BenchmarkElementLatency, waitStrategy);
+			for (auto numConsumers : { 1, 4, 10 })
+				pBenchmark->UseManualTime()->Arg(numConsumers);
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using catapult::disruptor::WaitStrategy;
+	catapult::disruptor::RegisterStrategy("BenchmarkElementLatency_BusySpin", WaitStrategy::Busy_Spin);
+	catapult::disruptor::RegisterStrategy("BenchmarkElementLatency_SpinThenYield", WaitStrategy::Spin_Then_Yield);
+	catapult::disruptor::RegisterStrategy("BenchmarkElementLatency_Blocking", WaitStrategy::Blocking);
+}
@@ -0,0 +1,111 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "plugins/coresystem/src/importance/ImportanceCalculator.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace importance {
+
+	namespace {
+		constexpr MosaicId Harvesting_Mosaic_Id(9876);
+		constexpr Amount Min_Harvester_Balance(1'000'000);
+
+		model::BlockChainConfiguration CreateBlockChainConfiguration() {
+			auto config = model::BlockChainConfiguration::Uninitialized();
+			config.HarvestingMosaicId = Harvesting_Mosaic_Id;
+			config.ImportanceGrouping = 1;
+			config.TotalChainImportance = Importance(8'999'999'998'000'000);
+			config.ImportanceActivityPercentage = 5;
+			config.MinHarvesterBalance = Min_Harvester_Balance;
+			return config;
+		}
+
+		cache::AccountStateCacheTypes::Options CreateAccountStateCacheOptions() {
+			return {
+				model::NetworkIdentifier::Private_Test,
+				1,
+				1,
+				Min_Harvester_Balance,
+				Amount(std::numeric_limits<Amount::ValueType>::max()),
+				Amount(),
+				MosaicId(1111),
+				Harvesting_Mosaic_Id
+			};
+		}
+
+		void SeedAccounts(cache::AccountStateCacheDelta& delta, size_t numAccounts) {
+			for (auto i = 0u; i < numAccounts; ++i) {
+				Address address;
+				bench::FillWithRandomData(address);
+				delta.addAccount(address, Height(1));
+
+				// give all accounts some (random) activity, so that activity importances need to be calculated
+				auto& accountState = delta.find(address).get();
+				accountState.Balances.credit(Harvesting_Mosaic_Id, Min_Harvester_Balance + Amount(bench::Random() % 1'000'000'000));
+				accountState.ActivityBuckets.update(model::ImportanceHeight(1), [](auto& bucket) {
+					bucket.TotalFeesPaid = Amount(bench::Random() % 10'000);
+					bucket.BeneficiaryCount = static_cast<uint32_t>(bench::Random() % 100);
+				});
+			}
+
+			delta.updateHighValueAccounts(Height(1));
+		}
+
+		void BenchmarkRecalculate(benchmark::State& state) {
+			auto numAccounts = static_cast<size_t>(state.range(0));
+			auto numWorkerThreads = static_cast<uint32_t>(state.range(1));
+
+			cache::AccountStateCache cache(cache::CacheConfiguration(), CreateAccountStateCacheOptions());
+			auto delta = cache.createDelta();
+			SeedAccounts(*delta, numAccounts);
+
+			// parallelize all recalculations when more than one thread is requested
+			auto pPool = thread::CreateIoThreadPool(numWorkerThreads);
+			pPool->start();
+			auto pCalculator = CreateImportanceCalculator(CreateBlockChainConfiguration(), [&pPool]() { return pPool.get(); }, 0);
+
+			auto importanceHeight = model::ImportanceHeight(1);
+			for (auto _ : state) {
+				importanceHeight = importanceHeight + model::ImportanceHeight(1);
+				pCalculator->recalculate(ImportanceRollbackMode::Disabled, importanceHeight, *delta);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(numAccounts * state.iterations()));
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkRecalculate", catapult::importance::BenchmarkRecalculate)
+			->UseRealTime()
+			->Unit(benchmark::kMillisecond)
+			->Args({ 100'000, 1 })
+			->Args({ 100'000, 4 })
+			->Args({ 1'000'000, 1 })
+			->Args({ 1'000'000, 2 })
+			->Args({ 1'000'000, 4 })
+			->Args({ 1'000'000, 8 });
+}
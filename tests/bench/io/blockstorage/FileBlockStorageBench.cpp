@@ -0,0 +1,155 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/model/BlockUtils.h"
+#include "catapult/model/EntityType.h"
+#include "catapult/utils/MemoryUtils.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+namespace catapult { namespace io {
+
+	namespace {
+		constexpr auto Storage_Directory = "bench_block_storage";
+		constexpr auto File_Database_Batch_Size = 100u;
+		constexpr auto Num_Blocks = 2'000u;
+		constexpr auto Num_Transactions_Per_Block = 50u;
+		constexpr auto Transaction_Size = 256u;
+
+		// region BenchStorage
+
+		// synthetic chain of Num_Blocks blocks with random transactions stored in a file block storage
+		class BenchStorage {
+		public:
+			BenchStorage() {
+				std::filesystem::remove_all(Storage_Directory);
+				std::filesystem::create_directories(Storage_Directory);
+
+				FileBlockStorage storage(Storage_Directory, File_Database_Batch_Size, FileBlockStorageMode::None);
+				for (auto i = 1u; i <= Num_Blocks; ++i) {
+					auto pBlock = CreateBlock(Height(i));
+					auto blockElement = model::BlockElement(*pBlock);
+					bench::FillWithRandomData(blockElement.EntityHash);
+					bench::FillWithRandomData(blockElement.GenerationHash);
+					for (const auto& transaction : pBlock->Transactions()) {
+						blockElement.Transactions.push_back(model::TransactionElement(transaction));
+						bench::FillWithRandomData(blockElement.Transactions.back().EntityHash);
+						bench::FillWithRandomData(blockElement.Transactions.back().MerkleComponentHash);
+					}
+
+					storage.saveBlock(blockElement);
+				}
+			}
+
+			~BenchStorage() {
+				std::filesystem::remove_all(Storage_Directory);
+			}
+
+		private:
+			static std::unique_ptr<model::Block> CreateBlock(Height height) {
+				model::Transactions transactions;
+				for (auto i = 0u; i < Num_Transactions_Per_Block; ++i) {
+					auto pTransaction = utils::MakeUniqueWithSize<model::Transaction>(Transaction_Size);
+					bench::FillWithRandomData({ reinterpret_cast<uint8_t*>(pTransaction.get()), Transaction_Size });
+					pTransaction->Size = Transaction_Size;
+					transactions.push_back(std::move(pTransaction));
+				}
+
+				model::PreviousBlockContext context;
+				context.BlockHeight = height - Height(1);
+
+				Key signerPublicKey;
+				bench::FillWithRandomData(signerPublicKey);
+				return model::CreateBlock(
+						model::Entity_Type_Block_Normal,
+						context,
+						model::NetworkIdentifier::Private_Test,
+						signerPublicKey,
+						transactions);
+			}
+		};
+
+		void EnsureBenchStorage() {
+			static BenchStorage benchStorage;
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		// state.range(0) is the maximum number of mapped files, where zero selects the stream-based read path
+		template<typename THeightGenerator>
+		void RunLoadBlockElementBenchmark(benchmark::State& state, THeightGenerator heightGenerator) {
+			EnsureBenchStorage();
+
+			auto maxMappedFiles = static_cast<uint32_t>(state.range(0));
+			FileBlockStorage storage(Storage_Directory, File_Database_Batch_Size, FileBlockStorageMode::None, maxMappedFiles);
+
+			size_t numBytes = 0;
+			for (auto _ : state) {
+				for (auto i = 0u; i < Num_Blocks; ++i) {
+					auto pBlockElement = storage.loadBlockElement(heightGenerator(i));
+
+					// touch all transactions so that mapped pages are actually read
+					for (const auto& transactionElement : pBlockElement->Transactions)
+						numBytes += transactionElement.Transaction.Size;
+
+					benchmark::DoNotOptimize(pBlockElement);
+				}
+			}
+
+			benchmark::DoNotOptimize(numBytes);
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Blocks * state.iterations()));
+			state.SetBytesProcessed(static_cast<int64_t>(numBytes));
+		}
+
+		void BenchmarkLoadBlockElementSequential(benchmark::State& state) {
+			RunLoadBlockElementBenchmark(state, [](auto index) {
+				return Height(index + 1);
+			});
+		}
+
+		void BenchmarkLoadBlockElementRandom(benchmark::State& state) {
+			RunLoadBlockElementBenchmark(state, [](auto) {
+				return Height(bench::Random() % Num_Blocks + 1);
+			});
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkLoadBlockElementSequential", catapult::io::BenchmarkLoadBlockElementSequential)
+			->UseRealTime()
+			->Arg(0)
+			->Arg(1)
+			->Arg(20);
+
+	benchmark::RegisterBenchmark("BenchmarkLoadBlockElementRandom", catapult::io::BenchmarkLoadBlockElementRandom)
+			->UseRealTime()
+			->Arg(0)
+			->Arg(1)
+			->Arg(20);
+}
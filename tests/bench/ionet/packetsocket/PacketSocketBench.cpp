@@ -0,0 +1,212 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/Node.h"
+#include "catapult/ionet/PacketPayloadBuilder.h"
+#include "catapult/ionet/PacketSocket.h"
+#include "catapult/thread/Future.h"
+#include "catapult/thread/IoThreadPool.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+namespace catapult { namespace ionet {
+
+	namespace {
+		// certificates are expected in the working directory (tests generate this directory on first use)
+		constexpr auto Certificate_Directory = "./cert";
+
+		// size of a typical (small) transaction
+		constexpr uint32_t Entity_Size = 256;
+
+		// region SocketPair
+
+		PacketSocketOptions CreatePacketSocketOptions() {
+			PacketSocketOptions options;
+			options.AcceptHandshakeTimeout = utils::TimeSpan::FromSeconds(10);
+			options.WorkingBufferSize = 16 * 1024;
+			options.WorkingBufferSensitivity = 0;
+			options.MaxPacketDataSize = 150 * 1024 * 1024;
+			options.OutgoingProtocols = IpProtocol::IPv4;
+			options.SslOptions.ContextSupplier = CreateSslContextSupplier(Certificate_Directory);
+			options.SslOptions.VerifyCallbackSupplier = []() {
+				return [](auto& verifyContext) {
+					verifyContext.setPublicKey(Key());
+					return true;
+				};
+			};
+			return options;
+		}
+
+		// ssl socket pair connected over loopback
+		class SocketPair {
+		public:
+			explicit SocketPair(thread::IoThreadPool& pool)
+					: m_acceptor(pool.ioContext(), boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0)) {
+				auto options = CreatePacketSocketOptions();
+
+				thread::promise<PacketSocketInfo> acceptPromise;
+				auto acceptFuture = acceptPromise.get_future();
+				Accept(pool.ioContext(), m_acceptor, options, [&acceptPromise](const auto& socketInfo) {
+					acceptPromise.set_value(PacketSocketInfo(socketInfo));
+				});
+
+				thread::promise<PacketSocketInfo> connectPromise;
+				auto connectFuture = connectPromise.get_future();
+				auto endpoint = NodeEndpoint{ "127.0.0.1", m_acceptor.local_endpoint().port() };
+				Connect(pool.ioContext(), options, endpoint, [&connectPromise](auto, const auto& socketInfo) {
+					connectPromise.set_value(PacketSocketInfo(socketInfo));
+				});
+
+				m_pWriter = acceptFuture.get().socket();
+				m_pReader = connectFuture.get().socket();
+			}
+
+			~SocketPair() {
+				if (m_pWriter)
+					m_pWriter->close();
+
+				if (m_pReader)
+					m_pReader->close();
+			}
+
+		public:
+			explicit operator bool() const {
+				return m_pWriter && m_pReader;
+			}
+
+			PacketSocket& writer() {
+				return *m_pWriter;
+			}
+
+			PacketSocket& reader() {
+				return *m_pReader;
+			}
+
+		private:
+			boost::asio::ip::tcp::acceptor m_acceptor;
+			std::shared_ptr<PacketSocket> m_pWriter;
+			std::shared_ptr<PacketSocket> m_pReader;
+		};
+
+		// endregion
+
+		// region benchmark
+
+		void ReadPackets(PacketIo& io, size_t numRemaining, const std::shared_ptr<thread::promise<bool>>& pPromise) {
+			io.read([&io, numRemaining, pPromise](auto code, const auto*) {
+				if (SocketOperationCode::Success != code) {
+					pPromise->set_value(false);
+					return;
+				}
+
+				if (1 == numRemaining)
+					pPromise->set_value(true);
+				else
+					ReadPackets(io, numRemaining - 1, pPromise);
+			});
+		}
+
+		std::shared_ptr<Packet> CreateEntityPacket() {
+			auto pPacket = CreateSharedPacket<Packet>(Entity_Size - sizeof(Packet));
+			pPacket->Type = PacketType::Push_Transactions;
+			return pPacket;
+		}
+
+		struct MultiBufferPayloadTraits {
+			// single payload composed of one buffer per entity (e.g. a push transactions packet)
+			static std::vector<PacketPayload> CreatePayloads(size_t numEntities) {
+				PacketPayloadBuilder builder(PacketType::Push_Transactions);
+				for (auto i = 0u; i < numEntities; ++i)
+					builder.appendEntity(CreateEntityPacket());
+
+				return { builder.build() };
+			}
+
+		};
+
+		struct BufferedSmallPayloadsTraits {
+			// one small payload per entity (e.g. many independent responses)
+			static std::vector<PacketPayload> CreatePayloads(size_t numEntities) {
+				std::vector<PacketPayload> payloads;
+				for (auto i = 0u; i < numEntities; ++i)
+					payloads.emplace_back(CreateEntityPacket());
+
+				return payloads;
+			}
+
+		};
+
+		template<typename TTraits>
+		void BenchmarkSslThroughput(benchmark::State& state) {
+			if (!std::filesystem::exists(Certificate_Directory)) {
+				state.SkipWithError("certificate directory does not exist");
+				return;
+			}
+
+			auto pPool = thread::CreateIoThreadPool(2);
+			pPool->start();
+
+			{
+				SocketPair socketPair(*pPool);
+				if (!socketPair) {
+					state.SkipWithError("could not create socket pair");
+				} else {
+					auto payloads = TTraits::CreatePayloads(static_cast<size_t>(state.range(0)));
+					uint64_t numBytes = 0;
+					for (const auto& payload : payloads)
+						numBytes += payload.header().Size;
+
+					// all writes are issued via buffered io because a write can still be in progress when the reader completes
+					auto pWriteIo = socketPair.writer().buffered();
+					for (auto _ : state) {
+						auto pPromise = std::make_shared<thread::promise<bool>>();
+						auto future = pPromise->get_future();
+						ReadPackets(socketPair.reader(), payloads.size(), pPromise);
+						for (const auto& payload : payloads)
+							pWriteIo->write(payload, [](auto) {});
+
+						if (!future.get()) {
+							state.SkipWithError("read failed");
+							break;
+						}
+					}
+
+					state.SetBytesProcessed(static_cast<int64_t>(numBytes * state.iterations()));
+				}
+			}
+
+			pPool->join();
+		}
+
+		void Register(const char* name, void (*benchmarkFunc)(benchmark::State&)) {
+			benchmark::RegisterBenchmark(name, benchmarkFunc)->UseRealTime()->Arg(1)->Arg(16)->Arg(256)->Arg(1024);
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace catapult::ionet;
+	Register("BenchmarkSslThroughput_MultiBufferPayload", BenchmarkSslThroughput<MultiBufferPayloadTraits>);
+	Register("BenchmarkSslThroughput_BufferedSmallPayloads", BenchmarkSslThroughput<BufferedSmallPayloadsTraits>);
+}
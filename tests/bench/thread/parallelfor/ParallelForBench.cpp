@@ -0,0 +1,111 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <thread>
+
+namespace catapult { namespace thread {
+
+	namespace {
+		// items in the first sixteenth of the range are this many times more expensive than all other items
+		// (e.g. a block containing a large aggregate transaction)
+		constexpr uint32_t Heavy_Item_Multiplier = 64;
+		constexpr uint32_t Light_Item_Cost = 256;
+
+		std::vector<uint32_t> CreateSkewedCosts(size_t numItems) {
+			std::vector<uint32_t> costs(numItems, Light_Item_Cost);
+			std::fill(costs.begin(), costs.begin() + static_cast<std::ptrdiff_t>(numItems / 16), Light_Item_Cost * Heavy_Item_Multiplier);
+			return costs;
+		}
+
+		bool ProcessItem(uint32_t cost) {
+			auto value = static_cast<uint64_t>(cost);
+			for (auto i = 0u; i < cost; ++i) {
+				value = value * 6364136223846793005ull + 1442695040888963407ull;
+				benchmark::DoNotOptimize(value);
+			}
+
+			return true;
+		}
+
+		struct StaticPartitionTraits {
+			static thread::future<bool> Process(IoThreadPool& pool, const std::vector<uint32_t>& costs) {
+				// emulates the fixed partitioning that ParallelFor used before work stealing
+				return ParallelForPartition(pool.ioContext(), costs, pool.numWorkerThreads(), [](auto itBegin, auto itEnd, auto, auto) {
+					for (auto iter = itBegin; itEnd != iter; ++iter)
+						ProcessItem(*iter);
+				});
+			}
+		};
+
+		struct WorkStealingTraits {
+			static thread::future<bool> Process(IoThreadPool& pool, const std::vector<uint32_t>& costs) {
+				return ParallelFor(pool.ioContext(), costs, pool.numWorkerThreads(), [](auto cost, auto) {
+					return ProcessItem(cost);
+				});
+			}
+		};
+
+		double Percentile(const std::vector<double>& sortedDurations, size_t percentile) {
+			auto rank = (sortedDurations.size() * percentile + 99) / 100;
+			return sortedDurations[std::max<size_t>(1, rank) - 1];
+		}
+
+		template<typename TTraits>
+		void BenchmarkSkewedParallelFor(benchmark::State& state) {
+			auto pPool = CreateIoThreadPool(std::max<size_t>(2, std::thread::hardware_concurrency()));
+			pPool->start();
+
+			auto costs = CreateSkewedCosts(static_cast<size_t>(state.range(0)));
+			std::vector<double> durations;
+			for (auto _ : state) {
+				// measure time until the slowest item has been processed
+				auto start = std::chrono::steady_clock::now();
+				TTraits::Process(*pPool, costs).get();
+
+				auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::steady_clock::now() - start);
+				state.SetIterationTime(elapsed.count());
+				durations.push_back(elapsed.count() * 1'000'000);
+			}
+
+			std::sort(durations.begin(), durations.end());
+			state.SetItemsProcessed(static_cast<int64_t>(costs.size() * state.iterations()));
+			state.counters["p50_us"] = Percentile(durations, 50);
+			state.counters["p99_us"] = Percentile(durations, 99);
+			state.counters["max_us"] = durations.back();
+			pPool->join();
+		}
+
+		void Register(const char* name, void (*benchmarkFunc)(benchmark::State&)) {
+			benchmark::RegisterBenchmark(name, benchmarkFunc)->UseManualTime()->Arg(256)->Arg(1024)->Arg(4096);
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace catapult::thread;
+	Register("BenchmarkSkewedParallelFor_StaticPartition", BenchmarkSkewedParallelFor<StaticPartitionTraits>);
+	Register("BenchmarkSkewedParallelFor_WorkStealing", BenchmarkSkewedParallelFor<WorkStealingTraits>);
+}
@@ -0,0 +1,143 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/tree/MemoryDataSource.h"
+#include "catapult/tree/PatriciaTree.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <bitset>
+
+namespace catapult { namespace tree {
+
+	namespace {
+		// region memory estimates
+
+		// mirrors the layout of TreeNode before it was changed to a variant with sparse branch links
+		struct LegacyTreeNodeLayout {
+			struct LegacyBranchTreeNode {
+				TreeNodePath Path;
+				std::array<Hash256, BranchTreeNode::Max_Links> Links;
+				std::array<std::shared_ptr<const TreeNode>, BranchTreeNode::Max_Links> LinkedNodes;
+				std::bitset<BranchTreeNode::Max_Links> LinkSet;
+				Hash256 Hash;
+				bool IsDirty;
+			};
+
+			LeafTreeNode LeafNode;
+			LegacyBranchTreeNode BranchNode;
+			uint32_t TreeNodeType;
+			TreeNodePath EmptyPath;
+			Hash256 EmptyHash;
+		};
+
+		// size of a single (sparse) branch link
+		constexpr size_t Link_Size = sizeof(Hash256) + sizeof(std::shared_ptr<const TreeNode>);
+
+		size_t EstimateNodeSize(const TreeNode& node) {
+			return sizeof(TreeNode) + (node.isBranch() ? node.asBranchNode().numLinks() * Link_Size : 0);
+		}
+
+		// endregion
+
+		// region benchmark
+
+		struct PassThroughEncoder {
+			using KeyType = Hash256;
+			using ValueType = Hash256;
+
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static const Hash256& EncodeValue(const ValueType& value) {
+				return value;
+			}
+		};
+
+		using MemoryPatriciaTree = PatriciaTree<PassThroughEncoder, MemoryDataSource>;
+
+		std::vector<Hash256> GenerateKeys(size_t count) {
+			std::vector<Hash256> keys(count);
+			for (auto& key : keys)
+				bench::FillWithRandomData(key);
+
+			return keys;
+		}
+
+		void BenchmarkInsert(benchmark::State& state) {
+			auto keys = GenerateKeys(static_cast<size_t>(state.range(0)));
+			size_t numNodes = 0;
+			size_t numBytes = 0;
+			for (auto _ : state) {
+				MemoryDataSource dataSource;
+				MemoryPatriciaTree tree(dataSource);
+				for (const auto& key : keys)
+					tree.set(key, key);
+
+				benchmark::DoNotOptimize(tree.root());
+
+				state.PauseTiming();
+				tree.saveAll();
+				numNodes = dataSource.size();
+				numBytes = 0;
+				dataSource.forEach([&numBytes](const auto& node) {
+					numBytes += EstimateNodeSize(node);
+				});
+				state.ResumeTiming();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(keys.size() * state.iterations()));
+			state.counters["nodes"] = static_cast<double>(numNodes);
+			state.counters["bytes_per_node"] = static_cast<double>(numBytes) / static_cast<double>(numNodes);
+			state.counters["legacy_bytes_per_node"] = static_cast<double>(sizeof(LegacyTreeNodeLayout));
+		}
+
+		void BenchmarkLookup(benchmark::State& state) {
+			auto keys = GenerateKeys(static_cast<size_t>(state.range(0)));
+			MemoryDataSource dataSource;
+			MemoryPatriciaTree tree(dataSource);
+			for (const auto& key : keys)
+				tree.set(key, key);
+
+			for (auto _ : state) {
+				for (const auto& key : keys) {
+					std::vector<TreeNode> nodePath;
+					benchmark::DoNotOptimize(tree.lookup(key, nodePath));
+				}
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(keys.size() * state.iterations()));
+		}
+
+		void Register(const char* name, void (*benchmarkFunc)(benchmark::State&)) {
+			benchmark::RegisterBenchmark(name, benchmarkFunc)->Arg(1'000)->Arg(10'000)->Arg(100'000);
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace catapult::tree;
+	Register("BenchmarkInsert", BenchmarkInsert);
+	Register("BenchmarkLookup", BenchmarkLookup);
+}
@@ -0,0 +1,230 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/validators/AggregateValidatorBuilder.h"
+#include "catapult/validators/DemuxValidatorBuilder.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <array>
+#include <utility>
+
+namespace catapult { namespace validators {
+
+	namespace {
+		// approximate the registrations of all plugins: validators for most types, a few validators that are always invoked
+		constexpr auto Num_Notification_Types = 60u;
+		constexpr auto Num_Typed_Validators = 115u;
+		constexpr auto Num_Always_Validators = 5u;
+		constexpr auto Num_Notifications_Per_Transaction = 8u;
+
+		constexpr uint32_t GetRawNotificationType(uint32_t index) {
+			// spread types across facilities with small contiguous codes (like the plugins do)
+			return 0x01000000 | (0x41 + index / 6) << 16 | (1 + index % 6);
+		}
+
+		template<uint32_t Index>
+		struct BenchNotification : public model::Notification {
+		public:
+			static constexpr auto Notification_Type = static_cast<model::NotificationType>(GetRawNotificationType(Index));
+
+		public:
+			BenchNotification() : Notification(Notification_Type, sizeof(BenchNotification))
+			{}
+		};
+
+		template<typename TNotification>
+		class BenchValidator : public stateful::NotificationValidatorT<TNotification> {
+		public:
+			explicit BenchValidator(size_t& numCalls)
+					: m_name("bench")
+					, m_numCalls(numCalls)
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			ValidationResult validate(const TNotification&, const ValidatorContext&) const override {
+				++m_numCalls;
+				return ValidationResult::Success;
+			}
+
+		private:
+			std::string m_name;
+			size_t& m_numCalls;
+		};
+
+		// region LegacyDemuxValidatorBuilder
+
+		// original dispatch strategy that wraps each typed validator in a predicate checked for every notification
+		class LegacyDemuxValidatorBuilder {
+		private:
+			using NotificationValidatorPredicate = predicate<const model::Notification&>;
+
+		public:
+			template<typename TNotification>
+			LegacyDemuxValidatorBuilder& add(stateful::NotificationValidatorPointerT<TNotification>&& pValidator) {
+				if constexpr (!std::is_same_v<model::Notification, TNotification>) {
+					auto predicate = [type = TNotification::Notification_Type](const auto& notification) {
+						return model::AreEqualExcludingChannel(type, notification.Type);
+					};
+					m_builder.add(std::make_unique<ConditionalValidator<TNotification>>(std::move(pValidator), predicate));
+				} else {
+					m_builder.add(std::move(pValidator));
+				}
+
+				return *this;
+			}
+
+			auto build(const ValidationResultPredicate& isSuppressedFailure) {
+				return m_builder.build(isSuppressedFailure);
+			}
+
+		private:
+			template<typename TNotification>
+			class ConditionalValidator : public stateful::NotificationValidator {
+			public:
+				ConditionalValidator(
+						stateful::NotificationValidatorPointerT<TNotification>&& pValidator,
+						const NotificationValidatorPredicate& predicate)
+						: m_pValidator(std::move(pValidator))
+						, m_predicate(predicate)
+				{}
+
+			public:
+				const std::string& name() const override {
+					return m_pValidator->name();
+				}
+
+				ValidationResult validate(const model::Notification& notification, const ValidatorContext& context) const override {
+					if (!m_predicate(notification))
+						return ValidationResult::Success;
+
+					return m_pValidator->validate(static_cast<const TNotification&>(notification), context);
+				}
+
+			private:
+				stateful::NotificationValidatorPointerT<TNotification> m_pValidator;
+				NotificationValidatorPredicate m_predicate;
+			};
+
+		private:
+			AggregateValidatorBuilder<model::Notification, const ValidatorContext&> m_builder;
+		};
+
+		// endregion
+
+		// region registration
+
+		template<typename TBuilder, size_t... Indexes>
+		void AddTypedValidators(TBuilder& builder, size_t& numCalls, std::index_sequence<Indexes...>) {
+			(builder.add(stateful::NotificationValidatorPointerT<BenchNotification<Indexes % Num_Notification_Types>>(
+					std::make_unique<BenchValidator<BenchNotification<Indexes % Num_Notification_Types>>>(numCalls))), ...);
+		}
+
+		template<typename TBuilder>
+		auto BuildValidator(size_t& numCalls) {
+			TBuilder builder;
+			for (auto i = 0u; i < Num_Always_Validators; ++i) {
+				auto pValidator = std::make_unique<BenchValidator<model::Notification>>(numCalls);
+				builder.add(stateful::NotificationValidatorPointerT<model::Notification>(std::move(pValidator)));
+			}
+
+			AddTypedValidators(builder, numCalls, std::make_index_sequence<Num_Typed_Validators>());
+			return builder.build([](auto) { return false; });
+		}
+
+		// endregion
+
+		// region block notifications
+
+		using NotificationPointers = std::vector<std::unique_ptr<model::Notification>>;
+		using NotificationFactory = std::unique_ptr<model::Notification> (*)();
+
+		template<size_t... Indexes>
+		auto CreateNotificationFactories(std::index_sequence<Indexes...>) {
+			return std::array<NotificationFactory, sizeof...(Indexes)>{{
+				[]() -> std::unique_ptr<model::Notification> { return std::make_unique<BenchNotification<Indexes>>(); }...
+			}};
+		}
+
+		NotificationPointers CreateBlockNotifications(size_t numTransactions) {
+			auto factories = CreateNotificationFactories(std::make_index_sequence<Num_Notification_Types>());
+
+			NotificationPointers notifications;
+			for (auto i = 0u; i < numTransactions * Num_Notifications_Per_Transaction; ++i)
+				notifications.push_back(factories[bench::Random() % Num_Notification_Types]());
+
+			return notifications;
+		}
+
+		// endregion
+
+		template<typename TBuilder>
+		void RunValidationBenchmark(benchmark::State& state) {
+			auto numTransactions = static_cast<size_t>(state.range(0));
+			auto notifications = CreateBlockNotifications(numTransactions);
+
+			size_t numCalls = 0;
+			auto pValidator = BuildValidator<TBuilder>(numCalls);
+
+			cache::CatapultCache cache({});
+			auto cacheView = cache.createView();
+			auto readOnlyCache = cacheView.toReadOnly();
+			auto notificationContext = model::NotificationContext(Height(1), model::ResolverContext());
+			auto context = ValidatorContext(notificationContext, Timestamp(), model::NetworkInfo(), readOnlyCache);
+
+			for (auto _ : state) {
+				for (const auto& pNotification : notifications)
+					benchmark::DoNotOptimize(pValidator->validate(*pNotification, context));
+			}
+
+			state.counters["validators/notification"] = static_cast<double>(numCalls)
+					/ static_cast<double>(notifications.size() * state.iterations());
+			state.SetItemsProcessed(static_cast<int64_t>(numTransactions * state.iterations()));
+		}
+
+		void BenchmarkValidatePredicateDispatch(benchmark::State& state) {
+			RunValidationBenchmark<LegacyDemuxValidatorBuilder>(state);
+		}
+
+		void BenchmarkValidateTableDispatch(benchmark::State& state) {
+			RunValidationBenchmark<stateful::DemuxValidatorBuilder>(state);
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkValidatePredicateDispatch", catapult::validators::BenchmarkValidatePredicateDispatch)
+			->UseRealTime()
+			->Arg(100)
+			->Arg(1'000)
+			->Arg(6'000);
+
+	benchmark::RegisterBenchmark("BenchmarkValidateTableDispatch", catapult::validators::BenchmarkValidateTableDispatch)
+			->UseRealTime()
+			->Arg(100)
+			->Arg(1'000)
+			->Arg(6'000);
+}
@@ -0,0 +1,187 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache/CachePrefetcher.h"
+#include "catapult/cache/CatapultCacheBuilder.h"
+#include "tests/test/cache/SimpleCache.h"
+#include "tests/test/core/NotificationTestUtils.h"
+#include "tests/test/core/ResolverTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS CachePrefetcherTests
+
+	namespace {
+		using NotificationType = model::AccountPublicKeyNotification;
+
+		class PrefetchCapturingDeltaExtension : public test::SimpleCacheDefaultDeltaExtension {
+		public:
+			using SimpleCacheDefaultDeltaExtension::SimpleCacheDefaultDeltaExtension;
+
+		public:
+			const auto& prefetchedKeys() const {
+				return m_prefetchedKeys;
+			}
+
+			void prefetch(const std::vector<uint64_t>& keys) const {
+				m_prefetchedKeys.push_back(keys);
+			}
+
+		private:
+			mutable std::vector<std::vector<uint64_t>> m_prefetchedKeys;
+		};
+
+		using PrefetchCapturingCache = test::SimpleCacheT<2, test::SimpleCacheDefaultViewExtension, PrefetchCapturingDeltaExtension>;
+		using PrefetchCapturingStorageTraits = test::SimpleCacheExtensionStorageTraits<
+			test::SimpleCacheDefaultViewExtension,
+			PrefetchCapturingDeltaExtension>;
+
+		CatapultCache CreatePrefetchCapturingCatapultCache() {
+			CatapultCacheBuilder builder;
+			builder.add<PrefetchCapturingStorageTraits>(std::make_unique<PrefetchCapturingCache>());
+			return builder.build();
+		}
+
+		using Prefetcher = FunctionalCachePrefetcher<PrefetchCapturingCache, uint64_t>;
+
+		void CollectKeys(Prefetcher& prefetcher, const std::vector<uint64_t>& values) {
+			for (auto value : values) {
+				auto notification = test::CreateNotification(NotificationType::Notification_Type);
+				notification.Size = static_cast<uint32_t>(value);
+				prefetcher.collect(notification, model::ResolverContext());
+			}
+		}
+
+		Prefetcher CreateSizeCollectingPrefetcher(CachePrefetchPhase phase = CachePrefetchPhase::Default) {
+			return Prefetcher(phase, [](const auto& notification, const auto&, auto& keys) {
+				keys.push_back(notification.Size);
+			});
+		}
+	}
+
+	TEST(TEST_CLASS, HasCorrectPhase) {
+		for (auto phase : { CachePrefetchPhase::Resolution, CachePrefetchPhase::Default }) {
+			// Act:
+			auto prefetcher = CreateSizeCollectingPrefetcher(phase);
+
+			// Assert:
+			EXPECT_EQ(phase, prefetcher.phase());
+		}
+	}
+
+	TEST(TEST_CLASS, CollectDelegatesToFunction) {
+		// Arrange:
+		std::vector<const model::Notification*> notifications;
+		std::vector<MosaicId> resolvedMosaicIds;
+		Prefetcher prefetcher(CachePrefetchPhase::Default, [&notifications, &resolvedMosaicIds](
+				const auto& notification,
+				const auto& resolvers,
+				const auto&) {
+			notifications.push_back(&notification);
+			resolvedMosaicIds.push_back(resolvers.resolve(UnresolvedMosaicId(123)));
+		});
+
+		auto notification = test::CreateNotification(NotificationType::Notification_Type);
+		auto resolvers = test::CreateResolverContextWithCustomDoublingMosaicResolver();
+
+		// Act:
+		prefetcher.collect(notification, resolvers);
+
+		// Assert:
+		ASSERT_EQ(1u, notifications.size());
+		EXPECT_EQ(&notification, notifications[0]);
+		EXPECT_EQ(std::vector<MosaicId>({ MosaicId(246) }), resolvedMosaicIds);
+	}
+
+	TEST(TEST_CLASS, PrefetchBypassesCacheWhenNoKeysAreCollected) {
+		// Arrange:
+		auto cache = CreatePrefetchCapturingCatapultCache();
+		auto delta = cache.createDelta();
+		auto prefetcher = CreateSizeCollectingPrefetcher();
+
+		// Act:
+		prefetcher.prefetch(delta);
+
+		// Assert:
+		EXPECT_TRUE(delta.sub<PrefetchCapturingCache>().prefetchedKeys().empty());
+	}
+
+	TEST(TEST_CLASS, PrefetchForwardsAllCollectedKeysToCache) {
+		// Arrange:
+		auto cache = CreatePrefetchCapturingCatapultCache();
+		auto delta = cache.createDelta();
+		auto prefetcher = CreateSizeCollectingPrefetcher();
+		CollectKeys(prefetcher, { 11, 7, 25 });
+
+		// Act:
+		prefetcher.prefetch(delta);
+
+		// Assert:
+		const auto& prefetchedKeys = delta.sub<PrefetchCapturingCache>().prefetchedKeys();
+		ASSERT_EQ(1u, prefetchedKeys.size());
+		EXPECT_EQ(std::vector<uint64_t>({ 7, 11, 25 }), prefetchedKeys[0]);
+	}
+
+	TEST(TEST_CLASS, PrefetchForwardsUniqueCollectedKeysToCache) {
+		// Arrange:
+		auto cache = CreatePrefetchCapturingCatapultCache();
+		auto delta = cache.createDelta();
+		auto prefetcher = CreateSizeCollectingPrefetcher();
+		CollectKeys(prefetcher, { 11, 7, 11, 25, 7, 11 });
+
+		// Act:
+		prefetcher.prefetch(delta);
+
+		// Assert:
+		const auto& prefetchedKeys = delta.sub<PrefetchCapturingCache>().prefetchedKeys();
+		ASSERT_EQ(1u, prefetchedKeys.size());
+		EXPECT_EQ(std::vector<uint64_t>({ 7, 11, 25 }), prefetchedKeys[0]);
+	}
+
+	TEST(TEST_CLASS, CanCreatePrefetcherFromFactory) {
+		// Arrange:
+		auto factory = CreateCachePrefetcherFactory<PrefetchCapturingCache, uint64_t>(
+				CachePrefetchPhase::Resolution,
+				[](const auto& notification, const auto&, auto& keys) {
+					keys.push_back(notification.Size);
+				});
+
+		auto cache = CreatePrefetchCapturingCatapultCache();
+		auto delta = cache.createDelta();
+
+		// Act:
+		auto pPrefetcher1 = factory();
+		auto pPrefetcher2 = factory();
+		pPrefetcher1->collect(test::CreateNotification(NotificationType::Notification_Type), model::ResolverContext());
+		pPrefetcher1->prefetch(delta);
+		pPrefetcher2->prefetch(delta);
+
+		// Assert: each prefetcher is independent
+		EXPECT_NE(pPrefetcher1.get(), pPrefetcher2.get());
+		EXPECT_EQ(CachePrefetchPhase::Resolution, pPrefetcher1->phase());
+		EXPECT_EQ(CachePrefetchPhase::Resolution, pPrefetcher2->phase());
+
+		const auto& prefetchedKeys = delta.sub<PrefetchCapturingCache>().prefetchedKeys();
+		ASSERT_EQ(1u, prefetchedKeys.size());
+		EXPECT_EQ(std::vector<uint64_t>({ sizeof(model::Notification) }), prefetchedKeys[0]);
+	}
+}}
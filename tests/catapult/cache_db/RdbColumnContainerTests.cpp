@@ -38,6 +38,18 @@ namespace catapult { namespace cache {
 				RdbColumnContainer::find(key, iterator);
 			}
 
+			void find(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const {
+				RdbColumnContainer::find(keys, iterators);
+			}
+
+			void prefetch(const std::vector<RawBuffer>& keys) const {
+				RdbColumnContainer::prefetch(keys);
+			}
+
+			void discardPrefetched() {
+				RdbColumnContainer::discardPrefetched();
+			}
+
 			void insert(const RawBuffer& key, const std::string& value) {
 				RdbColumnContainer::insert(key, value);
 			}
@@ -289,6 +301,224 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region batched find + prefetch
+
+	TEST(TEST_CLASS, BatchedFindForwardsToMultiGet) {
+		// Arrange:
+		auto key1 = test::GenerateRandomArray<10>();
+		auto key2 = test::GenerateRandomArray<10>();
+		auto key3 = test::GenerateRandomArray<10>();
+		test::RdbTestContext context(DefaultSettings(), [&key1, &key3](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], ToSlice(key1), "hello");
+			db.Put(rocksdb::WriteOptions(), columns[0], ToSlice(key3), "world");
+		});
+		TestColumnContainer container(context.database(), 0);
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		container.find({ key3, key2, key1 }, iters);
+
+		// Assert:
+		ASSERT_EQ(3u, iters.size());
+		test::AssertIteratorValue("world", iters[0]);
+		EXPECT_EQ(RdbDataIterator::End(), iters[1]);
+		test::AssertIteratorValue("hello", iters[2]);
+	}
+
+	TEST(TEST_CLASS, FindReturnsPrefetchedElementWithoutAccessingDb) {
+		// Arrange:
+		auto key = test::GenerateRandomArray<10>();
+		test::RdbTestContext context(DefaultSettings(), [&key](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], ToSlice(key), "world");
+		});
+		TestColumnContainer container(context.database(), 0);
+		container.prefetch({ key });
+
+		// - delete element from db directly, bypassing container
+		context.database().del(0, ToSlice(key));
+		context.database().flush();
+
+		// Act:
+		RdbDataIterator iter;
+		container.find(key, iter);
+
+		// Assert: prefetched value is returned
+		test::AssertIteratorValue("world", iter);
+	}
+
+	TEST(TEST_CLASS, FindReturnsPrefetchedNonexistentElementWithoutAccessingDb) {
+		// Arrange:
+		auto key = test::GenerateRandomArray<10>();
+		test::RdbTestContext context(DefaultSettings());
+		TestColumnContainer container(context.database(), 0);
+		container.prefetch({ key });
+
+		// - add element to db directly, bypassing container
+		context.database().put(0, ToSlice(key), "world");
+		context.database().flush();
+
+		// Act:
+		RdbDataIterator iter;
+		container.find(key, iter);
+
+		// Assert: prefetched value (not found) is returned
+		EXPECT_EQ(RdbDataIterator::End(), iter);
+	}
+
+	TEST(TEST_CLASS, InsertDiscardsPrefetchedElement) {
+		// Arrange:
+		auto key = test::GenerateRandomArray<10>();
+		test::RdbTestContext context(DefaultSettings(), [&key](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], ToSlice(key), "world");
+		});
+		TestColumnContainer container(context.database(), 0);
+		container.prefetch({ key });
+
+		// Act:
+		container.insert(key, "1234567890");
+
+		// Assert:
+		RdbDataIterator iter;
+		container.find(key, iter);
+		test::AssertIteratorValue("1234567890", iter);
+	}
+
+	TEST(TEST_CLASS, RemoveDiscardsPrefetchedElement) {
+		// Arrange:
+		auto key = test::GenerateRandomArray<10>();
+		test::RdbTestContext context(DefaultSettings(), [&key](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], ToSlice(key), "world");
+		});
+		TestColumnContainer container(context.database(), 0);
+		container.prefetch({ key });
+
+		// Act:
+		container.remove(key);
+
+		// Assert:
+		RdbDataIterator iter;
+		container.find(key, iter);
+		EXPECT_EQ(RdbDataIterator::End(), iter);
+	}
+
+	TEST(TEST_CLASS, DiscardPrefetchedDiscardsAllPrefetchedElements) {
+		// Arrange:
+		auto key1 = test::GenerateRandomArray<10>();
+		auto key2 = test::GenerateRandomArray<10>();
+		test::RdbTestContext context(DefaultSettings(), [&key1](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], ToSlice(key1), "world");
+		});
+		TestColumnContainer container(context.database(), 0);
+		container.prefetch({ key1, key2 });
+
+		// - change elements in db directly, bypassing container
+		context.database().del(0, ToSlice(key1));
+		context.database().put(0, ToSlice(key2), "hello");
+		context.database().flush();
+
+		// Act:
+		container.discardPrefetched();
+
+		// Assert: current db values are returned
+		RdbDataIterator iter1;
+		container.find(key1, iter1);
+		EXPECT_EQ(RdbDataIterator::End(), iter1);
+
+		RdbDataIterator iter2;
+		container.find(key2, iter2);
+		test::AssertIteratorValue("hello", iter2);
+	}
+
+	namespace {
+		constexpr size_t Max_Prefetched_Values = 4;
+
+		using RawKey = std::array<uint8_t, 10>;
+
+		template<typename TAction>
+		std::vector<bool> RunPrefetchLimitTest(size_t numKeys, TAction action) {
+			// Arrange:
+			auto keys = test::GenerateRandomDataVector<RawKey>(numKeys);
+			test::RdbTestContext context(DefaultSettings(), [&keys](auto& db, const auto& columns) {
+				for (const auto& key : keys)
+					db.Put(rocksdb::WriteOptions(), columns[0], ToSlice(key), "world");
+			});
+			TestColumnContainer container(context.database(), 0, Max_Prefetched_Values);
+
+			// Act:
+			action(container, keys);
+
+			// - delete all elements from db directly, bypassing container
+			for (const auto& key : keys)
+				context.database().del(0, ToSlice(key));
+
+			context.database().flush();
+
+			// Assert: only prefetched elements are found
+			std::vector<bool> prefetchedFlags;
+			for (const auto& key : keys) {
+				RdbDataIterator iter;
+				container.find(key, iter);
+				prefetchedFlags.push_back(RdbDataIterator::End() != iter);
+			}
+
+			return prefetchedFlags;
+		}
+
+		std::vector<RawBuffer> ToRawBuffers(const std::vector<RawKey>& keys, size_t startIndex, size_t endIndex) {
+			std::vector<RawBuffer> buffers;
+			for (auto i = startIndex; i < endIndex; ++i)
+				buffers.push_back(keys[i]);
+
+			return buffers;
+		}
+	}
+
+	TEST(TEST_CLASS, PrefetchRetainsPrefetchedElementsWhenBatchFitsRemainingSpace) {
+		// Act: prefetch 3 and then 1 element
+		auto prefetchedFlags = RunPrefetchLimitTest(4, [](auto& container, const auto& keys) {
+			container.prefetch(ToRawBuffers(keys, 0, 3));
+			container.prefetch(ToRawBuffers(keys, 3, 4));
+		});
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>({ true, true, true, true }), prefetchedFlags);
+	}
+
+	TEST(TEST_CLASS, PrefetchSkipsPrefetchedElementsInBatch) {
+		// Act: prefetch 2 and then 4 elements (including the first 2)
+		auto prefetchedFlags = RunPrefetchLimitTest(4, [](auto& container, const auto& keys) {
+			container.prefetch(ToRawBuffers(keys, 0, 2));
+			container.prefetch(ToRawBuffers(keys, 0, 4));
+		});
+
+		// Assert: only the 2 unknown elements were added, so the limit was not reached
+		EXPECT_EQ(std::vector<bool>({ true, true, true, true }), prefetchedFlags);
+	}
+
+	TEST(TEST_CLASS, PrefetchDiscardsPrefetchedElementsWhenBatchIsLargerThanRemainingSpace) {
+		// Act: prefetch 3 and then 2 elements
+		auto prefetchedFlags = RunPrefetchLimitTest(5, [](auto& container, const auto& keys) {
+			container.prefetch(ToRawBuffers(keys, 0, 3));
+			container.prefetch(ToRawBuffers(keys, 3, 5));
+		});
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>({ false, false, false, true, true }), prefetchedFlags);
+	}
+
+	TEST(TEST_CLASS, PrefetchDoesNotExceedLimitWhenBatchIsLargerThanLimit) {
+		// Act: prefetch 3 and then 6 elements
+		auto prefetchedFlags = RunPrefetchLimitTest(9, [](auto& container, const auto& keys) {
+			container.prefetch(ToRawBuffers(keys, 0, 3));
+			container.prefetch(ToRawBuffers(keys, 3, 9));
+		});
+
+		// Assert: only the first Max_Prefetched_Values elements of the second batch are prefetched
+		EXPECT_EQ(std::vector<bool>({ false, false, false, true, true, true, true, false, false }), prefetchedFlags);
+	}
+
+	// endregion
+
 	// region prune
 
 	namespace {
@@ -331,5 +561,24 @@ namespace catapult { namespace cache {
 		AssertKeys(container, 200, 238, AssertValidKey);
 	}
 
+	TEST(TEST_CLASS, PruneDiscardsPrefetchedElements) {
+		// Arrange: create 120 even keys (0 - 238) and prefetch some of them
+		auto evenSeeder = test::CreateEvenDbSeeder(120);
+		test::RdbTestContext context(PruningSettings(), evenSeeder);
+		TestColumnContainer container(context.database(), 0);
+
+		uint64_t prunedKey = 100;
+		uint64_t retainedKey = 220;
+		container.prefetch({ ToRawBuffer(prunedKey), ToRawBuffer(retainedKey) });
+
+		// Act: prune all keys < 200
+		auto numRemoved = container.prune(200);
+
+		// Assert:
+		EXPECT_EQ(100u, numRemoved);
+		AssertNoKey(container, prunedKey);
+		AssertValidKey(container, retainedKey);
+	}
+
 	// endregion
 }}
@@ -115,6 +115,21 @@ namespace catapult { namespace cache {
 				iterator.setFound(IsKeyFound);
 			}
 
+			void find(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const {
+				BatchedFindKeys.push_back(keys);
+				iterators.resize(keys.size());
+				for (auto& iterator : iterators)
+					iterator.setFound(IsKeyFound);
+			}
+
+			void prefetch(const std::vector<RawBuffer>& keys) const {
+				PrefetchKeys.push_back(keys);
+			}
+
+			void discardPrefetched() {
+				++NumDiscards;
+			}
+
 			auto prune(uint64_t pruningBoundary) {
 				PruneParams.push(pruningBoundary);
 				return NumPruned;
@@ -126,9 +141,12 @@ namespace catapult { namespace cache {
 		public:
 			size_t Size = 0;
 			size_t NumPruned = 0;
+			size_t NumDiscards = 0;
 
 			test::ParamsCapture<InsertParamsType> InsertParams;
 			mutable test::ParamsCapture<FindParamsType> FindParams;
+			mutable std::vector<std::vector<RawBuffer>> BatchedFindKeys;
+			mutable std::vector<std::vector<RawBuffer>> PrefetchKeys;
 			test::ParamsCapture<PruneParamsType> PruneParams;
 			test::ParamsCapture<RemoveParamsType> RemoveParams;
 		};
@@ -152,6 +170,18 @@ namespace catapult { namespace cache {
 				m_db.find(key, iterator);
 			}
 
+			void find(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const {
+				m_db.find(keys, iterators);
+			}
+
+			void prefetch(const std::vector<RawBuffer>& keys) const {
+				m_db.prefetch(keys);
+			}
+
+			void discardPrefetched() {
+				m_db.discardPrefetched();
+			}
+
 			size_t prune(uint64_t pruningBoundary) {
 				return m_db.prune(pruningBoundary);
 			}
@@ -236,6 +266,78 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(&iter.dbIterator(), params.pIterator);
 	}
 
+	namespace {
+		void AssertSerializedKeys(const std::vector<test::StringKey>& expectedKeys, const std::vector<RawBuffer>& keys) {
+			ASSERT_EQ(expectedKeys.size(), keys.size());
+
+			for (auto i = 0u; i < keys.size(); ++i) {
+				EXPECT_EQ(test::AsBytePointer(expectedKeys[i].data()), keys[i].pData) << "key at " << i;
+				EXPECT_EQ(expectedKeys[i].size(), keys[i].Size) << "key at " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, BatchedFindSerializesKeysAndForwardsToContainer) {
+		// Arrange:
+		MockDb db(true);
+		auto container = CreateContainer(db);
+
+		// Act:
+		std::vector<test::StringKey> keys{ test::StringKey("hello"), test::StringKey("world") };
+		auto iters = container.find(keys);
+
+		// Assert:
+		ASSERT_EQ(1u, db.BatchedFindKeys.size());
+		AssertSerializedKeys(keys, db.BatchedFindKeys[0]);
+		EXPECT_EQ(0u, db.FindParams.params().size());
+
+		ASSERT_EQ(2u, iters.size());
+		for (const auto& iter : iters)
+			EXPECT_NE(container.cend(), iter);
+	}
+
+	TEST(TEST_CLASS, BatchedFindReturnsCendForKeysThatAreNotFound) {
+		// Arrange:
+		MockDb db;
+		auto container = CreateContainer(db);
+
+		// Act:
+		auto iters = container.find(std::vector<test::StringKey>{ test::StringKey("hello"), test::StringKey("world") });
+
+		// Assert:
+		ASSERT_EQ(2u, iters.size());
+		for (const auto& iter : iters)
+			EXPECT_EQ(container.cend(), iter);
+	}
+
+	TEST(TEST_CLASS, PrefetchSerializesKeysAndForwardsToContainer) {
+		// Arrange:
+		MockDb db;
+		auto container = CreateContainer(db);
+
+		// Act:
+		std::vector<test::StringKey> keys{ test::StringKey("hello"), test::StringKey("world") };
+		container.prefetch(keys);
+
+		// Assert:
+		ASSERT_EQ(1u, db.PrefetchKeys.size());
+		AssertSerializedKeys(keys, db.PrefetchKeys[0]);
+		EXPECT_EQ(0u, db.FindParams.params().size());
+		EXPECT_EQ(0u, db.BatchedFindKeys.size());
+	}
+
+	TEST(TEST_CLASS, DiscardPrefetchedForwardsToContainer) {
+		// Arrange:
+		MockDb db;
+		auto container = CreateContainer(db);
+
+		// Act:
+		container.discardPrefetched();
+
+		// Assert:
+		EXPECT_EQ(1u, db.NumDiscards);
+	}
+
 	TEST(TEST_CLASS, PruneExtractsBoundaryFromKeyAndForwardsToContainer) {
 		// Arrange:
 		MockDb db;
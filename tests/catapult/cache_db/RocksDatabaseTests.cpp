@@ -222,6 +222,15 @@ namespace catapult { namespace cache {
 		EXPECT_THROW(database.get(0, "hello", iter), catapult_invalid_argument);
 	}
 
+	TEST(TEST_CLASS, DefaultCreatedRdbDoesNotAllowMultiGet) {
+		// Arrange:
+		RocksDatabase database;
+
+		// Act + Assert:
+		std::vector<RdbDataIterator> iters;
+		EXPECT_THROW(database.multiGet(0, { "hello" }, iters), catapult_invalid_argument);
+	}
+
 	TEST(TEST_CLASS, DefaultCreatedRdbDoesNotAllowPut) {
 		// Arrange:
 		RocksDatabase database;
@@ -384,6 +393,84 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region multi get
+
+	TEST(TEST_CLASS, MultiGetWithNoKeysReturnsNoResults) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings());
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(0, {}, iters);
+
+		// Assert:
+		EXPECT_TRUE(iters.empty());
+	}
+
+	TEST(TEST_CLASS, MultiGetCanReadMultipleValuesFromDb) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[0], "world", "awesome");
+			db.Put(rocksdb::WriteOptions(), columns[0], "apple", "incredible");
+		});
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(0, { "world", "nonexistent", "hello", "world" }, iters);
+
+		// Assert: results are ordered consistently with keys
+		ASSERT_EQ(4u, iters.size());
+		test::AssertIteratorValue("awesome", iters[0]);
+		EXPECT_EQ(RdbDataIterator::End(), iters[1]);
+		test::AssertIteratorValue("amazing", iters[2]);
+		test::AssertIteratorValue("awesome", iters[3]);
+	}
+
+	TEST(TEST_CLASS, MultiGetReadsFromSpecifiedColumn) {
+		// Arrange:
+		test::RdbTestContext context(MultiColumnSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[1], "hello", "awesome");
+			db.Put(rocksdb::WriteOptions(), columns[1], "world", "incredible");
+			db.Put(rocksdb::WriteOptions(), columns[2], "world", "fractured");
+		});
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(1, { "hello", "world" }, iters);
+
+		// Assert:
+		ASSERT_EQ(2u, iters.size());
+		test::AssertIteratorValue("awesome", iters[0]);
+		test::AssertIteratorValue("incredible", iters[1]);
+	}
+
+	TEST(TEST_CLASS, MultiGetCanReuseIterators) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[0], "world", "awesome");
+		});
+		auto& database = context.database();
+
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(0, { "hello", "nonexistent", "world" }, iters);
+
+		// Act:
+		database.multiGet(0, { "nonexistent", "world" }, iters);
+
+		// Assert:
+		ASSERT_EQ(2u, iters.size());
+		EXPECT_EQ(RdbDataIterator::End(), iters[0]);
+		test::AssertIteratorValue("awesome", iters[1]);
+	}
+
+	// endregion
+
 	// region iterators
 
 	namespace {
@@ -688,4 +775,75 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region group commit
+
+	namespace {
+		auto GroupCommitSettings(const std::string& databaseDirectory, const std::shared_ptr<RocksGroupCommitter>& pGroupCommitter) {
+			return RocksDatabaseSettings(
+					databaseDirectory,
+					config::NodeConfiguration::CacheDatabaseSubConfiguration(),
+					{ "default" },
+					FilterPruningMode::Disabled,
+					pGroupCommitter);
+		}
+	}
+
+	TEST(TEST_CLASS, GroupCommitFlushMakesBatchVisibleBeforeSync) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pGroupCommitter = std::make_shared<RocksGroupCommitter>(utils::TimeSpan::FromHours(1));
+		RocksDatabase database(GroupCommitSettings(dbDirGuard.name(), pGroupCommitter));
+
+		// Act:
+		database.put(0, "hello", "amazing");
+		database.flush();
+
+		// Assert: value is visible even though it has not been synced yet
+		AssertKeyValueColumn0(database, "hello", "amazing");
+		EXPECT_EQ(0u, pGroupCommitter->numSyncs());
+	}
+
+	TEST(TEST_CLASS, GroupCommitSyncsBatchesFromMultipleDatabasesTogether) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard1("db1");
+		test::TempDirectoryGuard dbDirGuard2("db2");
+		auto pGroupCommitter = std::make_shared<RocksGroupCommitter>(utils::TimeSpan::FromHours(1));
+		RocksDatabase database1(GroupCommitSettings(dbDirGuard1.name(), pGroupCommitter));
+		RocksDatabase database2(GroupCommitSettings(dbDirGuard2.name(), pGroupCommitter));
+
+		for (auto i = 0u; i < 3; ++i) {
+			database1.put(0, "hello" + std::to_string(i), "amazing");
+			database1.flush();
+			database2.put(0, "world" + std::to_string(i), "awesome");
+			database2.flush();
+		}
+
+		// Act:
+		pGroupCommitter->sync();
+
+		// Assert:
+		EXPECT_EQ(1u, pGroupCommitter->numSyncs());
+		AssertKeyValueColumn0(database1, "hello2", "amazing");
+		AssertKeyValueColumn0(database2, "world2", "awesome");
+	}
+
+	TEST(TEST_CLASS, GroupCommitBatchesArePersistedWhenDatabaseIsDestroyed) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pGroupCommitter = std::make_shared<RocksGroupCommitter>(utils::TimeSpan::FromHours(1));
+		{
+			RocksDatabase database(GroupCommitSettings(dbDirGuard.name(), pGroupCommitter));
+			database.put(0, "hello", "amazing");
+			database.flush();
+		}
+
+		// Act:
+		RocksDatabase database(GroupCommitSettings(dbDirGuard.name(), pGroupCommitter));
+
+		// Assert:
+		AssertKeyValueColumn0(database, "hello", "amazing");
+	}
+
+	// endregion
 }}
@@ -0,0 +1,287 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/RocksGroupCommitter.h"
+#include "catapult/cache_db/RocksDatabase.h"
+#include "catapult/cache_db/RocksInclude.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/Waits.h"
+#include "tests/TestHarness.h"
+#include <atomic>
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS RocksGroupCommitterTests
+
+	namespace {
+		constexpr auto Long_Interval = utils::TimeSpan::FromHours(1);
+
+		class TestContext {
+		public:
+			explicit TestContext(const utils::TimeSpan& interval = Long_Interval)
+					: m_pGroupCommitter(std::make_shared<RocksGroupCommitter>(interval))
+					, m_pDatabase(std::make_unique<RocksDatabase>(RocksDatabaseSettings(
+							m_dbDirGuard.name(),
+							config::NodeConfiguration::CacheDatabaseSubConfiguration(),
+							{ "default" },
+							FilterPruningMode::Disabled,
+							m_pGroupCommitter)))
+			{}
+
+		public:
+			RocksGroupCommitter& groupCommitter() {
+				return *m_pGroupCommitter;
+			}
+
+		public:
+			void write(const std::string& key) {
+				m_pDatabase->put(0, key, "value");
+				m_pDatabase->flush();
+			}
+
+			void destroyDatabase() {
+				m_pDatabase.reset();
+			}
+
+		private:
+			test::TempDirectoryGuard m_dbDirGuard;
+			std::shared_ptr<RocksGroupCommitter> m_pGroupCommitter;
+			std::unique_ptr<RocksDatabase> m_pDatabase;
+		};
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateGroupCommitter) {
+		// Act:
+		RocksGroupCommitter groupCommitter(Long_Interval);
+
+		// Assert:
+		EXPECT_EQ(0u, groupCommitter.numSyncs());
+	}
+
+	// endregion
+
+	// region sync
+
+	TEST(TEST_CLASS, SyncDoesNothingWhenNoWritesAreOutstanding) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.groupCommitter().sync();
+
+		// Assert:
+		EXPECT_EQ(0u, context.groupCommitter().numSyncs());
+	}
+
+	TEST(TEST_CLASS, SyncSyncsAllOutstandingWritesWithSinglePass) {
+		// Arrange:
+		TestContext context;
+		for (auto i = 0u; i < 5; ++i)
+			context.write(std::to_string(i));
+
+		// Sanity:
+		EXPECT_EQ(0u, context.groupCommitter().numSyncs());
+
+		// Act:
+		context.groupCommitter().sync();
+
+		// Assert:
+		EXPECT_EQ(1u, context.groupCommitter().numSyncs());
+	}
+
+	TEST(TEST_CLASS, SyncDoesNothingWhenAllWritesAreAlreadySynced) {
+		// Arrange:
+		TestContext context;
+		context.write("alpha");
+		context.groupCommitter().sync();
+
+		// Act:
+		context.groupCommitter().sync();
+
+		// Assert:
+		EXPECT_EQ(1u, context.groupCommitter().numSyncs());
+	}
+
+	TEST(TEST_CLASS, OutstandingWritesAreSyncedAfterInterval) {
+		// Arrange:
+		TestContext context(utils::TimeSpan::FromMilliseconds(10));
+
+		// Act:
+		context.write("alpha");
+
+		// Assert:
+		WAIT_FOR_ONE_EXPR(context.groupCommitter().numSyncs());
+	}
+
+	// endregion
+
+	// region remove
+
+	TEST(TEST_CLASS, RemoveSyncsOutstandingWritesOfRemovedDatabase) {
+		// Arrange:
+		TestContext context;
+		context.write("alpha");
+
+		// Act: destroying database removes it from committer
+		context.destroyDatabase();
+		context.groupCommitter().sync();
+
+		// Assert: database was synced by remove, so no sync pass had any databases to sync
+		EXPECT_EQ(0u, context.groupCommitter().numSyncs());
+	}
+
+	// endregion
+
+	// region whenDurable
+
+	TEST(TEST_CLASS, WhenDurableExecutesActionImmediatelyWhenNoWritesAreOutstanding) {
+		// Arrange:
+		TestContext context;
+		auto numActions = 0u;
+
+		// Act:
+		context.groupCommitter().whenDurable([&numActions]() { ++numActions; });
+
+		// Assert:
+		EXPECT_EQ(1u, numActions);
+	}
+
+	TEST(TEST_CLASS, WhenDurableDefersActionUntilOutstandingWritesAreSynced) {
+		// Arrange:
+		TestContext context;
+		context.write("alpha");
+		auto numActions = 0u;
+
+		// Act:
+		context.groupCommitter().whenDurable([&numActions]() { ++numActions; });
+
+		// Assert:
+		EXPECT_EQ(0u, numActions);
+
+		// Act:
+		context.groupCommitter().sync();
+
+		// Assert:
+		EXPECT_EQ(1u, numActions);
+	}
+
+	TEST(TEST_CLASS, WhenDurableExecutesActionsInOrder) {
+		// Arrange:
+		TestContext context;
+		std::vector<size_t> actionIds;
+
+		// Act: schedule actions interleaved with writes, including one that would otherwise be executed immediately
+		context.write("alpha");
+		context.groupCommitter().whenDurable([&actionIds]() { actionIds.push_back(1); });
+		context.write("beta");
+		context.groupCommitter().whenDurable([&actionIds]() { actionIds.push_back(2); });
+		context.groupCommitter().whenDurable([&actionIds]() { actionIds.push_back(3); });
+
+		// Sanity:
+		EXPECT_TRUE(actionIds.empty());
+
+		context.groupCommitter().sync();
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 1, 2, 3 }), actionIds);
+	}
+
+	TEST(TEST_CLASS, WhenDurableExecutesActionsAfterInterval) {
+		// Arrange:
+		TestContext context(utils::TimeSpan::FromMilliseconds(10));
+		context.write("alpha");
+		std::atomic<size_t> numActions(0);
+
+		// Act:
+		context.groupCommitter().whenDurable([&numActions]() { ++numActions; });
+
+		// Assert:
+		WAIT_FOR_ONE(numActions);
+	}
+
+	TEST(TEST_CLASS, WhenDurableExecutesActionsWithoutBlockingWrites) {
+		// Arrange:
+		TestContext context;
+		context.write("alpha");
+		auto numActions = 0u;
+
+		// Act: write from within action, which requires committer lock
+		context.groupCommitter().whenDurable([&context, &numActions]() {
+			context.write("beta");
+			++numActions;
+		});
+		context.groupCommitter().sync();
+
+		// Assert:
+		EXPECT_EQ(1u, numActions);
+	}
+
+	TEST(TEST_CLASS, WhenDurableActionFailureDoesNotFailWrites) {
+		// Arrange:
+		TestContext context;
+		context.write("alpha");
+		std::vector<size_t> actionIds;
+		context.groupCommitter().whenDurable([&actionIds]() {
+			actionIds.push_back(1);
+			CATAPULT_THROW_RUNTIME_ERROR("action failed");
+		});
+		context.groupCommitter().whenDurable([&actionIds]() { actionIds.push_back(2); });
+
+		// Act:
+		context.groupCommitter().sync();
+		context.write("beta");
+		context.groupCommitter().sync();
+
+		// Assert: failure did not prevent subsequent action, write or sync
+		EXPECT_EQ(std::vector<size_t>({ 1, 2 }), actionIds);
+		EXPECT_EQ(2u, context.groupCommitter().numSyncs());
+	}
+
+	TEST(TEST_CLASS, WhenDurableRethrowsActionFailureOnce) {
+		// Arrange:
+		TestContext context;
+		context.write("alpha");
+		context.groupCommitter().whenDurable([]() { CATAPULT_THROW_RUNTIME_ERROR("action failed"); });
+		context.groupCommitter().sync();
+		auto numActions = 0u;
+
+		// Act + Assert: failure is reported by next call, which does not schedule its action
+		EXPECT_THROW(context.groupCommitter().whenDurable([&numActions]() { ++numActions; }), catapult_runtime_error);
+		context.groupCommitter().whenDurable([&numActions]() { ++numActions; });
+
+		// Assert:
+		EXPECT_EQ(1u, numActions);
+	}
+
+	TEST(TEST_CLASS, WhenDurableRethrowsFailureOfImmediatelyExecutedAction) {
+		// Arrange:
+		TestContext context;
+
+		// Act + Assert:
+		EXPECT_THROW(
+				context.groupCommitter().whenDurable([]() { CATAPULT_THROW_RUNTIME_ERROR("action failed"); }),
+				catapult_runtime_error);
+	}
+
+	// endregion
+}}
@@ -35,7 +35,7 @@ namespace catapult { namespace cache {
 	namespace {
 		// region test utils
 
-		constexpr auto Default_Options = MemoryCacheOptions(utils::FileSize::FromMegabytes(1), utils::FileSize::FromMegabytes(1));
+		constexpr auto Default_Options = MemoryCacheOptions(utils::FileSize::FromMegabytes(1), utils::FileSize::FromMegabytes(1), 4);
 		using UnknownTransactions = std::vector<std::shared_ptr<const model::Transaction>>;
 
 		void AssertDeadlines(const UnknownTransactions& transactions, const std::vector<Timestamp::ValueType>& expectedDeadlines) {
@@ -522,6 +522,98 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region forEach (max fee multiplier order)
+
+	namespace {
+		std::vector<model::TransactionInfo> CreateTransactionInfosWithFeeMultipliers(const std::vector<uint32_t>& feeMultipliers) {
+			// generate transactions with deadlines in the range [1, size] and the specified fee multipliers
+			auto i = 0u;
+			auto transactionInfos = test::CreateTransactionInfos(feeMultipliers.size());
+			for (auto& transactionInfo : transactionInfos) {
+				const auto& transaction = *transactionInfo.pEntity;
+				const_cast<Amount&>(transaction.MaxFee) = Amount(transaction.Size * feeMultipliers[i]);
+				++i;
+			}
+
+			return transactionInfos;
+		}
+
+		std::vector<Timestamp::ValueType> ExtractDeadlines(
+				const MemoryUtCache& cache,
+				MaxFeeMultiplierOrder order,
+				size_t numRequested = std::numeric_limits<size_t>::max()) {
+			std::vector<Timestamp::ValueType> rawDeadlines;
+			cache.view().forEach(order, [numRequested, &rawDeadlines](const auto& info) {
+				rawDeadlines.push_back(info.pEntity->Deadline.unwrap());
+				return numRequested != rawDeadlines.size();
+			});
+			return rawDeadlines;
+		}
+	}
+
+	TEST(TEST_CLASS, ForEachWithMaxFeeMultiplierOrderForwardsNoTransactionInfosWhenCacheIsEmpty) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+
+		// Act + Assert:
+		EXPECT_TRUE(ExtractDeadlines(cache, MaxFeeMultiplierOrder::Ascending).empty());
+		EXPECT_TRUE(ExtractDeadlines(cache, MaxFeeMultiplierOrder::Descending).empty());
+	}
+
+	TEST(TEST_CLASS, ForEachWithMaxFeeMultiplierOrderForwardsAllTransactionsWhenNotShortCircuited) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, CreateTransactionInfosWithFeeMultipliers({ 30, 10, 20, 10, 30, 20 }));
+
+		// Act + Assert: older transactions are first when fee multipliers are equal
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 4, 3, 6, 1, 5 }), ExtractDeadlines(cache, MaxFeeMultiplierOrder::Ascending));
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 5, 3, 6, 2, 4 }), ExtractDeadlines(cache, MaxFeeMultiplierOrder::Descending));
+	}
+
+	TEST(TEST_CLASS, ForEachWithMaxFeeMultiplierOrderForwardsSubsetOfTransactionsWhenShortCircuited) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, CreateTransactionInfosWithFeeMultipliers({ 30, 10, 20, 10, 30, 20 }));
+
+		// Act + Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 4, 3 }), ExtractDeadlines(cache, MaxFeeMultiplierOrder::Ascending, 3));
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 5, 3 }), ExtractDeadlines(cache, MaxFeeMultiplierOrder::Descending, 3));
+	}
+
+	TEST(TEST_CLASS, ForEachWithMaxFeeMultiplierOrderReflectsRemovals) {
+		// Arrange:
+		auto transactionInfos = CreateTransactionInfosWithFeeMultipliers({ 30, 10, 20, 10, 30, 20 });
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		{
+			auto modifier = cache.modifier();
+			modifier.remove(transactionInfos[1].EntityHash);
+			modifier.remove(transactionInfos[4].EntityHash);
+		}
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 4, 3, 6, 1 }), ExtractDeadlines(cache, MaxFeeMultiplierOrder::Ascending));
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 3, 6, 4 }), ExtractDeadlines(cache, MaxFeeMultiplierOrder::Descending));
+	}
+
+	TEST(TEST_CLASS, ForEachWithMaxFeeMultiplierOrderReflectsRemoveAll) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, CreateTransactionInfosWithFeeMultipliers({ 30, 10, 20 }));
+
+		// Act:
+		cache.modifier().removeAll();
+		test::AddAll(cache, CreateTransactionInfosWithFeeMultipliers({ 20, 10 }));
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 1 }), ExtractDeadlines(cache, MaxFeeMultiplierOrder::Ascending));
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 2 }), ExtractDeadlines(cache, MaxFeeMultiplierOrder::Descending));
+	}
+
+	// endregion
+
 	// region shortHashes
 
 	TEST(TEST_CLASS, ShortHashesReturnsShortHashesForAllTransactions) {
@@ -658,6 +750,65 @@ namespace catapult { namespace cache {
 		AssertFeeMultiplierIsRespected(BlockFeeMultiplier(181), {});
 	}
 
+	TEST(TEST_CLASS, UnknownTransactionsExcludesAllTransactionsWithKnownShortHash) {
+		// Arrange: give the first two transactions the same short hash
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		std::memcpy(transactionInfos[1].EntityHash.data(), transactionInfos[0].EntityHash.data(), sizeof(utils::ShortHash));
+
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto transactions = cache.view().unknownTransactions(Timestamp(), BlockFeeMultiplier(), {
+			utils::ToShortHash(transactionInfos[0].EntityHash)
+		});
+
+		// Assert:
+		AssertDeadlines(transactions, { 3 });
+	}
+
+	TEST(TEST_CLASS, UnknownTransactionsReturnsTransactionsInInsertionOrderAcrossShards) {
+		// Arrange:
+		MemoryUtCache cache(MemoryCacheOptions(utils::FileSize::FromMegabytes(1), utils::FileSize::FromMegabytes(1), 16));
+		auto transactionInfos = test::CreateTransactionInfos(20);
+		test::AddAll(cache, transactionInfos);
+
+		// - mark every third transaction as known
+		utils::ShortHashesSet knownShortHashes;
+		for (auto i = 0u; i < transactionInfos.size(); i += 3)
+			knownShortHashes.insert(utils::ToShortHash(transactionInfos[i].EntityHash));
+
+		// Act:
+		auto transactions = cache.view().unknownTransactions(Timestamp(), BlockFeeMultiplier(), knownShortHashes);
+
+		// Assert:
+		AssertDeadlines(transactions, { 2, 3, 5, 6, 8, 9, 11, 12, 14, 15, 17, 18, 20 });
+	}
+
+	TEST(TEST_CLASS, UnknownTransactionsReturnsTransactionsAddedAfterManyRemovals) {
+		// Arrange: use a single shard so that removals trigger compaction
+		MemoryUtCache cache(MemoryCacheOptions(utils::FileSize::FromMegabytes(1), utils::FileSize::FromMegabytes(1)));
+		auto transactionInfos = test::CreateTransactionInfos(12);
+		auto hashes = test::ExtractHashes(transactionInfos);
+		{
+			auto modifier = cache.modifier();
+			for (auto i = 0u; i < 8; ++i)
+				modifier.add(transactionInfos[i]);
+
+			for (auto i = 1u; i < 7; ++i)
+				modifier.remove(hashes[i]);
+
+			for (auto i = 8u; i < 12; ++i)
+				modifier.add(transactionInfos[i]);
+		}
+
+		// Act:
+		auto transactions = cache.view().unknownTransactions(Timestamp(), BlockFeeMultiplier(), {});
+
+		// Assert:
+		AssertDeadlines(transactions, { 1, 8, 9, 10, 11, 12 });
+	}
+
 	// endregion
 
 	// region max size
@@ -733,15 +884,160 @@ namespace catapult { namespace cache {
 
 	// endregion
 
-	// region synchronization
+	// region sharding
 
 	namespace {
-		auto CreateLockProvider() {
-			return std::make_unique<MemoryUtCache>(Default_Options);
+		void AssertInsertionOrderIsPreservedAcrossShards(uint32_t numShards) {
+			// Arrange:
+			MemoryUtCache cache(MemoryCacheOptions(utils::FileSize::FromMegabytes(1), utils::FileSize::FromMegabytes(1), numShards));
+			auto transactionInfos = test::CreateTransactionInfos(20);
+			test::AddAll(cache, transactionInfos);
+
+			// Act:
+			test::RemoveAll(cache, { transactionInfos[3].EntityHash, transactionInfos[11].EntityHash });
+			auto removedTransactionInfos = cache.modifier().removeAll();
+
+			// Assert:
+			AssertDeadlines(removedTransactionInfos, { 1, 2, 3, 5, 6, 7, 8, 9, 10, 11, 13, 14, 15, 16, 17, 18, 19, 20 });
+		}
+	}
+
+	TEST(TEST_CLASS, InsertionOrderIsPreservedWithZeroShards) {
+		AssertInsertionOrderIsPreservedAcrossShards(0);
+	}
+
+	TEST(TEST_CLASS, InsertionOrderIsPreservedWithSingleShard) {
+		AssertInsertionOrderIsPreservedAcrossShards(1);
+	}
+
+	TEST(TEST_CLASS, InsertionOrderIsPreservedWithMultipleShards) {
+		AssertInsertionOrderIsPreservedAcrossShards(4);
+		AssertInsertionOrderIsPreservedAcrossShards(16);
+	}
+
+	TEST(TEST_CLASS, InsertionOrderIsPreservedWithMoreShardsThanTransactions) {
+		AssertInsertionOrderIsPreservedAcrossShards(64);
+	}
+
+	// endregion
+
+	// region synchronization
+
+	TEST(TEST_CLASS, MultipleViewsCanBeAcquired) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+
+		// Assert:
+		test::AssertMultipleViewsCanBeAcquired(cache);
+	}
+
+	TEST(TEST_CLASS, ModifierIsBlockedByModifier) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+
+		// Assert:
+		test::AssertModifierIsBlockedByModifier(cache);
+	}
+
+	TEST(TEST_CLASS, ViewIsNotBlockedByIdleModifier) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, test::CreateTransactionInfos(3));
+
+		// Act: acquire a view while a modifier is outstanding
+		auto modifier = cache.modifier();
+		auto size = cache.view().size();
+
+		// Assert:
+		EXPECT_EQ(3u, size);
+	}
+
+	TEST(TEST_CLASS, ViewDoesNotSeeChangesOfOutstandingModifier) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		cache.modifier().add(transactionInfos[0]);
+
+		// Act:
+		auto modifier = cache.modifier();
+		modifier.remove(transactionInfos[0].EntityHash);
+		modifier.add(transactionInfos[1]);
+		modifier.add(transactionInfos[2]);
+		auto view = cache.view();
+
+		// Assert:
+		EXPECT_EQ(1u, view.size());
+		EXPECT_TRUE(view.contains(transactionInfos[0].EntityHash));
+		EXPECT_FALSE(view.contains(transactionInfos[1].EntityHash));
+		EXPECT_FALSE(view.contains(transactionInfos[2].EntityHash));
+	}
+
+	TEST(TEST_CLASS, ViewDoesNotSeeRemoveAllOfOutstandingModifier) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		test::AddAll(cache, transactionInfos);
+
+		// Act: simulate ut updater removing all transactions and then partially re-adding them
+		auto modifier = cache.modifier();
+		modifier.removeAll();
+		modifier.add(transactionInfos[1]);
+		auto size = cache.view().size();
+
+		// Assert:
+		EXPECT_EQ(3u, size);
+	}
+
+	TEST(TEST_CLASS, ViewSeesChangesOfDestroyedModifier) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(4);
+		{
+			auto modifier = cache.modifier();
+			modifier.add(transactionInfos[0]);
+			modifier.add(transactionInfos[1]);
+		}
+
+		// Act:
+		{
+			auto modifier = cache.modifier();
+			modifier.removeAll();
+			modifier.add(transactionInfos[1]);
+			modifier.add(transactionInfos[2]);
+			modifier.remove(transactionInfos[2].EntityHash);
+			modifier.add(transactionInfos[3]);
 		}
+
+		// Assert:
+		auto view = cache.view();
+		EXPECT_EQ(2u, view.size());
+		EXPECT_FALSE(view.contains(transactionInfos[0].EntityHash));
+		EXPECT_TRUE(view.contains(transactionInfos[1].EntityHash));
+		EXPECT_FALSE(view.contains(transactionInfos[2].EntityHash));
+		EXPECT_TRUE(view.contains(transactionInfos[3].EntityHash));
+	}
+
+	TEST(TEST_CLASS, ModifierAddIsBlockedByView) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfo = test::CreateRandomTransactionInfo();
+
+		// Assert: changes are published when the modifier is destroyed
+		test::AssertExclusiveLocks(
+				[&cache]() { return cache.view(); },
+				[&cache, &transactionInfo]() { cache.modifier().add(transactionInfo); });
 	}
 
-	DEFINE_LOCK_PROVIDER_TESTS(MemoryUtCacheTests)
+	TEST(TEST_CLASS, ModifierRemoveAllIsBlockedByView) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, test::CreateTransactionInfos(3));
+
+		// Assert: changes are published when the modifier is destroyed
+		test::AssertExclusiveLocks(
+				[&cache]() { return cache.view(); },
+				[&cache]() { cache.modifier().removeAll(); });
+	}
 
 	// endregion
 }}
@@ -231,5 +231,88 @@ namespace catapult { namespace cache {
 			test::AssertEqual(*allTransactionInfos[9 - i * 2], *transactionInfos[i], "transaction at " + std::to_string(i));
 	}
 
+	// endregion
+	// region MaxFeeMultiplierOrdered
+
+	namespace {
+		auto CreateMemoryUtCacheWithFeeMultipliers(const std::vector<uint32_t>& feeMultipliers) {
+			// generate transactions with deadlines in the range [1, size] and the specified fee multipliers
+			auto i = 0u;
+			auto transactionInfos = test::CreateTransactionInfos(feeMultipliers.size());
+			for (auto& transactionInfo : transactionInfos) {
+				const auto& transaction = *transactionInfo.pEntity;
+				const_cast<Amount&>(transaction.MaxFee) = Amount(transaction.Size * feeMultipliers[i]);
+				++i;
+			}
+
+			auto cacheOptions = MemoryCacheOptions(utils::FileSize::FromKilobytes(1), utils::FileSize::FromMegabytes(1));
+			auto pUtCache = std::make_unique<MemoryUtCache>(cacheOptions);
+			test::AddAll(*pUtCache, transactionInfos);
+			return pUtCache;
+		}
+
+		std::vector<Timestamp::ValueType> ExtractDeadlines(const std::vector<const model::TransactionInfo*>& transactionInfos) {
+			std::vector<Timestamp::ValueType> rawDeadlines;
+			for (const auto* pTransactionInfo : transactionInfos)
+				rawDeadlines.push_back(pTransactionInfo->pEntity->Deadline.unwrap());
+
+			return rawDeadlines;
+		}
+
+		void AssertOrderedDeadlines(
+				MaxFeeMultiplierOrder order,
+				uint32_t count,
+				const EmbeddedCountRetriever& countRetriever,
+				const std::vector<Timestamp::ValueType>& expectedDeadlines) {
+			// Arrange:
+			auto pUtCache = CreateMemoryUtCacheWithFeeMultipliers({ 30, 10, 20, 10, 30, 20 });
+			auto utCacheView = pUtCache->view();
+
+			// Act:
+			auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, count, countRetriever, order, SelectAllFilter);
+
+			// Assert:
+			EXPECT_EQ(expectedDeadlines, ExtractDeadlines(transactionInfos));
+		}
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersReturnsNoTransactionInfosWhenZeroAreRequested_MaxFeeMultiplierOrdered) {
+		AssertOrderedDeadlines(MaxFeeMultiplierOrder::Ascending, 0, CountAsOne, {});
+		AssertOrderedDeadlines(MaxFeeMultiplierOrder::Descending, 0, CountAsOne, {});
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesAscendingOrder_MaxFeeMultiplierOrdered) {
+		AssertOrderedDeadlines(MaxFeeMultiplierOrder::Ascending, 3, CountAsOne, { 2, 4, 3 });
+		AssertOrderedDeadlines(MaxFeeMultiplierOrder::Ascending, 10, CountAsOne, { 2, 4, 3, 6, 1, 5 });
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesDescendingOrder_MaxFeeMultiplierOrdered) {
+		AssertOrderedDeadlines(MaxFeeMultiplierOrder::Descending, 3, CountAsOne, { 1, 5, 3 });
+		AssertOrderedDeadlines(MaxFeeMultiplierOrder::Descending, 10, CountAsOne, { 1, 5, 3, 6, 2, 4 });
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesCountAgainstTotalTransactions_MaxFeeMultiplierOrdered) {
+		// Arrange: total counts = { 4 2 } 3 2 5 1
+		AssertOrderedDeadlines(MaxFeeMultiplierOrder::Ascending, 8, CountAbsFromFive, { 2, 4 });
+
+		// - total counts = { 5 1 3 2 } 4 2
+		AssertOrderedDeadlines(MaxFeeMultiplierOrder::Descending, 12, CountAbsFromFive, { 1, 5, 3, 6 });
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesOrderAndFiltering_MaxFeeMultiplierOrdered) {
+		// Arrange:
+		auto pUtCache = CreateMemoryUtCacheWithFeeMultipliers({ 30, 10, 20, 10, 30, 20 });
+		auto utCacheView = pUtCache->view();
+
+		// Act: filter odd deadline txes
+		auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, 2, CountAsOne, MaxFeeMultiplierOrder::Descending, [](
+				const auto& transactionInfo) {
+			return 0 == transactionInfo.pEntity->Deadline.unwrap() % 2;
+		});
+
+		// Assert: (6, 2) should be returned; if count was applied first, no transactions would be returned
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 6, 2 }), ExtractDeadlines(transactionInfos));
+	}
+
 	// endregion
 }}
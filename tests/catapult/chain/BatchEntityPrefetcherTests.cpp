@@ -0,0 +1,355 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/chain/BatchEntityPrefetcher.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/other/MockExecutionConfiguration.h"
+#include "tests/TestHarness.h"
+#include <mutex>
+
+namespace catapult { namespace chain {
+
+#define TEST_CLASS BatchEntityPrefetcherTests
+
+	namespace {
+		// region MockCachePrefetcher
+
+		struct PrefetcherEvents {
+		public:
+			void add(const std::string& event) {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				m_events.push_back(event);
+			}
+
+			std::vector<std::string> events() const {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				return m_events;
+			}
+
+		private:
+			mutable std::mutex m_mutex;
+			std::vector<std::string> m_events;
+		};
+
+		struct PrefetcherState {
+		public:
+			PrefetcherState() : NumCreated(0)
+			{}
+
+		public:
+			size_t NumCreated;
+			std::vector<std::pair<Hash256, uint64_t>> CollectedNotifications;
+			std::vector<MosaicId> ResolvedMosaicIds;
+			std::vector<bool> PrefetchedMarkedCaches;
+		};
+
+		class MockCachePrefetcher : public cache::CachePrefetcher {
+		public:
+			MockCachePrefetcher(
+					const std::string& name,
+					cache::CachePrefetchPhase phase,
+					PrefetcherState& state,
+					PrefetcherEvents& events,
+					bool shouldThrow)
+					: m_name(name)
+					, m_phase(phase)
+					, m_state(state)
+					, m_events(events)
+					, m_shouldThrow(shouldThrow)
+			{}
+
+		public:
+			cache::CachePrefetchPhase phase() const override {
+				return m_phase;
+			}
+
+			void collect(const model::Notification& notification, const model::ResolverContext& resolvers) override {
+				const auto& mockNotification = static_cast<const test::MockNotification&>(notification);
+				m_state.CollectedNotifications.emplace_back(mockNotification.Hash, mockNotification.Id);
+				m_state.ResolvedMosaicIds.push_back(resolvers.resolve(UnresolvedMosaicId(11)));
+				m_events.add(m_name + " collect");
+			}
+
+			void prefetch(const cache::CatapultCacheDelta& cache) const override {
+				m_state.PrefetchedMarkedCaches.push_back(test::IsMarkedCache(cache));
+				m_events.add(m_name + " prefetch");
+
+				if (m_shouldThrow)
+					CATAPULT_THROW_RUNTIME_ERROR("prefetch failed");
+			}
+
+		private:
+			std::string m_name;
+			cache::CachePrefetchPhase m_phase;
+			PrefetcherState& m_state;
+			PrefetcherEvents& m_events;
+			bool m_shouldThrow;
+		};
+
+		// endregion
+
+		// region PrefetcherTestContext
+
+		class PrefetcherTestContext {
+		public:
+			PrefetcherTestContext()
+					: m_pPool(test::CreateStartedIoThreadPool())
+					, m_cache(test::CreateCatapultCacheWithMarkerAccount())
+			{}
+
+		public:
+			const auto& publisherParams() const {
+				return m_executionConfig.pNotificationPublisher->params();
+			}
+
+			const auto& state(size_t index) const {
+				return *m_states[index];
+			}
+
+			auto events() const {
+				return m_events.events();
+			}
+
+		public:
+			void addPrefetcher(const std::string& name, cache::CachePrefetchPhase phase, bool shouldThrow = false) {
+				m_states.push_back(std::make_unique<PrefetcherState>());
+				auto& state = *m_states.back();
+				auto& events = m_events;
+				m_factories.push_back([name, phase, &state, &events, shouldThrow]() {
+					++state.NumCreated;
+					return std::make_unique<MockCachePrefetcher>(name, phase, state, events, shouldThrow);
+				});
+			}
+
+			void prefetch(const model::WeakEntityInfos& entityInfos) {
+				auto prefetcher = CreateBatchEntityPrefetcher(m_executionConfig.Config, m_factories, *m_pPool);
+				auto delta = m_cache.createDelta();
+				prefetcher(entityInfos, delta);
+			}
+
+		private:
+			test::MockExecutionConfiguration m_executionConfig;
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
+			cache::CatapultCache m_cache;
+			std::vector<std::unique_ptr<PrefetcherState>> m_states;
+			std::vector<cache::CachePrefetcherFactory> m_factories;
+			PrefetcherEvents m_events;
+		};
+
+		// endregion
+
+		model::WeakEntityInfos ExtractEntityInfosFromBlock(const model::Block& block) {
+			// Arrange: extract all entities from block (block entity should be extracted last)
+			std::vector<const model::VerifiableEntity*> entities;
+			for (const auto& tx : block.Transactions())
+				entities.push_back(&tx);
+
+			entities.push_back(&block);
+
+			// - map to entity infos (use the entity itself as its fake hash since we know it will be alive)
+			model::WeakEntityInfos entityInfos;
+			for (auto i = 0u; i < entities.size(); ++i)
+				entityInfos.push_back(model::WeakEntityInfo(*entities[i], reinterpret_cast<const Hash256&>(*entities[i])));
+
+			return entityInfos;
+		}
+	}
+
+	// region CreateBatchEntityPrefetcher
+
+	TEST(TEST_CLASS, CanPrefetchZeroEntities) {
+		// Arrange:
+		PrefetcherTestContext context;
+		context.addPrefetcher("alpha", cache::CachePrefetchPhase::Default);
+
+		// Act:
+		context.prefetch({});
+
+		// Assert: since there are no entities, no prefetchers should be created
+		EXPECT_EQ(0u, context.publisherParams().size());
+		EXPECT_EQ(0u, context.state(0).NumCreated);
+		EXPECT_TRUE(context.events().empty());
+	}
+
+	TEST(TEST_CLASS, CanPrefetchWithoutPrefetchers) {
+		// Arrange:
+		PrefetcherTestContext context;
+		auto pBlock = test::GenerateBlockWithTransactions(3);
+		auto entityInfos = ExtractEntityInfosFromBlock(*pBlock);
+
+		// Act:
+		context.prefetch(entityInfos);
+
+		// Assert: since there are no prefetchers, no notifications should be published
+		EXPECT_EQ(0u, context.publisherParams().size());
+		EXPECT_TRUE(context.events().empty());
+	}
+
+	TEST(TEST_CLASS, PrefetcherCollectsAllNotificationsFromAllEntities) {
+		// Arrange:
+		PrefetcherTestContext context;
+		context.addPrefetcher("alpha", cache::CachePrefetchPhase::Default);
+		auto pBlock = test::GenerateBlockWithTransactions(3);
+		auto entityInfos = ExtractEntityInfosFromBlock(*pBlock);
+
+		// Act:
+		context.prefetch(entityInfos);
+
+		// Assert: each publish call creates two downstream notifications
+		ASSERT_EQ(4u, context.publisherParams().size());
+		for (auto i = 0u; i < entityInfos.size(); ++i)
+			EXPECT_EQ(entityInfos[i], context.publisherParams()[i].EntityInfo) << "publisher at " << i;
+
+		const auto& state = context.state(0);
+		EXPECT_EQ(1u, state.NumCreated);
+		ASSERT_EQ(8u, state.CollectedNotifications.size());
+		for (auto i = 0u; i < state.CollectedNotifications.size(); ++i) {
+			auto message = "notification at " + std::to_string(i);
+			EXPECT_EQ(entityInfos[i / 2].hash(), state.CollectedNotifications[i].first) << message;
+			EXPECT_EQ(0 == i % 2 ? 1u : 2u, state.CollectedNotifications[i].second) << message;
+
+			// - resolvers are created around the (marked) cache being prefetched
+			EXPECT_EQ(MosaicId(22), state.ResolvedMosaicIds[i]) << message;
+		}
+
+		// - prefetch is only called once after all notifications have been collected
+		EXPECT_EQ(std::vector<bool>({ true }), state.PrefetchedMarkedCaches);
+	}
+
+	TEST(TEST_CLASS, AllPrefetchersInPhaseArePrefetched) {
+		// Arrange:
+		PrefetcherTestContext context;
+		context.addPrefetcher("alpha", cache::CachePrefetchPhase::Default);
+		context.addPrefetcher("beta", cache::CachePrefetchPhase::Default);
+		context.addPrefetcher("gamma", cache::CachePrefetchPhase::Default);
+		auto pBlock = test::GenerateBlockWithTransactions(1);
+		auto entityInfos = ExtractEntityInfosFromBlock(*pBlock);
+
+		// Act:
+		context.prefetch(entityInfos);
+
+		// Assert: notifications are only published once for all prefetchers in the same phase
+		EXPECT_EQ(2u, context.publisherParams().size());
+		for (auto i = 0u; i < 3; ++i) {
+			const auto& state = context.state(i);
+			EXPECT_EQ(1u, state.NumCreated) << "prefetcher at " << i;
+			EXPECT_EQ(4u, state.CollectedNotifications.size()) << "prefetcher at " << i;
+			EXPECT_EQ(std::vector<bool>({ true }), state.PrefetchedMarkedCaches) << "prefetcher at " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, ResolutionPrefetchersArePrefetchedBeforeOtherPrefetchersCollect) {
+		// Arrange: register default prefetcher first
+		PrefetcherTestContext context;
+		context.addPrefetcher("alpha", cache::CachePrefetchPhase::Default);
+		context.addPrefetcher("beta", cache::CachePrefetchPhase::Resolution);
+		auto pBlock = test::GenerateBlockWithTransactions(0);
+		auto entityInfos = ExtractEntityInfosFromBlock(*pBlock);
+
+		// Act:
+		context.prefetch(entityInfos);
+
+		// Assert: notifications are published once per phase
+		EXPECT_EQ(2u, context.publisherParams().size());
+
+		auto expectedEvents = std::vector<std::string>{
+			"beta collect", "beta collect", "beta prefetch",
+			"alpha collect", "alpha collect", "alpha prefetch"
+		};
+		EXPECT_EQ(expectedEvents, context.events());
+	}
+
+	TEST(TEST_CLASS, NewPrefetchersAreCreatedForEachBatch) {
+		// Arrange:
+		PrefetcherTestContext context;
+		context.addPrefetcher("alpha", cache::CachePrefetchPhase::Default);
+		auto pBlock1 = test::GenerateBlockWithTransactions(0);
+		auto pBlock2 = test::GenerateBlockWithTransactions(1);
+
+		// Act:
+		context.prefetch(ExtractEntityInfosFromBlock(*pBlock1));
+		context.prefetch(ExtractEntityInfosFromBlock(*pBlock2));
+
+		// Assert:
+		const auto& state = context.state(0);
+		EXPECT_EQ(2u, state.NumCreated);
+		EXPECT_EQ(6u, state.CollectedNotifications.size());
+		EXPECT_EQ(std::vector<bool>({ true, true }), state.PrefetchedMarkedCaches);
+	}
+
+	TEST(TEST_CLASS, PrefetchExceptionIsPropagated) {
+		// Arrange:
+		PrefetcherTestContext context;
+		context.addPrefetcher("alpha", cache::CachePrefetchPhase::Default);
+		context.addPrefetcher("beta", cache::CachePrefetchPhase::Default, true);
+		auto pBlock = test::GenerateBlockWithTransactions(0);
+		auto entityInfos = ExtractEntityInfosFromBlock(*pBlock);
+
+		// Act + Assert:
+		EXPECT_THROW(context.prefetch(entityInfos), catapult_runtime_error);
+	}
+
+	// endregion
+
+	// region CreatePrefetchingBatchEntityProcessor
+
+	TEST(TEST_CLASS, PrefetchingProcessorPrefetchesBeforeProcessing) {
+		// Arrange:
+		std::vector<std::string> events;
+		std::vector<const model::WeakEntityInfos*> prefetchedEntityInfos;
+		std::vector<const cache::CatapultCacheDelta*> prefetchedCaches;
+		auto prefetcher = [&events, &prefetchedEntityInfos, &prefetchedCaches](const auto& entityInfos, auto& cache) {
+			events.push_back("prefetch");
+			prefetchedEntityInfos.push_back(&entityInfos);
+			prefetchedCaches.push_back(&cache);
+		};
+
+		std::vector<Height> processedHeights;
+		auto processor = [&events, &processedHeights](auto height, auto, const auto&, auto&) {
+			events.push_back("process");
+			processedHeights.push_back(height);
+			return validators::ValidationResult::Failure;
+		};
+
+		auto cache = test::CreateCatapultCacheWithMarkerAccount();
+		auto delta = cache.createDelta();
+		auto observerState = observers::ObserverState(delta);
+		model::WeakEntityInfos entityInfos;
+
+		auto prefetchingProcessor = CreatePrefetchingBatchEntityProcessor(prefetcher, processor);
+
+		// Act:
+		auto result = prefetchingProcessor(Height(246), Timestamp(721), entityInfos, observerState);
+
+		// Assert:
+		EXPECT_EQ(validators::ValidationResult::Failure, result);
+		EXPECT_EQ(std::vector<std::string>({ "prefetch", "process" }), events);
+
+		ASSERT_EQ(1u, prefetchedEntityInfos.size());
+		EXPECT_EQ(&entityInfos, prefetchedEntityInfos[0]);
+		EXPECT_EQ(&delta, prefetchedCaches[0]);
+		EXPECT_EQ(std::vector<Height>({ Height(246) }), processedHeights);
+	}
+
+	// endregion
+}}
@@ -108,8 +108,10 @@ namespace catapult { namespace config {
 			EXPECT_FALSE(config.EnableSingleThreadPool);
 			EXPECT_TRUE(config.EnableCacheDatabaseStorage);
 			EXPECT_TRUE(config.EnableAutoSyncCleanup);
+			EXPECT_FALSE(config.EnableParallelStateHashCalculation);
 
 			EXPECT_EQ(100u, config.FileDatabaseBatchSize);
+			EXPECT_EQ(0u, config.BlockStorageMaxMappedFiles);
 
 			EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 			EXPECT_EQ(Amount(10'000'000), config.TransactionSpamThrottlingMaxBoostFee);
@@ -128,6 +130,7 @@ namespace catapult { namespace config {
 			EXPECT_EQ(model::TransactionSelectionStrategy::Oldest, config.TransactionSelectionStrategy);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.UnconfirmedTransactionsCacheMaxResponseSize);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(20), config.UnconfirmedTransactionsCacheMaxSize);
+			EXPECT_EQ(4u, config.UnconfirmedTransactionsCacheNumShards);
 
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(10), config.ConnectTimeout);
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(60), config.SyncTimeout);
@@ -164,6 +167,7 @@ namespace catapult { namespace config {
 			EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.MemtableMemoryBudget);
 
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.CacheDatabase.MaxWriteBatchSize);
+			EXPECT_EQ(utils::TimeSpan::FromMilliseconds(0), config.CacheDatabase.GroupCommitInterval);
 
 			EXPECT_EQ("", config.Local.Host);
 			EXPECT_EQ("", config.Local.FriendlyName);
@@ -43,8 +43,10 @@ namespace catapult { namespace config {
 							{ "enableSingleThreadPool", "true" },
 							{ "enableCacheDatabaseStorage", "true" },
 							{ "enableAutoSyncCleanup", "true" },
+							{ "enableParallelStateHashCalculation", "true" },
 
 							{ "fileDatabaseBatchSize", "888" },
+							{ "blockStorageMaxMappedFiles", "12" },
 
 							{ "enableTransactionSpamThrottling", "true" },
 							{ "transactionSpamThrottlingMaxBoostFee", "54'123" },
@@ -63,6 +65,7 @@ namespace catapult { namespace config {
 							{ "transactionSelectionStrategy", "maximize-fee" },
 							{ "unconfirmedTransactionsCacheMaxResponseSize", "234KB" },
 							{ "unconfirmedTransactionsCacheMaxSize", "98MB" },
+							{ "unconfirmedTransactionsCacheNumShards", "7" },
 
 							{ "connectTimeout", "4m" },
 							{ "syncTimeout", "5m" },
@@ -102,7 +105,8 @@ namespace catapult { namespace config {
 							{ "blockCacheSize", "111MB" },
 							{ "memtableMemoryBudget", "45MB" },
 
-							{ "maxWriteBatchSize", "17KB" }
+							{ "maxWriteBatchSize", "17KB" },
+							{ "groupCommitInterval", "250ms" }
 						}
 					},
 					{
@@ -165,8 +169,10 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.EnableSingleThreadPool);
 				EXPECT_FALSE(config.EnableCacheDatabaseStorage);
 				EXPECT_FALSE(config.EnableAutoSyncCleanup);
+				EXPECT_FALSE(config.EnableParallelStateHashCalculation);
 
 				EXPECT_EQ(0u, config.FileDatabaseBatchSize);
+				EXPECT_EQ(0u, config.BlockStorageMaxMappedFiles);
 
 				EXPECT_FALSE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(), config.TransactionSpamThrottlingMaxBoostFee);
@@ -185,6 +191,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(model::TransactionSelectionStrategy::Oldest, config.TransactionSelectionStrategy);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.UnconfirmedTransactionsCacheMaxSize);
+				EXPECT_EQ(0u, config.UnconfirmedTransactionsCacheNumShards);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.SyncTimeout);
@@ -221,6 +228,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.MemtableMemoryBudget);
 
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.MaxWriteBatchSize);
+				EXPECT_EQ(utils::TimeSpan(), config.CacheDatabase.GroupCommitInterval);
 
 				EXPECT_EQ("", config.Local.Host);
 				EXPECT_EQ("", config.Local.FriendlyName);
@@ -260,8 +268,10 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.EnableSingleThreadPool);
 				EXPECT_TRUE(config.EnableCacheDatabaseStorage);
 				EXPECT_TRUE(config.EnableAutoSyncCleanup);
+				EXPECT_TRUE(config.EnableParallelStateHashCalculation);
 
 				EXPECT_EQ(888u, config.FileDatabaseBatchSize);
+				EXPECT_EQ(12u, config.BlockStorageMaxMappedFiles);
 
 				EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(54'123), config.TransactionSpamThrottlingMaxBoostFee);
@@ -280,6 +290,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(model::TransactionSelectionStrategy::Maximize_Fee, config.TransactionSelectionStrategy);
 				EXPECT_EQ(utils::FileSize::FromKilobytes(234), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(98), config.UnconfirmedTransactionsCacheMaxSize);
+				EXPECT_EQ(7u, config.UnconfirmedTransactionsCacheNumShards);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(4), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(5), config.SyncTimeout);
@@ -316,6 +327,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(utils::FileSize::FromMegabytes(45), config.CacheDatabase.MemtableMemoryBudget);
 
 				EXPECT_EQ(utils::FileSize::FromKilobytes(17), config.CacheDatabase.MaxWriteBatchSize);
+				EXPECT_EQ(utils::TimeSpan::FromMilliseconds(250), config.CacheDatabase.GroupCommitInterval);
 
 				EXPECT_EQ("alice.com", config.Local.Host);
 				EXPECT_EQ("a GREAT node", config.Local.FriendlyName);
@@ -29,6 +29,7 @@
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/KeyTestUtils.h"
 #include "tests/test/nodeps/ParamsCapture.h"
 #include "tests/TestHarness.h"
@@ -217,6 +218,18 @@ namespace catapult { namespace consumers {
 						receiptValidationMode);
 			}
 
+			explicit ProcessorTestContext(thread::IoThreadPool& stateHashPool) : BlockHitPredicateFactory(BlockHitPredicate) {
+				Processor = CreateBlockChainProcessor(
+						[this](const auto& cache) {
+							return BlockHitPredicateFactory(cache);
+						},
+						[this](auto height, auto timestamp, const auto& entities, auto& state) {
+							return BatchEntityProcessor(height, timestamp, entities, state);
+						},
+						ReceiptValidationMode::Disabled,
+						stateHashPool);
+			}
+
 		public:
 			MockBlockHitPredicate BlockHitPredicate;
 			MockBlockHitPredicateFactory BlockHitPredicateFactory;
@@ -491,6 +504,25 @@ namespace catapult { namespace consumers {
 		AssertCanProcessValidElements<TTraits>(elements, 3);
 	}
 
+	TEST(TEST_CLASS, CanProcessMultipleBlocksWithParallelStateHashCalculation) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		ProcessorTestContext context(*pPool);
+		auto pParentBlock = test::GenerateEmptyRandomBlock();
+		auto elements = test::CreateBlockElements(3);
+		PrepareChain(Height(11), *pParentBlock, elements);
+
+		// Act:
+		auto result = context.Process(*pParentBlock, elements);
+
+		// Assert:
+		EXPECT_EQ(ValidationResult::Success, result);
+		EXPECT_EQ(3u, context.BlockHitPredicate.params().size());
+		EXPECT_EQ(3u, context.BatchEntityProcessor.params().size());
+		context.assertBlockHitPredicateCalls(*pParentBlock, elements);
+		context.assertBatchEntityProcessorCalls(elements);
+	}
+
 	// endregion
 
 	// region valid - remote harvester
@@ -29,6 +29,7 @@
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/core/mocks/MockTransactionPluginWithCustomBuffers.h"
 #include "tests/test/nodeps/TestConstants.h"
@@ -188,6 +189,23 @@ namespace catapult { namespace consumers {
 		AssertBlockHashesAreCalculatedCorrectly(3, 4);
 	}
 
+	TEST(BLOCK_TEST_CLASS, CanProcessMultipleEntitiesWithTransactionsUsingPool) {
+		// Arrange: use a minimum partition size of one so that every merkle level with multiple pairs is split across the pool
+		auto pPool = test::CreateStartedIoThreadPool();
+		auto registry = CustomBuffersTraits::CreateTransactionRegistry();
+		auto input = CreateBlockConsumerInput(registry, 3, 9);
+		auto& blockElements = input.blocks();
+
+		// Act:
+		auto result = CreateBlockHashCalculatorConsumer(GetNetworkGenerationHashSeed(), registry, *pPool, 1)(blockElements);
+
+		// Assert:
+		test::AssertContinued(result);
+		EXPECT_EQ(3u, blockElements.size());
+		for (const auto& blockElement : blockElements)
+			AssertCorrectHashes(blockElement, 9);
+	}
+
 	TEST(BLOCK_TEST_CLASS, CalculatesCorrectHashForDeterministicEntity) {
 		// Arrange:
 		auto generationHashSeed = utils::ParseByteArray<GenerationHashSeed>(test::Deterministic_Network_Generation_Hash_Seed_String);
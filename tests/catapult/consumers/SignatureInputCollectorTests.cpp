@@ -0,0 +1,202 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/consumers/SignatureInputCollector.h"
+#include "catapult/utils/RandomGenerator.h"
+#include "tests/test/nodeps/KeyTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace consumers {
+
+#define TEST_CLASS SignatureInputCollectorTests
+
+	namespace {
+		using ReplayProtectionMode = model::SignatureNotification::ReplayProtectionMode;
+
+		struct SignedData {
+		public:
+			SignedData()
+					: PublicKey(test::GenerateRandomByteArray<Key>())
+					, Signature(test::GenerateRandomByteArray<catapult::Signature>())
+					, Data(test::GenerateRandomVector(50))
+			{}
+
+		public:
+			Key PublicKey;
+			catapult::Signature Signature;
+			std::vector<uint8_t> Data;
+		};
+
+		void Notify(SignatureInputCollector& collector, const SignedData& signedData, ReplayProtectionMode replayProtectionMode) {
+			const auto& data = signedData.Data;
+			collector.notify(model::SignatureNotification(signedData.PublicKey, signedData.Signature, data, replayProtectionMode));
+		}
+
+		void AssertInput(
+				const crypto::SignatureInputView& input,
+				const SignedData& signedData,
+				const std::vector<RawBuffer>& expectedPrefixBuffers,
+				const std::string& message) {
+			EXPECT_EQ(&signedData.PublicKey, &input.PublicKey) << message;
+			EXPECT_EQ(&signedData.Signature, &input.Signature) << message;
+			ASSERT_EQ(expectedPrefixBuffers.size() + 1, input.NumBuffers) << message;
+
+			for (auto i = 0u; i < expectedPrefixBuffers.size(); ++i) {
+				EXPECT_EQ(expectedPrefixBuffers[i].pData, input.pBuffers[i].pData) << message << " prefix " << i;
+				EXPECT_EQ(expectedPrefixBuffers[i].Size, input.pBuffers[i].Size) << message << " prefix " << i;
+			}
+
+			const auto& dataBuffer = input.pBuffers[expectedPrefixBuffers.size()];
+			EXPECT_EQ(signedData.Data.data(), dataBuffer.pData) << message;
+			EXPECT_EQ(signedData.Data.size(), dataBuffer.Size) << message;
+		}
+	}
+
+	// region ctor
+
+	TEST(TEST_CLASS, CollectorIsInitiallyEmpty) {
+		// Act:
+		SignatureInputCollector collector(test::GenerateRandomByteArray<GenerationHashSeed>(), 10);
+
+		// Assert:
+		EXPECT_TRUE(collector.notificationToEntityIndexMap().empty());
+		EXPECT_TRUE(collector.inputs().empty());
+	}
+
+	// endregion
+
+	// region notify
+
+	TEST(TEST_CLASS, CollectorIgnoresOtherNotifications) {
+		// Arrange:
+		SignatureInputCollector collector(test::GenerateRandomByteArray<GenerationHashSeed>(), 10);
+
+		// Act:
+		collector.notify(model::AccountAddressNotification(test::GenerateRandomByteArray<UnresolvedAddress>()));
+
+		// Assert:
+		EXPECT_TRUE(collector.notificationToEntityIndexMap().empty());
+		EXPECT_TRUE(collector.inputs().empty());
+	}
+
+	TEST(TEST_CLASS, CollectorCanCollectSignatureWithoutReplayProtection) {
+		// Arrange:
+		SignatureInputCollector collector(test::GenerateRandomByteArray<GenerationHashSeed>(), 10);
+		SignedData signedData;
+
+		// Act:
+		Notify(collector, signedData, ReplayProtectionMode::Disabled);
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 0 }), collector.notificationToEntityIndexMap());
+		ASSERT_EQ(1u, collector.inputs().size());
+		AssertInput(collector.inputs()[0], signedData, {}, "input 0");
+	}
+
+	TEST(TEST_CLASS, CollectorCanCollectSignatureWithReplayProtection) {
+		// Arrange:
+		auto generationHashSeed = test::GenerateRandomByteArray<GenerationHashSeed>();
+		SignatureInputCollector collector(generationHashSeed, 10);
+		SignedData signedData;
+
+		// Act:
+		Notify(collector, signedData, ReplayProtectionMode::Enabled);
+
+		// Assert: the generation hash seed prefix is not copied
+		EXPECT_EQ(std::vector<size_t>({ 0 }), collector.notificationToEntityIndexMap());
+		ASSERT_EQ(1u, collector.inputs().size());
+		AssertInput(collector.inputs()[0], signedData, { generationHashSeed }, "input 0");
+	}
+
+	TEST(TEST_CLASS, CollectorMapsSignaturesToEntities) {
+		// Arrange:
+		SignatureInputCollector collector(test::GenerateRandomByteArray<GenerationHashSeed>(), 10);
+		std::vector<SignedData> signedDataVector(4);
+
+		// Act: entity 0 => { 0 }, entity 1 => {}, entity 2 => { 1, 2 }, entity 3 => { 3 }
+		Notify(collector, signedDataVector[0], ReplayProtectionMode::Enabled);
+		collector.next();
+		collector.next();
+		Notify(collector, signedDataVector[1], ReplayProtectionMode::Disabled);
+		Notify(collector, signedDataVector[2], ReplayProtectionMode::Enabled);
+		collector.next();
+		Notify(collector, signedDataVector[3], ReplayProtectionMode::Disabled);
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 0, 2, 2, 3 }), collector.notificationToEntityIndexMap());
+		EXPECT_EQ(4u, collector.inputs().size());
+	}
+
+	TEST(TEST_CLASS, CollectorInputsAreValidWhenEntityHintIsExceeded) {
+		// Arrange: use a small hint to force the buffer arena to grow
+		auto generationHashSeed = test::GenerateRandomByteArray<GenerationHashSeed>();
+		SignatureInputCollector collector(generationHashSeed, 1);
+		std::vector<SignedData> signedDataVector(25);
+
+		// Act:
+		for (auto i = 0u; i < signedDataVector.size(); ++i)
+			Notify(collector, signedDataVector[i], 0 == i % 3 ? ReplayProtectionMode::Disabled : ReplayProtectionMode::Enabled);
+
+		// Assert:
+		ASSERT_EQ(signedDataVector.size(), collector.inputs().size());
+		for (auto i = 0u; i < signedDataVector.size(); ++i) {
+			auto expectedPrefixBuffers = 0 == i % 3 ? std::vector<RawBuffer>() : std::vector<RawBuffer>{ generationHashSeed };
+			AssertInput(collector.inputs()[i], signedDataVector[i], expectedPrefixBuffers, "input " + std::to_string(i));
+		}
+	}
+
+	// endregion
+
+	// region verification
+
+	TEST(TEST_CLASS, CollectedInputsCanBeVerified) {
+		// Arrange:
+		auto generationHashSeed = test::GenerateRandomByteArray<GenerationHashSeed>();
+		SignatureInputCollector collector(generationHashSeed, 3);
+		std::vector<SignedData> signedDataVector(10);
+		for (auto i = 0u; i < signedDataVector.size(); ++i) {
+			auto& signedData = signedDataVector[i];
+			auto keyPair = test::GenerateKeyPair();
+			signedData.PublicKey = keyPair.publicKey();
+
+			auto replayProtectionMode = ReplayProtectionMode::Disabled;
+			if (0 == i % 2) {
+				crypto::Sign(keyPair, { RawBuffer(generationHashSeed), RawBuffer(signedData.Data) }, signedData.Signature);
+				replayProtectionMode = ReplayProtectionMode::Enabled;
+			} else {
+				crypto::Sign(keyPair, signedData.Data, signedData.Signature);
+			}
+
+			Notify(collector, signedData, replayProtectionMode);
+		}
+
+		auto randomFiller = [](auto* pOut, auto count) { utils::LowEntropyRandomGenerator().fill(pOut, count); };
+
+		// Act:
+		auto result = crypto::VerifyMulti(randomFiller, collector.inputs().data(), collector.inputs().size());
+
+		// Assert:
+		EXPECT_TRUE(result.second);
+		EXPECT_EQ(std::vector<bool>(signedDataVector.size(), true), result.first);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,187 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/crypto/Keccak.h"
+#include "catapult/crypto/OpensslContexts.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+#include <openssl/evp.h>
+
+namespace catapult { namespace crypto {
+
+#define TEST_CLASS KeccakTests
+
+	namespace {
+		// sizes around the 136 byte rate boundaries
+		std::vector<size_t> GetSampleSizes() {
+			return { 0, 1, 32, 64, 135, 136, 137, 200, 271, 272, 273, 1000 };
+		}
+
+		Hash256 CalculateOpensslSha3_256(const RawBuffer& dataBuffer) {
+			Hash256 hash;
+			auto outputSize = static_cast<unsigned int>(hash.size());
+
+			OpensslDigestContext context;
+			context.dispatch(EVP_DigestInit_ex, EVP_sha3_256(), nullptr);
+			context.dispatch(EVP_DigestUpdate, dataBuffer.pData, dataBuffer.Size);
+			context.dispatch(EVP_DigestFinal_ex, hash.data(), &outputSize);
+			return hash;
+		}
+
+		Hash256 CalculateSha3_256(const RawBuffer& dataBuffer) {
+			Hash256 hash;
+			Sha3_256_Context context;
+			context.update(dataBuffer);
+			context.final(hash);
+			return hash;
+		}
+	}
+
+	// region KeccakF1600
+
+	TEST(TEST_CLASS, KeccakF1600_ZeroStateHasExpectedPermutation) {
+		// Arrange:
+		std::array<uint64_t, Keccak_State_Lanes> state{};
+
+		// Act:
+		KeccakF1600(state);
+
+		// Assert: data from: https://github.com/XKCP/XKCP/blob/master/tests/TestVectors/KeccakF-1600-IntermediateValues.txt
+		EXPECT_EQ(0xF1258F7940E1DDE7u, state[0]);
+		EXPECT_EQ(0x84D5CCF933C0478Au, state[1]);
+		EXPECT_EQ(0xD598261EA65AA9EEu, state[2]);
+		EXPECT_EQ(0xBD1547306F80494Du, state[3]);
+		EXPECT_EQ(0x8B284E056253D057u, state[4]);
+		EXPECT_EQ(0xEAF1FF7B5CECA249u, state[24]);
+	}
+
+	// endregion
+
+	// region GetMaxKeccakParallelism
+
+	TEST(TEST_CLASS, MaxParallelismIsSupportedValue) {
+		// Act:
+		auto maxParallelism = GetMaxKeccakParallelism();
+
+		// Assert:
+		EXPECT_TRUE(1 == maxParallelism || 4 == maxParallelism || 8 == maxParallelism) << maxParallelism;
+	}
+
+	// endregion
+
+	// region Sha3_256_Context
+
+	TEST(TEST_CLASS, ContextMatchesOpensslForSampleSizes) {
+		for (auto size : GetSampleSizes()) {
+			// Arrange:
+			auto buffer = test::GenerateRandomVector(size);
+
+			// Act:
+			auto hash = CalculateSha3_256(buffer);
+
+			// Assert:
+			EXPECT_EQ(CalculateOpensslSha3_256(buffer), hash) << "size " << size;
+		}
+	}
+
+	TEST(TEST_CLASS, ContextIncrementalUpdatesMatchSingleUpdate) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(1000);
+		auto expectedHash = CalculateSha3_256(buffer);
+
+		for (auto chunkSize : { 1u, 7u, 64u, 135u, 136u, 137u, 500u }) {
+			// Act:
+			Hash256 hash;
+			Sha3_256_Context context;
+			for (auto i = 0u; i < buffer.size(); i += chunkSize)
+				context.update({ buffer.data() + i, std::min<size_t>(chunkSize, buffer.size() - i) });
+
+			context.final(hash);
+
+			// Assert:
+			EXPECT_EQ(expectedHash, hash) << "chunk size " << chunkSize;
+		}
+	}
+
+	// endregion
+
+	// region Sha3_256Multi
+
+	namespace {
+		void AssertMultiMatchesSingle(const std::vector<size_t>& sizes, size_t maxParallelism) {
+			// Arrange:
+			std::vector<std::vector<uint8_t>> buffers;
+			std::vector<RawBuffer> dataBuffers;
+			for (auto size : sizes)
+				buffers.push_back(test::GenerateRandomVector(size));
+
+			for (const auto& buffer : buffers)
+				dataBuffers.push_back(buffer);
+
+			// Act:
+			std::vector<Hash256> hashes(sizes.size());
+			Sha3_256Multi(dataBuffers.data(), hashes.data(), dataBuffers.size(), maxParallelism);
+
+			// Assert:
+			for (auto i = 0u; i < buffers.size(); ++i)
+				EXPECT_EQ(CalculateSha3_256(buffers[i]), hashes[i]) << "buffer " << i << " with size " << sizes[i];
+		}
+
+		// note that parallelism is capped by the cpu, so wider variants might fall back to narrower ones
+		void AssertMultiMatchesSingleForAllParallelisms(const std::vector<size_t>& sizes) {
+			for (auto maxParallelism : { 1u, 4u, 8u }) {
+				CATAPULT_LOG(debug) << "max parallelism " << maxParallelism;
+				AssertMultiMatchesSingle(sizes, maxParallelism);
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, MultiCanHashZeroBuffers) {
+		AssertMultiMatchesSingleForAllParallelisms({});
+	}
+
+	TEST(TEST_CLASS, MultiCanHashSingleBuffer) {
+		AssertMultiMatchesSingleForAllParallelisms({ 64 });
+	}
+
+	TEST(TEST_CLASS, MultiCanHashEqualSizedBuffers) {
+		for (auto count : { 3u, 4u, 5u, 8u, 9u, 17u })
+			AssertMultiMatchesSingleForAllParallelisms(std::vector<size_t>(count, 64));
+	}
+
+	TEST(TEST_CLASS, MultiCanHashMultiBlockBuffers) {
+		AssertMultiMatchesSingleForAllParallelisms(std::vector<size_t>(11, 500));
+	}
+
+	TEST(TEST_CLASS, MultiCanHashMixedSizedBuffers) {
+		// Arrange: interleave sizes so that buffers with the same number of blocks are not adjacent
+		std::vector<size_t> sizes;
+		for (auto i = 0u; i < 3; ++i) {
+			for (auto size : GetSampleSizes())
+				sizes.push_back(size);
+		}
+
+		// Act + Assert:
+		AssertMultiMatchesSingleForAllParallelisms(sizes);
+	}
+
+	// endregion
+}}
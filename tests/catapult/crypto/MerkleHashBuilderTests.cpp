@@ -288,6 +288,141 @@ namespace catapult { namespace crypto {
 
 	// endregion
 
+	// region final - level hasher
+
+	TEST(TEST_CLASS, CustomLevelHasherIsCalledForEachLevel) {
+		// Arrange:
+		auto seedHashes = GenerateRandomHashes(5);
+		std::vector<size_t> levelSizes;
+		MerkleHashBuilder builder(0, [&levelSizes](const auto& pairBuffers, auto* pHashes) {
+			levelSizes.push_back(pairBuffers.size());
+			for (auto i = 0u; i < pairBuffers.size(); ++i)
+				Sha3_256(pairBuffers[i], pHashes[i]);
+		});
+
+		for (const auto& hash : seedHashes)
+			builder.update(hash);
+
+		// Act:
+		Hashes tree;
+		builder.final(tree);
+
+		// Assert: levels are padded to even sizes before hashing
+		EXPECT_EQ(std::vector<size_t>({ 3, 2, 1 }), levelSizes);
+		EXPECT_EQ(CreateMerkleTree(seedHashes), tree);
+	}
+
+	TEST(TEST_CLASS, CanFinalizeMultipleTimes) {
+		// Arrange:
+		auto seedHashes = GenerateRandomHashes(5);
+		MerkleHashBuilder builder;
+		for (const auto& hash : seedHashes)
+			builder.update(hash);
+
+		// Act:
+		Hash256 merkleHash;
+		builder.final(merkleHash);
+
+		Hashes tree;
+		builder.final(tree);
+
+		// Assert:
+		auto expectedTree = CreateMerkleTree(seedHashes);
+		EXPECT_EQ(expectedTree.back(), merkleHash);
+		EXPECT_EQ(expectedTree, tree);
+	}
+
+	TEST(TEST_CLASS, CannotUpdateAfterFinal) {
+		// Arrange:
+		MerkleHashBuilder builder;
+		builder.update(test::GenerateRandomByteArray<Hash256>());
+
+		Hash256 merkleHash;
+		builder.final(merkleHash);
+
+		// Act + Assert:
+		EXPECT_THROW(builder.update(test::GenerateRandomByteArray<Hash256>()), catapult_runtime_error);
+	}
+
+	// endregion
+
+	// region path
+
+	namespace {
+		Hash256 CalculateRootFromPath(const Hash256& leafHash, size_t index, const Hashes& path) {
+			auto hash = leafHash;
+			for (const auto& siblingHash : path) {
+				Sha3_256_Builder builder;
+				if (0 == index % 2)
+					builder.update({ hash, siblingHash });
+				else
+					builder.update({ siblingHash, hash });
+
+				builder.final(hash);
+				index /= 2;
+			}
+
+			return hash;
+		}
+
+		void AssertPathsLeadToRoot(size_t numHashes, size_t expectedPathSize) {
+			// Arrange:
+			auto seedHashes = GenerateRandomHashes(numHashes);
+			MerkleHashBuilder builder;
+			for (const auto& hash : seedHashes)
+				builder.update(hash);
+
+			Hash256 merkleHash;
+			builder.final(merkleHash);
+
+			for (auto i = 0u; i < numHashes; ++i) {
+				// Act:
+				auto path = builder.path(i);
+
+				// Assert:
+				EXPECT_EQ(expectedPathSize, path.size()) << "leaf " << i << " of " << numHashes;
+				EXPECT_EQ(merkleHash, CalculateRootFromPath(seedHashes[i], i, path)) << "leaf " << i << " of " << numHashes;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, CannotRetrievePathBeforeFinal) {
+		// Arrange:
+		MerkleHashBuilder builder;
+		builder.update(test::GenerateRandomByteArray<Hash256>());
+
+		// Act + Assert:
+		EXPECT_THROW(builder.path(0), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, CannotRetrievePathForUnknownLeaf) {
+		// Arrange:
+		MerkleHashBuilder builder;
+		for (const auto& hash : GenerateRandomHashes(5))
+			builder.update(hash);
+
+		Hash256 merkleHash;
+		builder.final(merkleHash);
+
+		// Act + Assert:
+		EXPECT_THROW(builder.path(5), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, PathOfSingleLeafIsEmpty) {
+		AssertPathsLeadToRoot(1, 0);
+	}
+
+	TEST(TEST_CLASS, PathsOfBalancedTreeLeadToRoot) {
+		AssertPathsLeadToRoot(8, 3);
+	}
+
+	TEST(TEST_CLASS, PathsOfUnbalancedTreeLeadToRoot) {
+		AssertPathsLeadToRoot(5, 3);
+		AssertPathsLeadToRoot(13, 4);
+	}
+
+	// endregion
+
 	// region treeSize
 
 	TEST(TEST_CLASS, TreeSizeReturnsExpectedValue) {
@@ -116,11 +116,10 @@ namespace catapult { namespace crypto {
 		}
 
 		template<typename TTraits, typename TMutator>
-		void AssertSignedPayloadsCannotBeVerifiedAsBatches(TMutator mutator) {
+		void AssertSignedPayloadsCannotBeVerifiedAsBatches(std::unordered_set<size_t>&& failedIndexes, TMutator mutator) {
 			// Arrange:
 			DataHolder dataHolder;
 			auto signatureInputs = CreateSignatureInputs(Default_Signature_Count, dataHolder);
-			std::unordered_set<size_t> failedIndexes{ 1, 17, 58 };
 			for (auto index : failedIndexes)
 				mutator(signatureInputs, index);
 
@@ -131,6 +130,11 @@ namespace catapult { namespace crypto {
 			TTraits::AssertVerifyResult(result, false, failedIndexes);
 		}
 
+		template<typename TTraits, typename TMutator>
+		void AssertSignedPayloadsCannotBeVerifiedAsBatches(TMutator mutator) {
+			AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>({ 1, 17, 58 }, mutator);
+		}
+
 		RandomFiller CreateRandomFiller() {
 			return [](auto* pOut, auto count) {
 				// can use low entropy source for tests
@@ -172,12 +176,39 @@ namespace catapult { namespace crypto {
 				EXPECT_EQ(expectedAggregateResult, result);
 			}
 		};
+
+		std::vector<SignatureInputView> CreateSignatureInputViews(const std::vector<SignatureInput>& signatureInputs) {
+			std::vector<SignatureInputView> signatureInputViews;
+			signatureInputViews.reserve(signatureInputs.size());
+			for (const auto& signatureInput : signatureInputs) {
+				const auto& buffers = signatureInput.Buffers;
+				signatureInputViews.push_back({ signatureInput.PublicKey, buffers.data(), buffers.size(), signatureInput.Signature });
+			}
+
+			return signatureInputViews;
+		}
+
+		struct VerifyMultiViewTraits : public VerifyMultiTraits {
+			static std::pair<std::vector<bool>, bool> Verify(const std::vector<SignatureInput>& signatureInputs) {
+				auto signatureInputViews = CreateSignatureInputViews(signatureInputs);
+				return VerifyMulti(CreateRandomFiller(), signatureInputViews.data(), signatureInputViews.size());
+			}
+		};
+
+		struct VerifyMultiShortCircuitViewTraits : public VerifyMultiShortCircuitTraits {
+			static bool Verify(const std::vector<SignatureInput>& signatureInputs) {
+				auto signatureInputViews = CreateSignatureInputViews(signatureInputs);
+				return VerifyMultiShortCircuit(CreateRandomFiller(), signatureInputViews.data(), signatureInputViews.size());
+			}
+		};
 	}
 
 #define VERIFY_MULTI_TEST(TEST_NAME) \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
 	TEST(TEST_CLASS, TEST_NAME##_All) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<VerifyMultiTraits>(); } \
 	TEST(TEST_CLASS, TEST_NAME##_ShortCircuit) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<VerifyMultiShortCircuitTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_AllView) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<VerifyMultiViewTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_ShortCircuitView) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<VerifyMultiShortCircuitViewTraits>(); } \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
 	VERIFY_MULTI_TEST(SignedPayloadsCanBeVerifiedAsBatches_LessThanBatchSize) {
@@ -201,6 +232,12 @@ namespace catapult { namespace crypto {
 		});
 	}
 
+	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_DifferentKeyNotInFirstBatch) {
+		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>({ 70, 93 }, [](auto& signatureInputs, auto index) {
+			const_cast<Key&>(signatureInputs[index].PublicKey) = Valid_Public_Key;
+		});
+	}
+
 	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_DifferentRPart) {
 		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>([](auto& signatureInputs, auto index) {
 			const_cast<Signature&>(signatureInputs[index].Signature)[5] ^= 0xFF;
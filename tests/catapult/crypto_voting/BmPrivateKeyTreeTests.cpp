@@ -418,4 +418,153 @@ namespace catapult { namespace crypto {
 	}
 
 	// endregion
+
+	// region VerifyMulti
+
+	namespace {
+		RandomFiller CreateRandomFiller() {
+			return [](auto* pOut, auto count) {
+				utils::LowEntropyRandomGenerator().fill(pOut, count);
+			};
+		}
+
+		struct SignedMessages {
+			std::vector<std::array<uint8_t, 10>> MessageBuffers;
+			std::vector<BmTreeSignature> Signatures;
+			std::vector<BmKeyIdentifier> KeyIdentifiers;
+		};
+
+		SignedMessages SignMessages(BmPrivateKeyTree& tree, size_t count) {
+			SignedMessages signedMessages;
+			for (auto i = 0u; i < count; ++i) {
+				BmKeyIdentifier keyIdentifier{ Start_Key.KeyId + i };
+				signedMessages.MessageBuffers.push_back(test::GenerateRandomArray<10>());
+				signedMessages.Signatures.push_back(tree.sign(keyIdentifier, signedMessages.MessageBuffers.back()));
+				signedMessages.KeyIdentifiers.push_back(keyIdentifier);
+			}
+
+			return signedMessages;
+		}
+
+		std::pair<std::vector<bool>, bool> VerifyMultiSignedMessages(
+				const SignedMessages& signedMessages,
+				const std::vector<bool>& rootVerifiedFlags = {}) {
+			std::vector<BmTreeSignatureInput> signatureInputs;
+			for (auto i = 0u; i < signedMessages.Signatures.size(); ++i) {
+				signatureInputs.push_back({
+					signedMessages.Signatures[i],
+					signedMessages.KeyIdentifiers[i],
+					signedMessages.MessageBuffers[i],
+					!rootVerifiedFlags.empty() && rootVerifiedFlags[i]
+				});
+			}
+
+			return VerifyMulti(CreateRandomFiller(), signatureInputs.data(), signatureInputs.size());
+		}
+
+		void AssertVerifyMultiSingleFailure(const consumer<SignedMessages&>& corrupt) {
+			// Arrange:
+			TestContext context;
+			auto signedMessages = SignMessages(context.tree(), 5);
+			corrupt(signedMessages);
+
+			// Act:
+			auto resultPair = VerifyMultiSignedMessages(signedMessages);
+
+			// Assert:
+			EXPECT_FALSE(resultPair.second);
+			EXPECT_EQ(std::vector<bool>({ true, true, false, true, true }), resultPair.first);
+
+			// Sanity: individual verification agrees
+			for (auto i = 0u; i < signedMessages.Signatures.size(); ++i) {
+				const auto& signature = signedMessages.Signatures[i];
+				const auto& messageBuffer = signedMessages.MessageBuffers[i];
+				EXPECT_EQ(resultPair.first[i], Verify(signature, signedMessages.KeyIdentifiers[i], messageBuffer)) << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenNoSignaturesAreProvided) {
+		// Act:
+		auto resultPair = VerifyMultiSignedMessages(SignedMessages());
+
+		// Assert:
+		EXPECT_TRUE(resultPair.second);
+		EXPECT_TRUE(resultPair.first.empty());
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenAllSignaturesAreValid) {
+		// Arrange:
+		TestContext context;
+		auto signedMessages = SignMessages(context.tree(), 5);
+
+		// Act:
+		auto resultPair = VerifyMultiSignedMessages(signedMessages);
+
+		// Assert:
+		EXPECT_TRUE(resultPair.second);
+		EXPECT_EQ(std::vector<bool>(5, true), resultPair.first);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenRootSignatureIsInvalid) {
+		AssertVerifyMultiSingleFailure([](auto& signedMessages) {
+			signedMessages.Signatures[2].Root.Signature[0] ^= 0xFF;
+		});
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenBottomSignatureIsInvalid) {
+		AssertVerifyMultiSingleFailure([](auto& signedMessages) {
+			signedMessages.Signatures[2].Bottom.Signature[0] ^= 0xFF;
+		});
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenBottomPublicKeyIsInvalid) {
+		AssertVerifyMultiSingleFailure([](auto& signedMessages) {
+			signedMessages.Signatures[2].Bottom.ParentPublicKey = signedMessages.Signatures[3].Bottom.ParentPublicKey;
+		});
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenKeyIdentifierIsInvalid) {
+		AssertVerifyMultiSingleFailure([](auto& signedMessages) {
+			signedMessages.KeyIdentifiers[2] = signedMessages.KeyIdentifiers[3];
+		});
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenMessageIsInvalid) {
+		AssertVerifyMultiSingleFailure([](auto& signedMessages) {
+			signedMessages.MessageBuffers[2][0] ^= 0xFF;
+		});
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSkipsVerificationOfVerifiedRootSignatures) {
+		// Arrange: corrupt root signatures of messages marked as verified
+		TestContext context;
+		auto signedMessages = SignMessages(context.tree(), 5);
+		signedMessages.Signatures[1].Root.Signature[0] ^= 0xFF;
+		signedMessages.Signatures[3].Root.Signature[0] ^= 0xFF;
+
+		// Act:
+		auto resultPair = VerifyMultiSignedMessages(signedMessages, { false, true, false, true, false });
+
+		// Assert:
+		EXPECT_TRUE(resultPair.second);
+		EXPECT_EQ(std::vector<bool>(5, true), resultPair.first);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiVerifiesBottomSignaturesWhenRootSignaturesAreVerified) {
+		// Arrange:
+		TestContext context;
+		auto signedMessages = SignMessages(context.tree(), 5);
+		signedMessages.Signatures[1].Bottom.Signature[0] ^= 0xFF;
+		signedMessages.Signatures[2].Bottom.Signature[0] ^= 0xFF;
+
+		// Act:
+		auto resultPair = VerifyMultiSignedMessages(signedMessages, { false, true, false, true, false });
+
+		// Assert:
+		EXPECT_FALSE(resultPair.second);
+		EXPECT_EQ(std::vector<bool>({ true, false, false, true, true }), resultPair.first);
+	}
+
+	// endregion
 }}
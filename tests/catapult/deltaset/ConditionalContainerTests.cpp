@@ -19,6 +19,8 @@
 *** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
 **/
 
+#include "catapult/deltaset/BaseSet.h"
+#include "catapult/deltaset/BaseSetDelta.h"
 #include "catapult/deltaset/ConditionalContainer.h"
 #include "catapult/deltaset/OrderedSet.h"
 #include "catapult/utils/ContainerHelpers.h"
@@ -384,4 +386,141 @@ namespace catapult { namespace deltaset {
 	}
 
 	// endregion
+
+	// region prefetch
+
+	namespace {
+		using PrefetchTypes = test::DeltaElementsTestUtils::Types;
+		using PrefetchKeyType = PrefetchTypes::StorageTraits::KeyTraits::KeyType;
+
+		struct PrefetchCapture {
+			std::vector<PrefetchKeyType> PrefetchedKeys;
+			size_t NumDiscards = 0;
+		};
+
+		class PrefetchCapturingStorageMap : public PrefetchTypes::StorageMapType {
+		public:
+			explicit PrefetchCapturingStorageMap(PrefetchCapture& capture) : m_capture(capture)
+			{}
+
+		public:
+			void prefetch(const std::vector<PrefetchKeyType>& keys) const {
+				m_capture.PrefetchedKeys.insert(m_capture.PrefetchedKeys.end(), keys.cbegin(), keys.cend());
+			}
+
+			void discardPrefetched() {
+				++m_capture.NumDiscards;
+			}
+
+		private:
+			PrefetchCapture& m_capture;
+		};
+
+		using PrefetchContainerType = ConditionalContainer<
+			PrefetchTypes::StorageTraits::KeyTraits,
+			PrefetchCapturingStorageMap,
+			PrefetchTypes::MemoryMapType>;
+
+		using PrefetchStorageTraits = MapStorageTraits<
+			PrefetchContainerType,
+			test::TestElementToKeyConverter<test::MutableTestElement>,
+			PrefetchTypes::MemoryMapType>;
+		using PrefetchBaseSetType = BaseSet<test::MutableElementValueTraits, PrefetchStorageTraits>;
+
+		std::vector<PrefetchKeyType> CreatePrefetchKeys() {
+			return { std::make_pair("alpha", 5), std::make_pair("gamma", 7) };
+		}
+	}
+
+	TEST(TEST_CLASS, PrefetchIsForwardedToUnderlyingStorageContainer) {
+		// Arrange:
+		PrefetchCapture capture;
+		PrefetchContainerType container(ConditionalContainerMode::Storage, capture);
+		auto keys = CreatePrefetchKeys();
+
+		// Act:
+		container.prefetch(keys);
+
+		// Assert:
+		EXPECT_EQ(keys, capture.PrefetchedKeys);
+	}
+
+	TEST(TEST_CLASS, PrefetchIsNoOpForUnderlyingMemoryContainer) {
+		// Arrange:
+		PrefetchCapture capture;
+		PrefetchContainerType container(ConditionalContainerMode::Memory, capture);
+
+		// Act:
+		container.prefetch(CreatePrefetchKeys());
+
+		// Assert:
+		EXPECT_TRUE(capture.PrefetchedKeys.empty());
+	}
+
+	TEST(TEST_CLASS, DiscardPrefetchedIsForwardedToUnderlyingStorageContainer) {
+		// Arrange:
+		PrefetchCapture capture;
+		PrefetchContainerType container(ConditionalContainerMode::Storage, capture);
+
+		// Act:
+		container.discardPrefetched();
+
+		// Assert:
+		EXPECT_EQ(1u, capture.NumDiscards);
+	}
+
+	TEST(TEST_CLASS, DiscardPrefetchedIsNoOpForUnderlyingMemoryContainer) {
+		// Arrange:
+		PrefetchCapture capture;
+		PrefetchContainerType container(ConditionalContainerMode::Memory, capture);
+
+		// Act:
+		container.discardPrefetched();
+
+		// Assert:
+		EXPECT_EQ(0u, capture.NumDiscards);
+	}
+
+	TEST(TEST_CLASS, BaseSetRebaseDiscardsPrefetchedElements) {
+		// Arrange:
+		PrefetchCapture capture;
+		PrefetchBaseSetType set(ConditionalContainerMode::Storage, capture);
+
+		// Act:
+		auto pDelta = set.rebase();
+
+		// Assert:
+		EXPECT_EQ(1u, capture.NumDiscards);
+	}
+
+	TEST(TEST_CLASS, BaseSetCommitDiscardsPrefetchedElements) {
+		// Arrange:
+		PrefetchCapture capture;
+		PrefetchBaseSetType set(ConditionalContainerMode::Storage, capture);
+		auto pDelta = set.rebase();
+		pDelta->insert(test::MutableTestElement("alpha", 5));
+		pDelta->prefetch(CreatePrefetchKeys());
+
+		// Act:
+		set.commit();
+
+		// Assert: only gamma is prefetched because alpha has a pending change
+		EXPECT_EQ(std::vector<PrefetchKeyType>({ std::make_pair("gamma", 7) }), capture.PrefetchedKeys);
+		EXPECT_EQ(2u, capture.NumDiscards);
+		EXPECT_EQ(1u, set.size());
+	}
+
+	TEST(TEST_CLASS, BaseSetRebaseDetachedDoesNotDiscardPrefetchedElements) {
+		// Arrange:
+		PrefetchCapture capture;
+		PrefetchBaseSetType set(ConditionalContainerMode::Storage, capture);
+
+		// Act:
+		auto pDelta = set.rebaseDetached();
+
+		// Assert:
+		EXPECT_EQ(0u, capture.NumDiscards);
+	}
+
+	// endregion
 }}
@@ -36,5 +36,6 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(utils::FileSize::FromMegabytes(1024), options.DisruptorMaxMemorySize);
 		EXPECT_EQ(1u, options.ElementTraceInterval);
 		EXPECT_TRUE(options.ShouldThrowWhenFull);
+		EXPECT_EQ(WaitStrategy::Blocking, options.ConsumerWaitStrategy);
 	}
 }}
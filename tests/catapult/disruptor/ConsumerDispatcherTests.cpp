@@ -549,6 +549,69 @@ namespace catapult { namespace disruptor {
 
 	// endregion
 
+	// region latencies
+
+	TEST(TEST_CLASS, LatenciesAreInitiallyEmpty) {
+		// Act:
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { CreateNoOpConsumer(), CreateNoOpConsumer() });
+
+		// Assert:
+		for (auto i = 0u; i < dispatcher.size(); ++i) {
+			EXPECT_EQ(0u, dispatcher.latencies(i).QueueWait.count()) << i;
+			EXPECT_EQ(0u, dispatcher.latencies(i).Processing.count()) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, LatenciesAreRecordedForEachConsumer) {
+		// Arrange:
+		auto ranges = test::PrepareRanges(3);
+
+		// Act: the second consumer is slow
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, {
+			CreateNoOpConsumer(),
+			[](const auto&) {
+				test::Sleep(5);
+				return ConsumerResult::Continue();
+			},
+			CreateNoOpConsumer()
+		});
+
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert: all consumers timed all elements
+		for (auto i = 0u; i < dispatcher.size(); ++i) {
+			EXPECT_EQ(3u, dispatcher.latencies(i).QueueWait.count()) << i;
+			EXPECT_EQ(3u, dispatcher.latencies(i).Processing.count()) << i;
+		}
+
+		// - slow consumer processing time is reflected in the histogram (in microseconds)
+		const auto& slowProcessing = dispatcher.latencies(1).Processing;
+		EXPECT_LE(5'000u, slowProcessing.percentile(1));
+		EXPECT_LE(5'000u, slowProcessing.max());
+	}
+
+	TEST(TEST_CLASS, LatenciesAreNotRecordedForSkippedElements) {
+		// Arrange:
+		auto ranges = test::PrepareRanges(5);
+		auto height = 0u;
+		for (auto& range : ranges)
+			range.begin()->Height = Height(++height);
+
+		// Act:
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { CreateSkipIfFirstBlockIsEvenConsumer(), CreateNoOpConsumer() });
+
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert: second consumer only processed elements with odd heights
+		EXPECT_EQ(5u, dispatcher.latencies(0).Processing.count());
+		EXPECT_EQ(3u, dispatcher.latencies(1).QueueWait.count());
+		EXPECT_EQ(3u, dispatcher.latencies(1).Processing.count());
+	}
+
+	// endregion
+
 	// region consumer exception
 
 #ifdef __clang__
@@ -21,6 +21,7 @@
 
 #include "catapult/disruptor/DisruptorBarrier.h"
 #include "tests/TestHarness.h"
+#include <thread>
 
 namespace catapult { namespace disruptor {
 
@@ -33,6 +34,17 @@ namespace catapult { namespace disruptor {
 		// Assert:
 		EXPECT_EQ(100u, barrier.level());
 		EXPECT_EQ(1u, barrier.position());
+		EXPECT_EQ(WaitStrategy::Blocking, barrier.waitStrategy());
+	}
+
+	TEST(TEST_CLASS, CanCreateBarrierWithCustomWaitStrategy) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 1, WaitStrategy::Busy_Spin);
+
+		// Assert:
+		EXPECT_EQ(100u, barrier.level());
+		EXPECT_EQ(1u, barrier.position());
+		EXPECT_EQ(WaitStrategy::Busy_Spin, barrier.waitStrategy());
 	}
 
 	TEST(TEST_CLASS, CanAdvanceBarrier) {
@@ -46,4 +58,89 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(100u, barrier.level());
 		EXPECT_EQ(2u, barrier.position());
 	}
+
+	// region wait
+
+#define WAIT_STRATEGY_TEST(TEST_NAME) \
+	void TEST_NAME##Impl(WaitStrategy waitStrategy); \
+	TEST(TEST_CLASS, TEST_NAME##_BusySpin) { TEST_NAME##Impl(WaitStrategy::Busy_Spin); } \
+	TEST(TEST_CLASS, TEST_NAME##_SpinThenYield) { TEST_NAME##Impl(WaitStrategy::Spin_Then_Yield); } \
+	TEST(TEST_CLASS, TEST_NAME##_Blocking) { TEST_NAME##Impl(WaitStrategy::Blocking); } \
+	void TEST_NAME##Impl(WaitStrategy waitStrategy)
+
+	WAIT_STRATEGY_TEST(WaitReturnsImmediatelyWhenBarrierHasMoved) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 1, waitStrategy);
+		std::atomic_bool keepWaiting(true);
+		barrier.advance();
+
+		// Act:
+		auto result = barrier.wait(1, keepWaiting);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(2u, barrier.position());
+	}
+
+	WAIT_STRATEGY_TEST(WaitReturnsImmediatelyWhenWaitingIsDisabled) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 1, waitStrategy);
+		std::atomic_bool keepWaiting(false);
+
+		// Act:
+		auto result = barrier.wait(1, keepWaiting);
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(1u, barrier.position());
+	}
+
+	WAIT_STRATEGY_TEST(WaitReturnsWhenBarrierIsAdvancedByOtherThread) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 1, waitStrategy);
+		std::atomic_bool keepWaiting(true);
+		std::atomic_bool isWaitComplete(false);
+
+		// Act:
+		std::thread waiter([&barrier, &keepWaiting, &isWaitComplete]() {
+			EXPECT_TRUE(barrier.wait(1, keepWaiting));
+			isWaitComplete = true;
+		});
+
+		test::Pause();
+		auto isWaitCompleteBeforeAdvance = isWaitComplete.load();
+		barrier.advance();
+		WAIT_FOR(isWaitComplete);
+		waiter.join();
+
+		// Assert:
+		EXPECT_FALSE(isWaitCompleteBeforeAdvance);
+		EXPECT_EQ(2u, barrier.position());
+	}
+
+	WAIT_STRATEGY_TEST(WaitReturnsWhenInterruptedByOtherThread) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 1, waitStrategy);
+		std::atomic_bool keepWaiting(true);
+		std::atomic_bool isWaitComplete(false);
+
+		// Act:
+		std::thread waiter([&barrier, &keepWaiting, &isWaitComplete]() {
+			EXPECT_FALSE(barrier.wait(1, keepWaiting));
+			isWaitComplete = true;
+		});
+
+		test::Pause();
+		auto isWaitCompleteBeforeInterrupt = isWaitComplete.load();
+		keepWaiting = false;
+		barrier.interrupt();
+		WAIT_FOR(isWaitComplete);
+		waiter.join();
+
+		// Assert:
+		EXPECT_FALSE(isWaitCompleteBeforeInterrupt);
+		EXPECT_EQ(1u, barrier.position());
+	}
+
+	// endregion
 }}
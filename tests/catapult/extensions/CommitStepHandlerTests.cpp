@@ -20,6 +20,8 @@
 **/
 
 #include "catapult/extensions/CommitStepHandler.h"
+#include "catapult/cache_db/RocksDatabase.h"
+#include "catapult/cache_db/RocksInclude.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/io/IndexFile.h"
 #include "tests/test/nodeps/Filesystem.h"
@@ -89,6 +91,7 @@ namespace catapult { namespace extensions {
 			// Assert:
 			EXPECT_EQ(step, context.readCommitStep());
 			EXPECT_FALSE(context.existsIndexWriterValue());
+			EXPECT_FALSE(context.existsIndexUpdatedValue());
 		}
 	}
 
@@ -126,4 +129,151 @@ namespace catapult { namespace extensions {
 	}
 
 	// endregion
+
+	// region CreateCommitStepHandler (group commit) - test context
+
+	namespace {
+		class GroupCommitStepHandlerTestContext {
+		public:
+			GroupCommitStepHandlerTestContext()
+					: m_dataDirectory(m_tempDir.name())
+					, m_pGroupCommitter(std::make_shared<cache::RocksGroupCommitter>(utils::TimeSpan::FromHours(1)))
+					, m_database(cache::RocksDatabaseSettings(
+							m_dataDirectory.dir("statedb").str(),
+							config::NodeConfiguration::CacheDatabaseSubConfiguration(),
+							{ "default" },
+							cache::FilterPruningMode::Disabled,
+							m_pGroupCommitter))
+					, m_commitStep(CreateCommitStepHandler(m_dataDirectory, *m_pGroupCommitter)) {
+				std::filesystem::create_directories(m_dataDirectory.spoolDir("state_change").path());
+			}
+
+		public:
+			cache::RocksGroupCommitter& groupCommitter() {
+				return *m_pGroupCommitter;
+			}
+
+			consumers::CommitOperationStep readCommitStep() const {
+				return static_cast<consumers::CommitOperationStep>(io::IndexFile(m_dataDirectory.rootDir().file("commit_step.dat")).get());
+			}
+
+			bool existsIndexWriterValue() const {
+				return stateChangeIndexFile("index.dat").exists();
+			}
+
+			uint64_t readIndexWriterValue() const {
+				return stateChangeIndexFile("index.dat").get();
+			}
+
+			bool existsIndexUpdatedValue() const {
+				return stateChangeIndexFile("index_updated.dat").exists();
+			}
+
+			uint64_t readIndexUpdatedValue() const {
+				return stateChangeIndexFile("index_updated.dat").get();
+			}
+
+		public:
+			void write(uint64_t syncIndexWriterValue) {
+				m_database.put(0, std::to_string(syncIndexWriterValue), "value");
+				m_database.flush();
+				stateChangeIndexFile("index_server.dat").set(syncIndexWriterValue);
+			}
+
+			void commitStep(consumers::CommitOperationStep step) {
+				m_commitStep(step);
+			}
+
+		private:
+			io::IndexFile stateChangeIndexFile(const std::string& indexName) const {
+				return io::IndexFile(m_dataDirectory.spoolDir("state_change").file(indexName));
+			}
+
+		private:
+			test::TempDirectoryGuard m_tempDir;
+			config::CatapultDataDirectory m_dataDirectory;
+			std::shared_ptr<cache::RocksGroupCommitter> m_pGroupCommitter;
+			cache::RocksDatabase m_database;
+			consumers::BlockChainSyncHandlers::CommitStepFunc m_commitStep;
+		};
+	}
+
+	// endregion
+
+	// region CreateCommitStepHandler (group commit) - tests
+
+	TEST(TEST_CLASS, GroupCommit_CommitStepFileIsUpdatedWhenOperationIsNotAllUpdated) {
+		// Arrange:
+		GroupCommitStepHandlerTestContext context;
+		context.write(123);
+
+		for (auto step : { consumers::CommitOperationStep::Blocks_Written, consumers::CommitOperationStep::State_Written }) {
+			// Act:
+			context.commitStep(step);
+
+			// Assert:
+			EXPECT_EQ(step, context.readCommitStep());
+			EXPECT_FALSE(context.existsIndexWriterValue());
+			EXPECT_FALSE(context.existsIndexUpdatedValue());
+		}
+	}
+
+	TEST(TEST_CLASS, GroupCommit_IndexWriterFileIsUpdatedImmediatelyWhenAllWritesAreDurable) {
+		// Arrange:
+		GroupCommitStepHandlerTestContext context;
+		context.write(123);
+		context.groupCommitter().sync();
+
+		// Act:
+		context.commitStep(consumers::CommitOperationStep::All_Updated);
+
+		// Assert:
+		EXPECT_EQ(consumers::CommitOperationStep::All_Updated, context.readCommitStep());
+		EXPECT_EQ(123u, context.readIndexWriterValue());
+		EXPECT_EQ(123u, context.readIndexUpdatedValue());
+	}
+
+	TEST(TEST_CLASS, GroupCommit_IndexWriterFileIsUpdatedOnlyAfterAllWritesAreDurable) {
+		// Arrange:
+		GroupCommitStepHandlerTestContext context;
+		context.write(123);
+
+		// Act:
+		context.commitStep(consumers::CommitOperationStep::All_Updated);
+
+		// Assert: commit step and updated index are updated immediately but state change index is deferred
+		EXPECT_EQ(consumers::CommitOperationStep::All_Updated, context.readCommitStep());
+		EXPECT_EQ(123u, context.readIndexUpdatedValue());
+		EXPECT_FALSE(context.existsIndexWriterValue());
+
+		// Act:
+		context.groupCommitter().sync();
+
+		// Assert:
+		EXPECT_EQ(123u, context.readIndexWriterValue());
+	}
+
+	TEST(TEST_CLASS, GroupCommit_IndexWriterFileIsAdvancedToLastDurableCommit) {
+		// Arrange: commit twice but only make first commit durable
+		GroupCommitStepHandlerTestContext context;
+		context.write(123);
+		context.commitStep(consumers::CommitOperationStep::All_Updated);
+		context.groupCommitter().sync();
+
+		context.write(234);
+		context.commitStep(consumers::CommitOperationStep::All_Updated);
+
+		// Assert:
+		EXPECT_EQ(123u, context.readIndexWriterValue());
+		EXPECT_EQ(234u, context.readIndexUpdatedValue());
+
+		// Act:
+		context.groupCommitter().sync();
+
+		// Assert:
+		EXPECT_EQ(234u, context.readIndexWriterValue());
+		EXPECT_EQ(234u, context.readIndexUpdatedValue());
+	}
+
+	// endregion
 }}
@@ -123,6 +123,57 @@ namespace catapult { namespace extensions {
 		isElementCallbackUnblocked.state()->set();
 	}
 
+	namespace {
+		auto GetCounterValues(const ServiceLocator& locator) {
+			std::unordered_map<std::string, uint64_t> counters;
+			for (const auto& counter : locator.counters())
+				counters[counter.id().name()] = counter.value();
+
+			return counters;
+		}
+	}
+
+	TEST(TEST_CLASS, CanAddDispatcherLatencyCountersToLocator) {
+		// Arrange: create a dispatcher with a single consumer and process one element
+		auto pDispatcher = CreateDispatcher();
+		pDispatcher->processElement(disruptor::ConsumerInput(test::CreateTransactionEntityRange(1)));
+		WAIT_FOR_ZERO_EXPR(pDispatcher->numActiveElements());
+
+		// - create a locator and register the service
+		config::CatapultKeys keys;
+		ServiceLocator locator(keys);
+		locator.registerRootedService("foo", pDispatcher);
+
+		// Act: register counters for more consumers than are present in the dispatcher
+		AddDispatcherLatencyCounters(locator, "foo", "XYZ", 2);
+		auto counters = GetCounterValues(locator);
+
+		// Assert:
+		ASSERT_EQ(12u, counters.size());
+
+		// - counters for the first consumer reflect processed element
+		const auto& latencies = pDispatcher->latencies(0);
+		EXPECT_EQ(latencies.QueueWait.percentile(50), counters.at("XYZ A W MED"));
+		EXPECT_EQ(latencies.QueueWait.percentile(99), counters.at("XYZ A W HI"));
+		EXPECT_EQ(latencies.QueueWait.max(), counters.at("XYZ A W MAX"));
+		EXPECT_EQ(latencies.Processing.percentile(50), counters.at("XYZ A P MED"));
+		EXPECT_EQ(latencies.Processing.percentile(99), counters.at("XYZ A P HI"));
+		EXPECT_EQ(latencies.Processing.max(), counters.at("XYZ A P MAX"));
+
+		// - counters for the missing consumer have sentinel values
+		for (const auto* name : { "XYZ B W MED", "XYZ B W HI", "XYZ B W MAX", "XYZ B P MED", "XYZ B P HI", "XYZ B P MAX" })
+			EXPECT_EQ(ServiceLocator::Sentinel_Counter_Value, counters.at(name)) << name;
+	}
+
+	TEST(TEST_CLASS, CannotAddDispatcherLatencyCountersForMoreConsumersThanLetters) {
+		// Arrange:
+		config::CatapultKeys keys;
+		ServiceLocator locator(keys);
+
+		// Act + Assert:
+		EXPECT_THROW(AddDispatcherLatencyCounters(locator, "foo", "XYZ", 27), catapult_invalid_argument);
+	}
+
 	TEST(TEST_CLASS, CanCreateBatchTransactionTask) {
 		// Arrange:
 		auto pDispatcher = CreateDispatcher();
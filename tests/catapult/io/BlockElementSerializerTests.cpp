@@ -300,6 +300,73 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region ReadBlockElementInPlace
+
+	namespace {
+		auto MakeSharedBuffer(const std::vector<uint8_t>& buffer) {
+			return std::make_shared<std::vector<uint8_t>>(buffer);
+		}
+	}
+
+	TEST(TEST_CLASS, CanReadBlockElementInPlace) {
+		// Arrange:
+		auto context = PrepareReadTestContext(3, 4);
+		auto pBuffer = MakeSharedBuffer(context.Buffer);
+
+		// Act:
+		auto pBlockElement = ReadBlockElementInPlace(*pBuffer, pBuffer);
+
+		// Assert: block is not copied
+		EXPECT_EQ(pBuffer->data(), reinterpret_cast<const uint8_t*>(&pBlockElement->Block));
+		EXPECT_EQ(*context.pBlock, pBlockElement->Block);
+		EXPECT_EQ(context.Hashes[0], pBlockElement->EntityHash);
+		EXPECT_EQ(context.GenerationHash, pBlockElement->GenerationHash);
+
+		ASSERT_EQ(4u, pBlockElement->SubCacheMerkleRoots.size());
+		EXPECT_EQ(std::vector<Hash256>(&context.Hashes[8], &context.Hashes[12]), pBlockElement->SubCacheMerkleRoots);
+		ASSERT_EQ(3u, pBlockElement->Transactions.size());
+		AssertReadTransactions(context, *pBlockElement);
+		EXPECT_FALSE(!!pBlockElement->OptionalStatement);
+	}
+
+	TEST(TEST_CLASS, ReadBlockElementInPlaceSharesBufferOwnership) {
+		// Arrange:
+		auto context = PrepareReadTestContext(3, 4);
+		auto pBuffer = MakeSharedBuffer(context.Buffer);
+
+		// Act:
+		auto pBlockElement = ReadBlockElementInPlace(*pBuffer, pBuffer);
+		std::weak_ptr<std::vector<uint8_t>> pBufferWeak = pBuffer;
+		pBuffer.reset();
+
+		// Assert: block element keeps buffer alive
+		EXPECT_FALSE(pBufferWeak.expired());
+		EXPECT_EQ(*context.pBlock, pBlockElement->Block);
+
+		pBlockElement.reset();
+		EXPECT_TRUE(pBufferWeak.expired());
+	}
+
+	TEST(TEST_CLASS, CannotReadBlockElementInPlaceWhenBlockSizeIsTooLarge) {
+		// Arrange:
+		auto context = PrepareReadTestContext(3, 4);
+		auto pBuffer = MakeSharedBuffer(context.Buffer);
+		reinterpret_cast<model::Block&>((*pBuffer)[0]).Size = static_cast<uint32_t>(pBuffer->size() + 1);
+
+		// Act + Assert:
+		EXPECT_THROW(ReadBlockElementInPlace(*pBuffer, pBuffer), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CannotReadBlockElementInPlaceWithTrailingData) {
+		// Arrange:
+		auto context = PrepareReadTestContext(3, 4);
+		context.Buffer.push_back(42);
+		auto pBuffer = MakeSharedBuffer(context.Buffer);
+
+		// Act + Assert:
+		EXPECT_THROW(ReadBlockElementInPlace(*pBuffer, pBuffer), catapult_runtime_error);
+	}
+
 	// region Roundtrip
 
 	namespace {
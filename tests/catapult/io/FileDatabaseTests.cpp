@@ -35,8 +35,8 @@ namespace catapult { namespace io {
 
 		class TestContext {
 		public:
-			explicit TestContext(size_t batchSize = Batch_Size)
-					: m_database(config::CatapultDirectory(m_tempDir.name()), { batchSize, ".bin" })
+			explicit TestContext(size_t batchSize = Batch_Size, size_t maxMappedFiles = 0)
+					: m_database(config::CatapultDirectory(m_tempDir.name()), { batchSize, ".bin", maxMappedFiles })
 			{}
 
 		public:
@@ -679,4 +679,184 @@ namespace catapult { namespace io {
 	}
 
 	// endregion
+
+	// region memory mapping
+
+	namespace {
+		constexpr auto Max_Mapped_Files = 3u;
+
+		std::vector<uint8_t> ToVector(const RawBuffer& buffer) {
+			return std::vector<uint8_t>(buffer.pData, buffer.pData + buffer.Size);
+		}
+	}
+
+	TEST(TEST_CLASS, CannotReadMappedPayloadWhenMemoryMappingIsDisabled) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().mappedPayload(10), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotReadMappedPayloadWhenFileDoesNotExist) {
+		// Arrange:
+		TestContext context(Batch_Size, Max_Mapped_Files);
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().mappedPayload(10), catapult_file_io_error);
+
+		EXPECT_EQ(0u, context.countDatabaseFiles());
+	}
+
+	READ_TEST(CanReadMappedPayloadInFile) {
+		// Arrange:
+		TestContext context(Batch_Size, Max_Mapped_Files);
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 20, 15 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto payload = context.database().mappedPayload(10 + Payload_Index);
+
+		// Assert:
+		ASSERT_TRUE(!!payload.pFile);
+		EXPECT_EQ(payloads[Payload_Index], ToVector(payload.Data));
+	}
+
+	TEST(TEST_CLASS, CannotReadUnwrittenMappedPayloadInPartiallyFullFile) {
+		// Arrange:
+		TestContext context(Batch_Size, Max_Mapped_Files);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().mappedPayload(13), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CanReadMappedPayloadAppendedAfterFileIsMapped) {
+		// Arrange:
+		TestContext context(Batch_Size, Max_Mapped_Files);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, { payloads[0], payloads[1] });
+		auto payload1 = context.database().mappedPayload(11);
+
+		// Act:
+		WriteAll(context.database(), 12, { payloads[2] });
+		auto payload2 = context.database().mappedPayload(12);
+
+		// Assert:
+		EXPECT_NE(payload1.pFile, payload2.pFile);
+		EXPECT_EQ(payloads[1], ToVector(payload1.Data));
+		EXPECT_EQ(payloads[2], ToVector(payload2.Data));
+	}
+
+	TEST(TEST_CLASS, MappedPayloadIsUnchangedWhenPayloadIsRewritten) {
+		// Arrange:
+		TestContext context(Batch_Size, Max_Mapped_Files);
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 20, 15 });
+		WriteAll(context.database(), 10, payloads);
+		auto originalPayload = context.database().mappedPayload(13);
+
+		// Act:
+		auto newPayload = test::GenerateRandomVector(7);
+		WriteAll(context.database(), 11, { newPayload });
+		auto rewrittenPayload = context.database().mappedPayload(11);
+
+		// Assert: the original mapping is still readable even though its payload was dropped from the file
+		EXPECT_EQ(payloads[3], ToVector(originalPayload.Data));
+		EXPECT_EQ(newPayload, ToVector(rewrittenPayload.Data));
+		EXPECT_THROW(context.database().mappedPayload(13), catapult_file_io_error);
+
+		EXPECT_EQ(1u, context.countDatabaseFiles(0));
+		EXPECT_EQ(Concatenate({ MakeHeader({ 40, 90, 0, 0, 0 }), payloads[0], newPayload }), context.readAll(10));
+	}
+
+	TEST(TEST_CLASS, MappedFileIsReusedAcrossPayloadsInSameFile) {
+		// Arrange:
+		TestContext context(Batch_Size, Max_Mapped_Files);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto payload1 = context.database().mappedPayload(10);
+		auto payload2 = context.database().mappedPayload(12);
+
+		// Assert:
+		EXPECT_EQ(payload1.pFile, payload2.pFile);
+		EXPECT_EQ(payloads[0], ToVector(payload1.Data));
+		EXPECT_EQ(payloads[2], ToVector(payload2.Data));
+	}
+
+	namespace {
+		void AssertMappedFileReuse(size_t maxMappedFiles, bool expectedReuse) {
+			// Arrange: write payloads into four files
+			TestContext context(Batch_Size, maxMappedFiles);
+
+			auto payloads = CreatePayloads({ 50, 10, 30, 20 });
+			WriteAll(context.database(), 0, payloads, Batch_Size);
+
+			// Act: map all files and then remap the first one
+			auto originalPayload = context.database().mappedPayload(0);
+			for (auto i = 1u; i < payloads.size(); ++i)
+				context.database().mappedPayload(i * Batch_Size);
+
+			auto payload = context.database().mappedPayload(0);
+
+			// Assert:
+			EXPECT_EQ(expectedReuse, originalPayload.pFile == payload.pFile);
+			EXPECT_EQ(payloads[0], ToVector(payload.Data));
+		}
+	}
+
+	TEST(TEST_CLASS, MappedFileIsReusedWhenItIsAmongMostRecentlyUsedFiles) {
+		AssertMappedFileReuse(4, true);
+	}
+
+	TEST(TEST_CLASS, MappedFileIsNotReusedWhenItIsNotAmongMostRecentlyUsedFiles) {
+		AssertMappedFileReuse(3, false);
+	}
+
+	TEST(TEST_CLASS, CanReadMappedPayloadInHeaderlessMode) {
+		// Arrange:
+		TestContext context(1, Max_Mapped_Files);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto payload1 = context.database().mappedPayload(10);
+		auto payload2 = context.database().mappedPayload(12);
+
+		// Assert:
+		EXPECT_EQ(payloads[0], ToVector(payload1.Data));
+		EXPECT_EQ(payloads[2], ToVector(payload2.Data));
+	}
+
+	TEST(TEST_CLASS, MappedPayloadIsUnchangedWhenPayloadIsRewrittenInHeaderlessMode) {
+		// Arrange:
+		TestContext context(1, Max_Mapped_Files);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+		auto originalPayload = context.database().mappedPayload(11);
+
+		// Act:
+		auto newPayload = test::GenerateRandomVector(7);
+		WriteAll(context.database(), 11, { newPayload });
+		auto rewrittenPayload = context.database().mappedPayload(11);
+
+		// Assert:
+		EXPECT_EQ(payloads[1], ToVector(originalPayload.Data));
+		EXPECT_EQ(newPayload, ToVector(rewrittenPayload.Data));
+		EXPECT_EQ(newPayload, context.readAll(11));
+	}
+
+	// endregion
 }}
@@ -691,4 +691,404 @@ namespace catapult { namespace io {
 	}
 
 	// endregion
+
+	// region segmented layout
+
+	namespace {
+		constexpr uint64_t Messages_Per_Segment = 1024;
+
+		std::vector<std::vector<uint8_t>> WriteMessages(FileQueueWriter& writer, size_t count) {
+			std::vector<std::vector<uint8_t>> buffers;
+			for (auto i = 0u; i < count; ++i) {
+				buffers.push_back(test::GenerateRandomVector(1 + i % 17));
+				writer.write(buffers.back());
+				writer.flush();
+			}
+
+			return buffers;
+		}
+
+		class SegmentedQueueTestContext : public BasicQueueTestContext<DefaultTraits> {
+		public:
+			SegmentedQueueTestContext() : BasicQueueTestContext<DefaultTraits>("q")
+			{}
+
+		public:
+			FileQueueWriter createWriter(FileQueueLayout layout = FileQueueLayout::Segmented) {
+				return FileQueueWriter(directory().generic_string(), DefaultTraits::Index_Writer_Filename, layout);
+			}
+
+			FileQueueWriter createWriter(utils::FileSize segmentSize) {
+				auto layout = FileQueueLayout::Segmented;
+				return FileQueueWriter(directory().generic_string(), DefaultTraits::Index_Writer_Filename, layout, segmentSize);
+			}
+
+			FileQueueReader createReader() {
+				return FileQueueReader(directory().generic_string());
+			}
+
+		public:
+			std::vector<std::vector<uint8_t>> writeMessages(size_t count, FileQueueLayout layout = FileQueueLayout::Segmented) {
+				auto writer = createWriter(layout);
+				return WriteMessages(writer, count);
+			}
+
+			std::vector<std::vector<uint8_t>> writeMessages(size_t count, utils::FileSize segmentSize) {
+				auto writer = createWriter(segmentSize);
+				return WriteMessages(writer, count);
+			}
+
+			uint64_t segmentFileSize(const std::string& filename) {
+				return std::filesystem::file_size(directory() / filename);
+			}
+
+			size_t countFilesWithExtension(const std::string& extension) {
+				size_t numFiles = 0;
+				for (const auto& entry : std::filesystem::directory_iterator(directory())) {
+					if (extension == entry.path().extension())
+						++numFiles;
+				}
+
+				return numFiles;
+			}
+		};
+
+		std::vector<std::vector<uint8_t>> ReadMessages(FileQueueReader& reader, size_t maxMessages) {
+			std::vector<std::vector<uint8_t>> buffers;
+			reader.tryReadNextMessages(maxMessages, [&buffers](const auto& buffer) {
+				buffers.push_back(buffer);
+			});
+			return buffers;
+		}
+
+		std::vector<std::vector<uint8_t>> Slice(const std::vector<std::vector<uint8_t>>& buffers, size_t startIndex, size_t count) {
+			auto startIter = buffers.cbegin() + static_cast<std::ptrdiff_t>(startIndex);
+			return std::vector<std::vector<uint8_t>>(startIter, startIter + static_cast<std::ptrdiff_t>(count));
+		}
+	}
+
+	TEST(TEST_CLASS, SegmentedWriterBuffersDataInMemory) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		auto writer = context.createWriter();
+
+		// Act:
+		writer.write(test::GenerateRandomVector(21));
+
+		// Assert: segment is only created when message is flushed
+		EXPECT_EQ(1u, context.countFiles());
+		EXPECT_EQ(0u, context.readIndexWriterFile());
+	}
+
+	TEST(TEST_CLASS, SegmentedWriterAppendsMultipleMessagesToSingleSegment) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+
+		// Act:
+		context.writeMessages(3);
+
+		// Assert:
+		EXPECT_EQ(2u, context.countFiles());
+		EXPECT_TRUE(context.exists(DefaultTraits::Index_Writer_Filename));
+		EXPECT_TRUE(context.exists("0000000000000000.seg"));
+
+		EXPECT_EQ(3u, context.readIndexWriterFile());
+	}
+
+	TEST(TEST_CLASS, SegmentedWriterPreallocatesNewSegment) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+
+		// Act:
+		context.writeMessages(1);
+
+		// Assert:
+		EXPECT_EQ(8u * 1024 * 1024, context.segmentFileSize("0000000000000000.seg"));
+	}
+
+	TEST(TEST_CLASS, SegmentedWriterPreallocatesNewSegmentWithCustomSize) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+
+		// Act:
+		auto writeBuffers = context.writeMessages(3, utils::FileSize::FromKilobytes(64));
+
+		auto reader = context.createReader();
+		auto readBuffers = ReadMessages(reader, 10);
+
+		// Assert:
+		EXPECT_EQ(64u * 1024, context.segmentFileSize("0000000000000000.seg"));
+		EXPECT_EQ(writeBuffers, readBuffers);
+	}
+
+	TEST(TEST_CLASS, SegmentedWriterCanWriteMultiplePayloadsToSingleMessage) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		std::vector<std::vector<uint8_t>> buffers{
+			test::GenerateRandomVector(21),
+			test::GenerateRandomVector(80),
+			test::GenerateRandomVector(11)
+		};
+
+		// Act:
+		{
+			auto writer = context.createWriter();
+			for (const auto& buffer : buffers)
+				writer.write(buffer);
+
+			writer.flush();
+		}
+
+		auto reader = context.createReader();
+		auto readBuffers = ReadMessages(reader, 10);
+
+		// Assert:
+		ASSERT_EQ(1u, readBuffers.size());
+		EXPECT_EQ(Merge(buffers), readBuffers[0]);
+	}
+
+	TEST(TEST_CLASS, CanReadMessagesFromSegmentOneAtATime) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		auto writeBuffers = context.writeMessages(5);
+		auto reader = context.createReader();
+
+		// Act:
+		std::vector<std::vector<uint8_t>> readBuffers;
+		while (reader.tryReadNextMessage([&readBuffers](const auto& buffer) { readBuffers.push_back(buffer); }))
+		{}
+
+		// Assert: partially consumed segment is not recycled
+		EXPECT_EQ(writeBuffers, readBuffers);
+		EXPECT_EQ(5u, context.readIndexReaderFile());
+		EXPECT_TRUE(context.exists("0000000000000000.seg"));
+	}
+
+	TEST(TEST_CLASS, CanReadBatchOfMessagesFromSegment) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		auto writeBuffers = context.writeMessages(10);
+		auto reader = context.createReader();
+
+		// Act:
+		auto readBuffers1 = ReadMessages(reader, 4);
+		auto readBuffers2 = ReadMessages(reader, 100);
+		auto readBuffers3 = ReadMessages(reader, 100);
+
+		// Assert:
+		EXPECT_EQ(Slice(writeBuffers, 0, 4), readBuffers1);
+		EXPECT_EQ(Slice(writeBuffers, 4, 6), readBuffers2);
+		EXPECT_TRUE(readBuffers3.empty());
+		EXPECT_EQ(10u, context.readIndexReaderFile());
+	}
+
+	TEST(TEST_CLASS, BatchReadAdvancesReaderIndexOnlyForConsumedMessages) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		context.writeMessages(10);
+		auto reader = context.createReader();
+
+		// Act: trigger a consumer exception on fourth message
+		auto numCalls = 0u;
+		EXPECT_THROW(reader.tryReadNextMessages(10, [&numCalls](const auto&) {
+			if (4 == ++numCalls)
+				CATAPULT_THROW_INVALID_ARGUMENT("consumer failed");
+		}), catapult_invalid_argument);
+
+		// Assert:
+		EXPECT_EQ(4u, numCalls);
+		EXPECT_EQ(3u, context.readIndexReaderFile());
+	}
+
+	TEST(TEST_CLASS, BatchReadPersistsReaderIndexAfterAllMessagesAreConsumed) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		context.writeMessages(10);
+		auto reader = context.createReader();
+		ReadMessages(reader, 2);
+
+		// Act:
+		std::vector<uint64_t> readerIndexValues;
+		auto numProcessed = reader.tryReadNextMessages(5, [&context, &readerIndexValues](const auto&) {
+			readerIndexValues.push_back(context.readIndexReaderFile());
+		});
+
+		// Assert: reader index is not persisted while batch is being consumed
+		EXPECT_EQ(5u, numProcessed);
+		EXPECT_EQ(std::vector<uint64_t>(5, 2), readerIndexValues);
+		EXPECT_EQ(7u, context.readIndexReaderFile());
+	}
+
+	TEST(TEST_CLASS, CanSkipMessagesInSegment) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		auto writeBuffers = context.writeMessages(10);
+		auto reader = context.createReader();
+
+		// Act:
+		reader.skip(6);
+		auto readBuffers = ReadMessages(reader, 100);
+
+		// Assert:
+		EXPECT_EQ(Slice(writeBuffers, 6, 4), readBuffers);
+	}
+
+	TEST(TEST_CLASS, CanReadMessagesSpanningMultipleSegments) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		auto numMessages = 2 * Messages_Per_Segment + 5;
+		auto writeBuffers = context.writeMessages(numMessages);
+
+		// Sanity:
+		EXPECT_EQ(3u, context.countFilesWithExtension(".seg"));
+
+		// Act:
+		auto reader = context.createReader();
+		auto readBuffers = ReadMessages(reader, numMessages + 10);
+
+		// Assert: fully consumed segments are recycled
+		EXPECT_EQ(writeBuffers, readBuffers);
+		EXPECT_EQ(numMessages, context.readIndexReaderFile());
+
+		EXPECT_EQ(1u, context.countFilesWithExtension(".seg"));
+		EXPECT_EQ(2u, context.countFilesWithExtension(".free"));
+		EXPECT_TRUE(context.exists("0000000000000800.seg"));
+	}
+
+	TEST(TEST_CLASS, WriterReusesRecycledSegments) {
+		// Arrange: fill and consume two segments
+		SegmentedQueueTestContext context;
+		context.writeMessages(2 * Messages_Per_Segment);
+		auto reader = context.createReader();
+		ReadMessages(reader, 2 * Messages_Per_Segment);
+
+		// Sanity:
+		EXPECT_EQ(0u, context.countFilesWithExtension(".seg"));
+		EXPECT_EQ(2u, context.countFilesWithExtension(".free"));
+
+		// Act:
+		auto writeBuffers = context.writeMessages(5);
+		auto readBuffers = ReadMessages(reader, 10);
+
+		// Assert:
+		EXPECT_EQ(writeBuffers, readBuffers);
+		EXPECT_EQ(1u, context.countFilesWithExtension(".seg"));
+		EXPECT_EQ(1u, context.countFilesWithExtension(".free"));
+		EXPECT_TRUE(context.exists("0000000000000800.seg"));
+	}
+
+	TEST(TEST_CLASS, WriterExtendsReusedSegmentSmallerThanCustomSize) {
+		// Arrange: fill and consume a small segment
+		SegmentedQueueTestContext context;
+		context.writeMessages(Messages_Per_Segment, utils::FileSize::FromKilobytes(64));
+		auto reader = context.createReader();
+		ReadMessages(reader, Messages_Per_Segment);
+
+		// Sanity:
+		EXPECT_EQ(64u * 1024, context.segmentFileSize("0000000000000000.free"));
+
+		// Act:
+		auto writeBuffers = context.writeMessages(5, utils::FileSize::FromKilobytes(256));
+		auto readBuffers = ReadMessages(reader, 10);
+
+		// Assert:
+		EXPECT_EQ(writeBuffers, readBuffers);
+		EXPECT_EQ(0u, context.countFilesWithExtension(".free"));
+		EXPECT_EQ(256u * 1024, context.segmentFileSize("0000000000000400.seg"));
+	}
+
+	TEST(TEST_CLASS, WriterDoesNotShrinkReusedSegmentLargerThanCustomSize) {
+		// Arrange: fill and consume a default segment
+		SegmentedQueueTestContext context;
+		context.writeMessages(Messages_Per_Segment);
+		auto reader = context.createReader();
+		ReadMessages(reader, Messages_Per_Segment);
+
+		// Act:
+		auto writeBuffers = context.writeMessages(5, utils::FileSize::FromKilobytes(64));
+		auto readBuffers = ReadMessages(reader, 10);
+
+		// Assert:
+		EXPECT_EQ(writeBuffers, readBuffers);
+		EXPECT_EQ(0u, context.countFilesWithExtension(".free"));
+		EXPECT_EQ(8u * 1024 * 1024, context.segmentFileSize("0000000000000400.seg"));
+	}
+
+	TEST(TEST_CLASS, WriterResumesSegmentAfterRestart) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		auto writeBuffers1 = context.writeMessages(3);
+
+		// Act: write with new writer instance
+		auto writeBuffers2 = context.writeMessages(4);
+
+		auto reader = context.createReader();
+		auto readBuffers = ReadMessages(reader, 100);
+
+		// Assert:
+		ASSERT_EQ(7u, readBuffers.size());
+		EXPECT_EQ(writeBuffers1, Slice(readBuffers, 0, 3));
+		EXPECT_EQ(writeBuffers2, Slice(readBuffers, 3, 4));
+		EXPECT_EQ(1u, context.countFilesWithExtension(".seg"));
+	}
+
+	TEST(TEST_CLASS, WriterOverwritesMessagesAfterWriterIndexIsRewound) {
+		// Arrange: write 10 messages and rewind writer index (as done by spooling repair)
+		SegmentedQueueTestContext context;
+		auto writeBuffers1 = context.writeMessages(10);
+		IndexFile((context.directory() / DefaultTraits::Index_Writer_Filename).generic_string()).set(6);
+
+		// Act:
+		auto writeBuffers2 = context.writeMessages(2);
+
+		auto reader = context.createReader();
+		auto readBuffers = ReadMessages(reader, 100);
+
+		// Assert:
+		ASSERT_EQ(8u, readBuffers.size());
+		EXPECT_EQ(Slice(writeBuffers1, 0, 6), Slice(readBuffers, 0, 6));
+		EXPECT_EQ(writeBuffers2, Slice(readBuffers, 6, 2));
+		EXPECT_EQ(8u, context.readIndexWriterFile());
+	}
+
+	TEST(TEST_CLASS, WriterDiscardsMessagesInLaterSegmentsAfterWriterIndexIsRewound) {
+		// Arrange: write into second segment and rewind writer index into first segment
+		SegmentedQueueTestContext context;
+		auto writeBuffers1 = context.writeMessages(Messages_Per_Segment + 10);
+		IndexFile((context.directory() / DefaultTraits::Index_Writer_Filename).generic_string()).set(Messages_Per_Segment - 2);
+
+		// Act: write into second segment again
+		auto writeBuffers2 = context.writeMessages(5);
+
+		auto reader = context.createReader();
+		reader.skip(Messages_Per_Segment - 2);
+		auto readBuffers = ReadMessages(reader, 100);
+
+		// Assert:
+		EXPECT_EQ(writeBuffers2, readBuffers);
+		EXPECT_EQ(Messages_Per_Segment + 3, context.readIndexReaderFile());
+	}
+
+	TEST(TEST_CLASS, CanReadMessagesWrittenWithDifferentLayouts) {
+		// Arrange: messages from both layouts share index files (e.g. after upgrading node)
+		SegmentedQueueTestContext context;
+		auto writeBuffers1 = context.writeMessages(3, FileQueueLayout::File_Per_Message);
+		auto writeBuffers2 = context.writeMessages(4, FileQueueLayout::Segmented);
+
+		// Sanity:
+		EXPECT_EQ(3u, context.countFilesWithExtension(".dat") - 1);
+		EXPECT_EQ(1u, context.countFilesWithExtension(".seg"));
+
+		// Act:
+		auto reader = context.createReader();
+		auto readBuffers = ReadMessages(reader, 100);
+
+		// Assert: message files are removed after being read
+		ASSERT_EQ(7u, readBuffers.size());
+		EXPECT_EQ(writeBuffers1, Slice(readBuffers, 0, 3));
+		EXPECT_EQ(writeBuffers2, Slice(readBuffers, 3, 4));
+		EXPECT_EQ(2u, context.countFilesWithExtension(".dat"));
+	}
+
+	// endregion
 }}
@@ -0,0 +1,152 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/FileBlockStorage.h"
+#include "tests/test/core/BlockStorageTests.h"
+#include "tests/test/core/EntityTestUtils.h"
+#include "tests/test/core/StorageTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/TestConstants.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS MappedFileBlockStorageTests
+
+	namespace {
+		constexpr uint32_t Max_Mapped_Files = 2;
+
+		struct MappedFileTraits {
+			using Guard = test::TempDirectoryGuard;
+			using StorageType = FileBlockStorage;
+
+			static std::unique_ptr<StorageType> OpenStorage(const std::string& destination, uint32_t fileDatabaseBatchSize = 1) {
+				auto mode = FileBlockStorageMode::Hash_Index;
+				return std::make_unique<StorageType>(destination, fileDatabaseBatchSize, mode, Max_Mapped_Files);
+			}
+
+			static std::unique_ptr<StorageType> PrepareStorage(const std::string& destination, Height height = Height()) {
+				test::PrepareStorage(destination);
+				if (Height() != height)
+					test::FakeHeight(destination, height.unwrap());
+
+				return OpenStorage(destination, test::File_Database_Batch_Size);
+			}
+		};
+	}
+
+	DEFINE_BLOCK_STORAGE_TESTS(MappedFileTraits)
+	DEFINE_PRUNABLE_BLOCK_STORAGE_TESTS(MappedFileTraits)
+
+	// region storage trailing data
+
+	TEST(TEST_CLASS, CannotReadSavedBlockElementWithTrailingData) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pBlock = test::GenerateBlockWithTransactions(5, Height(2));
+		auto element = test::BlockToBlockElement(*pBlock, test::GenerateRandomByteArray<Hash256>());
+		{
+			auto pStorage = MappedFileTraits::PrepareStorage(tempDir.name());
+			pStorage->saveBlock(element);
+		}
+
+		// - append some data
+		{
+			io::RawFile file(tempDir.name() + "/00000/00000.dat", io::OpenMode::Read_Append);
+			file.seek(file.size());
+			std::vector<uint8_t> buffer{ 42 };
+			file.write(buffer);
+		}
+
+		// Act + Assert
+		auto pStorage = MappedFileTraits::OpenStorage(tempDir.name(), test::File_Database_Batch_Size);
+		EXPECT_THROW(pStorage->loadBlockElement(Height(2)), catapult_runtime_error);
+	}
+
+	// endregion
+
+	// region mapping lifetime
+
+	TEST(TEST_CLASS, LoadedBlockIsUnchangedWhenBlockIsOverwritten) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = MappedFileTraits::PrepareStorage(tempDir.name());
+
+		auto pBlock = test::GenerateBlockWithTransactions(5, Height(2));
+		pStorage->saveBlock(test::CreateBlockElementForSaveTests(*pBlock));
+		auto pOriginalBlock = pStorage->loadBlock(Height(2));
+		auto originalBlockBuffer = test::CopyEntity(*pBlock);
+
+		// Act: overwrite the block with a smaller block
+		pStorage->dropBlocksAfter(Height(1));
+		auto pNewBlock = test::GenerateBlockWithTransactions(1, Height(2));
+		pStorage->saveBlock(test::CreateBlockElementForSaveTests(*pNewBlock));
+		auto pLoadedNewBlock = pStorage->loadBlock(Height(2));
+
+		// Assert:
+		EXPECT_EQ(*originalBlockBuffer, *pOriginalBlock);
+		EXPECT_EQ(*pNewBlock, *pLoadedNewBlock);
+	}
+
+	TEST(TEST_CLASS, LoadedBlockElementIsUnchangedWhenBlockIsOverwritten) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = MappedFileTraits::PrepareStorage(tempDir.name());
+
+		auto pBlock = test::GenerateBlockWithTransactions(5, Height(2));
+		auto originalBlockElement = test::CreateBlockElementForSaveTests(*pBlock);
+		pStorage->saveBlock(originalBlockElement);
+		auto pOriginalBlockElement = pStorage->loadBlockElement(Height(2));
+
+		// Act: overwrite the block with a smaller block
+		pStorage->dropBlocksAfter(Height(1));
+		auto pNewBlock = test::GenerateBlockWithTransactions(1, Height(2));
+		auto newBlockElement = test::CreateBlockElementForSaveTests(*pNewBlock);
+		pStorage->saveBlock(newBlockElement);
+		auto pLoadedNewBlockElement = pStorage->loadBlockElement(Height(2));
+
+		// Assert:
+		test::AssertEqual(originalBlockElement, *pOriginalBlockElement);
+		test::AssertEqual(newBlockElement, *pLoadedNewBlockElement);
+	}
+
+	TEST(TEST_CLASS, LoadedBlockElementIsUnchangedWhenStorageIsDestroyed) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pBlock = test::GenerateBlockWithTransactions(5, Height(2));
+		auto blockElement = test::CreateBlockElementForSaveTests(*pBlock);
+
+		std::shared_ptr<const model::BlockElement> pBlockElement;
+		{
+			auto pStorage = MappedFileTraits::PrepareStorage(tempDir.name());
+			pStorage->saveBlock(blockElement);
+
+			// Act:
+			pBlockElement = pStorage->loadBlockElement(Height(2));
+			pStorage->purge();
+		}
+
+		// Assert:
+		test::AssertEqual(blockElement, *pBlockElement);
+	}
+
+	// endregion
+}}
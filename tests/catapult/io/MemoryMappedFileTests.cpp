@@ -0,0 +1,117 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/MemoryMappedFile.h"
+#include "catapult/io/RawFile.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+#include <filesystem>
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS MemoryMappedFileTests
+
+	namespace {
+		void WriteFile(const std::string& filePath, const std::vector<uint8_t>& buffer) {
+			RawFile file(filePath, OpenMode::Read_Write);
+			file.write(buffer);
+		}
+
+		std::vector<uint8_t> ToVector(const RawBuffer& buffer) {
+			return std::vector<uint8_t>(buffer.pData, buffer.pData + buffer.Size);
+		}
+	}
+
+	TEST(TEST_CLASS, CannotMapFileThatDoesNotExist) {
+		// Arrange:
+		test::TempFileGuard tempFile("foo.dat");
+
+		// Act + Assert:
+		EXPECT_THROW(MemoryMappedFile(tempFile.name()), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CanMapEmptyFile) {
+		// Arrange:
+		test::TempFileGuard tempFile("foo.dat");
+		WriteFile(tempFile.name(), {});
+
+		// Act:
+		MemoryMappedFile file(tempFile.name());
+
+		// Assert:
+		EXPECT_EQ(0u, file.size());
+		EXPECT_EQ(0u, file.buffer().Size);
+	}
+
+	TEST(TEST_CLASS, CanMapFile) {
+		// Arrange:
+		test::TempFileGuard tempFile("foo.dat");
+		auto contents = test::GenerateRandomVector(1234);
+		WriteFile(tempFile.name(), contents);
+
+		// Act:
+		MemoryMappedFile file(tempFile.name());
+
+		// Assert:
+		EXPECT_EQ(1234u, file.size());
+		EXPECT_EQ(contents, ToVector(file.buffer()));
+	}
+
+	TEST(TEST_CLASS, MappingIsUnchangedWhenFileIsAppended) {
+		// Arrange:
+		test::TempFileGuard tempFile("foo.dat");
+		auto contents = test::GenerateRandomVector(1234);
+		WriteFile(tempFile.name(), contents);
+
+		MemoryMappedFile file(tempFile.name());
+
+		// Act:
+		{
+			RawFile rawFile(tempFile.name(), OpenMode::Read_Append);
+			rawFile.seek(rawFile.size());
+			rawFile.write(test::GenerateRandomVector(100));
+		}
+
+		// Assert:
+		EXPECT_EQ(1234u, file.size());
+		EXPECT_EQ(contents, ToVector(file.buffer()));
+	}
+
+	TEST(TEST_CLASS, MappingIsUnchangedWhenFileIsReplaced) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto filePath = (std::filesystem::path(tempDir.name()) / "foo.dat").generic_string();
+		auto replacementFilePath = (std::filesystem::path(tempDir.name()) / "bar.dat").generic_string();
+		auto contents = test::GenerateRandomVector(1234);
+		WriteFile(filePath, contents);
+
+		MemoryMappedFile file(filePath);
+
+		// Act:
+		WriteFile(replacementFilePath, test::GenerateRandomVector(100));
+		std::filesystem::rename(replacementFilePath, filePath);
+
+		// Assert:
+		EXPECT_EQ(1234u, file.size());
+		EXPECT_EQ(contents, ToVector(file.buffer()));
+	}
+}}
@@ -500,6 +500,81 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region reserve
+
+	WRITING_TRAITS_BASED_TEST(CanReserveSpaceForFile) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = test::GenerateRandomVector(Default_Bytes_Written);
+		RawFile rawFile(guard.name(), TTraits::Mode);
+		rawFile.write(inputData);
+
+		// Act:
+		rawFile.reserve(1000);
+
+		// Assert: file is extended with zeros but position is unchanged
+		EXPECT_EQ(1000u, rawFile.size());
+		EXPECT_EQ(Default_Bytes_Written, rawFile.position());
+		EXPECT_EQ(1000u, std::filesystem::file_size(guard.name()));
+
+		std::vector<uint8_t> fileBuffer(rawFile.size());
+		rawFile.seek(0);
+		rawFile.read(fileBuffer);
+		EXPECT_EQ(inputData, Slice(fileBuffer, 0, Default_Bytes_Written));
+		auto numReservedBytes = 1000 - Default_Bytes_Written;
+		EXPECT_EQ(std::vector<uint8_t>(numReservedBytes), Slice(fileBuffer, Default_Bytes_Written, numReservedBytes));
+	}
+
+	WRITING_TRAITS_BASED_TEST(ReserveDoesNotShrinkFile) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = test::GenerateRandomVector(Default_Bytes_Written);
+		RawFile rawFile(guard.name(), TTraits::Mode);
+		rawFile.write(inputData);
+
+		// Act:
+		rawFile.reserve(10);
+
+		// Assert:
+		EXPECT_EQ(Default_Bytes_Written, rawFile.size());
+		EXPECT_EQ(Default_Bytes_Written, std::filesystem::file_size(guard.name()));
+	}
+
+	// endregion
+
+	// region sync
+
+	WRITING_TRAITS_BASED_TEST(CanSyncFile) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = test::GenerateRandomVector(Default_Bytes_Written);
+		RawFile rawFile(guard.name(), TTraits::Mode);
+		rawFile.write(inputData);
+
+		// Act:
+		rawFile.sync();
+
+		// Assert: position is unchanged and all data is on disk
+		EXPECT_EQ(Default_Bytes_Written, rawFile.size());
+		EXPECT_EQ(Default_Bytes_Written, rawFile.position());
+
+		std::vector<uint8_t> fileBuffer(Default_Bytes_Written);
+		RawFile(guard.name(), OpenMode::Read_Only, LockMode::None).read(fileBuffer);
+		EXPECT_EQ(inputData, fileBuffer);
+	}
+
+	TEST(TEST_CLASS, CanSyncReadOnlyFile) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		WriteRandomVectorToFile(guard);
+		RawFile rawFile(guard.name(), OpenMode::Read_Only);
+
+		// Act + Assert:
+		EXPECT_NO_THROW(rawFile.sync());
+	}
+
+	// endregion
+
 	// region multiple raw files around same physical file
 
 	TEST(TEST_CLASS, PositionInDifferentInstancesIsIndependent) {
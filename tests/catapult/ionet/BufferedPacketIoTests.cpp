@@ -20,7 +20,9 @@
 **/
 
 #include "catapult/ionet/BufferedPacketIo.h"
+#include "catapult/ionet/BatchPacketWriter.h"
 #include "catapult/ionet/PacketSocket.h"
+#include "tests/test/core/mocks/MockPacketIo.h"
 #include "tests/test/net/SocketTestUtils.h"
 
 namespace catapult { namespace ionet {
@@ -48,4 +50,170 @@ namespace catapult { namespace ionet {
 	TEST(TEST_CLASS, ReadCanReadMultipleSimultaneousPayloadsWithoutInterleaving) {
 		test::AssertReadCanReadMultipleSimultaneousPayloadsWithoutInterleaving(Transform);
 	}
+
+	// region coalescing
+
+	namespace {
+		class MockBatchPacketWriter : public BatchPacketWriter {
+		public:
+			void writeMultiple(const std::vector<PacketPayload>& payloads, const PacketIo::WriteCallback& callback) override {
+				std::vector<uint32_t> sizes;
+				for (const auto& payload : payloads)
+					sizes.push_back(payload.header().Size);
+
+				m_writeSizes.push_back(sizes);
+				m_pendingCallback = callback;
+			}
+
+		public:
+			const std::vector<std::vector<uint32_t>>& writeSizes() const {
+				return m_writeSizes;
+			}
+
+			void complete(SocketOperationCode code) {
+				auto callback = m_pendingCallback;
+				m_pendingCallback = PacketIo::WriteCallback();
+				callback(code);
+			}
+
+		private:
+			std::vector<std::vector<uint32_t>> m_writeSizes;
+			PacketIo::WriteCallback m_pendingCallback;
+		};
+
+		class CoalescingTestContext {
+		public:
+			explicit CoalescingTestContext(uint32_t maxCoalescedWriteSize)
+					: m_strand(m_ioContext)
+					, m_pWriter(std::make_shared<MockBatchPacketWriter>())
+					, m_pIo(CreateBufferedPacketIo(std::make_shared<mocks::MockPacketIo>(), m_pWriter, m_strand, maxCoalescedWriteSize))
+			{}
+
+		public:
+			const auto& writeSizes() const {
+				return m_pWriter->writeSizes();
+			}
+
+			const auto& codes() const {
+				return m_codes;
+			}
+
+		public:
+			void write(uint32_t packetSize) {
+				auto pPacket = test::CreateRandomPacket(packetSize - SizeOf32<Packet>(), PacketType::Undefined);
+				m_pIo->write(PacketPayload(pPacket), [this](auto code) {
+					m_codes.push_back(code);
+				});
+			}
+
+			void run() {
+				m_ioContext.restart();
+				m_ioContext.run();
+			}
+
+			void complete(SocketOperationCode code) {
+				m_pWriter->complete(code);
+				run();
+			}
+
+		private:
+			boost::asio::io_context m_ioContext;
+			boost::asio::io_context::strand m_strand;
+			std::shared_ptr<MockBatchPacketWriter> m_pWriter;
+			std::shared_ptr<PacketIo> m_pIo;
+			std::vector<SocketOperationCode> m_codes;
+		};
+
+		using WriteSizesVector = std::vector<std::vector<uint32_t>>;
+	}
+
+	TEST(TEST_CLASS, WriteCoalescesAllWritesQueuedDuringInProgressWrite) {
+		// Arrange:
+		CoalescingTestContext context(1000);
+
+		// Act: queue four writes (only the first one is started immediately) and complete the first write
+		for (auto size : { 100u, 110u, 120u, 130u })
+			context.write(size);
+
+		context.run();
+		context.complete(SocketOperationCode::Success);
+
+		// Assert: the last three writes were coalesced
+		EXPECT_EQ(WriteSizesVector({ { 100 }, { 110, 120, 130 } }), context.writeSizes());
+		EXPECT_EQ(std::vector<SocketOperationCode>(1, SocketOperationCode::Success), context.codes());
+
+		// Act: complete the coalesced write
+		context.complete(SocketOperationCode::Success);
+
+		// Assert: all callbacks were called
+		EXPECT_EQ(2u, context.writeSizes().size());
+		EXPECT_EQ(std::vector<SocketOperationCode>(4, SocketOperationCode::Success), context.codes());
+	}
+
+	TEST(TEST_CLASS, WriteCoalescesQueuedWritesUpToMaxCoalescedWriteSize) {
+		// Arrange:
+		CoalescingTestContext context(250);
+
+		// Act: queue writes where the fourth one is too large to be coalesced with any other
+		for (auto size : { 100u, 110u, 120u, 300u, 130u, 140u })
+			context.write(size);
+
+		context.run();
+		for (auto i = 0u; i < 5; ++i)
+			context.complete(SocketOperationCode::Success);
+
+		// Assert:
+		EXPECT_EQ(WriteSizesVector({ { 100 }, { 110, 120 }, { 300 }, { 130 }, { 140 } }), context.writeSizes());
+		EXPECT_EQ(std::vector<SocketOperationCode>(6, SocketOperationCode::Success), context.codes());
+	}
+
+	TEST(TEST_CLASS, WriteFailureIsPropagatedToAllCoalescedWrites) {
+		// Arrange:
+		CoalescingTestContext context(1000);
+
+		// Act:
+		for (auto size : { 100u, 110u, 120u })
+			context.write(size);
+
+		context.run();
+		context.complete(SocketOperationCode::Success);
+		context.complete(SocketOperationCode::Write_Error);
+
+		// Assert:
+		EXPECT_EQ(WriteSizesVector({ { 100 }, { 110, 120 } }), context.writeSizes());
+		EXPECT_EQ(
+				std::vector<SocketOperationCode>({
+					SocketOperationCode::Success, SocketOperationCode::Write_Error, SocketOperationCode::Write_Error
+				}),
+				context.codes());
+	}
+
+	TEST(TEST_CLASS, WriteRetriesCoalescedWritesIndividuallyWhenAnyIsMalformed) {
+		// Arrange:
+		CoalescingTestContext context(1000);
+
+		// Act: reject the coalesced write as malformed and then only the second retried write
+		for (auto size : { 100u, 110u, 120u, 130u })
+			context.write(size);
+
+		context.run();
+		context.complete(SocketOperationCode::Success);
+		context.complete(SocketOperationCode::Malformed_Data);
+		context.complete(SocketOperationCode::Success);
+		context.complete(SocketOperationCode::Malformed_Data);
+		context.complete(SocketOperationCode::Success);
+
+		// Assert: only the malformed write failed
+		EXPECT_EQ(WriteSizesVector({ { 100 }, { 110, 120, 130 }, { 110 }, { 120 }, { 130 } }), context.writeSizes());
+		EXPECT_EQ(
+				std::vector<SocketOperationCode>({
+					SocketOperationCode::Success,
+					SocketOperationCode::Success,
+					SocketOperationCode::Malformed_Data,
+					SocketOperationCode::Success
+				}),
+				context.codes());
+	}
+
+	// endregion
 }}
@@ -20,9 +20,11 @@
 **/
 
 #include "catapult/ionet/PacketSocket.h"
+#include "catapult/ionet/BatchPacketWriter.h"
 #include "catapult/ionet/IoTypes.h"
 #include "catapult/ionet/Node.h"
 #include "catapult/ionet/Packet.h"
+#include "catapult/ionet/PacketPayloadBuilder.h"
 #include "catapult/ionet/WorkingBuffer.h"
 #include "catapult/thread/IoThreadPool.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
@@ -122,6 +124,27 @@ namespace catapult { namespace ionet {
 		AssertWriteSuccess(payload, packetBytes);
 	}
 
+	TEST(TEST_CLASS, WriteSucceedsWhenSocketWriteSucceeds_MultiBufferPayload) {
+		// Arrange: mix small buffers (that are staged) with large buffers (that are written in place)
+		PacketPayloadBuilder builder(PacketType::Undefined);
+		for (auto size : { 20u, 30u, 10'000u, 40u, 50u, 60u, 20'000u, 70u })
+			builder.appendEntity(test::CreateRandomPacket(size, PacketType::Undefined));
+
+		auto payload = builder.build();
+
+		ByteBuffer packetBytes(sizeof(PacketHeader));
+		std::memcpy(packetBytes.data(), &payload.header(), sizeof(PacketHeader));
+		for (const auto& buffer : payload.buffers())
+			packetBytes.insert(packetBytes.end(), buffer.pData, buffer.pData + buffer.Size);
+
+		// Sanity:
+		EXPECT_EQ(packetBytes.size(), payload.header().Size);
+		EXPECT_EQ(8u, payload.buffers().size());
+
+		// Assert:
+		AssertWriteSuccess(payload, packetBytes);
+	}
+
 	TEST(TEST_CLASS, WriteFailsWhenSocketWriteFails) {
 		// Arrange: set up payloads
 		auto payload = CreateSmallWritePayload();
@@ -205,6 +228,59 @@ namespace catapult { namespace ionet {
 		AssertWriteSuccess(payload, packetBytes, 150 - sizeof(PacketHeader));
 	}
 
+	TEST(TEST_CLASS, WriteMultipleSucceedsWhenSocketWriteSucceeds) {
+		// Arrange: set up payloads
+		auto packetBytes1 = test::GenerateRandomPacketBuffer(50);
+		auto packetBytes2 = test::GenerateRandomPacketBuffer(70);
+		auto payloads = std::vector<PacketPayload>{ test::BufferToPacketPayload(packetBytes1), test::BufferToPacketPayload(packetBytes2) };
+		ByteBuffer receiveBuffer(120);
+		SocketOperationCode writeCode;
+
+		// Act: "server" - writes both payloads to the socket with a single write
+		//      "client" - reads both payloads from the socket
+		auto pPool = test::CreateStartedIoThreadPool();
+		test::SpawnPacketServerWork(pPool->ioContext(), [&payloads, &writeCode](const auto& pServerSocket) {
+			auto pWriter = std::dynamic_pointer_cast<BatchPacketWriter>(pServerSocket);
+			pWriter->writeMultiple(payloads, [&writeCode](auto code) {
+				writeCode = code;
+			});
+		});
+		auto pClientSocket = test::AddClientReadBufferTask(pPool->ioContext(), receiveBuffer);
+		pPool->join();
+
+		// Assert: the write succeeded and all data was read from the socket in order
+		EXPECT_EQ(SocketOperationCode::Success, writeCode);
+		EXPECT_EQ_MEMORY(packetBytes1.data(), receiveBuffer.data(), 50);
+		EXPECT_EQ_MEMORY(packetBytes2.data(), receiveBuffer.data() + 50, 70);
+	}
+
+	TEST(TEST_CLASS, WriteMultipleFailsWhenAnyPacketPayloadExceedsMaxPacketDataSize) {
+		// Arrange: set up payloads
+		auto options = test::CreatePacketSocketOptions();
+		options.MaxPacketDataSize = 150 - sizeof(PacketHeader) - 1;
+
+		auto payloads = std::vector<PacketPayload>{
+			test::BufferToPacketPayload(test::GenerateRandomPacketBuffer(50)),
+			test::BufferToPacketPayload(test::GenerateRandomPacketBuffer(150))
+		};
+		SocketOperationCode writeCode;
+
+		// Act: "server" - writes both payloads to the socket with a single write
+		//      "client" - accepts a connection
+		auto pPool = test::CreateStartedIoThreadPool();
+		test::SpawnPacketServerWork(pPool->ioContext(), options, [&payloads, &writeCode](const auto& pServerSocket) {
+			auto pWriter = std::dynamic_pointer_cast<BatchPacketWriter>(pServerSocket);
+			pWriter->writeMultiple(payloads, [&writeCode](auto code) {
+				writeCode = code;
+			});
+		});
+		auto pClientSocket = test::AddClientConnectionTask(pPool->ioContext());
+		pPool->join();
+
+		// Assert: the write failed due to malformed data
+		EXPECT_EQ(SocketOperationCode::Malformed_Data, writeCode);
+	}
+
 	// endregion
 
 	// region read[Multiple]
@@ -25,7 +25,9 @@
 #include "tests/catapult/local/broker/test/BrokerTestUtils.h"
 #include "tests/test/local/LocalTestUtils.h"
 #include "tests/test/local/MessageIngestionTestContext.h"
+#include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
+#include <fstream>
 
 namespace catapult { namespace local {
 
@@ -80,6 +82,51 @@ namespace catapult { namespace local {
 		context.broker().shutdown();
 	}
 
+	TEST(TEST_CLASS, CanBootBrokerWithQueueLagCounters) {
+		// Arrange:
+		BrokerTestContext context;
+
+		// Act:
+		context.boot();
+		const auto& counters = context.broker().counters();
+
+		// Assert:
+		std::vector<std::string> expectedCounterNames{
+			"BLOCK LAG", "UT LAG", "PT LAG", "FIN LAG", "STATE LAG", "TX STATUS LAG"
+		};
+		ASSERT_EQ(expectedCounterNames.size(), counters.size());
+		for (auto i = 0u; i < counters.size(); ++i) {
+			EXPECT_EQ(expectedCounterNames[i], counters[i].id().name()) << "counter at " << i;
+			EXPECT_EQ(0u, counters[i].value()) << "counter at " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, BrokerLogsQueueLagCountersWhenPollingQueues) {
+		// Arrange:
+		BrokerTestContext context;
+		test::TempDirectoryGuard logDirectoryGuard("testlogs");
+		{
+			auto options = utils::FileLoggerOptions(logDirectoryGuard.name(), "BrokerTests%4N.txt");
+			options.SinkType = utils::LogSinkType::Sync;
+
+			utils::LoggingBootstrapper bootstrapper;
+			bootstrapper.addFileLogger(options, utils::LogFilter(utils::LogLevel::min));
+
+			// Act: boot broker and wait for first poll, which is scheduled after 100ms
+			context.boot();
+			test::Sleep(500);
+			context.reset();
+		}
+
+		// Assert: log file is flushed when bootstrapper is destroyed
+		std::ifstream logFile((std::filesystem::path(logDirectoryGuard.name()) / "BrokerTests0000.txt").generic_string());
+		std::string logContents((std::istreambuf_iterator<char>(logFile)), std::istreambuf_iterator<char>());
+
+		EXPECT_NE(std::string::npos, logContents.find("--- broker queue lag ---"));
+		for (const auto* counterName : { "BLOCK LAG", "UT LAG", "PT LAG", "FIN LAG", "STATE LAG", "TX STATUS LAG" })
+			EXPECT_NE(std::string::npos, logContents.find(std::string(counterName) + " : 0")) << counterName;
+	}
+
 	// endregion
 
 	// region ingestion - traits
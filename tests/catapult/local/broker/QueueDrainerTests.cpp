@@ -0,0 +1,227 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/local/broker/QueueDrainer.h"
+#include "catapult/io/IndexFile.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <atomic>
+#include <filesystem>
+
+namespace catapult { namespace local {
+
+#define TEST_CLASS QueueDrainerTests
+
+	namespace {
+		// region DrainCounter
+
+		class DrainCounter {
+		public:
+			explicit DrainCounter(size_t numBatches = 1)
+					: m_numBatches(numBatches)
+					, m_numRemainingBatches(0)
+					, m_numCalls(0)
+			{}
+
+		public:
+			size_t numCalls() const {
+				return m_numCalls;
+			}
+
+		public:
+			predicate<> drainBatch() {
+				return [this]() {
+					++m_numCalls;
+					if (0 == m_numRemainingBatches)
+						m_numRemainingBatches = m_numBatches;
+
+					return 0 != --m_numRemainingBatches;
+				};
+			}
+
+		private:
+			size_t m_numBatches;
+			size_t m_numRemainingBatches; // only accessed by single active drain
+			std::atomic<size_t> m_numCalls;
+		};
+
+		// endregion
+
+		// region TestContext
+
+		class TestContext {
+		public:
+			TestContext()
+					: m_pPool(test::CreateStartedIoThreadPool())
+					, m_pDrainer(CreateQueueDrainer(*m_pPool))
+			{}
+
+			~TestContext() {
+				m_pDrainer->shutdown();
+				m_pPool->join();
+			}
+
+		public:
+			QueueDrainer& drainer() {
+				return *m_pDrainer;
+			}
+
+			std::string directory() const {
+				return m_tempDirectoryGuard.name();
+			}
+
+		public:
+			void writeIndexFile(const std::string& filename, uint64_t value) {
+				io::IndexFile indexFile((std::filesystem::path(directory()) / filename).generic_string());
+				indexFile.set(value);
+			}
+
+		private:
+			test::TempDirectoryGuard m_tempDirectoryGuard;
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
+			std::shared_ptr<QueueDrainer> m_pDrainer;
+		};
+
+		// endregion
+	}
+
+	// region start / drainAll
+
+	TEST(TEST_CLASS, StartDrainsAllQueues) {
+		// Arrange:
+		TestContext context;
+		DrainCounter counter1;
+		DrainCounter counter2;
+		context.drainer().addQueue(context.directory(), "index1.dat", counter1.drainBatch());
+		context.drainer().addQueue(context.directory(), "index2.dat", counter2.drainBatch());
+
+		// Act:
+		context.drainer().start();
+
+		// Assert:
+		WAIT_FOR_ONE_EXPR(counter1.numCalls());
+		WAIT_FOR_ONE_EXPR(counter2.numCalls());
+	}
+
+	TEST(TEST_CLASS, DrainAllDrainsAllQueues) {
+		// Arrange:
+		TestContext context;
+		DrainCounter counter1;
+		DrainCounter counter2;
+		context.drainer().addQueue(context.directory(), "index1.dat", counter1.drainBatch());
+		context.drainer().addQueue(context.directory(), "index2.dat", counter2.drainBatch());
+		context.drainer().start();
+		WAIT_FOR_ONE_EXPR(counter1.numCalls());
+		WAIT_FOR_ONE_EXPR(counter2.numCalls());
+
+		// Act:
+		context.drainer().drainAll();
+
+		// Assert:
+		WAIT_FOR_VALUE_EXPR(2u, counter1.numCalls());
+		WAIT_FOR_VALUE_EXPR(2u, counter2.numCalls());
+	}
+
+	TEST(TEST_CLASS, QueueIsDrainedUntilNoMoreMessagesArePending) {
+		// Arrange: each drain requires three batches
+		TestContext context;
+		DrainCounter counter(3);
+		context.drainer().addQueue(context.directory(), "index.dat", counter.drainBatch());
+
+		// Act:
+		context.drainer().start();
+
+		// Assert:
+		WAIT_FOR_VALUE_EXPR(3u, counter.numCalls());
+	}
+
+	TEST(TEST_CLASS, DrainAllHasNoEffectAfterShutdown) {
+		// Arrange:
+		TestContext context;
+		DrainCounter counter;
+		context.drainer().addQueue(context.directory(), "index.dat", counter.drainBatch());
+		context.drainer().start();
+		WAIT_FOR_ONE_EXPR(counter.numCalls());
+
+		// Act:
+		context.drainer().shutdown();
+		context.drainer().drainAll();
+		test::Pause();
+
+		// Assert:
+		EXPECT_EQ(1u, counter.numCalls());
+	}
+
+	// endregion
+
+	// region change notifications
+
+	TEST(TEST_CLASS, WritingIndexFileDrainsOnlyMatchingQueue) {
+		// Arrange:
+		TestContext context;
+		if (!context.drainer().isChangeNotificationSupported()) {
+			CATAPULT_LOG(warning) << "skipping test because change notifications are not supported";
+			return;
+		}
+
+		DrainCounter counter1;
+		DrainCounter counter2;
+		context.drainer().addQueue(context.directory(), "index1.dat", counter1.drainBatch());
+		context.drainer().addQueue(context.directory(), "index2.dat", counter2.drainBatch());
+		context.drainer().start();
+		WAIT_FOR_ONE_EXPR(counter1.numCalls());
+		WAIT_FOR_ONE_EXPR(counter2.numCalls());
+
+		// Act:
+		context.writeIndexFile("index2.dat", 7);
+
+		// Assert:
+		WAIT_FOR_VALUE_EXPR(2u, counter2.numCalls());
+		test::Pause();
+		EXPECT_EQ(1u, counter1.numCalls());
+		EXPECT_EQ(2u, counter2.numCalls());
+	}
+
+	TEST(TEST_CLASS, WritingOtherFileDoesNotDrainQueue) {
+		// Arrange:
+		TestContext context;
+		if (!context.drainer().isChangeNotificationSupported()) {
+			CATAPULT_LOG(warning) << "skipping test because change notifications are not supported";
+			return;
+		}
+
+		DrainCounter counter;
+		context.drainer().addQueue(context.directory(), "index.dat", counter.drainBatch());
+		context.drainer().start();
+		WAIT_FOR_ONE_EXPR(counter.numCalls());
+
+		// Act:
+		context.writeIndexFile("index_r.dat", 7);
+		test::Pause();
+
+		// Assert:
+		EXPECT_EQ(1u, counter.numCalls());
+	}
+
+	// endregion
+}}
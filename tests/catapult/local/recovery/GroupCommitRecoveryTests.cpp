@@ -0,0 +1,288 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/local/recovery/RepairSpooling.h"
+#include "catapult/local/recovery/RepairState.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache_db/RocksDatabase.h"
+#include "catapult/cache_db/RocksInclude.h"
+#include "catapult/config/CatapultDataDirectory.h"
+#include "catapult/extensions/CommitStepHandler.h"
+#include "catapult/io/FileQueue.h"
+#include "catapult/io/IndexFile.h"
+#include "catapult/io/PodIoUtils.h"
+#include "catapult/io/RawFile.h"
+#include "catapult/subscribers/SubscriberOperationTypes.h"
+#include "catapult/utils/HexFormatter.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/other/mocks/MockStateChangeSubscriber.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace local {
+
+#define TEST_CLASS GroupCommitRecoveryTests
+
+	// these tests simulate a crash of a node using cache database group commit by snapshotting the commit step and
+	// state change spool and running the regular spooling and state recovery (in recovery orchestrator order) against the snapshot
+
+	namespace {
+		// region TestContext
+
+		enum class SyncCleanupMode { Disabled, Enabled_Without_Barrier, Enabled };
+
+		class TestContext {
+		public:
+			explicit TestContext(SyncCleanupMode syncCleanupMode = SyncCleanupMode::Disabled)
+					: m_syncCleanupMode(syncCleanupMode)
+					, m_crashTempDir("crash")
+					, m_dataDirectory(m_tempDir.name())
+					, m_crashDataDirectory(m_crashTempDir.name())
+					, m_pGroupCommitter(std::make_shared<cache::RocksGroupCommitter>(utils::TimeSpan::FromHours(1)))
+					, m_database(cache::RocksDatabaseSettings(
+							m_dataDirectory.dir("statedb").str(),
+							config::NodeConfiguration::CacheDatabaseSubConfiguration(),
+							{ "default" },
+							cache::FilterPruningMode::Disabled,
+							m_pGroupCommitter))
+					, m_commitStep(extensions::CreateCommitStepHandler(m_dataDirectory, *m_pGroupCommitter))
+					, m_catapultCache({}) {
+				std::filesystem::create_directories(stateChangeDirectory().path());
+				for (const auto* indexName : { "index_server_r.dat", "index.dat", "index_server.dat" })
+					io::IndexFile(stateChangeDirectory().file(indexName)).set(0);
+			}
+
+		public:
+			const auto& registeredSubscriber() const {
+				return m_registeredSubscriber;
+			}
+
+			const auto& repairSubscriber() const {
+				return m_repairSubscriber;
+			}
+
+		public:
+			void commit(Height height, consumers::CommitOperationStep lastStep = consumers::CommitOperationStep::All_Updated) {
+				// 1. save blocks
+				m_commitStep(consumers::CommitOperationStep::Blocks_Written);
+
+				// 2. spool state change message (chain score is set to height)
+				auto messageIndex = height.unwrap() - 1;
+				std::ostringstream messageFilename;
+				messageFilename << utils::HexFormat(messageIndex) << ".dat";
+				io::RawFile messageFile(stateChangeDirectory().file(messageFilename.str()), io::OpenMode::Read_Write);
+				io::Write8(messageFile, utils::to_underlying_type(subscribers::StateChangeOperationType::Score_Change));
+				io::Write64(messageFile, 0);
+				io::Write64(messageFile, height.unwrap());
+				io::IndexFile(stateChangeDirectory().file("index_server.dat")).set(messageIndex + 1);
+
+				if (consumers::CommitOperationStep::Blocks_Written == lastStep)
+					return;
+
+				m_commitStep(consumers::CommitOperationStep::State_Written);
+				if (consumers::CommitOperationStep::State_Written == lastStep)
+					return;
+
+				// 3. write cache database changes (not synced)
+				m_database.put(0, std::to_string(height.unwrap()), "value");
+				m_database.flush();
+
+				// 4. wait for durability barrier (added by dispatcher service when sync cleanup is enabled)
+				if (SyncCleanupMode::Enabled == m_syncCleanupMode)
+					m_pGroupCommitter->sync();
+
+				m_commitStep(consumers::CommitOperationStep::All_Updated);
+
+				// 5. discard state change message (like sync cleanup consumer)
+				if (SyncCleanupMode::Disabled != m_syncCleanupMode)
+					io::FileQueueReader(stateChangeDirectory().str(), "index_server_r.dat", "index_server.dat").skip(1);
+			}
+
+			void finalize() {
+				m_pGroupCommitter->sync();
+			}
+
+			void crashAndRecover() {
+				// capture commit step and state change spool as they are at time of crash
+				// (before outstanding writes become durable)
+				auto crashStateChangeDirectory = m_crashDataDirectory.spoolDir("state_change");
+				std::filesystem::create_directories(crashStateChangeDirectory.path());
+				std::filesystem::copy(
+						stateChangeDirectory().path(),
+						crashStateChangeDirectory.path(),
+						std::filesystem::copy_options::recursive | std::filesystem::copy_options::overwrite_existing);
+				std::filesystem::copy_file(
+						m_dataDirectory.rootDir().file("commit_step.dat"),
+						m_crashDataDirectory.rootDir().file("commit_step.dat"),
+						std::filesystem::copy_options::overwrite_existing);
+
+				auto commitStepValue = io::IndexFile(m_crashDataDirectory.rootDir().file("commit_step.dat")).get();
+				auto commitStep = static_cast<consumers::CommitOperationStep>(commitStepValue);
+				RepairSpooling(m_crashDataDirectory, commitStep);
+				RepairState(crashStateChangeDirectory, m_catapultCache, m_registeredSubscriber, m_repairSubscriber);
+			}
+
+			uint64_t readCrashIndex(const std::string& indexName) const {
+				return io::IndexFile(m_crashDataDirectory.spoolDir("state_change").file(indexName)).get();
+			}
+
+		private:
+			config::CatapultDirectory stateChangeDirectory() const {
+				return m_dataDirectory.spoolDir("state_change");
+			}
+
+		private:
+			SyncCleanupMode m_syncCleanupMode;
+			test::TempDirectoryGuard m_tempDir;
+			test::TempDirectoryGuard m_crashTempDir;
+			config::CatapultDataDirectory m_dataDirectory;
+			config::CatapultDataDirectory m_crashDataDirectory;
+			std::shared_ptr<cache::RocksGroupCommitter> m_pGroupCommitter;
+			cache::RocksDatabase m_database;
+			consumers::BlockChainSyncHandlers::CommitStepFunc m_commitStep;
+			cache::CatapultCache m_catapultCache;
+			mocks::MockStateChangeSubscriber m_registeredSubscriber;
+			mocks::MockStateChangeSubscriber m_repairSubscriber;
+		};
+
+		// endregion
+	}
+
+	TEST(TEST_CLASS, RecoveryReplaysAllChangesWhenNothingIsDurable) {
+		// Arrange:
+		TestContext context;
+		for (auto i = 1u; i <= 5; ++i)
+			context.commit(Height(i));
+
+		// Act:
+		context.crashAndRecover();
+
+		// Assert: all changes are replayed into cache database
+		EXPECT_EQ(0u, context.registeredSubscriber().numScoreChanges());
+		EXPECT_EQ(5u, context.repairSubscriber().numScoreChanges());
+		EXPECT_EQ(model::ChainScore(5), context.repairSubscriber().lastChainScore());
+		EXPECT_EQ(5u, context.readCrashIndex("index_server_r.dat"));
+	}
+
+	TEST(TEST_CLASS, RecoveryReplaysAllChangesAfterLastFinalization) {
+		// Arrange: finalize after third commit
+		TestContext context;
+		for (auto i = 1u; i <= 3; ++i)
+			context.commit(Height(i));
+
+		context.finalize();
+
+		for (auto i = 4u; i <= 5; ++i)
+			context.commit(Height(i));
+
+		// Act:
+		context.crashAndRecover();
+
+		// Assert: durable (finalized) changes are only forwarded, all changes that might not be durable are replayed
+		EXPECT_EQ(3u, context.registeredSubscriber().numScoreChanges());
+		EXPECT_EQ(model::ChainScore(3), context.registeredSubscriber().lastChainScore());
+		EXPECT_EQ(2u, context.repairSubscriber().numScoreChanges());
+		EXPECT_EQ(model::ChainScore(5), context.repairSubscriber().lastChainScore());
+		EXPECT_EQ(5u, context.readCrashIndex("index_server_r.dat"));
+	}
+
+	TEST(TEST_CLASS, RecoveryReplaysNothingWhenAllChangesAreFinalized) {
+		// Arrange:
+		TestContext context;
+		for (auto i = 1u; i <= 5; ++i)
+			context.commit(Height(i));
+
+		context.finalize();
+
+		// Act:
+		context.crashAndRecover();
+
+		// Assert: all changes are durable and only need to be forwarded
+		EXPECT_EQ(5u, context.registeredSubscriber().numScoreChanges());
+		EXPECT_EQ(model::ChainScore(5), context.registeredSubscriber().lastChainScore());
+		EXPECT_EQ(0u, context.repairSubscriber().numScoreChanges());
+		EXPECT_EQ(5u, context.readCrashIndex("index_server_r.dat"));
+	}
+
+	TEST(TEST_CLASS, RecoveryDiscardsChangesWhenCrashingBeforeStateIsWritten) {
+		// Arrange: crash after fourth state change is spooled but before state is written
+		TestContext context;
+		for (auto i = 1u; i <= 3; ++i)
+			context.commit(Height(i));
+
+		context.commit(Height(4), consumers::CommitOperationStep::Blocks_Written);
+
+		// Act:
+		context.crashAndRecover();
+
+		// Assert: all committed changes are replayed but incomplete change is discarded
+		EXPECT_EQ(0u, context.registeredSubscriber().numScoreChanges());
+		EXPECT_EQ(3u, context.repairSubscriber().numScoreChanges());
+		EXPECT_EQ(model::ChainScore(3), context.repairSubscriber().lastChainScore());
+		EXPECT_EQ(3u, context.readCrashIndex("index_server.dat"));
+		EXPECT_EQ(3u, context.readCrashIndex("index_server_r.dat"));
+	}
+
+	TEST(TEST_CLASS, RecoveryReplaysAllChangesWhenCrashingAfterStateIsWritten) {
+		// Arrange: crash after fourth state is written but before it is committed
+		TestContext context;
+		for (auto i = 1u; i <= 3; ++i)
+			context.commit(Height(i));
+
+		context.finalize();
+		context.commit(Height(4), consumers::CommitOperationStep::State_Written);
+
+		// Act:
+		context.crashAndRecover();
+
+		// Assert: written state change is replayed
+		EXPECT_EQ(3u, context.registeredSubscriber().numScoreChanges());
+		EXPECT_EQ(model::ChainScore(3), context.registeredSubscriber().lastChainScore());
+		EXPECT_EQ(1u, context.repairSubscriber().numScoreChanges());
+		EXPECT_EQ(model::ChainScore(4), context.repairSubscriber().lastChainScore());
+		EXPECT_EQ(4u, context.readCrashIndex("index_server_r.dat"));
+	}
+
+	TEST(TEST_CLASS, RecoveryCannotReplayChangesDiscardedBySyncCleanupWithoutBarrier) {
+		// Arrange:
+		TestContext context(SyncCleanupMode::Enabled_Without_Barrier);
+		for (auto i = 1u; i <= 5; ++i)
+			context.commit(Height(i));
+
+		// Act + Assert: changes that might not be durable have already been discarded
+		EXPECT_THROW(context.crashAndRecover(), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, RecoveryDoesNotNeedToReplayChangesDiscardedBySyncCleanup) {
+		// Arrange:
+		TestContext context(SyncCleanupMode::Enabled);
+		for (auto i = 1u; i <= 5; ++i)
+			context.commit(Height(i));
+
+		// Act:
+		context.crashAndRecover();
+
+		// Assert: all changes were durable before they were discarded
+		EXPECT_EQ(0u, context.registeredSubscriber().numScoreChanges());
+		EXPECT_EQ(0u, context.repairSubscriber().numScoreChanges());
+		EXPECT_EQ(5u, context.readCrashIndex("index.dat"));
+		EXPECT_EQ(5u, context.readCrashIndex("index_server_r.dat"));
+	}
+}}
@@ -264,6 +264,35 @@ namespace catapult { namespace local {
 		}
 	}
 
+	COMMIT_STEP_TEST(CanRepairSpoolingWhenAllDirectoriesArePresentAndStateChangeIndexUpdatedIsAhead) {
+		// Arrange: group commit has committed changes up to 117 that might not be durable
+		TestContext context(SetupMode::Create_Directories, 111);
+		context.setIndex("state_change", "index_server.dat", 123);
+		context.setIndex("state_change", "index_updated.dat", 117);
+
+		// Act:
+		RepairAndCheckNonStateChangeDirectories<TTraits>(context, 111);
+
+		// - check state_change directory (committed changes are retained so they can be replayed)
+		AssertRetained(context, "state_change", 4, 111);
+		EXPECT_EQ(TTraits::GetExpectedStateChangeIndexServerValue(117, 123), context.readIndex("state_change", "index_server.dat"));
+		EXPECT_EQ(117u, context.readIndex("state_change", "index_updated.dat"));
+	}
+
+	COMMIT_STEP_TEST(CanRepairSpoolingWhenAllDirectoriesArePresentAndStateChangeIndexUpdatedIsStale) {
+		// Arrange: index_updated.dat is left over from a previous run with group commit enabled
+		TestContext context(SetupMode::Create_Directories, 111);
+		context.setIndex("state_change", "index_server.dat", 123);
+		context.setIndex("state_change", "index_updated.dat", 105);
+
+		// Act:
+		RepairAndCheckNonStateChangeDirectories<TTraits>(context, 111);
+
+		// - check state_change directory (stale index is ignored)
+		AssertRetained(context, "state_change", 4, 111);
+		EXPECT_EQ(TTraits::GetExpectedStateChangeIndexServerValue(111, 123), context.readIndex("state_change", "index_server.dat"));
+	}
+
 	COMMIT_STEP_TEST(RepairHasNoEffectWhenNoSpoolingDirectoriesArePresent) {
 		// Arrange:
 		TestContext context(SetupMode::None, 111);
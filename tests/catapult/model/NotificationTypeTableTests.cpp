@@ -0,0 +1,156 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/model/NotificationTypeTable.h"
+#include "tests/TestHarness.h"
+#include <string>
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS NotificationTypeTableTests
+
+	namespace {
+		using StringTable = NotificationTypeTable<std::string>;
+
+		constexpr auto Validator_Type = static_cast<NotificationType>(0x01430005);
+		constexpr auto Observer_Type = static_cast<NotificationType>(0x02430005);
+		constexpr auto All_Type = static_cast<NotificationType>(0xFF430005);
+
+		std::vector<std::string> CollectValues(StringTable& table) {
+			std::vector<std::string> values;
+			table.forEachValue([&values](const auto& value) {
+				values.push_back(value);
+			});
+			return values;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateTableWithDefaultConstructedDefaultValue) {
+		// Act:
+		StringTable table;
+
+		// Assert:
+		EXPECT_FALSE(table.contains(Validator_Type));
+		EXPECT_EQ("", table[Validator_Type]);
+		EXPECT_EQ(std::vector<std::string>({ "" }), CollectValues(table));
+	}
+
+	TEST(TEST_CLASS, CanCreateTableWithCustomDefaultValue) {
+		// Act:
+		StringTable table("alpha");
+
+		// Assert:
+		EXPECT_FALSE(table.contains(Validator_Type));
+		EXPECT_EQ("alpha", table[Validator_Type]);
+		EXPECT_EQ(std::vector<std::string>({ "alpha" }), CollectValues(table));
+	}
+
+	// endregion
+
+	// region findOrInsert
+
+	TEST(TEST_CLASS, FindOrInsertAssociatesCopyOfDefaultValueWithUnknownType) {
+		// Arrange:
+		StringTable table("alpha");
+
+		// Act:
+		auto& value = table.findOrInsert(Validator_Type);
+		value += "-beta";
+
+		// Assert:
+		EXPECT_TRUE(table.contains(Validator_Type));
+		EXPECT_EQ("alpha-beta", table[Validator_Type]);
+		EXPECT_EQ("alpha", table[static_cast<NotificationType>(0x01430006)]);
+		EXPECT_EQ(std::vector<std::string>({ "alpha", "alpha-beta" }), CollectValues(table));
+	}
+
+	TEST(TEST_CLASS, FindOrInsertReturnsExistingValueForKnownType) {
+		// Arrange:
+		StringTable table;
+		table.findOrInsert(Validator_Type) = "alpha";
+
+		// Act:
+		auto& value = table.findOrInsert(Validator_Type);
+
+		// Assert:
+		EXPECT_EQ("alpha", value);
+		EXPECT_EQ(std::vector<std::string>({ "", "alpha" }), CollectValues(table));
+	}
+
+	TEST(TEST_CLASS, LookupIgnoresChannel) {
+		// Arrange:
+		StringTable table;
+		table.findOrInsert(Validator_Type) = "alpha";
+
+		// Act + Assert:
+		for (auto type : { Validator_Type, Observer_Type, All_Type }) {
+			EXPECT_TRUE(table.contains(type));
+			EXPECT_EQ("alpha", table[type]);
+		}
+
+		EXPECT_EQ("alpha", table.findOrInsert(All_Type));
+		EXPECT_EQ(2u, CollectValues(table).size());
+	}
+
+	TEST(TEST_CLASS, LookupDistinguishesFacilityAndCode) {
+		// Arrange:
+		StringTable table("default");
+		table.findOrInsert(static_cast<NotificationType>(0x01430005)) = "alpha";
+		table.findOrInsert(static_cast<NotificationType>(0x014E0005)) = "beta";
+		table.findOrInsert(static_cast<NotificationType>(0x01438005)) = "gamma";
+
+		// Act + Assert:
+		EXPECT_EQ("alpha", table[static_cast<NotificationType>(0x01430005)]);
+		EXPECT_EQ("beta", table[static_cast<NotificationType>(0x014E0005)]);
+		EXPECT_EQ("gamma", table[static_cast<NotificationType>(0x01438005)]);
+
+		// - unknown facilities and codes (both within and beyond allocated ranges) map to default value
+		EXPECT_EQ("default", table[static_cast<NotificationType>(0x01430004)]);
+		EXPECT_EQ("default", table[static_cast<NotificationType>(0x0143FFFF)]);
+		EXPECT_EQ("default", table[static_cast<NotificationType>(0x01440005)]);
+		EXPECT_EQ("default", table[static_cast<NotificationType>(0x01FF0005)]);
+	}
+
+	// endregion
+
+	// region forEachValue
+
+	TEST(TEST_CLASS, ForEachValueCanModifyAllValues) {
+		// Arrange:
+		StringTable table("default");
+		table.findOrInsert(Validator_Type) = "alpha";
+		table.findOrInsert(static_cast<NotificationType>(0x014E0005)) = "beta";
+
+		// Act:
+		table.forEachValue([](auto& value) {
+			value += "!";
+		});
+
+		// Assert:
+		EXPECT_EQ("alpha!", table[Validator_Type]);
+		EXPECT_EQ("beta!", table[static_cast<NotificationType>(0x014E0005)]);
+		EXPECT_EQ("default!", table[static_cast<NotificationType>(0x01000000)]);
+	}
+
+	// endregion
+}}
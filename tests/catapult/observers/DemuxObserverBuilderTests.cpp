@@ -245,5 +245,75 @@ namespace catapult { namespace observers {
 		});
 	}
 
+	namespace {
+		Breadcrumbs ObserveAndCollectBreadcrumbs(
+				const AggregateNotificationObserver& observer,
+				const model::Notification& notification,
+				NotifyMode mode,
+				Breadcrumbs& breadcrumbs) {
+			cache::CatapultCache cache({});
+			auto cacheDelta = cache.createDelta();
+			auto context = test::CreateObserverContext(cacheDelta, Height(123), mode);
+			test::ObserveNotification<model::Notification>(observer, notification, context);
+
+			auto selectedNames = breadcrumbs;
+			breadcrumbs.clear();
+			return selectedNames;
+		}
+
+		void AssertFilteredObserversPreserveRegistrationOrder(NotifyMode mode, const consumer<Breadcrumbs&>& prepareExpected) {
+			// Arrange: interleave typed observers with observers that match all types
+			Breadcrumbs breadcrumbs;
+			DemuxObserverBuilder builder;
+			builder
+				.add(CreateBreadcrumbObserver<model::AccountPublicKeyNotification>(breadcrumbs, "alpha"))
+				.add(CreateBreadcrumbObserver(breadcrumbs, "zEtA"))
+				.add(CreateBreadcrumbObserver<model::AccountAddressNotification>(breadcrumbs, "OMEGA"))
+				.add(CreateBreadcrumbObserver<model::AccountPublicKeyNotification>(breadcrumbs, "beta"))
+				.add(CreateBreadcrumbObserver(breadcrumbs, "eta"));
+			auto pObserver = builder.build();
+
+			// Act:
+			auto publicKeyBreadcrumbs = ObserveAndCollectBreadcrumbs(
+					*pObserver,
+					model::AccountPublicKeyNotification(Key()),
+					mode,
+					breadcrumbs);
+			auto addressBreadcrumbs = ObserveAndCollectBreadcrumbs(
+					*pObserver,
+					model::AccountAddressNotification(UnresolvedAddress()),
+					mode,
+					breadcrumbs);
+			auto otherBreadcrumbs = ObserveAndCollectBreadcrumbs(
+					*pObserver,
+					model::Notification(static_cast<model::NotificationType>(0x0100FFFF), sizeof(model::Notification)),
+					mode,
+					breadcrumbs);
+
+			// Assert:
+			Breadcrumbs expectedPublicKeyBreadcrumbs{ "alpha", "zEtA", "beta", "eta" };
+			Breadcrumbs expectedAddressBreadcrumbs{ "zEtA", "OMEGA", "eta" };
+			Breadcrumbs expectedOtherBreadcrumbs{ "zEtA", "eta" };
+			prepareExpected(expectedPublicKeyBreadcrumbs);
+			prepareExpected(expectedAddressBreadcrumbs);
+			prepareExpected(expectedOtherBreadcrumbs);
+
+			EXPECT_EQ(Breadcrumbs({ "alpha", "zEtA", "OMEGA", "beta", "eta" }), pObserver->names());
+			EXPECT_EQ(expectedPublicKeyBreadcrumbs, publicKeyBreadcrumbs);
+			EXPECT_EQ(expectedAddressBreadcrumbs, addressBreadcrumbs);
+			EXPECT_EQ(expectedOtherBreadcrumbs, otherBreadcrumbs);
+		}
+	}
+
+	TEST(TEST_CLASS, FilteredObserversPreserveRegistrationOrderOnCommit) {
+		AssertFilteredObserversPreserveRegistrationOrder(NotifyMode::Commit, [](const auto&) {});
+	}
+
+	TEST(TEST_CLASS, FilteredObserversPreserveReverseRegistrationOrderOnRollback) {
+		AssertFilteredObserversPreserveRegistrationOrder(NotifyMode::Rollback, [](auto& breadcrumbs) {
+			std::reverse(breadcrumbs.begin(), breadcrumbs.end());
+		});
+	}
+
 	// endregion
 }}
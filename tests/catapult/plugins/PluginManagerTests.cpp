@@ -23,6 +23,7 @@
 #include "sdk/src/extensions/ConversionExtensions.h"
 #include "catapult/cache/CatapultCache.h"
 #include "tests/test/cache/SimpleCache.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockNotificationSubscriber.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/nodeps/NumericTestUtils.h"
@@ -98,6 +99,72 @@ namespace catapult { namespace plugins {
 		// Assert: cache configuration is constructed appropriately
 		assertCacheConfiguration(manager.cacheConfig("foo"), "abc/foo");
 		assertCacheConfiguration(manager.cacheConfig("bar"), "abc/bar");
+
+		// - group commit is disabled by default
+		EXPECT_FALSE(!!manager.cacheDatabaseGroupCommitter());
+		EXPECT_FALSE(!!manager.cacheConfig("foo").pCacheDatabaseGroupCommitter);
+	}
+
+	TEST(TEST_CLASS, CanCreateCacheConfigurationWithGroupCommit) {
+		// Arrange:
+		auto storageConfig = StorageConfiguration();
+		storageConfig.PreferCacheDatabase = true;
+		storageConfig.CacheDatabaseDirectory = "abc";
+		storageConfig.CacheDatabaseConfig.GroupCommitInterval = utils::TimeSpan::FromMilliseconds(50);
+
+		// Act:
+		PluginManager manager(
+				model::BlockChainConfiguration::Uninitialized(),
+				storageConfig,
+				config::UserConfiguration::Uninitialized(),
+				config::InflationConfiguration::Uninitialized());
+
+		// Assert: all cache configurations share the same group committer
+		auto* pGroupCommitter = manager.cacheDatabaseGroupCommitter();
+		ASSERT_TRUE(!!pGroupCommitter);
+		EXPECT_EQ(pGroupCommitter, manager.cacheConfig("foo").pCacheDatabaseGroupCommitter.get());
+		EXPECT_EQ(pGroupCommitter, manager.cacheConfig("bar").pCacheDatabaseGroupCommitter.get());
+	}
+
+	TEST(TEST_CLASS, CannotEnableGroupCommitWithoutCacheDatabase) {
+		// Arrange:
+		auto storageConfig = StorageConfiguration();
+		storageConfig.CacheDatabaseConfig.GroupCommitInterval = utils::TimeSpan::FromMilliseconds(50);
+
+		// Act:
+		PluginManager manager(
+				model::BlockChainConfiguration::Uninitialized(),
+				storageConfig,
+				config::UserConfiguration::Uninitialized(),
+				config::InflationConfiguration::Uninitialized());
+
+		// Assert:
+		EXPECT_FALSE(!!manager.cacheDatabaseGroupCommitter());
+		EXPECT_FALSE(!!manager.cacheConfig("foo").pCacheDatabaseGroupCommitter);
+	}
+
+	// endregion
+
+	// region worker pool
+
+	TEST(TEST_CLASS, WorkerPoolIsInitiallyUnset) {
+		// Act:
+		auto manager = test::CreatePluginManager();
+
+		// Assert:
+		EXPECT_FALSE(!!manager.workerPool());
+	}
+
+	TEST(TEST_CLASS, CanSetWorkerPool) {
+		// Arrange:
+		auto manager = test::CreatePluginManager();
+		auto pPool = test::CreateStartedIoThreadPool(1);
+
+		// Act:
+		manager.setWorkerPool(pPool.get());
+
+		// Assert:
+		EXPECT_EQ(pPool.get(), manager.workerPool());
 	}
 
 	// endregion
@@ -513,6 +580,53 @@ namespace catapult { namespace plugins {
 
 	// endregion
 
+	// region prefetchers
+
+	namespace {
+		class PhaseCachePrefetcher : public cache::CachePrefetcher {
+		public:
+			explicit PhaseCachePrefetcher(cache::CachePrefetchPhase phase) : m_phase(phase)
+			{}
+
+		public:
+			cache::CachePrefetchPhase phase() const override {
+				return m_phase;
+			}
+
+			void collect(const model::Notification&, const model::ResolverContext&) override {
+				CATAPULT_THROW_RUNTIME_ERROR("not implemented in mock");
+			}
+
+			void prefetch(const cache::CatapultCacheDelta&) const override {
+				CATAPULT_THROW_RUNTIME_ERROR("not implemented in mock");
+			}
+
+		private:
+			cache::CachePrefetchPhase m_phase;
+		};
+
+		cache::CachePrefetcherFactory CreatePhaseCachePrefetcherFactory(cache::CachePrefetchPhase phase) {
+			return [phase]() { return std::make_unique<PhaseCachePrefetcher>(phase); };
+		}
+	}
+
+	TEST(TEST_CLASS, CanRegisterCachePrefetchers) {
+		// Arrange:
+		auto manager = test::CreatePluginManager();
+		manager.addCachePrefetcher(CreatePhaseCachePrefetcherFactory(cache::CachePrefetchPhase::Default));
+		manager.addCachePrefetcher(CreatePhaseCachePrefetcherFactory(cache::CachePrefetchPhase::Resolution));
+
+		// Act:
+		const auto& factories = manager.cachePrefetcherFactories();
+
+		// Assert:
+		ASSERT_EQ(2u, factories.size());
+		EXPECT_EQ(cache::CachePrefetchPhase::Default, factories[0]()->phase());
+		EXPECT_EQ(cache::CachePrefetchPhase::Resolution, factories[1]()->phase());
+	}
+
+	// endregion
+
 	// region resolvers
 
 	namespace {
@@ -345,4 +345,57 @@ namespace catapult { namespace subscribers {
 	}
 
 	// endregion
+
+	// region ReadBatch
+
+	TEST(TEST_CLASS, ReadBatch_CanReadZero) {
+		// Arrange:
+		QueueTestContext context;
+
+		MockBufferSubscriber subscriber;
+
+		// Act:
+		auto numMessages = ReadBatch(context.reader(), 2, subscriber, ReadNextBuffer);
+
+		// Assert:
+		EXPECT_EQ(0u, numMessages);
+		EXPECT_EQ(std::vector<Breadcrumb>(), subscriber.breadcrumbs());
+	}
+
+	TEST(TEST_CLASS, ReadBatch_ReadsAtMostMaxMessages) {
+		// Arrange:
+		auto notificationBuffer1 = test::GenerateRandomVector(141);
+		auto notificationBuffer2 = test::GenerateRandomVector(129);
+		auto notificationBuffer3 = test::GenerateRandomVector(144);
+
+		QueueTestContext context;
+		context.write(notificationBuffer1);
+		context.write(notificationBuffer2);
+		context.write(notificationBuffer3);
+
+		MockBufferSubscriber subscriber;
+
+		// Act:
+		auto numMessages1 = ReadBatch(context.reader(), 2, subscriber, ReadNextBuffer);
+		auto numMessages2 = ReadBatch(context.reader(), 2, subscriber, ReadNextBuffer);
+
+		// Assert:
+		EXPECT_EQ(2u, numMessages1);
+		EXPECT_EQ(1u, numMessages2);
+
+		std::vector<Breadcrumb> expectedBreadcrumbs{
+			Breadcrumb::Notify, Breadcrumb::Flush,
+			Breadcrumb::Notify, Breadcrumb::Flush,
+			Breadcrumb::Notify, Breadcrumb::Flush
+		};
+		EXPECT_EQ(expectedBreadcrumbs, subscriber.breadcrumbs());
+
+		const auto& notifications = subscriber.notifications();
+		ASSERT_EQ(3u, notifications.size());
+		EXPECT_EQ(notificationBuffer1, notifications[0]);
+		EXPECT_EQ(notificationBuffer2, notifications[1]);
+		EXPECT_EQ(notificationBuffer3, notifications[2]);
+	}
+
+	// endregion
 }}
@@ -283,6 +283,47 @@ namespace catapult { namespace thread {
 		EXPECT_GT(context.ItemsSum, sum);
 	}
 
+	CONTAINER_TEST(ShortCircuitStopsProcessingOfAllWorkers) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+
+		// Act:
+		std::atomic<size_t> counter(0);
+		ParallelFor(context.pPool->ioContext(), context.Items, context.NumThreads, [&counter](auto, auto) {
+			++counter;
+			return false;
+		}).get();
+
+		// Assert: each worker processed at most one item before observing the short circuit
+		EXPECT_LE(1u, counter);
+		EXPECT_GE(context.NumThreads, counter);
+	}
+
+	CONTAINER_TEST(SlowItemDoesNotStallOtherItems) {
+		// Arrange: five items per thread results in one item per chunk, so all items other than the first one can be stolen
+		BasicTestContext<typename TTraits::ContainerType> context;
+
+		// Act: block processing of the first item until all other items have been processed
+		std::atomic<size_t> sum(0);
+		std::vector<uint8_t> indexFlags(context.NumItems, 0);
+		std::atomic<size_t> numProcessedItems(0);
+		auto aggregate = CreateItemAggregate(sum, indexFlags);
+		ParallelFor(context.pPool->ioContext(), context.Items, context.NumThreads, [&aggregate, &numProcessedItems, &context](
+				auto value,
+				auto index) {
+			if (0 == index)
+				WAIT_FOR_VALUE_EXPR(context.NumItems - 1, numProcessedItems.load());
+
+			++numProcessedItems;
+			return aggregate(value, index);
+		}).get();
+
+		// Assert:
+		EXPECT_EQ(context.NumItems, numProcessedItems);
+		EXPECT_EQ(context.ItemsSum, sum);
+		EXPECT_EQ(std::vector<uint8_t>(context.NumItems, 1), indexFlags);
+	}
+
 	CONTAINER_TEST(CanModifyMultipleItemsConcurrently) {
 		// Arrange:
 		BasicTestContext<typename TTraits::ContainerType> context;
@@ -338,6 +379,8 @@ namespace catapult { namespace thread {
 		using MultiThreadedState = test::BasicMultiThreadedState<ParallelForTraits>;
 
 		struct DistributeParallelForTraits {
+			static constexpr auto Has_Fixed_Partitions = false;
+
 			static void ParallelFor(
 					boost::asio::io_context& ioContext,
 					const std::vector<ItemType>& items,
@@ -357,6 +400,8 @@ namespace catapult { namespace thread {
 		};
 
 		struct DistributeParallelForPartitionTraits {
+			static constexpr auto Has_Fixed_Partitions = true;
+
 			static void ParallelFor(
 					boost::asio::io_context& ioContext,
 					const std::vector<ItemType>& items,
@@ -380,8 +425,8 @@ namespace catapult { namespace thread {
 			}
 		};
 
-		template<typename TParallelFunc>
-		void AssertCanDistributeWorkEvenly(size_t multiplier, size_t divisor, TParallelFunc parallelFunc) {
+		template<typename TTraits>
+		void AssertCanDistributeWorkEvenly(size_t multiplier, size_t divisor) {
 			// Arrange:
 			auto pPool = test::CreateStartedIoThreadPool();
 			auto numThreads = pPool->numWorkerThreads();
@@ -393,7 +438,7 @@ namespace catapult { namespace thread {
 
 			// Act:
 			MultiThreadedState state;
-			parallelFunc(pPool->ioContext(), items, numThreads, state);
+			TTraits::ParallelFor(pPool->ioContext(), items, numThreads, state);
 
 			// Assert: all items were processed once
 			EXPECT_EQ(numItems, state.counter());
@@ -401,11 +446,15 @@ namespace catapult { namespace thread {
 
 			// - multiple execution threads were used
 			EXPECT_EQ(numThreads, state.threadCounters().size());
-			EXPECT_EQ(numThreads, state.sortedAndReducedThreadIds().size());
+			if (TTraits::Has_Fixed_Partitions)
+				EXPECT_EQ(numThreads, state.sortedAndReducedThreadIds().size());
+			else
+				EXPECT_LE(numThreads, state.sortedAndReducedThreadIds().size()); // stolen chunks interleave items across threads
 
 			// - the work was distributed evenly across threads
 			//   (a thread can do more than the min amount of work if the number of items is not divisible by the number of threads)
-			auto minWorkPerThread = numItems / numThreads;
+			//   (when work can be stolen, a thread is only guaranteed to process the item it was blocked on)
+			auto minWorkPerThread = TTraits::Has_Fixed_Partitions ? numItems / numThreads : 1;
 			for (auto counter : state.threadCounters())
 				EXPECT_LE(minWorkPerThread, counter);
 		}
@@ -418,11 +467,11 @@ namespace catapult { namespace thread {
 	}
 
 	DISTRIBUTE_TEST(CanDistributeWorkEvenlyWhenItemsAreMultipleOfThreads) {
-		AssertCanDistributeWorkEvenly(20, 1, TTraits::ParallelFor);
+		AssertCanDistributeWorkEvenly<TTraits>(20, 1);
 	}
 
 	DISTRIBUTE_TEST(CanDistributeWorkEvenlyWhenItemsAreNotMultipleOfThreads) {
-		AssertCanDistributeWorkEvenly(81, 4, TTraits::ParallelFor);
+		AssertCanDistributeWorkEvenly<TTraits>(81, 4);
 	}
 
 	// endregion
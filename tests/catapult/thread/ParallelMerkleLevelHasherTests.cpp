@@ -0,0 +1,102 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/thread/ParallelMerkleLevelHasher.h"
+#include "catapult/crypto/Hashes.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace thread {
+
+#define TEST_CLASS ParallelMerkleLevelHasherTests
+
+	namespace {
+		std::vector<Hash256> GenerateRandomHashes(size_t count) {
+			std::vector<Hash256> hashes(count);
+			for (auto& hash : hashes)
+				hash = test::GenerateRandomByteArray<Hash256>();
+
+			return hashes;
+		}
+
+		void AssertLevelIsHashedCorrectly(size_t numPairs, size_t minPartitionSize) {
+			// Arrange:
+			auto pPool = test::CreateStartedIoThreadPool();
+			auto hasher = CreateParallelMerkleLevelHasher(*pPool, minPartitionSize);
+
+			auto seedHashes = GenerateRandomHashes(2 * numPairs);
+			std::vector<RawBuffer> pairBuffers;
+			for (auto i = 0u; i < numPairs; ++i)
+				pairBuffers.push_back({ seedHashes[2 * i].data(), 2 * Hash256::Size });
+
+			// Act:
+			std::vector<Hash256> hashes(numPairs);
+			hasher(pairBuffers, hashes.data());
+
+			// Assert:
+			for (auto i = 0u; i < numPairs; ++i) {
+				Hash256 expectedHash;
+				crypto::Sha3_256(pairBuffers[i], expectedHash);
+				EXPECT_EQ(expectedHash, hashes[i]) << "pair " << i << " of " << numPairs;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, CanHashLevelSmallerThanPartitionSize) {
+		AssertLevelIsHashedCorrectly(1, 10);
+		AssertLevelIsHashedCorrectly(9, 10);
+	}
+
+	TEST(TEST_CLASS, CanHashLevelSplitAcrossPool) {
+		AssertLevelIsHashedCorrectly(20, 10);
+		AssertLevelIsHashedCorrectly(101, 3);
+		AssertLevelIsHashedCorrectly(101, 1);
+	}
+
+	TEST(TEST_CLASS, ZeroPartitionSizeIsTreatedAsOne) {
+		AssertLevelIsHashedCorrectly(17, 0);
+	}
+
+	TEST(TEST_CLASS, MerkleHashBuilderProducesSameTreeAsDefaultHasher) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		auto seedHashes = GenerateRandomHashes(123);
+
+		crypto::MerkleHashBuilder defaultBuilder;
+		crypto::MerkleHashBuilder parallelBuilder(0, CreateParallelMerkleLevelHasher(*pPool, 4));
+		for (const auto& hash : seedHashes) {
+			defaultBuilder.update(hash);
+			parallelBuilder.update(hash);
+		}
+
+		// Act:
+		std::vector<Hash256> defaultTree;
+		defaultBuilder.final(defaultTree);
+
+		std::vector<Hash256> parallelTree;
+		parallelBuilder.final(parallelTree);
+
+		// Assert:
+		EXPECT_EQ(defaultTree, parallelTree);
+	}
+}}
@@ -0,0 +1,199 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/thread/detail/WorkStealingContext.h"
+#include "tests/TestHarness.h"
+#include <list>
+#include <numeric>
+
+namespace catapult { namespace thread {
+
+	using namespace detail;
+
+#define TEST_CLASS WorkStealingContextTests
+
+	namespace {
+		using Items = std::vector<uint32_t>;
+		using ContextType = WorkStealingContext<Items::const_iterator>;
+
+		Items CreateIncrementingValues(size_t size) {
+			Items items(size);
+			std::iota(items.begin(), items.end(), 0u);
+			return items;
+		}
+
+		void AssertChunk(const WorkChunk<Items::const_iterator>* pChunk, uint32_t expectedStartIndex, size_t expectedSize) {
+			ASSERT_TRUE(!!pChunk);
+			EXPECT_EQ(expectedStartIndex, pChunk->StartIndex);
+			EXPECT_EQ(expectedSize, static_cast<size_t>(std::distance(pChunk->Begin, pChunk->End)));
+			EXPECT_EQ(expectedStartIndex, *pChunk->Begin);
+		}
+	}
+
+	// region CreateWorkChunks
+
+	TEST(TEST_CLASS, CreateWorkChunksCreatesOneItemChunksWhenThereAreFewItems) {
+		// Arrange:
+		const auto items = CreateIncrementingValues(10);
+
+		// Act:
+		auto chunks = CreateWorkChunks(items, 3);
+
+		// Assert:
+		ASSERT_EQ(10u, chunks.size());
+		for (auto i = 0u; i < chunks.size(); ++i)
+			AssertChunk(&chunks[i], i, 1);
+	}
+
+	TEST(TEST_CLASS, CreateWorkChunksCreatesMultipleChunksPerWorker) {
+		// Arrange: 3 workers * 8 chunks => chunk size 4
+		const auto items = CreateIncrementingValues(100);
+
+		// Act:
+		auto chunks = CreateWorkChunks(items, 3);
+
+		// Assert: last chunk is partial
+		ASSERT_EQ(25u, chunks.size());
+		for (auto i = 0u; i < chunks.size(); ++i)
+			AssertChunk(&chunks[i], i * 4, 4);
+	}
+
+	TEST(TEST_CLASS, CreateWorkChunksCoversAllItemsWhenNotDivisible) {
+		// Arrange: 2 workers * 8 chunks => chunk size 6
+		auto items = std::list<uint32_t>(100, 7);
+
+		// Act:
+		auto chunks = CreateWorkChunks(items, 2);
+
+		// Assert:
+		ASSERT_EQ(17u, chunks.size());
+		for (auto i = 0u; i < chunks.size() - 1; ++i) {
+			EXPECT_EQ(i * 6, chunks[i].StartIndex) << i;
+			EXPECT_EQ(6, std::distance(chunks[i].Begin, chunks[i].End)) << i;
+		}
+
+		EXPECT_EQ(96u, chunks.back().StartIndex);
+		EXPECT_EQ(4, std::distance(chunks.back().Begin, chunks.back().End));
+		EXPECT_EQ(items.end(), chunks.back().End);
+	}
+
+	// endregion
+
+	// region next
+
+	TEST(TEST_CLASS, WorkerInitiallyProcessesOwnChunksInOrder) {
+		// Arrange: 10 one-item chunks split across 2 workers
+		const auto items = CreateIncrementingValues(10);
+		ContextType context(CreateWorkChunks(items, 2), 2);
+
+		// Act + Assert:
+		for (auto i = 0u; i < 5; ++i) {
+			AssertChunk(context.next(0), i, 1);
+			AssertChunk(context.next(1), 5 + i, 1);
+		}
+	}
+
+	TEST(TEST_CLASS, IdleWorkerStealsChunksFromBackOfOtherWorkers) {
+		// Arrange: 10 one-item chunks split across 2 workers
+		const auto items = CreateIncrementingValues(10);
+		ContextType context(CreateWorkChunks(items, 2), 2);
+
+		// Act: worker 0 processes its own chunks and then steals from worker 1, which is busy with its first chunk
+		AssertChunk(context.next(1), 5, 1);
+		for (auto i = 0u; i < 5; ++i)
+			AssertChunk(context.next(0), i, 1);
+
+		for (auto i = 0u; i < 4; ++i)
+			AssertChunk(context.next(0), 9 - i, 1);
+
+		// Assert: no work remains
+		EXPECT_FALSE(!!context.next(0));
+		EXPECT_FALSE(!!context.next(1));
+	}
+
+	TEST(TEST_CLASS, WorkerStealsFromNextWorkerWithWork) {
+		// Arrange: 6 one-item chunks split across 3 workers
+		const auto items = CreateIncrementingValues(6);
+		ContextType context(CreateWorkChunks(items, 3), 3);
+
+		// - drain worker 1
+		context.next(1);
+		context.next(1);
+
+		// Act + Assert: worker 0 steals from worker 2 after draining itself
+		context.next(0);
+		context.next(0);
+		AssertChunk(context.next(0), 5, 1);
+		AssertChunk(context.next(1), 4, 1);
+		EXPECT_FALSE(!!context.next(2));
+	}
+
+	TEST(TEST_CLASS, NoChunksAreReturnedAfterAbort) {
+		// Arrange:
+		const auto items = CreateIncrementingValues(10);
+		ContextType context(CreateWorkChunks(items, 2), 2);
+
+		// Act:
+		context.abort();
+
+		// Assert:
+		EXPECT_FALSE(!!context.next(0));
+		EXPECT_FALSE(!!context.next(1));
+	}
+
+	// endregion
+
+	// region completeWorker
+
+	TEST(TEST_CLASS, FutureIsResolvedWhenAllWorkersComplete) {
+		// Arrange:
+		const auto items = CreateIncrementingValues(10);
+		ContextType context(CreateWorkChunks(items, 3), 3);
+		auto future = context.future();
+
+		// Act + Assert:
+		for (auto i = 0u; i < 3; ++i) {
+			EXPECT_FALSE(future.is_ready()) << i;
+			context.completeWorker();
+		}
+
+		ASSERT_TRUE(future.is_ready());
+		EXPECT_TRUE(future.get());
+	}
+
+	TEST(TEST_CLASS, WorkerCompletionGuardCompletesWorkerWhenDestroyed) {
+		// Arrange:
+		const auto items = CreateIncrementingValues(10);
+		ContextType context(CreateWorkChunks(items, 1), 1);
+		auto future = context.future();
+
+		// Act:
+		{
+			WorkerCompletionGuard<ContextType> guard(context);
+			EXPECT_FALSE(future.is_ready());
+		}
+
+		// Assert:
+		EXPECT_TRUE(future.is_ready());
+	}
+
+	// endregion
+}}
@@ -388,6 +388,24 @@ namespace catapult { namespace tree {
 		EXPECT_EQ(expectedHash, node.hash());
 	}
 
+	BRANCH_LINK_TEST(CanSetBranchTreeNodeLinksOutOfOrder) {
+		// Arrange:
+		auto path = TreeNodePath(0x64'6F'67'00);
+		auto links = TTraits::GenerateLinks(2);
+		auto node = BranchTreeNode(path);
+
+		// Act: set higher link first
+		node.setLink(links[1], 11);
+		node.setLink(links[0], 6);
+
+		// Assert:
+		EXPECT_EQ(path, node.path());
+		AssertTwoLinks<TTraits>(node, TTraits::GetHash(links[0]), TTraits::GetHash(links[1]));
+
+		auto expectedHash = CalculateTwoLinkHash({ 0x00, 0x64, 0x6F, 0x67, 0x00 }, TTraits::GetHash(links[0]), TTraits::GetHash(links[1]));
+		EXPECT_EQ(expectedHash, node.hash());
+	}
+
 	BRANCH_LINK_TEST(BranchTreeNodeSetLinkTriggersHashRecalculation) {
 		// Arrange:
 		auto links = TTraits::GenerateLinks(2);
@@ -464,6 +482,22 @@ namespace catapult { namespace tree {
 		EXPECT_EQ(expectedHash, node.hash());
 	}
 
+	TEST(TEST_CLASS, BranchTreeNodeSetLinkCanCopyLinkFromSameNode) {
+		// Arrange: set eight links so that adding another link (likely) requires growing link storage
+		auto link = test::GenerateRandomByteArray<Hash256>();
+		auto node = BranchTreeNode(TreeNodePath(0x64'6F'67'00));
+		for (auto i = 0u; i < 8; ++i)
+			node.setLink(6 == i ? link : test::GenerateRandomByteArray<Hash256>(), i);
+
+		// Act:
+		node.setLink(node.link(6), 11);
+
+		// Assert:
+		EXPECT_EQ(9u, node.numLinks());
+		EXPECT_EQ(link, node.link(6));
+		EXPECT_EQ(link, node.link(11));
+	}
+
 	BRANCH_LINK_TEST(BranchTreeNodeCompactLinksReplacesLinksWithHashLinks) {
 		// Arrange:
 		auto path = TreeNodePath(0x64'6F'67'00);
@@ -696,6 +730,20 @@ namespace catapult { namespace tree {
 
 	// endregion
 
+	// region TreeNode - layout
+
+	TEST(TEST_CLASS, TreeNodeIsNotLargerThanLargestNodeTypeAndTag) {
+		// Assert: leaf nodes should not pay for branch storage
+		EXPECT_GE(std::max(sizeof(LeafTreeNode), sizeof(BranchTreeNode)) + sizeof(uint64_t), sizeof(TreeNode));
+	}
+
+	TEST(TEST_CLASS, BranchTreeNodeSizeIsIndependentOfMaxLinks) {
+		// Assert: link storage is not inline
+		EXPECT_GT(BranchTreeNode::Max_Links * sizeof(Hash256), sizeof(BranchTreeNode));
+	}
+
+	// endregion
+
 	// region TreeNode - setPath
 
 	TEST(TEST_CLASS, CannotChangeEmptyTreeNodePathViaTreeNode) {
@@ -0,0 +1,171 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/LatencyHistogram.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+#include <algorithm>
+#include <thread>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS LatencyHistogramTests
+
+	// region bucket mapping
+
+	TEST(TEST_CLASS, SmallValuesHaveDedicatedBuckets) {
+		for (auto value = 0u; value < 4; ++value) {
+			EXPECT_EQ(value, LatencyHistogram::BucketIndex(value)) << value;
+			EXPECT_EQ(value, LatencyHistogram::BucketUpperBound(value)) << value;
+		}
+	}
+
+	TEST(TEST_CLASS, LargerValuesShareBucketsWithinSubRange) {
+		// Assert: [4, 7] map to dedicated buckets
+		EXPECT_EQ(4u, LatencyHistogram::BucketIndex(4));
+		EXPECT_EQ(7u, LatencyHistogram::BucketIndex(7));
+
+		// - [8, 15] map to buckets of width 2
+		EXPECT_EQ(8u, LatencyHistogram::BucketIndex(8));
+		EXPECT_EQ(8u, LatencyHistogram::BucketIndex(9));
+		EXPECT_EQ(11u, LatencyHistogram::BucketIndex(15));
+
+		// - [1024, 2047] map to buckets of width 256
+		EXPECT_EQ(36u, LatencyHistogram::BucketIndex(1024));
+		EXPECT_EQ(36u, LatencyHistogram::BucketIndex(1279));
+		EXPECT_EQ(37u, LatencyHistogram::BucketIndex(1280));
+		EXPECT_EQ(39u, LatencyHistogram::BucketIndex(2047));
+
+		// - largest value maps to last bucket
+		EXPECT_EQ(LatencyHistogram::Num_Buckets - 1, LatencyHistogram::BucketIndex(std::numeric_limits<uint64_t>::max()));
+	}
+
+	TEST(TEST_CLASS, BucketUpperBoundIsLargestValueInBucket) {
+		for (auto i = 0u; i < LatencyHistogram::Num_Buckets - 1; ++i) {
+			auto upperBound = LatencyHistogram::BucketUpperBound(i);
+			EXPECT_EQ(i, LatencyHistogram::BucketIndex(upperBound)) << i;
+			EXPECT_EQ(i + 1, LatencyHistogram::BucketIndex(upperBound + 1)) << i;
+		}
+
+		EXPECT_EQ(std::numeric_limits<uint64_t>::max(), LatencyHistogram::BucketUpperBound(LatencyHistogram::Num_Buckets - 1));
+	}
+
+	// endregion
+
+	// region add / percentile
+
+	TEST(TEST_CLASS, HistogramIsInitiallyEmpty) {
+		// Act:
+		LatencyHistogram histogram;
+
+		// Assert:
+		EXPECT_EQ(0u, histogram.count());
+		EXPECT_EQ(0u, histogram.max());
+		EXPECT_EQ(0u, histogram.percentile(50));
+		EXPECT_EQ(0u, histogram.percentile(100));
+	}
+
+	TEST(TEST_CLASS, CannotQueryPercentileOutsideOfValidRange) {
+		// Arrange:
+		LatencyHistogram histogram;
+		histogram.add(10);
+
+		// Act + Assert:
+		EXPECT_THROW(histogram.percentile(0), catapult_invalid_argument);
+		EXPECT_THROW(histogram.percentile(101), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanAddSingleValue) {
+		// Arrange:
+		LatencyHistogram histogram;
+
+		// Act:
+		histogram.add(1000);
+
+		// Assert: percentiles are capped by max
+		EXPECT_EQ(1u, histogram.count());
+		EXPECT_EQ(1000u, histogram.max());
+		EXPECT_EQ(1000u, histogram.percentile(1));
+		EXPECT_EQ(1000u, histogram.percentile(50));
+		EXPECT_EQ(1000u, histogram.percentile(100));
+	}
+
+	TEST(TEST_CLASS, CanAddMultipleValues) {
+		// Arrange:
+		LatencyHistogram histogram;
+
+		// Act: add 1..100
+		for (auto i = 1u; i <= 100; ++i)
+			histogram.add(i);
+
+		// Assert: percentiles are bucket upper bounds
+		EXPECT_EQ(100u, histogram.count());
+		EXPECT_EQ(100u, histogram.max());
+		EXPECT_EQ(1u, histogram.percentile(1));
+		EXPECT_EQ(55u, histogram.percentile(50)); // bucket [48, 55]
+		EXPECT_EQ(63u, histogram.percentile(56)); // bucket [56, 63]
+		EXPECT_EQ(100u, histogram.percentile(99)); // bucket [96, 111] capped by max
+		EXPECT_EQ(100u, histogram.percentile(100));
+	}
+
+	TEST(TEST_CLASS, PercentileIsAccurateWithinBucketResolution) {
+		// Arrange:
+		LatencyHistogram histogram;
+		std::vector<uint64_t> values;
+		for (auto i = 0u; i < 1000; ++i) {
+			values.push_back(1 + test::Random() % 1'000'000);
+			histogram.add(values.back());
+		}
+
+		std::sort(values.begin(), values.end());
+
+		// Act + Assert:
+		for (auto percentile : { 50u, 90u, 99u }) {
+			auto expectedValue = values[values.size() * percentile / 100 - 1];
+			auto value = histogram.percentile(percentile);
+			EXPECT_LE(expectedValue, value) << percentile;
+			EXPECT_GE(expectedValue + expectedValue / 4, value) << percentile;
+		}
+	}
+
+	TEST(TEST_CLASS, CanAddValuesConcurrently) {
+		// Arrange:
+		LatencyHistogram histogram;
+		std::vector<std::thread> threads;
+
+		// Act:
+		for (auto i = 0u; i < 4; ++i) {
+			threads.emplace_back([&histogram, i]() {
+				for (auto j = 0u; j < 1000; ++j)
+					histogram.add(i * 1000 + j);
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		// Assert:
+		EXPECT_EQ(4000u, histogram.count());
+		EXPECT_EQ(3999u, histogram.max());
+	}
+
+	// endregion
+}}
@@ -155,7 +155,7 @@ namespace catapult { namespace utils {
 			}
 
 			auto elapsedMillisString = " (" + std::to_string(elapsedMillis) + "ms)";
-			EXPECT_EQ("<warning> (utils::StackLogger.h@77) slow operation detected: 'test'" + elapsedMillisString, records[0].Message);
+			EXPECT_EQ("<warning> (utils::StackLogger.h@80) slow operation detected: 'test'" + elapsedMillisString, records[0].Message);
 			return true;
 		});
 	}
@@ -229,7 +229,7 @@ namespace catapult { namespace utils {
 
 			std::ostringstream expectedMessage;
 			expectedMessage
-					<< "<warning> (utils::StackLogger.h@77) slow operation detected: 'test' (" << elapsedMillis << "ms)"
+					<< "<warning> (utils::StackLogger.h@80) slow operation detected: 'test' (" << elapsedMillis << "ms)"
 					<< std::endl << " + " << subOperationTimes[0] << "ms: 'zeta' (" << subOperationTimes[1] - subOperationTimes[0] << "ms)"
 					<< std::endl << " + " << subOperationTimes[1] << "ms: 'beta' (" << subOperationTimes[2] - subOperationTimes[1] << "ms)"
 					<< std::endl << " + " << subOperationTimes[2] << "ms: 'gamma' (" << elapsedMillis - subOperationTimes[2] << "ms)";
@@ -238,5 +238,50 @@ namespace catapult { namespace utils {
 		});
 	}
 
+	TEST(TEST_CLASS, SlowOperationLoggerLogsWhenThresholdIsExceededWithConcurrentSubOperations) {
+		// Arrange: non-deterministic due to sleep
+		test::RunNonDeterministicTest("log stack messages", []() {
+			test::TempLogsDirectoryGuard logFileGuard;
+
+			{
+				// Arrange: add a file logger
+				LoggingBootstrapper bootstrapper;
+				bootstrapper.addFileLogger(test::CreateTestFileLoggerOptions(), LogFilter(LogLevel::min));
+
+				// Act: messages should be logged because threshold is less than wait
+				{
+					auto threshold = utils::TimeSpan::FromMilliseconds(Sleep_Millis);
+					SlowOperationLogger slowOperationLogger("test", LogLevel::warning, threshold);
+
+					// - wait with two concurrent sub operations
+					test::Sleep(10 * Sleep_Millis);
+					slowOperationLogger.addConcurrentSubOperation("zeta", 7);
+					slowOperationLogger.addConcurrentSubOperation("beta", 3);
+				}
+			}
+
+			// Assert:
+			auto records = test::ParseLogLines(logFileGuard.name());
+			if (1u != records.size()) // can be 0 or 1
+				return false;
+
+			EXPECT_EQ(1u, records.size());
+
+			auto elapsedMillis = ParseElapsedMillis(records[0].Message);
+			if (!IsWithinSleepEpsilonRange(elapsedMillis, 10)) {
+				CATAPULT_LOG(debug) << "elapsedMillis (" << elapsedMillis << ") outside of expected range";
+				return false;
+			}
+
+			std::ostringstream expectedMessage;
+			expectedMessage
+					<< "<warning> (utils::StackLogger.h@80) slow operation detected: 'test' (" << elapsedMillis << "ms)"
+					<< std::endl << " * 'zeta' (7ms)"
+					<< std::endl << " * 'beta' (3ms)";
+			EXPECT_EQ(expectedMessage.str(), records[0].Message);
+			return true;
+		});
+	}
+
 	// endregion
 }}
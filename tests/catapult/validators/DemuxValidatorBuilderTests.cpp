@@ -250,5 +250,49 @@ namespace catapult { namespace validators {
 		});
 	}
 
+	namespace {
+		Breadcrumbs ValidateAndCollectBreadcrumbs(
+				const stateful::AggregateNotificationValidator& validator,
+				const model::Notification& notification,
+				Breadcrumbs& breadcrumbs) {
+			auto cache = test::CreateEmptyCatapultCache();
+			test::ValidateNotification<model::Notification>(validator, notification, cache);
+
+			auto selectedNames = breadcrumbs;
+			breadcrumbs.clear();
+			return selectedNames;
+		}
+	}
+
+	TEST(TEST_CLASS, FilteredValidatorsPreserveRegistrationOrder) {
+		// Arrange: interleave typed validators with validators that match all types
+		Breadcrumbs breadcrumbs;
+		stateful::DemuxValidatorBuilder builder;
+		builder
+			.add(CreateBreadcrumbValidator<model::AccountPublicKeyNotification>(breadcrumbs, "alpha"))
+			.add(CreateBreadcrumbValidator(breadcrumbs, "zEtA"))
+			.add(CreateBreadcrumbValidator<model::AccountAddressNotification>(breadcrumbs, "OMEGA"))
+			.add(CreateBreadcrumbValidator<model::AccountPublicKeyNotification>(breadcrumbs, "beta"))
+			.add(CreateBreadcrumbValidator(breadcrumbs, "eta"));
+		auto pValidator = builder.build([](auto) { return false; });
+
+		// Act:
+		auto publicKeyBreadcrumbs = ValidateAndCollectBreadcrumbs(*pValidator, model::AccountPublicKeyNotification(Key()), breadcrumbs);
+		auto addressBreadcrumbs = ValidateAndCollectBreadcrumbs(
+				*pValidator,
+				model::AccountAddressNotification(UnresolvedAddress()),
+				breadcrumbs);
+		auto otherBreadcrumbs = ValidateAndCollectBreadcrumbs(
+				*pValidator,
+				model::Notification(static_cast<model::NotificationType>(0x0100FFFF), sizeof(model::Notification)),
+				breadcrumbs);
+
+		// Assert:
+		EXPECT_EQ(Breadcrumbs({ "alpha", "zEtA", "OMEGA", "beta", "eta" }), pValidator->names());
+		EXPECT_EQ(Breadcrumbs({ "alpha", "zEtA", "beta", "eta" }), publicKeyBreadcrumbs);
+		EXPECT_EQ(Breadcrumbs({ "zEtA", "OMEGA", "eta" }), addressBreadcrumbs);
+		EXPECT_EQ(Breadcrumbs({ "zEtA", "eta" }), otherBreadcrumbs);
+	}
+
 	// endregion
 }}
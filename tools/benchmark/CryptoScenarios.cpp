@@ -0,0 +1,275 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Scenario.h"
+#include "ScenarioUtils.h"
+#include "tools/Random.h"
+#include "tools/ToolKeys.h"
+#include "catapult/crypto/Hashes.h"
+#include "catapult/crypto/Signer.h"
+#include "catapult/model/EntityHasher.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/utils/RandomGenerator.h"
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	namespace {
+		// maximum number of distinct batches prepared by batch scenarios (operations reuse batches)
+		constexpr size_t Max_Prepared_Batches = 16;
+
+		// region sign / verify
+
+		struct SignatureEntry {
+			std::vector<uint8_t> Data;
+			catapult::Signature Signature;
+		};
+
+		class SignatureScenario : public Scenario {
+		public:
+			SignatureScenario(const std::string& name, const ScenarioSettings& settings)
+					: m_name(name)
+					, m_dataSize(settings.DataSize)
+					, m_keyPair(GenerateRandomKeyPair())
+			{}
+
+		public:
+			std::string name() const override {
+				return m_name;
+			}
+
+			size_t itemsPerOperation() const override {
+				return 1;
+			}
+
+			bool isParallel() const override {
+				return true;
+			}
+
+			void prepare(size_t numOperations) override {
+				m_entries.resize(numOperations);
+				for (auto& entry : m_entries)
+					entry.Data = GenerateRandomVector(m_dataSize);
+			}
+
+		protected:
+			const crypto::KeyPair& keyPair() const {
+				return m_keyPair;
+			}
+
+			std::vector<SignatureEntry>& entries() {
+				return m_entries;
+			}
+
+		private:
+			std::string m_name;
+			uint32_t m_dataSize;
+			crypto::KeyPair m_keyPair;
+			std::vector<SignatureEntry> m_entries;
+		};
+
+		class SignScenario : public SignatureScenario {
+		public:
+			explicit SignScenario(const ScenarioSettings& settings) : SignatureScenario("sign", settings)
+			{}
+
+		public:
+			void execute(size_t index) override {
+				auto& entry = entries()[index];
+				crypto::Sign(keyPair(), entry.Data, entry.Signature);
+			}
+		};
+
+		class VerifyScenario : public SignatureScenario {
+		public:
+			explicit VerifyScenario(const ScenarioSettings& settings) : SignatureScenario("verify", settings)
+			{}
+
+		public:
+			void prepare(size_t numOperations) override {
+				SignatureScenario::prepare(numOperations);
+				for (auto& entry : entries())
+					crypto::Sign(keyPair(), entry.Data, entry.Signature);
+			}
+
+			void execute(size_t index) override {
+				const auto& entry = entries()[index];
+				if (!crypto::Verify(keyPair().publicKey(), entry.Data, entry.Signature))
+					CATAPULT_LOG(warning) << "could not verify data!";
+			}
+		};
+
+		// endregion
+
+		// region verify multi
+
+		class VerifyMultiScenario : public Scenario {
+		public:
+			VerifyMultiScenario(size_t batchSize, const ScenarioSettings& settings)
+					: m_batchSize(batchSize)
+					, m_dataSize(settings.DataSize)
+			{}
+
+		public:
+			std::string name() const override {
+				return "verify_multi_" + std::to_string(m_batchSize);
+			}
+
+			size_t itemsPerOperation() const override {
+				return m_batchSize;
+			}
+
+			bool isParallel() const override {
+				return true;
+			}
+
+			void prepare(size_t numOperations) override {
+				auto numSignatures = m_batchSize * std::min(numOperations, Max_Prepared_Batches);
+				m_publicKeys.resize(numSignatures);
+				m_entries.resize(numSignatures);
+				m_signatureInputs.clear();
+				m_signatureInputs.reserve(numSignatures);
+
+				for (auto i = 0u; i < numSignatures; ++i) {
+					auto keyPair = GenerateRandomKeyPair();
+					auto& entry = m_entries[i];
+					entry.Data = GenerateRandomVector(m_dataSize);
+					crypto::Sign(keyPair, entry.Data, entry.Signature);
+
+					m_publicKeys[i] = keyPair.publicKey();
+					m_signatureInputs.push_back({ m_publicKeys[i], { entry.Data }, entry.Signature });
+				}
+			}
+
+			void execute(size_t index) override {
+				auto numBatches = m_signatureInputs.size() / m_batchSize;
+				const auto* pSignatureInputs = &m_signatureInputs[(index % numBatches) * m_batchSize];
+				if (!crypto::VerifyMulti(CreateRandomFiller(), pSignatureInputs, m_batchSize).second)
+					CATAPULT_LOG(warning) << "could not verify batch!";
+			}
+
+		private:
+			static crypto::RandomFiller CreateRandomFiller() {
+				return [](auto* pOut, auto count) {
+					utils::HighEntropyRandomGenerator().fill(pOut, count);
+				};
+			}
+
+		private:
+			size_t m_batchSize;
+			uint32_t m_dataSize;
+			std::vector<Key> m_publicKeys;
+			std::vector<SignatureEntry> m_entries;
+			std::vector<crypto::SignatureInput> m_signatureInputs;
+		};
+
+		// endregion
+
+		// region hashes
+
+		template<typename THash>
+		class TransactionHashScenario : public Scenario {
+		public:
+			TransactionHashScenario(const std::string& name, const ScenarioSettings& settings)
+					: m_name(name)
+					, m_dataSize(settings.DataSize)
+			{}
+
+		public:
+			std::string name() const override {
+				return m_name;
+			}
+
+			size_t itemsPerOperation() const override {
+				return 1;
+			}
+
+			bool isParallel() const override {
+				return true;
+			}
+
+			void prepare(size_t numOperations) override {
+				m_transactions = GenerateRandomTransactions(numOperations, m_dataSize);
+				m_hashes.resize(numOperations);
+			}
+
+			void execute(size_t index) override {
+				const auto& transaction = *m_transactions[index];
+				calculateHash(transaction, m_hashes[index]);
+			}
+
+		protected:
+			virtual void calculateHash(const model::Transaction& transaction, THash& hash) const = 0;
+
+		private:
+			std::string m_name;
+			uint32_t m_dataSize;
+			std::vector<std::shared_ptr<const model::Transaction>> m_transactions;
+			std::vector<THash> m_hashes;
+		};
+
+		class Sha3_256Scenario : public TransactionHashScenario<Hash256> {
+		public:
+			explicit Sha3_256Scenario(const ScenarioSettings& settings) : TransactionHashScenario("sha3_256", settings)
+			{}
+
+		protected:
+			void calculateHash(const model::Transaction& transaction, Hash256& hash) const override {
+				crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(&transaction), transaction.Size }, hash);
+			}
+		};
+
+		class Sha512Scenario : public TransactionHashScenario<Hash512> {
+		public:
+			explicit Sha512Scenario(const ScenarioSettings& settings) : TransactionHashScenario("sha512", settings)
+			{}
+
+		protected:
+			void calculateHash(const model::Transaction& transaction, Hash512& hash) const override {
+				crypto::Sha512({ reinterpret_cast<const uint8_t*>(&transaction), transaction.Size }, hash);
+			}
+		};
+
+		class EntityHasherScenario : public TransactionHashScenario<Hash256> {
+		public:
+			explicit EntityHasherScenario(const ScenarioSettings& settings) : TransactionHashScenario("entity_hasher", settings)
+			{}
+
+		protected:
+			void calculateHash(const model::Transaction& transaction, Hash256& hash) const override {
+				hash = model::CalculateHash(transaction, Benchmark_Generation_Hash_Seed);
+			}
+		};
+
+		// endregion
+	}
+
+	void AddCryptoScenarios(Scenarios& scenarios, const ScenarioSettings& settings) {
+		scenarios.push_back(std::make_unique<SignScenario>(settings));
+		scenarios.push_back(std::make_unique<VerifyScenario>(settings));
+
+		for (auto batchSize : { 16u, 64u, 256u })
+			scenarios.push_back(std::make_unique<VerifyMultiScenario>(batchSize, settings));
+
+		scenarios.push_back(std::make_unique<Sha3_256Scenario>(settings));
+		scenarios.push_back(std::make_unique<Sha512Scenario>(settings));
+		scenarios.push_back(std::make_unique<EntityHasherScenario>(settings));
+	}
+}}}
@@ -0,0 +1,123 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Scenario.h"
+#include "tools/Random.h"
+#include "finalization/src/chain/RoundContext.h"
+#include <algorithm>
+#include <random>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	namespace {
+		// region round context
+
+		constexpr size_t Num_Voters = 5000;
+		constexpr size_t Num_Branch_Hashes = 64;
+		constexpr size_t Num_Common_Hashes = 48;
+
+		class RoundContextScenario : public Scenario {
+		private:
+			struct Vote {
+				bool IsPrevote;
+				size_t BranchIndex;
+				size_t NumHashes;
+				uint64_t Weight;
+			};
+
+		public:
+			RoundContextScenario()
+					: m_totalWeight(0)
+					, m_numBestPrecommits(0)
+			{}
+
+		public:
+			std::string name() const override {
+				return "round_context";
+			}
+
+			size_t itemsPerOperation() const override {
+				return m_votes.size();
+			}
+
+			bool isParallel() const override {
+				return false;
+			}
+
+			void prepare(size_t) override {
+				// all operations replay the same round, so votes only need to be generated once
+				if (!m_votes.empty())
+					return;
+
+				// two competing branches that share a common prefix
+				for (auto& branch : m_branches) {
+					branch.resize(Num_Branch_Hashes);
+					for (auto& hash : branch)
+						std::generate(hash.begin(), hash.end(), RandomByte);
+				}
+
+				std::copy(m_branches[0].cbegin(), m_branches[0].cbegin() + Num_Common_Hashes, m_branches[1].begin());
+
+				// each voter prevotes for a prefix of one branch and precommits to a hash within that prefix
+				for (auto i = 0u; i < Num_Voters; ++i) {
+					auto branchIndex = 0 == Random() % 10 ? 1u : 0u;
+					auto numPrevoteHashes = 1 + Random() % Num_Branch_Hashes;
+					auto weight = 1 + Random() % 1000;
+					m_votes.push_back({ true, branchIndex, numPrevoteHashes, weight });
+					m_votes.push_back({ false, branchIndex, 1 + Random() % numPrevoteHashes, weight });
+					m_totalWeight += weight;
+				}
+
+				// shuffle votes so that some precommits are received before matching prevotes
+				std::shuffle(m_votes.begin(), m_votes.end(), std::mt19937_64(Random()));
+			}
+
+			void execute(size_t) override {
+				chain::RoundContext context(m_totalWeight, m_totalWeight * 2 / 3);
+				for (const auto& vote : m_votes) {
+					const auto& branch = m_branches[vote.BranchIndex];
+					if (vote.IsPrevote)
+						context.acceptPrevote(Height(1), branch.data(), vote.NumHashes, vote.Weight);
+					else
+						context.acceptPrecommit(Height(vote.NumHashes), branch[vote.NumHashes - 1], vote.Weight);
+
+					// simulate the orchestrator polling the round after every accepted message
+					if (context.tryFindBestPrecommit().second)
+						++m_numBestPrecommits;
+
+					context.tryFindEstimate();
+				}
+			}
+
+		private:
+			std::array<std::vector<Hash256>, 2> m_branches;
+			std::vector<Vote> m_votes;
+			uint64_t m_totalWeight;
+			size_t m_numBestPrecommits;
+		};
+
+		// endregion
+	}
+
+	void AddFinalizationScenarios(Scenarios& scenarios, const ScenarioSettings&) {
+		scenarios.push_back(std::make_unique<RoundContextScenario>());
+	}
+}}}
@@ -0,0 +1,74 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	/// Settings shared by all benchmark scenarios.
+	struct ScenarioSettings {
+		/// Size of generated data (e.g. transaction payloads).
+		uint32_t DataSize;
+
+		/// Number of transactions in each generated block.
+		uint32_t NumBlockTransactions;
+	};
+
+	/// Benchmark scenario composed of independently timed operations.
+	class Scenario {
+	public:
+		virtual ~Scenario() = default;
+
+	public:
+		/// Gets the scenario name.
+		virtual std::string name() const = 0;
+
+		/// Gets the number of items (e.g. signatures or transactions) processed by a single operation.
+		virtual size_t itemsPerOperation() const = 0;
+
+		/// Returns \c true if operations can be executed concurrently.
+		virtual bool isParallel() const = 0;
+
+	public:
+		/// Prepares all data required to execute \a numOperations operations.
+		/// \note Preparation is not timed.
+		virtual void prepare(size_t numOperations) = 0;
+
+		/// Executes the operation with \a index.
+		virtual void execute(size_t index) = 0;
+	};
+
+	/// Container of benchmark scenarios.
+	using Scenarios = std::vector<std::unique_ptr<Scenario>>;
+
+	/// Adds crypto scenarios configured with \a settings to \a scenarios.
+	void AddCryptoScenarios(Scenarios& scenarios, const ScenarioSettings& settings);
+
+	/// Adds state (tree, cache and execution) scenarios configured with \a settings to \a scenarios.
+	void AddStateScenarios(Scenarios& scenarios, const ScenarioSettings& settings);
+
+	/// Adds finalization (round context) scenarios configured with \a settings to \a scenarios.
+	void AddFinalizationScenarios(Scenarios& scenarios, const ScenarioSettings& settings);
+}}}
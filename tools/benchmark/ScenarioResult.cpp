@@ -0,0 +1,82 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ScenarioResult.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	ScenarioResult::ScenarioResult(
+			const std::string& name,
+			size_t itemsPerOperation,
+			uint64_t elapsedNanos,
+			std::vector<uint64_t>&& operationNanos)
+			: m_name(name)
+			, m_itemsPerOperation(itemsPerOperation)
+			, m_elapsedNanos(elapsedNanos)
+			, m_operationNanos(std::move(operationNanos)) {
+		std::sort(m_operationNanos.begin(), m_operationNanos.end());
+	}
+
+	const std::string& ScenarioResult::name() const {
+		return m_name;
+	}
+
+	size_t ScenarioResult::numOperations() const {
+		return m_operationNanos.size();
+	}
+
+	size_t ScenarioResult::itemsPerOperation() const {
+		return m_itemsPerOperation;
+	}
+
+	uint64_t ScenarioResult::elapsedNanos() const {
+		return m_elapsedNanos;
+	}
+
+	double ScenarioResult::operationsPerSecond() const {
+		if (0 == m_elapsedNanos)
+			return 0;
+
+		return static_cast<double>(numOperations()) * 1'000'000'000 / static_cast<double>(m_elapsedNanos);
+	}
+
+	double ScenarioResult::itemsPerSecond() const {
+		return operationsPerSecond() * static_cast<double>(m_itemsPerOperation);
+	}
+
+	uint64_t ScenarioResult::meanNanos() const {
+		if (m_operationNanos.empty())
+			return 0;
+
+		return std::accumulate(m_operationNanos.cbegin(), m_operationNanos.cend(), static_cast<uint64_t>(0)) / numOperations();
+	}
+
+	uint64_t ScenarioResult::percentileNanos(double percentile) const {
+		if (m_operationNanos.empty())
+			return 0;
+
+		auto rank = static_cast<size_t>(std::ceil(percentile / 100 * static_cast<double>(numOperations())));
+		return m_operationNanos[std::clamp<size_t>(rank, 1, numOperations()) - 1];
+	}
+}}}
@@ -0,0 +1,68 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	/// Result of running a benchmark scenario.
+	class ScenarioResult {
+	public:
+		/// Creates a result for scenario \a name that processed \a itemsPerOperation items per operation
+		/// given total elapsed time (\a elapsedNanos) and individual operation durations (\a operationNanos).
+		ScenarioResult(const std::string& name, size_t itemsPerOperation, uint64_t elapsedNanos, std::vector<uint64_t>&& operationNanos);
+
+	public:
+		/// Gets the scenario name.
+		const std::string& name() const;
+
+		/// Gets the number of executed operations.
+		size_t numOperations() const;
+
+		/// Gets the number of items processed by a single operation.
+		size_t itemsPerOperation() const;
+
+		/// Gets the total elapsed (wall clock) time in nanoseconds.
+		uint64_t elapsedNanos() const;
+
+	public:
+		/// Gets the number of operations executed per second.
+		double operationsPerSecond() const;
+
+		/// Gets the number of items processed per second.
+		double itemsPerSecond() const;
+
+		/// Gets the mean operation duration in nanoseconds.
+		uint64_t meanNanos() const;
+
+		/// Gets the operation duration in nanoseconds at \a percentile (in range [0, 100]) using the nearest rank method.
+		uint64_t percentileNanos(double percentile) const;
+
+	private:
+		std::string m_name;
+		size_t m_itemsPerOperation;
+		uint64_t m_elapsedNanos;
+		std::vector<uint64_t> m_operationNanos;
+	};
+}}}
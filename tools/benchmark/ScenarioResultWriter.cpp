@@ -0,0 +1,137 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ScenarioResultWriter.h"
+#include "catapult/utils/ConfigurationValueParsers.h"
+#include <iomanip>
+#include <ostream>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	namespace {
+		const std::array<std::pair<const char*, OutputFormat>, 3> String_To_OutputFormat_Pairs{{
+			{ std::make_pair("text", OutputFormat::Text) },
+			{ std::make_pair("json", OutputFormat::Json) },
+			{ std::make_pair("csv", OutputFormat::Csv) }
+		}};
+
+		constexpr std::array<uint32_t, 3> Percentiles{{ 50, 90, 99 }};
+
+		double ToMicros(uint64_t nanos) {
+			return static_cast<double>(nanos) / 1'000;
+		}
+
+		double ToMillis(uint64_t nanos) {
+			return static_cast<double>(nanos) / 1'000'000;
+		}
+
+		void WriteText(std::ostream& out, const std::vector<ScenarioResult>& results) {
+			for (const auto& result : results) {
+				out
+						<< std::left << std::setw(20) << result.name() << std::right
+						<< std::setw(14) << result.operationsPerSecond() << " ops/s"
+						<< std::setw(14) << result.itemsPerSecond() << " items/s"
+						<< " (elapsed time " << ToMillis(result.elapsedNanos()) << "ms, "
+						<< result.numOperations() << " ops, latency us: mean " << ToMicros(result.meanNanos());
+
+				for (auto percentile : Percentiles)
+					out << ", p" << percentile << " " << ToMicros(result.percentileNanos(percentile));
+
+				out << ", max " << ToMicros(result.percentileNanos(100)) << ")" << std::endl;
+			}
+		}
+
+		void WriteJson(std::ostream& out, const std::vector<ScenarioResult>& results) {
+			out << "{" << std::endl << "  \"scenarios\": [";
+
+			auto isFirst = true;
+			for (const auto& result : results) {
+				out
+						<< (isFirst ? "" : ",") << std::endl
+						<< "    {" << std::endl
+						<< "      \"name\": \"" << result.name() << "\"," << std::endl
+						<< "      \"operations\": " << result.numOperations() << "," << std::endl
+						<< "      \"itemsPerOperation\": " << result.itemsPerOperation() << "," << std::endl
+						<< "      \"elapsedMs\": " << ToMillis(result.elapsedNanos()) << "," << std::endl
+						<< "      \"opsPerSecond\": " << result.operationsPerSecond() << "," << std::endl
+						<< "      \"itemsPerSecond\": " << result.itemsPerSecond() << "," << std::endl
+						<< "      \"latencyUs\": { \"mean\": " << ToMicros(result.meanNanos());
+
+				for (auto percentile : Percentiles)
+					out << ", \"p" << percentile << "\": " << ToMicros(result.percentileNanos(percentile));
+
+				out << ", \"max\": " << ToMicros(result.percentileNanos(100)) << " }" << std::endl << "    }";
+				isFirst = false;
+			}
+
+			out << std::endl << "  ]" << std::endl << "}" << std::endl;
+		}
+
+		void WriteCsv(std::ostream& out, const std::vector<ScenarioResult>& results) {
+			out << "name,operations,items_per_operation,elapsed_ms,ops_per_second,items_per_second,mean_us";
+			for (auto percentile : Percentiles)
+				out << ",p" << percentile << "_us";
+
+			out << ",max_us" << std::endl;
+
+			for (const auto& result : results) {
+				out
+						<< result.name()
+						<< "," << result.numOperations()
+						<< "," << result.itemsPerOperation()
+						<< "," << ToMillis(result.elapsedNanos())
+						<< "," << result.operationsPerSecond()
+						<< "," << result.itemsPerSecond()
+						<< "," << ToMicros(result.meanNanos());
+
+				for (auto percentile : Percentiles)
+					out << "," << ToMicros(result.percentileNanos(percentile));
+
+				out << "," << ToMicros(result.percentileNanos(100)) << std::endl;
+			}
+		}
+	}
+
+	bool TryParseValue(const std::string& str, OutputFormat& format) {
+		return utils::TryParseEnumValue(String_To_OutputFormat_Pairs, str, format);
+	}
+
+	void WriteResults(std::ostream& out, OutputFormat format, const std::vector<ScenarioResult>& results) {
+		auto flags = out.flags();
+		out << std::fixed << std::setprecision(3);
+
+		switch (format) {
+		case OutputFormat::Text:
+			WriteText(out, results);
+			break;
+
+		case OutputFormat::Json:
+			WriteJson(out, results);
+			break;
+
+		case OutputFormat::Csv:
+			WriteCsv(out, results);
+			break;
+		}
+
+		out.flags(flags);
+	}
+}}}
@@ -0,0 +1,67 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ScenarioRunner.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+#include "catapult/utils/Logging.h"
+#include <chrono>
+#include <numeric>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	namespace {
+		using Clock = std::chrono::steady_clock;
+
+		uint64_t GetElapsedNanos(Clock::time_point start) {
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+		}
+
+		uint64_t ExecuteTimed(Scenario& scenario, size_t index) {
+			auto start = Clock::now();
+			scenario.execute(index);
+			return GetElapsedNanos(start);
+		}
+	}
+
+	ScenarioResult RunScenario(Scenario& scenario, thread::IoThreadPool& pool, uint32_t numPartitions, size_t numOperations) {
+		CATAPULT_LOG(info) << "preparing scenario " << scenario.name() << " with " << numOperations << " operations";
+		scenario.prepare(numOperations);
+
+		CATAPULT_LOG(info) << "running scenario " << scenario.name();
+		std::vector<uint64_t> operationNanos(numOperations);
+		auto start = Clock::now();
+		if (scenario.isParallel()) {
+			std::vector<size_t> indexes(numOperations);
+			std::iota(indexes.begin(), indexes.end(), 0);
+			thread::ParallelFor(pool.ioContext(), indexes, numPartitions, [&scenario, &operationNanos](auto index, auto) {
+				operationNanos[index] = ExecuteTimed(scenario, index);
+				return true;
+			}).get();
+		} else {
+			for (auto i = 0u; i < numOperations; ++i)
+				operationNanos[i] = ExecuteTimed(scenario, i);
+		}
+
+		auto elapsedNanos = GetElapsedNanos(start);
+		return ScenarioResult(scenario.name(), scenario.itemsPerOperation(), elapsedNanos, std::move(operationNanos));
+	}
+}}}
@@ -0,0 +1,33 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "Scenario.h"
+#include "ScenarioResult.h"
+
+namespace catapult { namespace thread { class IoThreadPool; } }
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	/// Prepares and runs \a numOperations operations of \a scenario.
+	/// Parallel scenarios are split into \a numPartitions partitions and executed using \a pool.
+	ScenarioResult RunScenario(Scenario& scenario, thread::IoThreadPool& pool, uint32_t numPartitions, size_t numOperations);
+}}}
@@ -0,0 +1,67 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ScenarioUtils.h"
+#include "tools/Random.h"
+#include "catapult/utils/HexParser.h"
+#include "catapult/utils/MemoryUtils.h"
+#include <algorithm>
+#include <cstring>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	const GenerationHashSeed Benchmark_Generation_Hash_Seed = utils::ParseByteArray<GenerationHashSeed>(
+			"57F7DA205008026C776CB6AED843393F04CD458E0AA2D9F1D5F31A402072B2D6");
+
+	namespace {
+		template<typename TArray>
+		void FillWithRandomData(TArray& array) {
+			std::generate(array.begin(), array.end(), RandomByte);
+		}
+	}
+
+	std::unique_ptr<model::Transaction> GenerateRandomTransaction(uint32_t dataSize) {
+		auto size = static_cast<uint32_t>(sizeof(model::Transaction)) + dataSize;
+		auto pTransaction = utils::MakeUniqueWithSize<model::Transaction>(size);
+		std::memset(static_cast<void*>(pTransaction.get()), 0, size);
+		pTransaction->Size = size;
+		pTransaction->Version = 1;
+		pTransaction->Network = model::NetworkIdentifier::Private_Test;
+		pTransaction->Type = model::MakeEntityType(model::BasicEntityType::Transaction, model::FacilityCode::Transfer, 1);
+		pTransaction->MaxFee = Amount(Random() % 1'000'000);
+		pTransaction->Deadline = Timestamp(Random());
+		FillWithRandomData(pTransaction->SignerPublicKey);
+		FillWithRandomData(pTransaction->Signature);
+
+		auto* pPayload = reinterpret_cast<uint8_t*>(pTransaction.get() + 1);
+		std::generate_n(pPayload, dataSize, RandomByte);
+		return pTransaction;
+	}
+
+	std::vector<std::shared_ptr<const model::Transaction>> GenerateRandomTransactions(size_t count, uint32_t dataSize) {
+		std::vector<std::shared_ptr<const model::Transaction>> transactions;
+		transactions.reserve(count);
+		for (auto i = 0u; i < count; ++i)
+			transactions.push_back(GenerateRandomTransaction(dataSize));
+
+		return transactions;
+	}
+}}}
@@ -0,0 +1,36 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/model/Transaction.h"
+#include <memory>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	/// Benchmark network generation hash seed.
+	extern const GenerationHashSeed Benchmark_Generation_Hash_Seed;
+
+	/// Generates a transaction with random header fields and \a dataSize bytes of random payload.
+	std::unique_ptr<model::Transaction> GenerateRandomTransaction(uint32_t dataSize);
+
+	/// Generates \a count transactions with random header fields and \a dataSize bytes of random payload.
+	std::vector<std::shared_ptr<const model::Transaction>> GenerateRandomTransactions(size_t count, uint32_t dataSize);
+}}}
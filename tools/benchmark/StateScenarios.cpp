@@ -0,0 +1,351 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Scenario.h"
+#include "ScenarioUtils.h"
+#include "tools/Random.h"
+#include "tools/ToolKeys.h"
+#include "catapult/cache/CatapultCacheBuilder.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/cache_core/AccountStateCacheSubCachePlugin.h"
+#include "catapult/cache_tx/MemoryUtCache.h"
+#include "catapult/chain/BlockExecutor.h"
+#include "catapult/model/Address.h"
+#include "catapult/model/Block.h"
+#include "catapult/model/EntityHasher.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/observers/DemuxObserverBuilder.h"
+#include "catapult/observers/FunctionalNotificationObserver.h"
+#include "catapult/observers/NotificationObserverAdapter.h"
+#include "catapult/tree/MemoryDataSource.h"
+#include "catapult/tree/PatriciaTree.h"
+#include "catapult/utils/MemoryUtils.h"
+#include <cstring>
+
+namespace catapult { namespace tools { namespace benchmark {
+
+	namespace {
+		constexpr auto Network_Identifier = model::NetworkIdentifier::Private_Test;
+		constexpr auto Currency_Mosaic_Id = MosaicId(1111);
+
+		// region patricia tree
+
+		class HashEncoder {
+		public:
+			using KeyType = Hash256;
+			using ValueType = Hash256;
+
+		public:
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static const ValueType& EncodeValue(const ValueType& value) {
+				return value;
+			}
+		};
+
+		class PatriciaTreeScenario : public Scenario {
+		private:
+			using MemoryPatriciaTree = tree::PatriciaTree<HashEncoder, tree::MemoryDataSource>;
+
+		public:
+			std::string name() const override {
+				return "patricia_tree";
+			}
+
+			size_t itemsPerOperation() const override {
+				return 1;
+			}
+
+			bool isParallel() const override {
+				return false;
+			}
+
+			void prepare(size_t numOperations) override {
+				m_pairs.resize(numOperations);
+				for (auto& pair : m_pairs) {
+					std::generate(pair.first.begin(), pair.first.end(), RandomByte);
+					std::generate(pair.second.begin(), pair.second.end(), RandomByte);
+				}
+
+				m_pTree.reset();
+				m_pDataSource = std::make_unique<tree::MemoryDataSource>();
+				m_pTree = std::make_unique<MemoryPatriciaTree>(*m_pDataSource);
+			}
+
+			void execute(size_t index) override {
+				// each operation inserts a single pair and calculates the resulting root
+				const auto& pair = m_pairs[index];
+				m_pTree->set(pair.first, pair.second);
+				m_root = m_pTree->root();
+			}
+
+		private:
+			std::vector<std::pair<Hash256, Hash256>> m_pairs;
+			std::unique_ptr<tree::MemoryDataSource> m_pDataSource;
+			std::unique_ptr<MemoryPatriciaTree> m_pTree;
+			Hash256 m_root;
+		};
+
+		// endregion
+
+		// region ut cache
+
+		class UtCacheScenario : public Scenario {
+		public:
+			UtCacheScenario(const std::string& name, const ScenarioSettings& settings)
+					: m_name(name)
+					, m_dataSize(settings.DataSize)
+			{}
+
+		public:
+			std::string name() const override {
+				return m_name;
+			}
+
+			size_t itemsPerOperation() const override {
+				return 1;
+			}
+
+			bool isParallel() const override {
+				return false;
+			}
+
+			void prepare(size_t numOperations) override {
+				m_transactionInfos.clear();
+				m_transactionInfos.reserve(numOperations);
+				for (const auto& pTransaction : GenerateRandomTransactions(numOperations, m_dataSize)) {
+					auto hash = model::CalculateHash(*pTransaction, Benchmark_Generation_Hash_Seed);
+					m_transactionInfos.emplace_back(pTransaction, hash);
+				}
+
+				// cache size is unbounded for all practical purposes so that no adds are rejected
+				auto options = cache::MemoryCacheOptions(utils::FileSize::FromMegabytes(20), utils::FileSize::FromMegabytes(1'024 * 1'024));
+				m_pUtCache = std::make_unique<cache::MemoryUtCache>(options);
+			}
+
+		protected:
+			const model::TransactionInfo& transactionInfo(size_t index) const {
+				return m_transactionInfos[index];
+			}
+
+			cache::MemoryUtCache& utCache() {
+				return *m_pUtCache;
+			}
+
+		private:
+			std::string m_name;
+			uint32_t m_dataSize;
+			std::vector<model::TransactionInfo> m_transactionInfos;
+			std::unique_ptr<cache::MemoryUtCache> m_pUtCache;
+		};
+
+		class UtCacheAddScenario : public UtCacheScenario {
+		public:
+			explicit UtCacheAddScenario(const ScenarioSettings& settings) : UtCacheScenario("ut_cache_add", settings)
+			{}
+
+		public:
+			void execute(size_t index) override {
+				utCache().modifier().add(transactionInfo(index));
+			}
+		};
+
+		class UtCacheRemoveScenario : public UtCacheScenario {
+		public:
+			explicit UtCacheRemoveScenario(const ScenarioSettings& settings) : UtCacheScenario("ut_cache_remove", settings)
+			{}
+
+		public:
+			void prepare(size_t numOperations) override {
+				UtCacheScenario::prepare(numOperations);
+
+				auto modifier = utCache().modifier();
+				for (auto i = 0u; i < numOperations; ++i)
+					modifier.add(transactionInfo(i));
+			}
+
+			void execute(size_t index) override {
+				utCache().modifier().remove(transactionInfo(index).EntityHash);
+			}
+		};
+
+		// endregion
+
+		// region block execution
+
+		// publishes a single transfer from the transaction signer to the recipient stored at the start of the payload
+		class TransferNotificationPublisher : public model::NotificationPublisher {
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& sub) const override {
+				if (model::BasicEntityType::Transaction != model::ToBasicEntityType(entityInfo.type()))
+					return;
+
+				const auto& transaction = entityInfo.cast<model::Transaction>().entity();
+				UnresolvedAddress recipient;
+				std::memcpy(recipient.data(), &transaction + 1, recipient.size());
+
+				sub.notify(model::BalanceTransferNotification(
+						model::PublicKeyToAddress(transaction.SignerPublicKey, Network_Identifier),
+						recipient,
+						UnresolvedMosaicId(Currency_Mosaic_Id.unwrap()),
+						Amount(1)));
+			}
+		};
+
+		observers::AggregateNotificationObserverPointerT<model::Notification> CreateTransferObserver() {
+			using TransferObserver = observers::FunctionalNotificationObserverT<model::BalanceTransferNotification>;
+			observers::NotificationObserverPointerT<model::BalanceTransferNotification> pTransferObserver;
+			pTransferObserver = std::make_unique<TransferObserver>("TransferObserver", [](const auto& notification, auto& context) {
+				auto& accountStateCache = context.Cache.template sub<cache::AccountStateCache>();
+				auto mosaicId = context.Resolvers.resolve(notification.MosaicId);
+				auto recipient = context.Resolvers.resolve(notification.Recipient);
+				accountStateCache.addAccount(recipient, context.Height);
+
+				accountStateCache.find(notification.Sender).get().Balances.debit(mosaicId, notification.Amount);
+				accountStateCache.find(recipient).get().Balances.credit(mosaicId, notification.Amount);
+			});
+
+			return observers::DemuxObserverBuilder().add(std::move(pTransferObserver)).build();
+		}
+
+		class BlockExecutionScenario : public Scenario {
+		private:
+			static constexpr size_t Max_Prepared_Blocks = 16;
+			static constexpr size_t Num_Senders = 1'000;
+			static constexpr size_t Num_Recipients = 10'000;
+
+		public:
+			explicit BlockExecutionScenario(const ScenarioSettings& settings)
+					: m_dataSize(std::max<uint32_t>(settings.DataSize, static_cast<uint32_t>(UnresolvedAddress::Size)))
+					, m_numBlockTransactions(settings.NumBlockTransactions)
+					, m_observer(CreateTransferObserver(), std::make_unique<TransferNotificationPublisher>())
+			{}
+
+		public:
+			std::string name() const override {
+				return "block_execution";
+			}
+
+			size_t itemsPerOperation() const override {
+				return m_numBlockTransactions;
+			}
+
+			bool isParallel() const override {
+				return false;
+			}
+
+			void prepare(size_t numOperations) override {
+				m_pObserverState.reset();
+				m_pCacheDelta.reset();
+				m_pCache = CreateCache();
+				m_pCacheDelta = std::make_unique<cache::CatapultCacheDelta>(m_pCache->createDelta());
+				m_pObserverState = std::make_unique<observers::ObserverState>(*m_pCacheDelta);
+
+				auto senders = prepareSenders();
+				auto recipients = PrepareAddresses(Num_Recipients);
+
+				m_blockElements.clear();
+				m_blocks.clear();
+				m_transactions.clear();
+				for (auto i = 0u; i < std::min(numOperations, Max_Prepared_Blocks); ++i)
+					prepareBlock(senders, recipients);
+			}
+
+			void execute(size_t index) override {
+				const auto& blockElement = *m_blockElements[index % m_blockElements.size()];
+				chain::ExecuteBlock(blockElement, chain::BlockExecutionContext(m_observer, m_resolvers, *m_pObserverState));
+			}
+
+		private:
+			static std::unique_ptr<cache::CatapultCache> CreateCache() {
+				auto options = cache::AccountStateCacheTypes::Options{
+					Network_Identifier, 359, 3, Amount(), Amount(), Amount(), Currency_Mosaic_Id, MosaicId(2222)
+				};
+
+				cache::CatapultCacheBuilder builder;
+				builder.add(std::make_unique<cache::AccountStateCacheSubCachePlugin>(cache::CacheConfiguration(), options));
+				return std::make_unique<cache::CatapultCache>(builder.build());
+			}
+
+			std::vector<Key> prepareSenders() {
+				std::vector<Key> senders(Num_Senders);
+				auto& accountStateCache = m_pCacheDelta->sub<cache::AccountStateCache>();
+				for (auto& sender : senders) {
+					std::generate(sender.begin(), sender.end(), RandomByte);
+					accountStateCache.addAccount(sender, Height(1));
+					accountStateCache.find(sender).get().Balances.credit(Currency_Mosaic_Id, Amount(1'000'000'000'000));
+				}
+
+				return senders;
+			}
+
+			void prepareBlock(const std::vector<Key>& senders, const std::vector<Address>& recipients) {
+				auto pBlock = utils::MakeUniqueWithSize<model::Block>(sizeof(model::BlockHeader));
+				std::memset(static_cast<void*>(pBlock.get()), 0, sizeof(model::BlockHeader));
+				pBlock->Size = sizeof(model::BlockHeader);
+				pBlock->Type = model::Entity_Type_Block_Normal;
+				pBlock->Network = Network_Identifier;
+				pBlock->Height = Height(2);
+
+				auto pBlockElement = std::make_unique<model::BlockElement>(*pBlock);
+				for (auto i = 0u; i < m_numBlockTransactions; ++i) {
+					auto pTransaction = GenerateRandomTransaction(m_dataSize);
+					pTransaction->SignerPublicKey = senders[Random() % senders.size()];
+
+					const auto& recipient = recipients[Random() % recipients.size()];
+					std::memcpy(static_cast<void*>(pTransaction.get() + 1), recipient.data(), recipient.size());
+
+					pBlockElement->Transactions.emplace_back(*pTransaction);
+					pBlockElement->Transactions.back().EntityHash = model::CalculateHash(*pTransaction, Benchmark_Generation_Hash_Seed);
+					m_transactions.push_back(std::move(pTransaction));
+				}
+
+				m_blocks.push_back(std::move(pBlock));
+				m_blockElements.push_back(std::move(pBlockElement));
+			}
+
+		private:
+			uint32_t m_dataSize;
+			uint32_t m_numBlockTransactions;
+			observers::NotificationObserverAdapter m_observer;
+			model::ResolverContext m_resolvers;
+
+			std::unique_ptr<cache::CatapultCache> m_pCache;
+			std::unique_ptr<cache::CatapultCacheDelta> m_pCacheDelta;
+			std::unique_ptr<observers::ObserverState> m_pObserverState;
+
+			std::vector<std::unique_ptr<model::Transaction>> m_transactions;
+			std::vector<std::unique_ptr<model::Block>> m_blocks;
+			std::vector<std::unique_ptr<model::BlockElement>> m_blockElements;
+		};
+
+		// endregion
+	}
+
+	void AddStateScenarios(Scenarios& scenarios, const ScenarioSettings& settings) {
+		scenarios.push_back(std::make_unique<PatriciaTreeScenario>());
+		scenarios.push_back(std::make_unique<UtCacheAddScenario>(settings));
+		scenarios.push_back(std::make_unique<UtCacheRemoveScenario>(settings));
+		scenarios.push_back(std::make_unique<BlockExecutionScenario>(settings));
+	}
+}}}
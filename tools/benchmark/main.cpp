@@ -20,22 +20,18 @@
 **/
 
 #include "tools/ToolMain.h"
-#include "tools/ToolKeys.h"
+#include "Scenario.h"
+#include "ScenarioResultWriter.h"
+#include "ScenarioRunner.h"
 #include "tools/ToolThreadUtils.h"
-#include "catapult/crypto/Signer.h"
 #include "catapult/thread/IoThreadPool.h"
-#include "catapult/thread/ParallelFor.h"
-#include "catapult/utils/StackLogger.h"
+#include <fstream>
+#include <iostream>
+#include <thread>
 
 namespace catapult { namespace tools { namespace benchmark {
 
 	namespace {
-		struct BenchmarkEntry {
-			std::vector<uint8_t> Data;
-			catapult::Signature Signature;
-			bool IsVerified = false;
-		};
-
 		class BenchmarkTool : public Tool {
 		public:
 			std::string name() const override {
@@ -53,72 +49,120 @@ namespace catapult { namespace tools { namespace benchmark {
 						OptionsValue<uint32_t>(m_opsPerPartition)->default_value(1000),
 						"number of operations per partition");
 				optionsBuilder("data size,s",
-						OptionsValue<uint32_t>(m_dataSize)->default_value(148),
+						OptionsValue<uint32_t>(m_settings.DataSize)->default_value(148),
 						"size of the data to generate");
+				optionsBuilder("block transactions,b",
+						OptionsValue<uint32_t>(m_settings.NumBlockTransactions)->default_value(100),
+						"number of transactions in each executed block");
+				optionsBuilder("scenarios,x",
+						OptionsValue<std::vector<std::string>>(m_scenarioNames)->multitoken(),
+						"names of scenarios to run (default: all)");
+				optionsBuilder("list",
+						OptionsSwitch(),
+						"list available scenarios");
+				optionsBuilder("format,f",
+						OptionsValue<std::string>(m_format)->default_value("text"),
+						"output format (text, json or csv)");
+				optionsBuilder("output,u",
+						OptionsValue<std::string>(m_outputFilePath),
+						"path to output file (default: standard output)");
 			}
 
-			int run(const Options&) override {
+			int run(const Options& options) override {
+				Scenarios scenarios;
+				AddCryptoScenarios(scenarios, m_settings);
+				AddStateScenarios(scenarios, m_settings);
+				AddFinalizationScenarios(scenarios, m_settings);
+
+				if (options["list"].as<bool>()) {
+					for (const auto& pScenario : scenarios)
+						std::cout << pScenario->name() << std::endl;
+
+					return 0;
+				}
+
+				OutputFormat format;
+				if (!TryParseValue(m_format, format)) {
+					CATAPULT_LOG(error) << "unknown output format " << m_format;
+					return -1;
+				}
+
+				if (!filterScenarios(scenarios))
+					return -1;
+
+				// open the output file before running any scenarios so that a bad path is reported immediately
+				std::ofstream outputFileStream;
+				if (!m_outputFilePath.empty()) {
+					outputFileStream.open(m_outputFilePath, std::ios::out | std::ios::trunc);
+					if (!outputFileStream.is_open()) {
+						CATAPULT_LOG(error) << "unable to open output file " << m_outputFilePath;
+						return -1;
+					}
+				}
+
 				m_numThreads = 0 != m_numThreads ? m_numThreads : std::thread::hardware_concurrency();
 				m_numPartitions = 0 != m_numPartitions ? m_numPartitions : m_numThreads;
+				auto numOperations = static_cast<size_t>(m_numPartitions) * m_opsPerPartition;
 
 				CATAPULT_LOG(info)
 						<< "num threads (" << m_numThreads
 						<< "), num partitions (" << m_numPartitions
 						<< "), ops / partition (" << m_opsPerPartition
-						<< "), data size (" << m_dataSize << ")";
+						<< "), data size (" << m_settings.DataSize
+						<< "), block transactions (" << m_settings.NumBlockTransactions << ")";
 
-				auto keyPair = GenerateRandomKeyPair();
-				auto entries = std::vector<BenchmarkEntry>(m_numPartitions * m_opsPerPartition);
 				auto pPool = CreateStartedThreadPool(m_numThreads);
 
-				CATAPULT_LOG(info) << "num operations (" << entries.size() << ")";
-
-				RunParallel("Data Generation", *pPool, entries, [dataSize = m_dataSize](auto& entry) {
-					entry.Data.resize(dataSize);
-					std::generate_n(entry.Data.begin(), entry.Data.size(), []() { return static_cast<uint8_t>(std::rand()); });
-				});
+				std::vector<ScenarioResult> results;
+				for (const auto& pScenario : scenarios)
+					results.push_back(RunScenario(*pScenario, *pPool, m_numPartitions, numOperations));
 
-				RunParallel("Signature", *pPool, entries, [&keyPair](auto& entry) {
-					crypto::Sign(keyPair, entry.Data, entry.Signature);
-				});
+				if (m_outputFilePath.empty()) {
+					WriteResults(std::cout, format, results);
+					return 0;
+				}
 
-				RunParallel("Verify", *pPool, entries, [&keyPair](auto& entry) {
-					entry.IsVerified = crypto::Verify(keyPair.publicKey(), entry.Data, entry.Signature);
-					if (!entry.IsVerified)
-						CATAPULT_LOG(warning) << "could not verify data!";
-				});
+				WriteResults(outputFileStream, format, results);
+				outputFileStream.flush();
+				if (outputFileStream.fail()) {
+					CATAPULT_LOG(error) << "unable to write results to output file " << m_outputFilePath;
+					return -1;
+				}
 
 				return 0;
 			}
 
 		private:
-			template<typename TAction>
-			uint64_t RunParallel(
-					const char* testName,
-					thread::IoThreadPool& pool,
-					std::vector<BenchmarkEntry>& entries,
-					TAction action) const {
-				utils::StackLogger logger(testName, utils::LogLevel::info);
-				utils::StackTimer stopwatch;
-				thread::ParallelFor(pool.ioContext(), entries, m_numPartitions, [action](auto& entry, auto) {
-					action(entry);
+			bool filterScenarios(Scenarios& scenarios) const {
+				if (m_scenarioNames.empty())
 					return true;
-				}).get();
 
-				auto elapsedMillis = stopwatch.millis();
-				auto elapsedMicrosPerOp = elapsedMillis * 1000u / entries.size();
-				auto opsPerSecond = 0 == elapsedMillis ? 0 : entries.size() * 1000u / elapsedMillis;
-				CATAPULT_LOG(info)
-						<< (0 == opsPerSecond ? "???" : std::to_string(opsPerSecond)) << " ops/s "
-						<< "(elapsed time " << elapsedMillis << "ms, " << elapsedMicrosPerOp << "us/op)";
-				return elapsedMillis;
+				Scenarios selectedScenarios;
+				for (const auto& scenarioName : m_scenarioNames) {
+					auto iter = std::find_if(scenarios.begin(), scenarios.end(), [&scenarioName](const auto& pScenario) {
+						return pScenario && scenarioName == pScenario->name();
+					});
+
+					if (scenarios.end() == iter) {
+						CATAPULT_LOG(error) << "unknown or duplicate scenario " << scenarioName;
+						return false;
+					}
+
+					selectedScenarios.push_back(std::move(*iter));
+				}
+
+				scenarios = std::move(selectedScenarios);
+				return true;
 			}
 
 		private:
 			uint32_t m_numThreads;
 			uint32_t m_numPartitions;
 			uint32_t m_opsPerPartition;
-			uint32_t m_dataSize;
+			ScenarioSettings m_settings;
+			std::vector<std::string> m_scenarioNames;
+			std::string m_format;
+			std::string m_outputFilePath;
 		};
 	}
 }}}